@@ -11,6 +11,7 @@
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionsCodeGeneration.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
@@ -373,6 +374,86 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(gd::InstructionsList
     return outputCode;
 }
 
+gd::String EventsCodeGenerator::GenerateConditionsListPredicat(const gd::InstructionsList & conditions, const EventsCodeGenerationContext & context)
+{
+    gd::String predicat;
+    for (std::size_t i = 0;i<conditions.size();++i)
+    {
+        if (i != 0) predicat += " && ";
+        predicat += GenerateBooleanFullName("condition"+gd::String::From(i)+"IsTrue", context);
+    }
+
+    return predicat;
+}
+
+gd::InstructionsList EventsCodeGenerator::ExtractInvariantConditions(gd::InstructionsList & conditions, EventsCodeGenerationContext & context)
+{
+    std::vector< std::pair<int, std::shared_ptr<gd::Instruction> > > invariantConditions;
+    for (std::size_t cId = 0;cId < conditions.size();)
+    {
+        gd::Instruction & condition = conditions[cId];
+        gd::InstructionMetadata instrInfos = MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+
+        //Custom conditions can depend on the conditions evaluated before them: stop there.
+        if ( condition.GetType().empty() || instrInfos.codeExtraInformation.HasCustomCodeGenerator() )
+            break;
+
+        bool invariant = MetadataProvider::HasCondition(platform, condition.GetType());
+        for (std::size_t pNb = 0;invariant && pNb < instrInfos.parameters.size();++pNb)
+        {
+            if ( ParameterMetadata::IsObject(instrInfos.parameters[pNb].type) || instrInfos.parameters[pNb].type == "behavior" )
+                invariant = false;
+        }
+
+        //Expressions of the parameters can still use objects: generate a copy of the condition
+        //and check that no objects lists were needed. Everything added to the generator by
+        //this generation ( includes, declarations, custom code ) is discarded.
+        if ( invariant )
+        {
+            std::set<gd::String> previousIncludeFiles = includeFiles;
+            std::set<gd::String> previousCustomGlobalDeclaration = customGlobalDeclaration;
+            gd::String previousCustomCodeOutsideMain = customCodeOutsideMain;
+            gd::String previousCustomCodeInMain = customCodeInMain;
+            size_t previousMaxCustomConditionsDepth = maxCustomConditionsDepth;
+            size_t previousMaxConditionsListsSize = maxConditionsListsSize;
+            bool previousErrorOccurred = errorOccurred;
+
+            gd::Instruction probeCondition = condition;
+            EventsCodeGenerationContext probeContext = context;
+            GenerateConditionCode(probeCondition, "conditionTrue", probeContext);
+            invariant = probeContext.GetAllObjectsToBeDeclared() == context.GetAllObjectsToBeDeclared();
+
+            includeFiles = previousIncludeFiles;
+            customGlobalDeclaration = previousCustomGlobalDeclaration;
+            customCodeOutsideMain = previousCustomCodeOutsideMain;
+            customCodeInMain = previousCustomCodeInMain;
+            maxCustomConditionsDepth = previousMaxCustomConditionsDepth;
+            maxConditionsListsSize = previousMaxConditionsListsSize;
+            errorOccurred = previousErrorOccurred;
+        }
+
+        if ( invariant )
+        {
+            invariantConditions.push_back(std::make_pair(instrInfos.GetCostHint(), conditions.GetSmartPtr(cId)));
+            conditions.Remove(cId);
+        }
+        else
+            ++cId;
+    }
+
+    //Evaluate the cheapest conditions first.
+    std::stable_sort(invariantConditions.begin(), invariantConditions.end(),
+        [](const std::pair<int, std::shared_ptr<gd::Instruction> > & a, const std::pair<int, std::shared_ptr<gd::Instruction> > & b) {
+            return a.first < b.first;
+        });
+
+    gd::InstructionsList sortedConditions;
+    for (auto & condition : invariantConditions)
+        sortedConditions.Insert(condition.second);
+
+    return sortedConditions;
+}
+
 /**
  * Generate code for an action.
  */
@@ -497,18 +578,19 @@ gd::String EventsCodeGenerator::GenerateActionsListCode(gd::InstructionsList & a
     return outputCode;
 }
 
-gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                         gd::EventsCodeGenerationContext & context,
                                                         const gd::String & previousParameter,
                                                         std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes)
 {
+    const gd::String & parameter = expression.GetPlainString();
     gd::String argOutput;
 
     if ( metadata.type == "expression" || metadata.type == "camera" )
     {
         CallbacksForGeneratingExpressionCode callbacks(argOutput, *this, context);
 
-        gd::ExpressionParser parser(parameter);
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseMathExpression(platform, project, scene, callbacks) )
         {
             cout << "Error :" << parser.firstErrorStr << " in: "<< parameter << endl;
@@ -522,7 +604,7 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parame
     {
         CallbacksForGeneratingExpressionCode callbacks(argOutput, *this, context);
 
-        gd::ExpressionParser parser(parameter);
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseStringExpression(platform, project, scene, callbacks) )
         {
             cout << "Error in text expression" << parser.firstErrorStr << endl;
@@ -608,20 +690,25 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parame
     return argOutput;
 }
 
-vector<gd::String>  EventsCodeGenerator::GenerateParametersCodes(vector < gd::Expression > parameters, const vector < gd::ParameterMetadata > & parametersInfo, EventsCodeGenerationContext & context, std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes)
+vector<gd::String>  EventsCodeGenerator::GenerateParametersCodes(const vector < gd::Expression > & parameters, const vector < gd::ParameterMetadata > & parametersInfo, EventsCodeGenerationContext & context, std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes)
 {
     vector<gd::String>  arguments;
 
-    while(parameters.size() < parametersInfo.size())
-        parameters.push_back(gd::Expression(""));
-
-    for (std::size_t pNb = 0;pNb < parametersInfo.size() && pNb < parameters.size();++pNb)
+    //Parameters are not copied, so that the trees of the expressions are kept in the instructions.
+    vector<gd::Expression> defaultParameters(parametersInfo.size());
+    const gd::Expression * previousParameter = NULL;
+    for (std::size_t pNb = 0;pNb < parametersInfo.size();++pNb)
     {
-        if ( parameters[pNb].GetPlainString().empty() && parametersInfo[pNb].optional  )
-            parameters[pNb] = gd::Expression(parametersInfo[pNb].defaultValue);
+        const gd::Expression * parameter = pNb < parameters.size() ? &parameters[pNb] : &defaultParameters[pNb];
+        if ( parameter->GetPlainString().empty() && parametersInfo[pNb].optional  )
+        {
+            defaultParameters[pNb] = gd::Expression(parametersInfo[pNb].defaultValue);
+            parameter = &defaultParameters[pNb];
+        }
 
-        gd::String argOutput = GenerateParameterCodes(parameters[pNb].GetPlainString(), parametersInfo[pNb], context,
-            pNb == 0 ? "" : parameters[pNb-1].GetPlainString(), supplementaryParametersTypes);
+        gd::String argOutput = GenerateParameterCodes(*parameter, parametersInfo[pNb], context,
+            previousParameter ? previousParameter->GetPlainString() : "", supplementaryParametersTypes);
+        previousParameter = parameter;
 
         arguments.push_back(argOutput);
     }
@@ -690,9 +777,18 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(EventsCodeGenerat
  */
 gd::String EventsCodeGenerator::GenerateEventsListCode(gd::EventsList & events, const EventsCodeGenerationContext & parentContext)
 {
+    //*Optimization*: events having no effect are not generated at all.
+    std::size_t lastEventId = events.size();
+    for ( std::size_t eId = 0; eId < events.size();++eId )
+    {
+        if ( !IsUselessEvent(events[eId]) ) lastEventId = eId;
+    }
+
     gd::String output;
     for ( std::size_t eId = 0; eId < events.size();++eId )
     {
+        if ( IsUselessEvent(events[eId]) ) continue;
+
         //Each event has its own context : Objects picked in an event are totally different than the one picked in another.
         gd::EventsCodeGenerationContext newContext;
         newContext.InheritsFrom(parentContext); //Events in the same "level" share the same context as their parent.
@@ -700,17 +796,38 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(gd::EventsList & events,
         //*Optimization*: when the event is the last of a list, we can use the
         //same lists of objects as the parent (as they will be discarded just after).
         //This avoids a copy of the lists of objects which is an expensive operation.
-        bool reuseParentContext = parentContext.CanReuse() && eId == events.size()-1;
+        bool reuseParentContext = parentContext.CanReuse() && eId == lastEventId;
         gd::EventsCodeGenerationContext reusedContext;
         reusedContext.Reuse(parentContext);
 
         auto & context = reuseParentContext ? reusedContext : newContext;
 
+        //*Optimization*: the conditions of a standard event which do not depend on any object
+        //are evaluated first, so that the objects lists are not declared (and copied) when
+        //one of them is false. They are removed from the event.
+        gd::String invariantConditionsCode;
+        gd::String invariantConditionsPredicat;
+        if ( gd::StandardEvent * standardEvent = dynamic_cast<gd::StandardEvent*>(&events[eId]) )
+        {
+            gd::InstructionsList invariantConditions = ExtractInvariantConditions(standardEvent->GetConditions(), context);
+            if ( !invariantConditions.empty() )
+            {
+                invariantConditionsCode = GenerateConditionsListCode(invariantConditions, context);
+                invariantConditionsPredicat = GenerateConditionsListPredicat(invariantConditions, context);
+            }
+        }
+
         gd::String eventCoreCode = events[eId].GenerateEventCode(*this, context);
         gd::String scopeBegin = GenerateScopeBegin(context);
         gd::String scopeEnd = GenerateScopeEnd(context);
         gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
+        if ( !invariantConditionsPredicat.empty() )
+        {
+            declarationsCode = invariantConditionsCode + "\nif (" + invariantConditionsPredicat + ")\n{\n" + declarationsCode;
+            eventCoreCode += "\n}";
+        }
+
         output += "\n"+ scopeBegin +"\n" + declarationsCode + "\n" + eventCoreCode + "\n"+ scopeEnd +"\n";
     }
 
@@ -798,6 +915,27 @@ void EventsCodeGenerator::DeleteUselessEvents(gd::EventsList & events)
     }
 }
 
+bool EventsCodeGenerator::IsUselessEvent(gd::BaseEvent & event) const
+{
+    if ( !event.IsExecutable() || event.IsDisabled() )
+        return true;
+
+    //The conditions of a standard event without actions nor sub events don't need to be
+    //evaluated, unless one of them has side effects ( like "Trigger once" ).
+    gd::StandardEvent * standardEvent = dynamic_cast<gd::StandardEvent*>(&event);
+    if ( !standardEvent || !standardEvent->GetActions().empty() || !standardEvent->GetSubEvents().IsEmpty() )
+        return false;
+
+    const gd::InstructionsList & conditions = standardEvent->GetConditions();
+    for ( std::size_t cId = 0; cId < conditions.size();++cId )
+    {
+        if ( MetadataProvider::GetConditionMetadata(platform, conditions[cId].GetType()).codeExtraInformation.HasCustomCodeGenerator() )
+            return false;
+    }
+
+    return true;
+}
+
 /**
  * Call preprocessing method of each event
  */
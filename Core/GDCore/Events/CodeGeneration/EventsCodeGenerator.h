@@ -52,6 +52,13 @@ public:
      */
     void PreprocessEventList(gd::EventsList & listEvent);
 
+    /**
+     * \brief Return true if the event has no effect and must not be generated: non executable
+     * or disabled events, and standard events without actions nor sub events whose conditions
+     * have no side effect ( i.e: none of them has a custom code generator ).
+     */
+    bool IsUselessEvent(gd::BaseEvent & event) const;
+
     /**
      * \brief Generate code for executing an event list
      *
@@ -74,6 +81,18 @@ public:
      */
     virtual gd::String GenerateConditionsListCode(gd::InstructionsList & conditions, EventsCodeGenerationContext & context);
 
+    /**
+     * \brief Generate the predicate which is true if all the conditions of a list generated by
+     * GenerateConditionsListCode are true.
+     *
+     * The default implementation joins the booleans of the conditions with &&.
+     *
+     * \param conditions The conditions given to GenerateConditionsListCode
+     * \param context Context used for generation
+     * \return Code, or an empty string if there is no condition.
+     */
+    virtual gd::String GenerateConditionsListPredicat(const gd::InstructionsList & conditions, const EventsCodeGenerationContext & context);
+
     /**
      * \brief Generate code for executing an action list
      *
@@ -99,7 +118,7 @@ public:
      * \param supplementaryParametersTypes Optional std::vector of new parameters types ( std::vector of pair<gd::String,gd::String>("type", "valueToBeInserted") )
      *
      */
-    std::vector<gd::String> GenerateParametersCodes(std::vector < gd::Expression > parameters,
+    std::vector<gd::String> GenerateParametersCodes(const std::vector < gd::Expression > & parameters,
                                                      const std::vector < gd::ParameterMetadata > & parametersInfo,
                                                      EventsCodeGenerationContext & context,
                                                      std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes = 0);
@@ -328,7 +347,7 @@ protected:
     //The called function will be called with this signature on the C++ platform: Function(gd::String, RuntimeObject*)
      * \endcode
      */
-    virtual gd::String GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+    virtual gd::String GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                gd::EventsCodeGenerationContext & context,
                                                const gd::String & previousParameter,
                                                std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes);
@@ -462,6 +481,18 @@ protected:
      */
     virtual gd::String GenerateArgumentsList(const std::vector<gd::String> & arguments, size_t startFrom = 0);
 
+    /**
+     * \brief Remove from \a conditions the conditions which do not depend on any object, and
+     * return them sorted by their cost hint ( see gd::InstructionMetadata::GetCostHint ).
+     *
+     * Only the conditions placed before the first custom condition ( like "Trigger once" ) are
+     * moved, so that evaluating the returned conditions first does not change what the event does.
+     *
+     * \param conditions The conditions of an event being generated.
+     * \param context The context of the event, in which no objects lists are needed yet.
+     */
+    gd::InstructionsList ExtractInvariantConditions(gd::InstructionsList & conditions, EventsCodeGenerationContext & context);
+
     gd::Project & project; ///< The project being used.
     const gd::Layout & scene; ///< The scene being generated.
     const gd::Platform & platform; ///< The platform being used.
@@ -0,0 +1,333 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ExpressionCodeTree.h"
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+
+namespace
+{
+
+/**
+ * \brief A node of the tree built from the tokens of the expression.
+ */
+struct Node
+{
+    enum Type { Constant, FunctionCall, UnaryOperation, Operation, Parenthesis };
+
+    Node(Type type_) : type(type_), value(0), integer(false) {};
+
+    Type type;
+    gd::String code; ///< The code of the function call, or the operator.
+    double value; ///< The value of a constant.
+    bool integer; ///< True if the constant is an integer.
+    std::unique_ptr<Node> left; ///< The operand of a unary operation or of parentheses, or the left operand of an operation.
+    std::unique_ptr<Node> right; ///< The right operand of an operation.
+};
+
+/**
+ * \brief Build the tree from the tokens and fold the operations on constants, with a
+ * recursive descent parser following the usual precedence of operators.
+ */
+class TreeBuilder
+{
+public:
+    TreeBuilder(const std::vector<gd::ExpressionCodeTree::Token> & tokens_) : tokens(tokens_), position(0) {};
+
+    /**
+     * \brief Return the tree of the expression, or nullptr if the tokens are not a valid expression.
+     */
+    std::unique_ptr<Node> Build()
+    {
+        std::unique_ptr<Node> root = ParseSum();
+        if ( position != tokens.size() ) return nullptr;
+
+        return root;
+    }
+
+private:
+    bool IsOperator(const gd::String & operators) const
+    {
+        return position < tokens.size() && tokens[position].type == gd::ExpressionCodeTree::Token::Operator &&
+            operators.find(tokens[position].code) != gd::String::npos;
+    }
+
+    std::unique_ptr<Node> ParseSum()
+    {
+        std::unique_ptr<Node> node = ParseProduct();
+        while ( node && IsOperator("+-") )
+        {
+            gd::String op = tokens[position++].code;
+            node = MakeOperation(std::move(node), op, ParseProduct());
+        }
+
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseProduct()
+    {
+        std::unique_ptr<Node> node = ParseUnary();
+        while ( node && IsOperator("*/%") )
+        {
+            gd::String op = tokens[position++].code;
+            node = MakeOperation(std::move(node), op, ParseUnary());
+        }
+
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseUnary()
+    {
+        if ( !IsOperator("+-") ) return ParsePrimary();
+
+        gd::String op = tokens[position++].code;
+        std::unique_ptr<Node> operand = ParseUnary();
+        if ( !operand ) return nullptr;
+        if ( op == "+" ) return operand;
+
+        if ( operand->type == Node::Constant )
+        {
+            operand->value = -operand->value;
+            return operand;
+        }
+
+        std::unique_ptr<Node> node(new Node(Node::UnaryOperation));
+        node->code = op;
+        node->left = std::move(operand);
+        return node;
+    }
+
+    std::unique_ptr<Node> ParsePrimary()
+    {
+        if ( position >= tokens.size() ) return nullptr;
+
+        const gd::ExpressionCodeTree::Token & token = tokens[position++];
+        if ( token.type == gd::ExpressionCodeTree::Token::Number )
+        {
+            std::unique_ptr<Node> node(new Node(Node::Constant));
+            node->value = token.value;
+            node->integer = token.integer;
+            return node;
+        }
+        else if ( token.type == gd::ExpressionCodeTree::Token::FunctionCall )
+        {
+            std::unique_ptr<Node> node(new Node(Node::FunctionCall));
+            node->code = token.code;
+            return node;
+        }
+        else if ( token.type == gd::ExpressionCodeTree::Token::OpeningParenthesis )
+        {
+            std::unique_ptr<Node> operand = ParseSum();
+            if ( !operand || position >= tokens.size() ||
+                tokens[position].type != gd::ExpressionCodeTree::Token::ClosingParenthesis )
+                return nullptr;
+
+            position++;
+            if ( operand->type == Node::Constant ) return operand;
+
+            std::unique_ptr<Node> node(new Node(Node::Parenthesis));
+            node->left = std::move(operand);
+            return node;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * \brief Create the node of an operation, or directly its result if both operands are
+     * constants and the result of the operation is the same as in the generated code.
+     */
+    std::unique_ptr<Node> MakeOperation(std::unique_ptr<Node> left, const gd::String & op, std::unique_ptr<Node> right)
+    {
+        if ( !left || !right ) return nullptr;
+
+        if ( left->type == Node::Constant && right->type == Node::Constant )
+        {
+            bool integer = left->integer && right->integer;
+            bool canBeFolded = true;
+            double value = 0;
+            if ( op == "+" ) value = left->value + right->value;
+            else if ( op == "-" ) value = left->value - right->value;
+            else if ( op == "*" ) value = left->value * right->value;
+            else if ( op == "/" )
+            {
+                value = left->value / right->value;
+                canBeFolded = right->value != 0 && (!integer || value == std::trunc(value)); //Integer divisions are only folded when exact.
+            }
+            else if ( op == "%" )
+            {
+                value = std::fmod(left->value, right->value);
+                canBeFolded = integer && right->value != 0; //Modulo is only defined for integers in C++.
+            }
+
+            if ( integer && std::abs(value) > std::numeric_limits<int>::max() ) canBeFolded = false;
+            if ( canBeFolded && std::isfinite(value) )
+            {
+                left->value = value;
+                left->integer = integer;
+                return left;
+            }
+        }
+
+        std::unique_ptr<Node> node(new Node(Node::Operation));
+        node->code = op;
+        node->left = std::move(left);
+        node->right = std::move(right);
+        return node;
+    }
+
+    const std::vector<gd::ExpressionCodeTree::Token> & tokens;
+    std::size_t position;
+};
+
+gd::String GenerateNodeCode(const Node & node, bool root)
+{
+    if ( node.type == Node::Constant )
+    {
+        gd::String code = gd::ExpressionCodeTree::GenerateNumber(node.value, node.integer);
+        return (!root && code[0] == U'-') ? "("+code+")" : code;
+    }
+    else if ( node.type == Node::FunctionCall )
+        return node.code;
+    else if ( node.type == Node::UnaryOperation )
+        return node.code+GenerateNodeCode(*node.left, false);
+    else if ( node.type == Node::Parenthesis )
+        return "("+GenerateNodeCode(*node.left, true)+")";
+
+    //Avoid generating "--" or "++" when the right operand is a unary operation.
+    gd::String rightCode = GenerateNodeCode(*node.right, false);
+    gd::String separator = (!rightCode.empty() && (rightCode[0] == U'-' || rightCode[0] == U'+')) ? " " : "";
+    return GenerateNodeCode(*node.left, false)+node.code+separator+rightCode;
+}
+
+}
+
+namespace gd
+{
+
+void ExpressionCodeTree::AddCode(const gd::String & code)
+{
+    static const gd::String numerics = "0123456789.e";
+    static const gd::String operators = "+-*/%";
+
+    addedCode += code;
+    for (auto it = code.begin(); it != code.end();)
+    {
+        char32_t character = *it;
+        if ( character == U' ' || character == U'\n' || character == U'\r' || character == U'\t' )
+        {
+            ++it;
+        }
+        else if ( numerics.find(character) != gd::String::npos )
+        {
+            gd::String number;
+            char32_t previous = 0;
+            while ( it != code.end() && (numerics.find(*it) != gd::String::npos ||
+                ((*it == U'-' || *it == U'+') && previous == U'e')) )
+            {
+                previous = *it;
+                number += *it;
+                ++it;
+            }
+
+            Token token;
+            token.type = Token::Number;
+            token.code = number;
+            token.integer = number.find_first_of(".e") == gd::String::npos;
+
+            //Read the number like the compiler would, and make sure that the whole token is read.
+            std::istringstream stream(number.ToUTF8());
+            stream.imbue(std::locale::classic());
+            if ( !(stream >> token.value) || stream.peek() != std::char_traits<char>::eof() ) foldable = false;
+            if ( token.integer && token.value > std::numeric_limits<int>::max() ) foldable = false;
+
+            tokens.push_back(token);
+        }
+        else
+        {
+            Token token;
+            token.code += character;
+            token.value = 0;
+            token.integer = false;
+            if ( operators.find(character) != gd::String::npos ) token.type = Token::Operator;
+            else if ( character == U'(' ) token.type = Token::OpeningParenthesis;
+            else if ( character == U')' ) token.type = Token::ClosingParenthesis;
+            else foldable = false;
+
+            tokens.push_back(token);
+            ++it;
+        }
+    }
+}
+
+void ExpressionCodeTree::AddFunctionCall(const gd::String & code)
+{
+    Token token;
+    token.type = Token::FunctionCall;
+    token.code = code;
+    token.value = 0;
+    token.integer = false;
+
+    tokens.push_back(token);
+    addedCode += code;
+}
+
+void ExpressionCodeTree::AddConstant(double value, bool integer)
+{
+    Token token;
+    token.type = Token::Number;
+    token.code = GenerateNumber(value, integer);
+    token.value = value;
+    token.integer = integer;
+
+    tokens.push_back(token);
+    addedCode += token.code[0] == U'-' ? "("+token.code+")" : token.code;
+}
+
+gd::String ExpressionCodeTree::GenerateCode() const
+{
+    if ( !foldable || tokens.empty() ) return addedCode;
+
+    TreeBuilder builder(tokens);
+    std::unique_ptr<Node> root = builder.Build();
+    if ( !root ) return addedCode;
+
+    return GenerateNodeCode(*root, true);
+}
+
+bool ExpressionCodeTree::GetConstantValue(const gd::String & code, double & value)
+{
+    ExpressionCodeTree tree;
+    tree.AddCode(code);
+    if ( !tree.foldable || tree.tokens.empty() ) return false;
+
+    TreeBuilder builder(tree.tokens);
+    std::unique_ptr<Node> root = builder.Build();
+    if ( !root || root->type != Node::Constant ) return false;
+
+    value = root->value;
+    return true;
+}
+
+gd::String ExpressionCodeTree::GenerateNumber(double value, bool integer)
+{
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    if ( integer )
+        stream << static_cast<long long>(value);
+    else
+    {
+        stream << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+        if ( stream.str().find_first_of(".e") == std::string::npos ) stream << ".0";
+    }
+
+    return gd::String::FromUTF8(stream.str());
+}
+
+}
@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONCODETREE_H
+#define GDCORE_EXPRESSIONCODETREE_H
+
+#include <vector>
+#include "GDCore/String.h"
+
+namespace gd
+{
+
+/**
+ * \brief Intermediate representation of the code generated for a math expression.
+ *
+ * The code of the expression is added piece by piece ( numbers, operators, parentheses and the
+ * code of function calls ) and is then generated with the operations on constants computed:
+ * `360/60*ToRad(45)` is generated as a single number when the value of `ToRad(45)` is known.
+ *
+ * Folding never changes the result of the generated code: an operation on two integers is
+ * folded only if the result is an integer ( `1/2` is kept as is, as it is an integer division
+ * in C++ ) and operations giving infinite or NaN values are kept as is.
+ *
+ * \see gd::CallbacksForGeneratingExpressionCode
+ * \ingroup Events
+ */
+class GD_CORE_API ExpressionCodeTree
+{
+public:
+    ExpressionCodeTree() : foldable(true) {};
+    virtual ~ExpressionCodeTree() {};
+
+    /**
+     * \brief Add code made of numbers, operators and parentheses.
+     */
+    void AddCode(const gd::String & code);
+
+    /**
+     * \brief Add the code of a function call, which is not modified.
+     */
+    void AddFunctionCall(const gd::String & code);
+
+    /**
+     * \brief Add a number.
+     * \param integer True if the number must be generated as an integer.
+     */
+    void AddConstant(double value, bool integer = false);
+
+    /**
+     * \brief Generate the code of the expression, with the operations on constants computed.
+     *
+     * If the code cannot be analyzed, it is returned as it was added.
+     */
+    gd::String GenerateCode() const;
+
+    /**
+     * \brief Return true if \a code is the code of a constant math expression ( i.e: a number or
+     * operations on numbers ), and store its value in \a value.
+     */
+    static bool GetConstantValue(const gd::String & code, double & value);
+
+    /**
+     * \brief Generate the code of a number, so that it is read back as exactly the same value.
+     * \param integer True if the number must be generated as an integer, otherwise the code
+     * is always a floating point number ( i.e: `2.0` and not `2` ).
+     */
+    static gd::String GenerateNumber(double value, bool integer);
+
+    /**
+     * \brief A token of the expression.
+     */
+    struct Token
+    {
+        enum Type { Number, Operator, OpeningParenthesis, ClosingParenthesis, FunctionCall };
+
+        Type type;
+        gd::String code;
+        double value; ///< The value of a number.
+        bool integer; ///< True if the number is an integer.
+    };
+
+    /**
+     * \brief Return the tokens of the code added to the tree.
+     */
+    const std::vector<Token> & GetTokens() const { return tokens; }
+
+    /**
+     * \brief Return false if code which cannot be analyzed was added, in which case the
+     * tokens are not meaningful.
+     */
+    bool CanBeAnalyzed() const { return foldable; }
+
+private:
+    std::vector<Token> tokens;
+    gd::String addedCode; ///< The code, as it was added.
+    bool foldable; ///< False if code which cannot be analyzed was added.
+};
+
+}
+
+#endif // GDCORE_EXPRESSIONCODETREE_H
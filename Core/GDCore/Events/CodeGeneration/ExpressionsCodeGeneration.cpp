@@ -17,6 +17,7 @@
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/CommonTools.h"
+#include <cmath>
 
 using namespace std;
 
@@ -27,6 +28,7 @@ CallbacksForGeneratingExpressionCode::CallbacksForGeneratingExpressionCode(gd::S
                                                                            EventsCodeGenerator & codeGenerator_,
                                                                            EventsCodeGenerationContext & context_) :
     plainExpression(plainExpression_),
+    plainExpressionPrefix(plainExpression_),
     codeGenerator(codeGenerator_),
     context(context_)
 {
@@ -35,9 +37,52 @@ CallbacksForGeneratingExpressionCode::CallbacksForGeneratingExpressionCode(gd::S
 
 void CallbacksForGeneratingExpressionCode::OnConstantToken(gd::String text)
 {
-    plainExpression += text;
+    if ( GetReturnType() == "string" )
+    {
+        plainExpression += text;
+        return;
+    }
+
+    expressionTree.AddCode(text);
+    plainExpression = plainExpressionPrefix+expressionTree.GenerateCode();
 };
 
+void CallbacksForGeneratingExpressionCode::AddFunctionCallCode(const gd::String & code)
+{
+    if ( GetReturnType() == "string" )
+    {
+        plainExpression += code;
+        return;
+    }
+
+    expressionTree.AddFunctionCall(code);
+    plainExpression = plainExpressionPrefix+expressionTree.GenerateCode();
+}
+
+bool CallbacksForGeneratingExpressionCode::AddPureFunctionValue(const std::vector<gd::String> & parametersCode, const gd::ExpressionMetadata & expressionInfo)
+{
+    if ( GetReturnType() == "string" || !expressionInfo.IsPure() || !expressionInfo.codeExtraInformation.HasConstantEvaluator() )
+        return false;
+
+    std::vector<double> values;
+    for (std::size_t i = 0;i<parametersCode.size();++i)
+    {
+        double value;
+        if ( i >= expressionInfo.parameters.size() || expressionInfo.parameters[i].type != "expression" ||
+            !gd::ExpressionCodeTree::GetConstantValue(parametersCode[i], value) )
+            return false;
+
+        values.push_back(value);
+    }
+
+    double result = expressionInfo.codeExtraInformation.constantEvaluator(values);
+    if ( !std::isfinite(result) ) return false;
+
+    expressionTree.AddConstant(result);
+    plainExpression = plainExpressionPrefix+expressionTree.GenerateCode();
+    return true;
+}
+
 void CallbacksForGeneratingExpressionCode::OnStaticFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
 {
     codeGenerator.AddIncludeFiles(expressionInfo.codeExtraInformation.GetIncludeFiles());
@@ -45,7 +90,7 @@ void CallbacksForGeneratingExpressionCode::OnStaticFunction(gd::String functionN
     //Launch custom code generator if needed
     if (expressionInfo.codeExtraInformation.HasCustomCodeGenerator())
     {
-        plainExpression += expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context);
+        AddFunctionCallCode(expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context));
         return;
     }
 
@@ -60,6 +105,10 @@ void CallbacksForGeneratingExpressionCode::OnStaticFunction(gd::String functionN
 
     //Prepare parameters
     std::vector<gd::String> parametersCode = codeGenerator.GenerateParametersCodes(parameters, expressionInfo.parameters, context);
+
+    //Pure functions called with constant parameters are computed now.
+    if ( AddPureFunctionValue(parametersCode, expressionInfo) ) return;
+
     gd::String parametersStr;
     for (std::size_t i = 0;i<parametersCode.size();++i)
     {
@@ -68,7 +117,7 @@ void CallbacksForGeneratingExpressionCode::OnStaticFunction(gd::String functionN
     }
 
 
-    plainExpression += expressionInfo.codeExtraInformation.functionCallName+"("+parametersStr+")";
+    AddFunctionCallCode(expressionInfo.codeExtraInformation.functionCallName+"("+parametersStr+")");
 };
 
 void CallbacksForGeneratingExpressionCode::OnObjectFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
@@ -82,7 +131,7 @@ void CallbacksForGeneratingExpressionCode::OnObjectFunction(gd::String functionN
     //Launch custom code generator if needed
     if ( expressionInfo.codeExtraInformation.HasCustomCodeGenerator() )
     {
-        plainExpression += expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context);
+        AddFunctionCallCode(expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context));
         return;
     }
 
@@ -111,7 +160,7 @@ void CallbacksForGeneratingExpressionCode::OnObjectFunction(gd::String functionN
         output = codeGenerator.GenerateObjectFunctionCall(realObjects[i], objInfo, expressionInfo.codeExtraInformation, parametersStr, output, context);
     }
 
-    plainExpression += output;
+    AddFunctionCallCode(output);
 };
 
 void CallbacksForGeneratingExpressionCode::OnObjectBehaviorFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
@@ -125,7 +174,7 @@ void CallbacksForGeneratingExpressionCode::OnObjectBehaviorFunction(gd::String f
     //Launch custom code generator if needed
     if ( expressionInfo.codeExtraInformation.HasCustomCodeGenerator() )
     {
-        plainExpression += expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context);
+        AddFunctionCallCode(expressionInfo.codeExtraInformation.customCodeGenerator(parameters, codeGenerator, context));
         return;
     }
 
@@ -156,7 +205,7 @@ void CallbacksForGeneratingExpressionCode::OnObjectBehaviorFunction(gd::String f
     }
 
 
-    plainExpression += output;
+    AddFunctionCallCode(output);
 };
 
 bool CallbacksForGeneratingExpressionCode::OnSubMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
@@ -165,7 +214,7 @@ bool CallbacksForGeneratingExpressionCode::OnSubMathExpression(const gd::Platfor
 
     CallbacksForGeneratingExpressionCode callbacks(newExpression, codeGenerator, context);
 
-    gd::ExpressionParser parser(expression.GetPlainString());
+    gd::ExpressionParser parser(expression);
     if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
     {
         #if defined(GD_IDE_ONLY)
@@ -184,7 +233,7 @@ bool CallbacksForGeneratingExpressionCode::OnSubTextExpression(const gd::Platfor
 
     CallbacksForGeneratingExpressionCode callbacks(newExpression, codeGenerator, context);
 
-    gd::ExpressionParser parser(expression.GetPlainString());
+    gd::ExpressionParser parser(expression);
     if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
     {
         #if defined(GD_IDE_ONLY)
@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/String.h"
 #include "GDCore/Events/Parsers/ExpressionParser.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeTree.h"
 namespace gd { class ExpressionMetadata; }
 namespace gd { class Expression; }
 namespace gd { class Project; }
@@ -23,6 +24,9 @@ namespace gd
 /**
  * \brief Used to generate code from expressions.
  *
+ * The code of math expressions is built using a gd::ExpressionCodeTree, so that operations on
+ * constants and pure expressions called with constant parameters are computed during generation.
+ *
  * Usage example :
  * \code
  *   gd::String expressionOutputCppCode;
@@ -49,7 +53,20 @@ public:
     bool OnSubTextExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression);
 
 private:
+    /**
+     * \brief Add the code of a function call to the expression.
+     */
+    void AddFunctionCallCode(const gd::String & code);
+
+    /**
+     * \brief Add the value of a pure function called with constant parameters to the expression.
+     * \return false if the value cannot be computed during code generation.
+     */
+    bool AddPureFunctionValue(const std::vector<gd::String> & parametersCode, const gd::ExpressionMetadata & expressionInfo);
+
     gd::String & plainExpression;
+    gd::String plainExpressionPrefix; ///< The code in plainExpression before the expression was parsed.
+    gd::ExpressionCodeTree expressionTree; ///< The code of the math expression.
     EventsCodeGenerator & codeGenerator;
     EventsCodeGenerationContext & context;
 };
@@ -6,14 +6,20 @@
 
 #ifndef GDCORE_EXPRESSION_H
 #define GDCORE_EXPRESSION_H
+#include <memory>
 #include "GDCore/String.h"
+namespace gd { class ExpressionParseTree; }
 
 namespace gd
 {
 
 /**
  * \brief Class representing an expression used as a parameter of a gd::Instruction.
- * This class is nothing more than a wrapper around a gd::String.
+ * This class is a wrapper around a gd::String.
+ *
+ * The text of an expression never changes: the trees built by gd::ExpressionParser when the
+ * expression is parsed are kept with it, so that the expression is not parsed again by the
+ * code generation and the IDE tools. Copies of an expression share these trees.
  *
  * \see gd::Instruction
  *
@@ -21,6 +27,8 @@ namespace gd
  */
 class GD_CORE_API Expression
 {
+    friend class ExpressionParser;
+    friend class ExpressionParseTree;
 public:
 
     /**
@@ -52,7 +60,27 @@ public:
 
 private:
 
+    /**
+     * \brief The trees of the expression, built by gd::ExpressionParser.
+     */
+    struct ParseTrees
+    {
+        std::shared_ptr<const gd::ExpressionParseTree> math; ///< The tree of the expression parsed as a math expression.
+        std::shared_ptr<const gd::ExpressionParseTree> string; ///< The tree of the expression parsed as a string expression.
+    };
+
+    /**
+     * \brief Get the trees of the expression, which are shared with the copies of the expression made
+     * after this call.
+     */
+    std::shared_ptr<ParseTrees> GetParseTrees() const
+    {
+        if ( !parseTrees ) parseTrees = std::make_shared<ParseTrees>();
+        return parseTrees;
+    };
+
     gd::String plainString; ///<The expression string
+    mutable std::shared_ptr<ParseTrees> parseTrees; ///< The trees of the expression, or nullptr if it was never parsed.
 };
 
 }
@@ -13,6 +13,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/CommonTools.h"
 #include <algorithm>
+#include <memory>
 #include <iostream>
 #include "GDCore/Tools/Localization.h"
 
@@ -21,6 +22,140 @@ using namespace std;
 namespace gd
 {
 
+/**
+ * \brief The tree of an expression: the constant tokens, sub expressions and function calls found by
+ * gd::ExpressionParser, in the order in which they are given to gd::ParserCallbacks.
+ *
+ * The tree depends on the types of the objects and behaviors used in the expression: they are
+ * remembered so that the expression is parsed again if they change.
+ */
+class ExpressionParseTree
+{
+public:
+    ExpressionParseTree(const gd::Platform & platform_, const gd::Project & project_, const gd::Layout & layout_) :
+        valid(true),
+        errorPos(0),
+        platform(&platform_),
+        project(&project_),
+        layout(&layout_)
+    {};
+
+    struct Node
+    {
+        enum Type { ConstantToken, SubMathExpression, SubTextExpression, StaticFunction, ObjectFunction, ObjectBehaviorFunction };
+
+        Type type;
+        gd::String text; ///< The text of a constant token, or the name of a function.
+        std::vector<gd::Expression> parameters; ///< The parameters of a function.
+        const gd::ExpressionMetadata * metadata; ///< The metadata of a function, owned by the platform.
+        std::size_t parameter; ///< The index of a sub expression in the parameters of the next function.
+        std::size_t position; ///< The position of the function using a sub expression, added to the position of its errors.
+    };
+
+    /**
+     * \brief Return true if the tree is the tree of the expression parsed for the platform, project and layout.
+     */
+    bool IsUpToDate(const gd::Platform & platform_, const gd::Project & project_, const gd::Layout & layout_) const
+    {
+        if ( &platform_ != platform || &project_ != project || &layout_ != layout ) return false;
+
+        for (std::size_t i = 0;i<dependencies.size();++i)
+        {
+            if ( dependencies[i].values != GetDependencyValues(dependencies[i].type, dependencies[i].name) )
+                return false;
+        }
+
+        return true;
+    }
+
+    gd::String GetTypeOfObject(const gd::String & objectName) { return GetDependency(Dependency::ObjectType, objectName)[0]; }
+    gd::String GetTypeOfBehavior(const gd::String & behaviorName) { return GetDependency(Dependency::BehaviorType, behaviorName)[0]; }
+    std::vector<gd::String> GetBehaviorsOfObject(const gd::String & objectName) { return GetDependency(Dependency::ObjectBehaviors, objectName); }
+
+    void AddConstantToken(const gd::String & text)
+    {
+        Node node;
+        node.type = Node::ConstantToken;
+        node.text = text;
+        node.metadata = nullptr;
+        node.parameter = 0;
+        node.position = 0;
+        nodes.push_back(node);
+    }
+
+    void AddSubExpression(Node::Type type, std::size_t parameter, std::size_t position)
+    {
+        Node node;
+        node.type = type;
+        node.metadata = nullptr;
+        node.parameter = parameter;
+        node.position = position;
+        nodes.push_back(node);
+    }
+
+    void AddFunction(Node::Type type, const gd::String & name, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & metadata)
+    {
+        Node node;
+        node.type = type;
+        node.text = name;
+        node.parameters = parameters;
+        node.metadata = &metadata;
+        node.parameter = 0;
+        node.position = 0;
+
+        //Parameters are copied each time the tree is used: make sure that their copies share their trees.
+        for (std::size_t i = 0;i<node.parameters.size();++i)
+            node.parameters[i].GetParseTrees();
+
+        nodes.push_back(node);
+    }
+
+    std::vector<Node> nodes;
+    bool valid; ///< False if the expression has an error.
+    gd::String errorStr; ///< The error of the expression, if any.
+    std::size_t errorPos; ///< The position of the error of the expression, if any.
+
+private:
+    struct Dependency
+    {
+        enum Type { ObjectType, BehaviorType, ObjectBehaviors };
+
+        Type type;
+        gd::String name;
+        std::vector<gd::String> values;
+    };
+
+    const std::vector<gd::String> & GetDependency(Dependency::Type type, const gd::String & name)
+    {
+        for (std::size_t i = 0;i<dependencies.size();++i)
+        {
+            if ( dependencies[i].type == type && dependencies[i].name == name )
+                return dependencies[i].values;
+        }
+
+        Dependency dependency;
+        dependency.type = type;
+        dependency.name = name;
+        dependency.values = GetDependencyValues(type, name);
+        dependencies.push_back(dependency);
+
+        return dependencies.back().values;
+    }
+
+    std::vector<gd::String> GetDependencyValues(Dependency::Type type, const gd::String & name) const
+    {
+        if ( type == Dependency::ObjectType ) return std::vector<gd::String>(1, gd::GetTypeOfObject(*project, *layout, name));
+        else if ( type == Dependency::BehaviorType ) return std::vector<gd::String>(1, gd::GetTypeOfBehavior(*project, *layout, name));
+
+        return gd::GetBehaviorsOfObject(*project, *layout, name);
+    }
+
+    const gd::Platform * platform;
+    const gd::Project * project;
+    const gd::Layout * layout;
+    std::vector<Dependency> dependencies; ///< The types of the objects and behaviors used to build the tree.
+};
+
 gd::String ExpressionParser::parserSeparators = " ,+-*/%.<>=&|;()#^![]{}";
 
 size_t ExpressionParser::GetMinimalParametersNumber(const std::vector < gd::ParameterMetadata > & parametersInfos)
@@ -305,9 +440,8 @@ bool ExpressionParser::ValidSyntax(const gd::String & str)
     return true;
 }
 
-bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks)
+bool ExpressionParser::BuildMathExpressionTree(const gd::Platform & platform, gd::ExpressionParseTree & tree)
 {
-    callbacks.SetReturnType("expression");
     gd::String expression = expressionPlainString;
 
     size_t parsePosition = 0;
@@ -348,7 +482,7 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
         }
 
         //Now we're going to identify the expression
-        gd::ExpressionMetadata instructionInfos;
+        const gd::ExpressionMetadata * instructionInfos = nullptr;
 
         if ( functionName.substr(0, functionName.length()-1).find_first_of(parserSeparators) == string::npos )
         {
@@ -361,13 +495,13 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
             if ( nameIsFunction && MetadataProvider::HasExpression(platform, functionName) )
             {
                 functionFound = true; staticFunctionFound = true;
-                instructionInfos = MetadataProvider::GetExpressionMetadata(platform, functionName);
+                instructionInfos = &MetadataProvider::GetExpressionMetadata(platform, functionName);
             }
             //Then search in object expression
-            else if ( !nameIsFunction && MetadataProvider::HasObjectExpression(platform, gd::GetTypeOfObject(project, layout, objectName), functionName) )
+            else if ( !nameIsFunction && MetadataProvider::HasObjectExpression(platform, tree.GetTypeOfObject(objectName), functionName) )
             {
                 functionFound = true; objectFunctionFound = true;
-                instructionInfos = MetadataProvider::GetObjectExpressionMetadata(platform, gd::GetTypeOfObject(project, layout, objectName), functionName);
+                instructionInfos = &MetadataProvider::GetObjectExpressionMetadata(platform, tree.GetTypeOfObject(objectName), functionName);
             }
             //And in behaviors expressions
             else if ( !nameIsFunction )
@@ -381,16 +515,16 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
                     else
                         functionName = "";
 
-                    if ( MetadataProvider::HasBehaviorExpression(platform, gd::GetTypeOfBehavior(project, layout, autoName), functionName) )
+                    if ( MetadataProvider::HasBehaviorExpression(platform, tree.GetTypeOfBehavior(autoName), functionName) )
                     {
                         parameters.push_back(gd::Expression(autoName));
                         functionFound = true; behaviorFunctionFound = true;
 
-                        instructionInfos = MetadataProvider::GetBehaviorExpressionMetadata(platform,
-                                                                                             gd::GetTypeOfBehavior(project, layout, autoName), functionName);
+                        instructionInfos = &MetadataProvider::GetBehaviorExpressionMetadata(platform,
+                                                                                             tree.GetTypeOfBehavior(autoName), functionName);
 
                         //Verify that object has behavior.
-                        vector < gd::String > behaviors = gd::GetBehaviorsOfObject(project, layout, objectName);
+                        vector < gd::String > behaviors = tree.GetBehaviorsOfObject(objectName);
                         if ( find(behaviors.begin(), behaviors.end(), autoName) == behaviors.end() )
                         {
                             cout << "Bad behavior requested" << endl;
@@ -447,23 +581,22 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
                     }
 
                     //Testing the number of parameters
-                    if ( parameters.size() > GetMaximalParametersNumber(instructionInfos.parameters) || parameters.size() < GetMinimalParametersNumber(instructionInfos.parameters) )
+                    if ( parameters.size() > GetMaximalParametersNumber(instructionInfos->parameters) || parameters.size() < GetMinimalParametersNumber(instructionInfos->parameters) )
                     {
                         firstErrorPos = functionNameEnd;
                         firstErrorStr = _("Incorrect number of parameters");
                         firstErrorStr += " ";
                         firstErrorStr += _("Excepted ( maximum ) :");
-                        firstErrorStr += gd::String::From(GetMaximalParametersNumber(instructionInfos.parameters));
+                        firstErrorStr += gd::String::From(GetMaximalParametersNumber(instructionInfos->parameters));
 
                         return false;
                     }
 
                     //Preparing parameters
-                    parameters = CompleteParameters(instructionInfos.parameters, parameters);
-                    for (std::size_t i = 0;i<instructionInfos.parameters.size();++i)
+                    parameters = CompleteParameters(instructionInfos->parameters, parameters);
+                    for (std::size_t i = 0;i<instructionInfos->parameters.size();++i)
                     {
-                        if ( !PrepareParameter(platform, project, layout, callbacks, parameters[i], instructionInfos.parameters[i], functionNameEnd) )
-                            return false; //TODO : Boarf, param�tres optionels sont rajout�s et �valu�s : Probl�me avec les calques par exemple ( Au minimum, il faut "" )
+                        PrepareParameter(tree, parameters[i], i, instructionInfos->parameters[i], functionNameEnd); //TODO : Boarf, param�tres optionels sont rajout�s et �valu�s : Probl�me avec les calques par exemple ( Au minimum, il faut "" )
                     }
                 }
                 else
@@ -474,14 +607,14 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
                     return false;
                 }
 
-                callbacks.OnConstantToken(nonFunctionToken+expression.substr(parsePosition, nameStart-parsePosition));
+                tree.AddConstantToken(nonFunctionToken+expression.substr(parsePosition, nameStart-parsePosition));
                 expressionWithoutFunctions += expression.substr(parsePosition, nameStart-parsePosition);
                 nonFunctionToken.clear();
                 nonFunctionTokenStartPos = gd::String::npos;
 
-                if      ( objectFunctionFound ) callbacks.OnObjectFunction(functionName, parameters, instructionInfos);
-                else if ( behaviorFunctionFound ) callbacks.OnObjectBehaviorFunction(functionName, parameters, instructionInfos);
-                else if ( staticFunctionFound ) callbacks.OnStaticFunction(functionName, parameters, instructionInfos);
+                if      ( objectFunctionFound ) tree.AddFunction(ExpressionParseTree::Node::ObjectFunction, functionName, parameters, *instructionInfos);
+                else if ( behaviorFunctionFound ) tree.AddFunction(ExpressionParseTree::Node::ObjectBehaviorFunction, functionName, parameters, *instructionInfos);
+                else if ( staticFunctionFound ) tree.AddFunction(ExpressionParseTree::Node::StaticFunction, functionName, parameters, *instructionInfos);
 
                 if ( objectFunctionFound || behaviorFunctionFound || staticFunctionFound ) expressionWithoutFunctions += "0";
 
@@ -511,16 +644,15 @@ bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const
     }
 
     if ( parsePosition < expression.length() || !nonFunctionToken.empty() )
-        callbacks.OnConstantToken(nonFunctionToken+expression.substr(parsePosition, expression.length()));
+        tree.AddConstantToken(nonFunctionToken+expression.substr(parsePosition, expression.length()));
 
     expressionWithoutFunctions += expression.substr(parsePosition, expression.length());
 
     return ValidSyntax(expressionWithoutFunctions);
 }
 
-bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks)
+bool ExpressionParser::BuildStringExpressionTree(const gd::Platform & platform, gd::ExpressionParseTree & tree)
 {
-    callbacks.SetReturnType("string");
     gd::String expression = expressionPlainString;
 
     size_t parsePosition = 0;
@@ -542,7 +674,7 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
     {
         if ( firstQuotePos < firstPointPos && firstQuotePos < firstParPos ) //Adding a constant text
         {
-            callbacks.OnConstantToken(expression.substr(parsePosition, firstQuotePos-parsePosition));
+            tree.AddConstantToken(expression.substr(parsePosition, firstQuotePos-parsePosition));
 
             //Finding start and end of quotes
             size_t finalQuotePosition = expression.find("\"", firstQuotePos+1);
@@ -571,9 +703,9 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
             //(Function without name is considered as a constant text)
             vector < gd::Expression > parameters;
             parameters.push_back(finalText);
-            gd::ExpressionMetadata noParametersInfo;
+            static const gd::ExpressionMetadata noParametersInfo;
 
-            callbacks.OnStaticFunction("", parameters, noParametersInfo);
+            tree.AddFunction(ExpressionParseTree::Node::StaticFunction, "", parameters, noParametersInfo);
 
             parsePosition = finalQuotePosition+1;
         }
@@ -584,7 +716,7 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
             size_t nameStart = expression.find_last_of(parserSeparators, nameEnd-1);
             nameStart++;
 
-            callbacks.OnConstantToken(expression.substr(parsePosition, nameStart-parsePosition));
+            tree.AddConstantToken(expression.substr(parsePosition, nameStart-parsePosition));
 
             gd::String nameBefore = expression.substr(nameStart, nameEnd-nameStart);
             gd::String objectName = nameBefore.FindAndReplace("~", " ");
@@ -666,17 +798,16 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
                 parameters = CompleteParameters(expressionInfo.parameters, parameters);
                 for (std::size_t i = 0;i<parameters.size() && i<expressionInfo.parameters.size();++i)
                 {
-                    if ( !PrepareParameter(platform, project, layout, callbacks, parameters[i], expressionInfo.parameters[i], functionNameEnd) )
-                        return false;
+                    PrepareParameter(tree, parameters[i], i, expressionInfo.parameters[i], functionNameEnd);
                 }
 
-                callbacks.OnStaticFunction(functionName, parameters, expressionInfo);
+                tree.AddFunction(ExpressionParseTree::Node::StaticFunction, functionName, parameters, expressionInfo);
             }
             //Then an object member expression
-            else if ( !nameIsFunction && MetadataProvider::HasObjectStrExpression(platform, gd::GetTypeOfObject(project, layout, objectName), functionName) )
+            else if ( !nameIsFunction && MetadataProvider::HasObjectStrExpression(platform, tree.GetTypeOfObject(objectName), functionName) )
             {
                 functionFound = true;
-                const gd::ExpressionMetadata & expressionInfo = MetadataProvider::GetObjectStrExpressionMetadata(platform, gd::GetTypeOfObject(project, layout, nameBefore), functionName);
+                const gd::ExpressionMetadata & expressionInfo = MetadataProvider::GetObjectStrExpressionMetadata(platform, tree.GetTypeOfObject(nameBefore), functionName);
 
                 //Testing the number of parameters
                 if ( parameters.size() > GetMaximalParametersNumber(expressionInfo.parameters) || parameters.size() < GetMinimalParametersNumber(expressionInfo.parameters))
@@ -694,11 +825,10 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
                 parameters = CompleteParameters(expressionInfo.parameters, parameters);
                 for (std::size_t i = 0;i<parameters.size() && i<expressionInfo.parameters.size();++i)
                 {
-                    if ( !PrepareParameter(platform, project, layout, callbacks, parameters[i], expressionInfo.parameters[i], functionNameEnd) )
-                        return false;
+                    PrepareParameter(tree, parameters[i], i, expressionInfo.parameters[i], functionNameEnd);
                 }
 
-                callbacks.OnObjectFunction(functionName, parameters, expressionInfo);
+                tree.AddFunction(ExpressionParseTree::Node::ObjectFunction, functionName, parameters, expressionInfo);
             }
             //And search behaviors expressions
             else
@@ -712,16 +842,16 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
                     else
                         functionName = "";
 
-                    if ( MetadataProvider::HasBehaviorStrExpression(platform, gd::GetTypeOfBehavior(project, layout, autoName), functionName) )
+                    if ( MetadataProvider::HasBehaviorStrExpression(platform, tree.GetTypeOfBehavior(autoName), functionName) )
                     {
                         parameters.push_back(gd::Expression(autoName));
                         functionFound = true;
 
                         const gd::ExpressionMetadata & expressionInfo = MetadataProvider::GetBehaviorStrExpressionMetadata(platform,
-                                                                                                                                gd::GetTypeOfBehavior(project, layout, autoName), functionName);
+                                                                                                                                tree.GetTypeOfBehavior(autoName), functionName);
 
                         //Verify that object has behavior.
-                        vector < gd::String > behaviors = gd::GetBehaviorsOfObject(project, layout, objectName);
+                        vector < gd::String > behaviors = tree.GetBehaviorsOfObject(objectName);
                         if ( find(behaviors.begin(), behaviors.end(), autoName) == behaviors.end() )
                         {
                             cout << "Bad behavior requested" << endl;
@@ -742,11 +872,10 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
                             parameters = CompleteParameters(expressionInfo.parameters, parameters);
                             for (std::size_t i = 0;i<parameters.size() && i<expressionInfo.parameters.size();++i)
                             {
-                                if ( !PrepareParameter(platform, project, layout, callbacks, parameters[i], expressionInfo.parameters[i], functionNameEnd) )
-                                    return false;
+                                PrepareParameter(tree, parameters[i], i, expressionInfo.parameters[i], functionNameEnd);
                             }
 
-                            callbacks.OnObjectBehaviorFunction(functionName, parameters, expressionInfo);
+                            tree.AddFunction(ExpressionParseTree::Node::ObjectBehaviorFunction, functionName, parameters, expressionInfo);
                         }
                     }
                 }
@@ -806,41 +935,127 @@ bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, cons
     return true;
 }
 
-bool ExpressionParser::PrepareParameter(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, ParserCallbacks & callbacks, gd::Expression & parameter, const gd::ParameterMetadata & parametersInfo, const size_t positionInExpression)
+void ExpressionParser::PrepareParameter(gd::ExpressionParseTree & tree, gd::Expression & parameter, std::size_t parameterIndex, const gd::ParameterMetadata & parametersInfo, const size_t positionInExpression)
 {
     if ( parametersInfo.type == "expression" || parametersInfo.type == "camera" )
     {
         if (parametersInfo.optional && parameter.GetPlainString().empty())
             parameter = parametersInfo.defaultValue.empty() ? gd::Expression("0") : gd::Expression(parametersInfo.defaultValue);
 
-        if ( !callbacks.OnSubMathExpression(platform, project, layout, parameter) )
-        {
-            firstErrorStr = callbacks.firstErrorStr;
-            firstErrorPos = callbacks.firstErrorPos+positionInExpression;
-
-            return false;
-        }
+        tree.AddSubExpression(ExpressionParseTree::Node::SubMathExpression, parameterIndex, positionInExpression);
     }
     else if ( parametersInfo.type == "string" || parametersInfo.type == "layer" || parametersInfo.type == "color" || parametersInfo.type == "file" || parametersInfo.type == "joyaxis" )
     {
         if (parametersInfo.optional && parameter.GetPlainString().empty())
             parameter = parametersInfo.defaultValue.empty() ? gd::Expression("\"\"") : gd::Expression(parametersInfo.defaultValue);
 
-        if ( !callbacks.OnSubTextExpression(platform, project, layout, parameter) )
+        tree.AddSubExpression(ExpressionParseTree::Node::SubTextExpression, parameterIndex, positionInExpression);
+    }
+}
+
+bool ExpressionParser::ParseMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks)
+{
+    callbacks.SetReturnType("expression");
+    return WalkTree(*GetTree(false, platform, project, layout), platform, project, layout, callbacks);
+}
+
+bool ExpressionParser::ParseStringExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks)
+{
+    callbacks.SetReturnType("string");
+    return WalkTree(*GetTree(true, platform, project, layout), platform, project, layout, callbacks);
+}
+
+std::shared_ptr<const gd::ExpressionParseTree> ExpressionParser::GetTree(bool stringExpression, const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout)
+{
+    if ( trees )
+    {
+        const std::shared_ptr<const gd::ExpressionParseTree> & cachedTree = stringExpression ? trees->string : trees->math;
+        if ( cachedTree && cachedTree->IsUpToDate(platform, project, layout) )
+            return cachedTree;
+    }
+
+    std::shared_ptr<gd::ExpressionParseTree> tree = std::make_shared<gd::ExpressionParseTree>(platform, project, layout);
+    tree->valid = stringExpression ? BuildStringExpressionTree(platform, *tree) : BuildMathExpressionTree(platform, *tree);
+    if ( !tree->valid )
+    {
+        tree->errorStr = firstErrorStr;
+        tree->errorPos = firstErrorPos;
+    }
+
+    if ( trees ) (stringExpression ? trees->string : trees->math) = tree;
+    return tree;
+}
+
+bool ExpressionParser::WalkTree(const gd::ExpressionParseTree & tree, const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks)
+{
+    //The parameters of the next function, copied as the callbacks can modify them.
+    std::vector<gd::Expression> parameters;
+    bool parametersCopied = false;
+
+    for (std::size_t i = 0;i<tree.nodes.size();++i)
+    {
+        const ExpressionParseTree::Node & node = tree.nodes[i];
+        if ( node.type == ExpressionParseTree::Node::ConstantToken )
+            callbacks.OnConstantToken(node.text);
+        else if ( node.type == ExpressionParseTree::Node::SubMathExpression || node.type == ExpressionParseTree::Node::SubTextExpression )
         {
-            firstErrorStr = callbacks.firstErrorStr;
-            firstErrorPos = callbacks.firstErrorPos+positionInExpression;
+            if ( !parametersCopied )
+            {
+                std::size_t functionIndex = i+1;
+                while ( tree.nodes[functionIndex].type == ExpressionParseTree::Node::ConstantToken ||
+                    tree.nodes[functionIndex].type == ExpressionParseTree::Node::SubMathExpression ||
+                    tree.nodes[functionIndex].type == ExpressionParseTree::Node::SubTextExpression )
+                    functionIndex++;
+
+                parameters = tree.nodes[functionIndex].parameters;
+                parametersCopied = true;
+            }
 
-            return false;
+            gd::Expression & parameter = parameters[node.parameter];
+            bool subExpressionIsValid = node.type == ExpressionParseTree::Node::SubMathExpression ?
+                callbacks.OnSubMathExpression(platform, project, layout, parameter) :
+                callbacks.OnSubTextExpression(platform, project, layout, parameter);
+            if ( !subExpressionIsValid )
+            {
+                firstErrorStr = callbacks.firstErrorStr;
+                firstErrorPos = callbacks.firstErrorPos+node.position;
+
+                return false;
+            }
+        }
+        else
+        {
+            if ( !parametersCopied ) parameters = node.parameters;
+            parametersCopied = false;
+
+            if ( node.type == ExpressionParseTree::Node::ObjectFunction ) callbacks.OnObjectFunction(node.text, parameters, *node.metadata);
+            else if ( node.type == ExpressionParseTree::Node::ObjectBehaviorFunction ) callbacks.OnObjectBehaviorFunction(node.text, parameters, *node.metadata);
+            else callbacks.OnStaticFunction(node.text, parameters, *node.metadata);
         }
     }
 
+    if ( !tree.valid )
+    {
+        firstErrorStr = tree.errorStr;
+        firstErrorPos = tree.errorPos;
+
+        return false;
+    }
+
     return true;
 }
 
 ExpressionParser::ExpressionParser(const gd::String & expressionPlainString_) :
+firstErrorPos(0),
 expressionPlainString(expressionPlainString_)
 {
 }
 
+ExpressionParser::ExpressionParser(const gd::Expression & expression) :
+firstErrorPos(0),
+expressionPlainString(expression.GetPlainString()),
+trees(expression.GetParseTrees())
+{
+}
+
 }
@@ -7,8 +7,10 @@
 #define GDCORE_EXPRESSIONPARSER_H
 
 #include "GDCore/String.h"
+#include "GDCore/Events/Expression.h"
+#include <memory>
 #include <vector>
-namespace gd { class Expression; }
+namespace gd { class ExpressionParseTree; }
 namespace gd { class ParserCallbacks; }
 namespace gd { class Layout; }
 namespace gd { class Project; }
@@ -22,11 +24,25 @@ namespace gd
 /** \brief Parse an expression
  *
  * Parse an expression, calling callbacks when a token is reached
+ *
+ * The expression is first parsed into a tree, which is then walked to call the callbacks.
+ * When the parser is constructed from a gd::Expression, the tree is kept with the expression
+ * and reused the next time the expression is parsed, as long as the platform, project, layout
+ * and the types of the objects and behaviors used by the expression are the same.
+ *
  * \see gd::ParserCallbacks
  */
 class GD_CORE_API ExpressionParser
 {
 public:
+    /**
+     * \brief Construct a parser for an expression, using and filling the trees cached in the expression.
+     */
+    ExpressionParser(const gd::Expression & expression);
+
+    /**
+     * \brief Construct a parser for an expression which is parsed each time.
+     */
     ExpressionParser(const gd::String & expressionPlainString_);
     virtual ~ExpressionParser() {};
 
@@ -48,14 +64,32 @@ public:
 private:
 
     /**
-     * Tool function to add a parameter
+     * \brief Return the tree of the expression, taken from the expression if it is up to date.
+     */
+    std::shared_ptr<const gd::ExpressionParseTree> GetTree(bool stringExpression, const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout);
+
+    /**
+     * \brief Parse the expression as a math expression, filling the tree.
+     * \return True if expression was correctly parsed.
+     */
+    bool BuildMathExpressionTree(const gd::Platform & platform, gd::ExpressionParseTree & tree);
+
+    /**
+     * \brief Parse the expression as a string expression, filling the tree.
+     * \return True if expression was correctly parsed.
+     */
+    bool BuildStringExpressionTree(const gd::Platform & platform, gd::ExpressionParseTree & tree);
+
+    /**
+     * \brief Call the callbacks for each node of the tree.
+     * \return True if the expression and its sub expressions are correct.
      */
-    bool AddParameterToList(const gd::Project & project, const gd::Layout & layout, ParserCallbacks &, std::vector < gd::Expression > & parameters, gd::String parameterStr, std::vector < gd::ParameterMetadata > parametersInfos, const size_t positionInExpression);
+    bool WalkTree(const gd::ExpressionParseTree & tree, const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::ParserCallbacks & callbacks);
 
     /**
      * Tool function to prepare a parameter
      */
-    bool PrepareParameter(const gd::Platform & platform,const gd::Project & project, const gd::Layout & layout, ParserCallbacks &, gd::Expression & parameter, const gd::ParameterMetadata & parametersInfo, const size_t positionInExpression);
+    void PrepareParameter(gd::ExpressionParseTree & tree, gd::Expression & parameter, std::size_t parameterIndex, const gd::ParameterMetadata & parametersInfo, const size_t positionInExpression);
 
     /**
      * Return the minimal number of parameters which can be used when calling an expression ( i.e. ParametersCount-OptionalParameters-CodeOnlyParameters )
@@ -70,6 +104,7 @@ private:
     bool ValidSyntax(const gd::String & str);
 
     gd::String expressionPlainString;
+    std::shared_ptr<gd::Expression::ParseTrees> trees; ///< The trees of the parsed expression, or nullptr if they are not kept.
     static gd::String parserSeparators;
 };
 
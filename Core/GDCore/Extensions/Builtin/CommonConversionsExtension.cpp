@@ -46,7 +46,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCommonConversionsExtens
                        _("Converts the angle, expressed in degrees, into radians"),
                        _("Conversion"),
                        "res/conditions/toujours24.png")
-        .AddParameter("expression", _("Angle, in degrees"));
+        .AddParameter("expression", _("Angle, in degrees"))
+        .SetPure();
 
 
     extension.AddExpression("ToDeg",
@@ -54,7 +55,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCommonConversionsExtens
                        _("Converts the angle, expressed in radians, into degrees"),
                        _("Conversion"),
                        "res/conditions/toujours24.png")
-        .AddParameter("expression", _("Angle, in radians"));
+        .AddParameter("expression", _("Angle, in radians"))
+        .SetPure();
     #endif
 }
 
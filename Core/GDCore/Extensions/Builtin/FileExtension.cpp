@@ -28,7 +28,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsFileExtension(gd::Platf
                    "res/conditions/fichier.png")
         .AddParameter("file", _("Filename"))
         .AddParameter("string", _("Group"))
-        .MarkAsAdvanced();
+        .MarkAsAdvanced()
+        .SetCostHint(9);
 
     extension.AddAction("LoadFile",
                    _("Load a structured file in memory"),
@@ -124,7 +125,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsFileExtension(gd::Platf
                    "res/conditions/fichier24.png",
                    "res/conditions/fichier.png")
         .AddParameter("file", _("Filename"))
-        .MarkAsAdvanced();
+        .MarkAsAdvanced()
+        .SetCostHint(9);
 
     extension.AddAction("LaunchFile",
                    _("Open an URL or a file"),
@@ -27,7 +27,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(gd::P
                    "res/conditions/keyboard24.png",
                    "res/conditions/keyboard.png")
         .AddCodeOnlyParameter("currentScene", "")
-        .AddParameter("key", _("Key"));
+        .AddParameter("key", _("Key"))
+        .SetCostHint(1);
 
     extension.AddCondition("KeyReleased",
                    _("Key released"),
@@ -37,7 +38,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(gd::P
                    "res/conditions/keyboard24.png",
                    "res/conditions/keyboard.png")
         .AddCodeOnlyParameter("currentScene", "")
-        .AddParameter("key", _("Key"));
+        .AddParameter("key", _("Key"))
+        .SetCostHint(1);
 
     extension.AddCondition("KeyFromTextPressed",
                    _("Key pressed (text expression)"),
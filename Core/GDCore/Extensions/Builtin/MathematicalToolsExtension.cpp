@@ -179,6 +179,10 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtens
         .AddParameter("expression", _("b (in a+(b-a)*x)"))
         .AddParameter("expression", _("x (in a+(b-a)*x)"));
 
+    //Mathematical functions have no side effect and only depend on their parameters.
+    for (auto & it : extension.GetAllExpressions())
+        it.second.SetPure();
+
     #endif
 }
 
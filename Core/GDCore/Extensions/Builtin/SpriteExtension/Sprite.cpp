@@ -131,7 +131,8 @@ void Sprite::SetCustomCollisionMask(const std::vector<Polygon2d> & collisionMask
 void Sprite::LoadImage(std::shared_ptr<SFMLTextureWrapper> image_)
 {
     sfmlImage = image_;
-    sfmlSprite.setTexture(sfmlImage->texture, true);
+    sfmlSprite.setTexture(sfmlImage->GetTexture(), true);
+    sfmlSprite.setTextureRect(sfmlImage->GetTextureRect()); //The image can be a part of an atlas page.
     hasItsOwnImage = false;
 
     if ( automaticCentre )
@@ -142,8 +143,19 @@ void Sprite::MakeSpriteOwnsItsImage()
 {
     if ( !hasItsOwnImage || sfmlImage == std::shared_ptr<SFMLTextureWrapper>() )
     {
-        sfmlImage = std::make_shared<SFMLTextureWrapper>(sfmlImage->texture); //Copy the texture.
-        sfmlSprite.setTexture(sfmlImage->texture);
+        if ( sfmlImage->IsInAtlas() )
+        {
+            //Create a texture from the pixels of the image, as the atlas page is shared.
+            auto ownImage = std::make_shared<SFMLTextureWrapper>();
+            ownImage->image = sfmlImage->image;
+            ownImage->texture.loadFromImage(ownImage->image);
+            ownImage->texture.setSmooth(sfmlImage->GetTexture().isSmooth());
+            sfmlImage = ownImage;
+        }
+        else
+            sfmlImage = std::make_shared<SFMLTextureWrapper>(sfmlImage->texture); //Copy the texture.
+
+        sfmlSprite.setTexture(sfmlImage->texture, true);
         hasItsOwnImage = true;
     }
 }
@@ -29,6 +29,7 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(gd::
         .AddParameter("scenevar", _("Variable"))
         .AddParameter("relationalOperator", _("Sign of the test"))
         .AddParameter("expression", _("Value to compare"))
+        .SetCostHint(1)
         .SetManipulatedType("number");
 
     extension.AddCondition("VarSceneTxt",
@@ -41,6 +42,7 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(gd::
         .AddParameter("scenevar", _("Variable"))
         .AddParameter("relationalOperator", _("Sign of the test"))
         .AddParameter("string", _("Text to compare"))
+        .SetCostHint(1)
         .SetManipulatedType("string");
 
     extension.AddCondition("VariableChildExists",
@@ -87,6 +89,7 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(gd::
         .AddParameter("relationalOperator", _("Sign of the test"))
         .AddParameter("expression", _("Value to compare"))
         .MarkAsAdvanced()
+        .SetCostHint(1)
         .SetManipulatedType("number");
 
     extension.AddCondition("VarGlobalTxt",
@@ -100,6 +103,7 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(gd::
         .AddParameter("relationalOperator", _("Sign of the test"))
         .AddParameter("string", _("Text to compare"))
         .MarkAsAdvanced()
+        .SetCostHint(1)
         .SetManipulatedType("string");
 
     extension.AddCondition("VarGlobalDef",
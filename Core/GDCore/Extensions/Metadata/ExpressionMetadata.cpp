@@ -24,6 +24,7 @@ fullname(fullname_),
 description(description_),
 group(group_),
 shown(true),
+pure(false),
 smallIconFilename(smallicon_),
 extensionNamespace(extensionNamespace_)
 {
@@ -96,6 +96,51 @@ public:
 
     bool HasCustomCodeGenerator() const { return hasCustomCodeGenerator; }
 
+    /**
+     * \brief Set the function used to compute, during code generation, the value of the expression
+     * when all its parameters are constants.
+     *
+     * The function must give the same result as the function called by the generated code.
+     * It is only used for expressions which are pure ( see gd::ExpressionMetadata::SetPure ).
+     */
+    ExpressionCodeGenerationInformation & SetConstantEvaluator(std::function<double(const std::vector<double> & parameters)> evaluator)
+    {
+        constantEvaluator = evaluator;
+        return *this;
+    }
+
+    /**
+     * \brief Set the function, taking one parameter, used to compute the value of the expression
+     * during code generation.
+     * \see SetConstantEvaluator
+     */
+    ExpressionCodeGenerationInformation & SetConstantEvaluator(double (*function)(double))
+    {
+        return SetConstantEvaluator([function](const std::vector<double> & parameters) { return function(parameters[0]); });
+    }
+
+    /**
+     * \brief Set the function, taking two parameters, used to compute the value of the expression
+     * during code generation.
+     * \see SetConstantEvaluator
+     */
+    ExpressionCodeGenerationInformation & SetConstantEvaluator(double (*function)(double, double))
+    {
+        return SetConstantEvaluator([function](const std::vector<double> & parameters) { return function(parameters[0], parameters[1]); });
+    }
+
+    /**
+     * \brief Set the function, taking three parameters, used to compute the value of the expression
+     * during code generation.
+     * \see SetConstantEvaluator
+     */
+    ExpressionCodeGenerationInformation & SetConstantEvaluator(double (*function)(double, double, double))
+    {
+        return SetConstantEvaluator([function](const std::vector<double> & parameters) { return function(parameters[0], parameters[1], parameters[2]); });
+    }
+
+    bool HasConstantEvaluator() const { return static_cast<bool>(constantEvaluator); }
+
     bool staticFunction;
     gd::String functionCallName;
     bool hasCustomCodeGenerator;
@@ -103,6 +148,7 @@ public:
         const std::vector<gd::Expression> & parameters,
         gd::EventsCodeGenerator & codeGenerator,
         gd::EventsCodeGenerationContext & context)> customCodeGenerator;
+    std::function<double(const std::vector<double> & parameters)> constantEvaluator;
 
 private:
     std::vector<gd::String> includeFiles;
@@ -130,6 +176,25 @@ public:
      */
     ExpressionMetadata & SetHidden();
 
+    /**
+     * \brief Set that the expression has no side effect and that its result only
+     * depends on its parameters.
+     *
+     * When all its parameters are constants, the expression can then be computed during
+     * code generation ( see gd::ExpressionCodeGenerationInformation::SetConstantEvaluator ).
+     */
+    ExpressionMetadata & SetPure()
+    {
+        pure = true;
+        return *this;
+    }
+
+    /**
+     * \brief Return true if the expression has no side effect and its result only
+     * depends on its parameters.
+     */
+    bool IsPure() const { return pure; }
+
     /**
      * \brief Set the group of the instruction in the IDE.
      */
@@ -175,7 +240,7 @@ public:
 
     /** Don't use this constructor. Only here to fullfil std::map requirements
      */
-    ExpressionMetadata() : shown(false) {};
+    ExpressionMetadata() : shown(false), pure(false) {};
 
     bool IsShown() const { return shown; }
     const gd::String & GetFullName() const { return fullname; }
@@ -195,6 +260,7 @@ private:
     gd::String description;
     gd::String group;
     bool shown;
+    bool pure;
 
 #if !defined(GD_NO_WX_GUI)
     wxBitmap smallicon;
@@ -17,7 +17,9 @@ namespace gd
 InstructionMetadata::InstructionMetadata() :
     sentence(_("Unknown or unsupported instruction")),
     canHaveSubInstructions(false),
-    hidden(true)
+    hidden(true),
+    usageComplexity(5),
+    costHint(5)
 {
 }
 
@@ -39,7 +41,8 @@ smallIconFilename(smallIcon_),
 canHaveSubInstructions(false),
 extensionNamespace(extensionNamespace_),
 hidden(false),
-usageComplexity(5)
+usageComplexity(5),
+costHint(5)
 {
 #if !defined(GD_NO_WX_GUI)
     if ( wxFile::Exists(icon_) )
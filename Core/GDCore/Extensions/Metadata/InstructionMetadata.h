@@ -227,6 +227,25 @@ public:
      */
     int GetUsageComplexity() const { return usageComplexity; }
 
+    /**
+     * \brief Set the estimated cost of evaluating the instruction, from 0 (a comparison
+     * of values) to 10 (a test done for each object, like a collision test).
+     *
+     * When it does not change what the events do, the code generator evaluates the
+     * conditions with the lowest cost first.
+     */
+    InstructionMetadata & SetCostHint(int cost)
+    {
+        costHint = cost;
+        return *this;
+    }
+
+    /**
+     * \brief Return the estimated cost of evaluating the instruction, from 0 to 10.
+     * \see gd::InstructionMetadata::SetCostHint
+     */
+    int GetCostHint() const { return costHint; }
+
     /**
      * \brief Defines information about how generate the code for an instruction
      */
@@ -394,6 +413,7 @@ private:
     gd::String extensionNamespace;
     bool hidden;
     int usageComplexity; ///< Evaluate the instruction from 0 (simple&easy to use) to 10 (complex to understand)
+    int costHint; ///< Estimated cost of evaluating the instruction, from 0 (cheap) to 10 (expensive)
 };
 
 }
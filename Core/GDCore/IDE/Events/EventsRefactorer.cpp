@@ -99,7 +99,7 @@ class CallbacksForRenamingObject : public gd::ParserCallbacks
 
         CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
             return false;
 
@@ -113,7 +113,7 @@ class CallbacksForRenamingObject : public gd::ParserCallbacks
 
         CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
             return false;
 
@@ -164,7 +164,7 @@ class CallbacksForRemovingObject : public gd::ParserCallbacks
     {
         CallbacksForRemovingObject callbacks(name);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
             return false;
 
@@ -176,7 +176,7 @@ class CallbacksForRemovingObject : public gd::ParserCallbacks
     {
         CallbacksForRemovingObject callbacks(name);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
             return false;
 
@@ -209,7 +209,7 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform & platform, gd::
 
                 CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-                gd::ExpressionParser parser(oldExpression);
+                gd::ExpressionParser parser(actions[aId].GetParameter(pNb));
                 if ( parser.ParseMathExpression(platform, project, layout, callbacks) && newExpression != oldExpression )
                 {
                     somethingModified = true;
@@ -224,7 +224,7 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform & platform, gd::
 
                 CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-                gd::ExpressionParser parser(oldExpression);
+                gd::ExpressionParser parser(actions[aId].GetParameter(pNb));
                 if ( parser.ParseStringExpression(platform, project, layout, callbacks) && newExpression != oldExpression )
                 {
                     somethingModified = true;
@@ -260,8 +260,8 @@ bool EventsRefactorer::RenameObjectInConditions(const gd::Platform & platform, g
 
                 CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-                gd::ExpressionParser parser(oldExpression);
-                if ( parser.ParseMathExpression(platform, project, layout, callbacks) )
+                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb));
+                if ( parser.ParseMathExpression(platform, project, layout, callbacks) && newExpression != oldExpression )
                 {
                     somethingModified = true;
                     conditions[cId].SetParameter(pNb, gd::Expression(newExpression));
@@ -275,8 +275,8 @@ bool EventsRefactorer::RenameObjectInConditions(const gd::Platform & platform, g
 
                 CallbacksForRenamingObject callbacks(newExpression, oldName, newName);
 
-                gd::ExpressionParser parser(oldExpression);
-                if ( parser.ParseMathExpression(platform, project, layout, callbacks) )
+                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb));
+                if ( parser.ParseMathExpression(platform, project, layout, callbacks) && newExpression != oldExpression )
                 {
                     somethingModified = true;
                     conditions[cId].SetParameter(pNb, gd::Expression(newExpression));
@@ -339,7 +339,7 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform & platform, gd::
             {
                 CallbacksForRemovingObject callbacks(name);
 
-                gd::ExpressionParser parser(actions[aId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(actions[aId].GetParameter(pNb));
                 if ( parser.ParseMathExpression(platform, project, layout, callbacks) && callbacks.objectPresent )
                 {
                     deleteMe = true;
@@ -351,7 +351,7 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform & platform, gd::
             {
                 CallbacksForRemovingObject callbacks(name);
 
-                gd::ExpressionParser parser(actions[aId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(actions[aId].GetParameter(pNb));
                 if ( parser.ParseStringExpression(platform, project, layout, callbacks) && callbacks.objectPresent )
                 {
                     deleteMe = true;
@@ -394,7 +394,7 @@ bool EventsRefactorer::RemoveObjectInConditions(const gd::Platform & platform, g
             {
                 CallbacksForRemovingObject callbacks(name);
 
-                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb));
                 if ( parser.ParseMathExpression(platform, project, layout, callbacks) && callbacks.objectPresent )
                 {
                     deleteMe = true;
@@ -406,7 +406,7 @@ bool EventsRefactorer::RemoveObjectInConditions(const gd::Platform & platform, g
             {
                 CallbacksForRemovingObject callbacks(name);
 
-                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(conditions[cId].GetParameter(pNb));
                 if ( parser.ParseStringExpression(platform, project, layout, callbacks) && callbacks.objectPresent )
                 {
                     deleteMe = true;
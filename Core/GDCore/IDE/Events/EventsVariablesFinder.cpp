@@ -42,7 +42,7 @@ public:
     {
         CallbacksForSearchingVariable callbacks(results, parameterType, objectName);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         parser.ParseMathExpression(platform, project, layout, callbacks);
 
         return true;
@@ -52,7 +52,7 @@ public:
     {
         CallbacksForSearchingVariable callbacks(results, parameterType, objectName);
 
-        gd::ExpressionParser parser(expression.GetPlainString());
+        gd::ExpressionParser parser(expression);
         parser.ParseStringExpression(platform, project, layout, callbacks);
 
         return true;
@@ -142,7 +142,7 @@ std::set < gd::String > EventsVariablesFinder::FindArgumentsInInstructions(const
             {
                 CallbacksForSearchingVariable callbacks(results, parameterType, objectName);
 
-                gd::ExpressionParser parser(instructions[aId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(instructions[aId].GetParameter(pNb));
                 parser.ParseMathExpression(platform, project, layout, callbacks);
             }
             //Search in gd::String expressions
@@ -150,7 +150,7 @@ std::set < gd::String > EventsVariablesFinder::FindArgumentsInInstructions(const
             {
                 CallbacksForSearchingVariable callbacks(results, parameterType, objectName);
 
-                gd::ExpressionParser parser(instructions[aId].GetParameter(pNb).GetPlainString());
+                gd::ExpressionParser parser(instructions[aId].GetParameter(pNb));
                 parser.ParseStringExpression(platform, project, layout, callbacks);
             }
             //Remember the value of the last "object" parameter.
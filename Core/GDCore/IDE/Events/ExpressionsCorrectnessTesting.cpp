@@ -24,7 +24,7 @@ bool CallbacksForExpressionCorrectnessTesting::OnSubMathExpression(const gd::Pla
 {
     CallbacksForExpressionCorrectnessTesting callbacks(project, layout);
 
-    gd::ExpressionParser parser(expression.GetPlainString());
+    gd::ExpressionParser parser(expression);
     if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
     {
         #if defined(GD_IDE_ONLY)
@@ -41,7 +41,7 @@ bool CallbacksForExpressionCorrectnessTesting::OnSubTextExpression(const gd::Pla
 {
     CallbacksForExpressionCorrectnessTesting callbacks(project, layout);
 
-    gd::ExpressionParser parser(expression.GetPlainString());
+    gd::ExpressionParser parser(expression);
     if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
     {
         #if defined(GD_IDE_ONLY)
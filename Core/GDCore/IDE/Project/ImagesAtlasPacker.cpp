@@ -0,0 +1,162 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#include "GDCore/IDE/Project/ImagesAtlasPacker.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/NewNameGenerator.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/ResourcesLoader.h"
+#include "GDCore/Tools/ParallelTasks.h"
+#include "GDCore/Tools/SkylinePacker.h"
+#undef LoadImage //thx windows.h
+
+namespace gd
+{
+
+namespace
+{
+
+struct ImageToPack
+{
+    gd::ImageResource * resource;
+    gd::String file;
+    sf::Image image;
+    unsigned int x;
+    unsigned int y;
+};
+
+struct AtlasPage
+{
+    AtlasPage(unsigned int width, unsigned int height, bool smooth_) : packer(width, height), smooth(smooth_) {};
+
+    gd::SkylinePacker packer;
+    bool smooth; ///< The smoothing of the images of the page: all images of a page share the same texture.
+    std::vector<ImageToPack *> images;
+};
+
+}
+
+ImagesAtlasPacker::ImagesAtlasPacker(gd::AbstractFileSystem & fileSystem) :
+    ArbitraryResourceWorker(),
+    pageWidth(2048),
+    pageHeight(2048),
+    padding(2),
+    fs(fileSystem)
+{
+}
+
+std::size_t ImagesAtlasPacker::PackInto(gd::Project & project, const gd::String & outputDirectory)
+{
+    gd::ResourcesManager & resources = project.GetResourcesManager();
+
+    //List the images that can be packed
+    std::vector<ImageToPack> images;
+    for (auto & name : exposedImages)
+    {
+        if ( excludedImages.find(name) != excludedImages.end() || !resources.HasResource(name) ) continue;
+
+        gd::ImageResource * resource = dynamic_cast<gd::ImageResource*>(&resources.GetResource(name));
+        if ( !resource || resource->IsInAtlas() || resource->alwaysLoaded || resource->GetFile().empty() ) continue;
+
+        ImageToPack image;
+        image.resource = resource;
+        image.file = resource->GetFile();
+        fs.MakeAbsolute(image.file, baseDirectory);
+        images.push_back(image);
+    }
+
+    ParallelTasks::Run(images.size(), [&images](std::size_t i) {
+        ResourcesLoader::Get()->LoadSFMLImage(images[i].file, images[i].image);
+    });
+
+    //Pack the highest images first, to get a better packing.
+    std::vector<ImageToPack *> sortedImages;
+    for (auto & image : images)
+    {
+        sf::Vector2u size = image.image.getSize();
+        if ( size.x == 0 || size.y == 0 || size.x + padding > pageWidth || size.y + padding > pageHeight ) continue;
+
+        sortedImages.push_back(&image);
+    }
+    std::stable_sort(sortedImages.begin(), sortedImages.end(), [](const ImageToPack * a, const ImageToPack * b) {
+        if ( a->image.getSize().y != b->image.getSize().y ) return a->image.getSize().y > b->image.getSize().y;
+        return a->image.getSize().x > b->image.getSize().x;
+    });
+
+    std::vector< std::unique_ptr<AtlasPage> > pages;
+    for (auto image : sortedImages)
+    {
+        sf::Vector2u size = image->image.getSize();
+        bool placed = false;
+        for (auto & page : pages)
+        {
+            if ( page->smooth == image->resource->smooth &&
+                page->packer.Insert(size.x + padding, size.y + padding, image->x, image->y) )
+            {
+                page->images.push_back(image);
+                placed = true;
+                break;
+            }
+        }
+
+        if ( !placed )
+        {
+            pages.push_back(std::unique_ptr<AtlasPage>(new AtlasPage(pageWidth, pageHeight, image->resource->smooth)));
+            pages.back()->packer.Insert(size.x + padding, size.y + padding, image->x, image->y);
+            pages.back()->images.push_back(image);
+        }
+    }
+
+    //Save the pages and update the resources
+    std::size_t packedImagesCount = 0;
+    for (std::size_t i = 0;i < pages.size();++i)
+    {
+        AtlasPage & page = *pages[i];
+        if ( page.images.size() < 2 ) continue; //Nothing to gain.
+
+        sf::Image pageImage;
+        pageImage.create(page.packer.GetUsedWidth(), page.packer.GetUsedHeight(), sf::Color(0, 0, 0, 0));
+        for (auto image : page.images)
+            pageImage.copy(image->image, image->x, image->y);
+
+        gd::String pageName = gd::NewNameGenerator::Generate("GDAtlasPage" + gd::String::From(i), [&resources](const gd::String & name) {
+            return resources.HasResource(name);
+        });
+        gd::String pageFile = outputDirectory + "/" + pageName + ".png";
+        if ( !pageImage.saveToFile(pageFile.ToLocale()) )
+        {
+            std::cout << "Unable to save the atlas page " << pageFile << std::endl;
+            continue;
+        }
+
+        gd::ImageResource pageResource;
+        pageResource.SetName(pageName);
+        pageResource.SetFile(pageFile);
+        pageResource.smooth = page.smooth;
+        resources.AddResource(pageResource);
+
+        for (auto image : page.images)
+        {
+            image->resource->atlasPage = pageName;
+            image->resource->atlasX = image->x;
+            image->resource->atlasY = image->y;
+            image->resource->atlasWidth = image->image.getSize().x;
+            image->resource->atlasHeight = image->image.getSize().y;
+            image->resource->SetFile(""); //The file is not needed anymore.
+            packedImagesCount++;
+        }
+    }
+
+    return packedImagesCount;
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_IMAGESATLASPACKER_H
+#define GDCORE_IMAGESATLASPACKER_H
+
+#include "GDCore/String.h"
+#include <set>
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+namespace gd { class AbstractFileSystem; }
+namespace gd { class Project; }
+
+namespace gd {
+
+/**
+ * \brief Pack the images exposed to the worker into large images ("atlas pages"),
+ * so that the objects using them share a few textures.
+ *
+ * The images exposed are packed by gd::SkylinePacker into pages, saved as PNG files.
+ * The pages are added to the project as image resources, and the image resources
+ * packed are updated to refer to their page (see gd::ImageResource::atlasPage). They
+ * are then resolved by gd::ImageManager to a part of the page texture.
+ *
+ * Only images used by objects able to draw a part of a texture should be exposed,
+ * and images used elsewhere must be excluded. Usage example, during export:
+\code
+    gd::ImagesAtlasPacker atlasPacker(fs);
+    atlasPacker.SetBaseDirectory(projectDirectory);
+    spriteObject.ExposeResources(atlasPacker);
+
+    gd::ImagesUsedInventorizer otherImages;
+    otherObject.ExposeResources(otherImages);
+    atlasPacker.ExcludeImages(otherImages.GetAllUsedImages());
+
+    atlasPacker.PackInto(project, outputDirectory);
+    project.ExposeResources(resourcesMergingHelper); //The pages are then exported as any image.
+\endcode
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ImagesAtlasPacker : public gd::ArbitraryResourceWorker
+{
+public:
+    ImagesAtlasPacker(gd::AbstractFileSystem & fileSystem);
+    virtual ~ImagesAtlasPacker() {};
+
+    /**
+     * \brief Set the directory used as base directory: All resources filename are relative to this directory.
+     * (usually, it is the project directory).
+     */
+    void SetBaseDirectory(const gd::String & baseDirectory_) { baseDirectory = baseDirectory_; }
+
+    /**
+     * \brief Set the maximum size of the atlas pages (2048x2048 by default).
+     */
+    void SetPageSize(unsigned int width, unsigned int height) { pageWidth = width; pageHeight = height; }
+
+    /**
+     * \brief Set the number of transparent pixels kept between images (2 by default),
+     * so that smoothed textures don't bleed on their neighbours.
+     */
+    void SetPadding(unsigned int padding_) { padding = padding_; }
+
+    /**
+     * \brief Prevent the specified images from being packed.
+     */
+    void ExcludeImages(const std::set<gd::String> & images) { excludedImages.insert(images.begin(), images.end()); }
+
+    /**
+     * \brief Pack the exposed images into pages saved in \a outputDirectory, and update
+     * the resources of the project.
+     *
+     * Images flagged as always loaded are never packed, as they can be used by actions.
+     *
+     * \return The number of images packed.
+     */
+    std::size_t PackInto(gd::Project & project, const gd::String & outputDirectory);
+
+    virtual void ExposeFile(gd::String & resource) { /*Don't care, only images are packed*/ };
+    virtual void ExposeImage(gd::String & imageName) { exposedImages.insert(imageName); };
+
+private:
+    std::set<gd::String> exposedImages;
+    std::set<gd::String> excludedImages;
+    gd::String baseDirectory;
+    unsigned int pageWidth;
+    unsigned int pageHeight;
+    unsigned int padding;
+    gd::AbstractFileSystem & fs; ///< The gd::AbstractFileSystem used to manipulate files.
+};
+
+}
+
+#endif // GDCORE_IMAGESATLASPACKER_H
+#endif
@@ -0,0 +1,216 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCore/Project/ImageDecodingQueue.h"
+#include "GDCore/Project/ResourcesLoader.h"
+#include "GDCore/Tools/ParallelTasks.h"
+#include <algorithm>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Sleep.hpp>
+#undef LoadImage //thx windows.h
+
+namespace gd
+{
+
+ImageDecodingQueue::ImageDecodingQueue()
+#if !defined(EMSCRIPTEN)
+    : threadRunning(false),
+    stopping(false)
+#endif
+{
+}
+
+ImageDecodingQueue::ImageDecodingQueue(const ImageDecodingQueue &)
+#if !defined(EMSCRIPTEN)
+    : threadRunning(false),
+    stopping(false)
+#endif
+{
+}
+
+ImageDecodingQueue & ImageDecodingQueue::operator=(const ImageDecodingQueue & other)
+{
+    if ( this != &other )
+        Clear();
+
+    return *this;
+}
+
+ImageDecodingQueue::~ImageDecodingQueue()
+{
+    #if !defined(EMSCRIPTEN)
+    {
+        sf::Lock lock(mutex);
+        stopping = true;
+    }
+    #endif
+    Clear();
+}
+
+void ImageDecodingQueue::Clear()
+{
+    #if !defined(EMSCRIPTEN)
+    {
+        sf::Lock lock(mutex);
+        pendingImages.clear();
+    }
+
+    //Images being decoded are finished by the background thread before it exits.
+    if ( thread ) thread->wait();
+    thread.reset();
+    threadRunning = false;
+    #endif
+
+    pendingImages.clear();
+    decodingImages.clear();
+    decodedImages.clear();
+}
+
+void ImageDecodingQueue::Add(const gd::String & name, const gd::String & file)
+{
+    #if !defined(EMSCRIPTEN)
+    sf::Lock lock(mutex);
+    pendingImages.push_back(std::make_pair(name, file));
+
+    if ( !threadRunning && !stopping )
+    {
+        //The previous thread, if any, has nothing more to do and is exiting.
+        if ( thread ) thread->wait();
+
+        ResourcesLoader::Get(); //Make sure the singleton is not created by the background threads.
+
+        threadRunning = true;
+        thread.reset(new sf::Thread(&ImageDecodingQueue::DecodeImages, this));
+        thread->launch();
+    }
+    #else
+    pendingImages.push_back(std::make_pair(name, file));
+    #endif
+}
+
+bool ImageDecodingQueue::Contains(const gd::String & name) const
+{
+    #if !defined(EMSCRIPTEN)
+    sf::Lock lock(mutex);
+    #endif
+
+    if ( decodingImages.find(name) != decodingImages.end() ) return true;
+    for (auto & pending : pendingImages)
+        if ( pending.first == name ) return true;
+    for (auto & decoded : decodedImages)
+        if ( decoded.first == name ) return true;
+
+    return false;
+}
+
+std::size_t ImageDecodingQueue::GetCount() const
+{
+    #if !defined(EMSCRIPTEN)
+    sf::Lock lock(mutex);
+    #endif
+
+    return pendingImages.size() + decodingImages.size() + decodedImages.size();
+}
+
+bool ImageDecodingQueue::TakeDecodedImage(gd::String & name, sf::Image & image)
+{
+    #if !defined(EMSCRIPTEN)
+    sf::Lock lock(mutex);
+    #else
+    //No threads: decode the next image now.
+    if ( decodedImages.empty() && !pendingImages.empty() )
+    {
+        auto pending = pendingImages.front();
+        pendingImages.pop_front();
+        name = pending.first;
+        ResourcesLoader::Get()->LoadSFMLImage(pending.second, image);
+        return true;
+    }
+    #endif
+
+    if ( decodedImages.empty() ) return false;
+
+    name = decodedImages.front().first;
+    image = *decodedImages.front().second;
+    decodedImages.erase(decodedImages.begin());
+    return true;
+}
+
+bool ImageDecodingQueue::TakeImage(const gd::String & name, sf::Image & image)
+{
+    gd::String file;
+    while ( true )
+    {
+        {
+            #if !defined(EMSCRIPTEN)
+            sf::Lock lock(mutex);
+            #endif
+
+            auto decoded = std::find_if(decodedImages.begin(), decodedImages.end(),
+                [&name](const std::pair<gd::String, std::shared_ptr<sf::Image> > & decoded) { return decoded.first == name; });
+            if ( decoded != decodedImages.end() )
+            {
+                image = *decoded->second;
+                decodedImages.erase(decoded);
+                return true;
+            }
+
+            //Don't wait for the background thread if it has not started to decode the image.
+            auto pending = std::find_if(pendingImages.begin(), pendingImages.end(),
+                [&name](const std::pair<gd::String, gd::String> & pending) { return pending.first == name; });
+            if ( pending != pendingImages.end() )
+            {
+                file = pending->second;
+                pendingImages.erase(pending);
+                break;
+            }
+
+            if ( decodingImages.find(name) == decodingImages.end() )
+                return false;
+        }
+
+        #if !defined(EMSCRIPTEN)
+        sf::sleep(sf::milliseconds(1));
+        #endif
+    }
+
+    //Decoded without holding the lock, so that the background threads are not stopped.
+    ResourcesLoader::Get()->LoadSFMLImage(file, image);
+    return true;
+}
+
+void ImageDecodingQueue::DecodeImages()
+{
+    #if !defined(EMSCRIPTEN)
+    while ( true )
+    {
+        std::vector< std::pair<gd::String, gd::String> > images;
+        {
+            sf::Lock lock(mutex);
+            if ( pendingImages.empty() || stopping )
+            {
+                threadRunning = false;
+                return;
+            }
+
+            images.assign(pendingImages.begin(), pendingImages.end());
+            pendingImages.clear();
+            for (auto & image : images)
+                decodingImages.insert(image.first);
+        }
+
+        ParallelTasks::Run(images.size(), [this, &images](std::size_t i) {
+            auto image = std::make_shared<sf::Image>();
+            ResourcesLoader::Get()->LoadSFMLImage(images[i].second, *image);
+
+            sf::Lock lock(mutex);
+            decodingImages.erase(images[i].first);
+            decodedImages.push_back(std::make_pair(images[i].first, image));
+        });
+    }
+    #endif
+}
+
+}
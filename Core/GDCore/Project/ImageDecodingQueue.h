@@ -0,0 +1,100 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef GDCORE_IMAGEDECODINGQUEUE_H
+#define GDCORE_IMAGEDECODINGQUEUE_H
+#include <deque>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Thread.hpp>
+#include "GDCore/String.h"
+
+namespace gd
+{
+
+/**
+ * \brief Decode images into sf::Image on background threads.
+ *
+ * Images are added to the queue with their name and file, and are decoded by a
+ * background thread (which spreads the work on all the processors, see gd::ParallelTasks).
+ * Decoded images are then taken from the main thread, usually to create the
+ * textures on the GPU.
+ *
+ * \note Only sf::Image are created by the background threads: no OpenGL calls are made.
+ * When compiled with Emscripten, images are decoded when they are taken.
+ *
+ * \see gd::ImageManager::PreloadImages
+ * \ingroup ResourcesManagement
+ */
+class GD_CORE_API ImageDecodingQueue
+{
+public:
+    ImageDecodingQueue();
+
+    /**
+     * \brief Copying a queue does not copy the images: the copy is empty.
+     */
+    ImageDecodingQueue(const ImageDecodingQueue &);
+    ImageDecodingQueue & operator=(const ImageDecodingQueue &);
+
+    /**
+     * \brief Destroy the queue, waiting for the images being decoded.
+     */
+    virtual ~ImageDecodingQueue();
+
+    /**
+     * \brief Add an image to be decoded.
+     * \param name The name of the image, used to get it back once decoded.
+     * \param file The file of the image.
+     */
+    void Add(const gd::String & name, const gd::String & file);
+
+    /**
+     * \brief Return true if the image is waiting to be decoded, being decoded
+     * or decoded but not yet taken.
+     */
+    bool Contains(const gd::String & name) const;
+
+    /**
+     * \brief Return the number of images added and not yet taken.
+     */
+    std::size_t GetCount() const;
+
+    /**
+     * \brief Take an image which has been decoded, if any. Never blocks.
+     * \return true if an image was taken and stored into \a name and \a image.
+     */
+    bool TakeDecodedImage(gd::String & name, sf::Image & image);
+
+    /**
+     * \brief Take the specified image, waiting for it to be decoded if necessary.
+     * If its decoding has not started yet, the image is decoded on the calling thread.
+     * \return false if the image was not in the queue.
+     */
+    bool TakeImage(const gd::String & name, sf::Image & image);
+
+private:
+    void Clear();
+    void DecodeImages(); ///< Body of the background thread.
+
+    std::deque< std::pair<gd::String, gd::String> > pendingImages; ///< Name and file of the images waiting to be decoded.
+    std::set<gd::String> decodingImages; ///< Names of the images being decoded.
+    std::vector< std::pair<gd::String, std::shared_ptr<sf::Image> > > decodedImages; ///< Images decoded, in the order they were decoded.
+
+    #if !defined(EMSCRIPTEN)
+    mutable sf::Mutex mutex; ///< Protect the lists of images.
+    std::unique_ptr<sf::Thread> thread;
+    bool threadRunning; ///< True while the background thread has images to decode.
+    bool stopping; ///< True when the queue is being destroyed.
+    #endif
+};
+
+}
+
+#endif // GDCORE_IMAGEDECODINGQUEUE_H
@@ -9,6 +9,8 @@
 #include "GDCore/Tools/InvalidImage.h"
 #include "GDCore/Project/ResourcesManager.h"
 #include <SFML/OpenGL.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Lock.hpp>
 #if !defined(ANDROID) && !defined(MACOS)
 #include <GL/glu.h>
 #endif
@@ -18,7 +20,9 @@ namespace gd
 {
 
 ImageManager::ImageManager() :
-    resourcesManager(NULL)
+    resourcesManager(NULL),
+    preloadingImagesCount(0),
+    asynchronousLoading(false)
 {
     #if !defined(EMSCRIPTEN)
     badTexture = std::make_shared<SFMLTextureWrapper>();
@@ -28,8 +32,49 @@ ImageManager::ImageManager() :
     #endif
 }
 
+ImageManager::ImageManager(const ImageManager & other) :
+    preloadingImagesCount(0)
+{
+    Init(other);
+}
+
+ImageManager & ImageManager::operator=(const ImageManager & other)
+{
+    if ( this != &other )
+        Init(other);
+
+    return *this;
+}
+
+ImageManager::~ImageManager()
+{
+}
+
+void ImageManager::Init(const ImageManager & other)
+{
+    sf::Lock lock(other.mutex);
+    alreadyLoadedImages = other.alreadyLoadedImages;
+    permanentlyLoadedImages = other.permanentlyLoadedImages;
+    #if defined(GD_IDE_ONLY)
+    unloadingPreventer = other.unloadingPreventer;
+    preventUnloading = other.preventUnloading;
+    #endif
+    alreadyLoadedOpenGLTextures = other.alreadyLoadedOpenGLTextures;
+    badTexture = other.badTexture;
+    badOpenGLTexture = other.badOpenGLTexture;
+    resourcesManager = other.resourcesManager;
+    asynchronousLoading = other.asynchronousLoading;
+
+    //Images being decoded belong to the other manager.
+    decodingQueue = gd::ImageDecodingQueue();
+    preloadedImages = other.preloadedImages;
+    preloadingImages.clear();
+    preloadingImagesCount = 0;
+}
+
 std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(const gd::String & name) const
 {
+    sf::Lock lock(mutex);
     if ( !resourcesManager )
     {
         std::cout << "ImageManager has no ResourcesManager associated with.";
@@ -39,12 +84,29 @@ std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(const gd::Strin
     if ( alreadyLoadedImages.find(name) != alreadyLoadedImages.end() && !alreadyLoadedImages.find(name)->second.expired() )
         return alreadyLoadedImages.find(name)->second.lock();
 
+    //The image is being decoded in the background
+    if ( decodingQueue.Contains(name) )
+    {
+        if ( asynchronousLoading ) return CreatePlaceholderTexture(name);
+
+        sf::Image image;
+        if ( decodingQueue.TakeImage(name, image) ) return CreateTexture(name, image);
+    }
+
     std::cout << "ImageManager: Loading " << name << ".";
 
     //Load only an image when necessary
     try
     {
         ImageResource & image = dynamic_cast<ImageResource&>(resourcesManager->GetResource(name));
+        if ( image.IsInAtlas() ) return CreateAtlasTexture(name, image);
+
+        if ( asynchronousLoading )
+        {
+            std::cout << " Decoding in the background." << std::endl;
+            decodingQueue.Add(name, image.GetFile());
+            return CreatePlaceholderTexture(name);
+        }
 
         auto texture = std::make_shared<SFMLTextureWrapper>();
         ResourcesLoader::Get()->LoadSFMLImage( image.GetFile(), texture->image );
@@ -69,6 +131,7 @@ std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(const gd::Strin
 
 bool ImageManager::HasLoadedSFMLTexture(const gd::String & name) const
 {
+    sf::Lock lock(mutex);
     if ( alreadyLoadedImages.find(name) != alreadyLoadedImages.end() && !alreadyLoadedImages.find(name)->second.expired() )
         return true;
 
@@ -77,6 +140,7 @@ bool ImageManager::HasLoadedSFMLTexture(const gd::String & name) const
 
 void ImageManager::SetSFMLTextureAsPermanentlyLoaded(const gd::String & name, std::shared_ptr<SFMLTextureWrapper> & texture) const
 {
+    sf::Lock lock(mutex);
     if ( alreadyLoadedImages.find(name) == alreadyLoadedImages.end() || alreadyLoadedImages.find(name)->second.expired() )
         alreadyLoadedImages[name] = texture;
 
@@ -86,6 +150,7 @@ void ImageManager::SetSFMLTextureAsPermanentlyLoaded(const gd::String & name, st
 
 void ImageManager::ReloadImage(const gd::String & name) const
 {
+    sf::Lock lock(mutex);
     if ( !resourcesManager )
     {
         std::cout << "ImageManager has no ResourcesManager associated with.";
@@ -101,6 +166,7 @@ void ImageManager::ReloadImage(const gd::String & name) const
     try
     {
         ImageResource & image = dynamic_cast<ImageResource&>(resourcesManager->GetResource(name));
+        if ( image.IsInAtlas() ) return; //Atlas pages are reloaded instead.
 
         std::cout << "ImageManager: Reload " << name << std::endl;
 
@@ -119,6 +185,7 @@ void ImageManager::ReloadImage(const gd::String & name) const
 
 std::shared_ptr<OpenGLTextureWrapper> ImageManager::GetOpenGLTexture(const gd::String & name) const
 {
+    sf::Lock lock(mutex);
     if ( alreadyLoadedOpenGLTextures.find(name) != alreadyLoadedOpenGLTextures.end() && !alreadyLoadedOpenGLTextures.find(name)->second.expired() )
         return alreadyLoadedOpenGLTextures.find(name)->second.lock();
 
@@ -131,6 +198,7 @@ std::shared_ptr<OpenGLTextureWrapper> ImageManager::GetOpenGLTexture(const gd::S
 
 void ImageManager::LoadPermanentImages()
 {
+    sf::Lock lock(mutex);
     if ( !resourcesManager )
     {
         std::cout << "ImageManager has no ResourcesManager associated with.";
@@ -157,6 +225,208 @@ void ImageManager::LoadPermanentImages()
     permanentlyLoadedImages = newPermanentlyLoadedImages;
 }
 
+void ImageManager::PreloadImages(const std::vector<gd::String> & names)
+{
+    sf::Lock lock(mutex);
+    if ( !resourcesManager )
+    {
+        std::cout << "ImageManager has no ResourcesManager associated with.";
+        return;
+    }
+
+    //Create a new list of preloaded images but do not delete now the old list
+    //so as not to unload images that are preloaded again.
+    std::map < gd::String, std::shared_ptr<SFMLTextureWrapper> > newPreloadedImages;
+    preloadingImages.clear();
+
+    for ( std::size_t i = 0;i < names.size();i++ )
+        PreloadImage(names[i], newPreloadedImages);
+
+    preloadedImages = newPreloadedImages;
+    preloadingImagesCount = preloadedImages.size() + preloadingImages.size();
+}
+
+void ImageManager::PreloadImage(const gd::String & name, std::map < gd::String, std::shared_ptr<SFMLTextureWrapper> > & newPreloadedImages)
+{
+    if ( alreadyLoadedImages.find(name) != alreadyLoadedImages.end() && !alreadyLoadedImages.find(name)->second.expired() )
+    {
+        newPreloadedImages[name] = alreadyLoadedImages.find(name)->second.lock();
+        return;
+    }
+
+    if ( decodingQueue.Contains(name) )
+    {
+        preloadingImages.insert(name);
+        return;
+    }
+
+    try
+    {
+        ImageResource & image = dynamic_cast<ImageResource&>(resourcesManager->GetResource(name));
+        if ( image.IsInAtlas() )
+        {
+            //Only the page containing the image has to be loaded.
+            if ( newPreloadedImages.find(image.atlasPage) == newPreloadedImages.end() &&
+                preloadingImages.find(image.atlasPage) == preloadingImages.end() )
+                PreloadImage(image.atlasPage, newPreloadedImages);
+
+            return;
+        }
+
+        decodingQueue.Add(name, image.GetFile());
+        preloadingImages.insert(name);
+    }
+    catch(...) { /*The resource is not an image, we don't care about it.*/}
+}
+
+std::size_t ImageManager::UploadDecodedImages(sf::Time budget)
+{
+    sf::Lock lock(mutex);
+    sf::Clock clock;
+    std::size_t uploadedCount = 0;
+
+    gd::String name;
+    sf::Image image;
+    while ( (uploadedCount == 0 || clock.getElapsedTime() < budget) && decodingQueue.TakeDecodedImage(name, image) )
+    {
+        CreateTexture(name, image);
+        uploadedCount++;
+    }
+
+    return uploadedCount;
+}
+
+std::size_t ImageManager::UploadAllPreloadingImages()
+{
+    sf::Lock lock(mutex);
+    std::size_t uploadedCount = 0;
+
+    //Copied as CreateTexture removes the images from preloadingImages.
+    std::set < gd::String > names = preloadingImages;
+    for (auto & name : names)
+    {
+        sf::Image image;
+        if ( decodingQueue.TakeImage(name, image) )
+        {
+            CreateTexture(name, image);
+            uploadedCount++;
+        }
+    }
+
+    preloadingImages.clear(); //Images not in the queue anymore can't be waited for.
+    return uploadedCount;
+}
+
+float ImageManager::GetPreloadingProgress() const
+{
+    sf::Lock lock(mutex);
+    if ( preloadingImagesCount == 0 || preloadingImages.size() > preloadingImagesCount ) return 1.0f;
+
+    return 1.0f - static_cast<float>(preloadingImages.size()) / static_cast<float>(preloadingImagesCount);
+}
+
+bool ImageManager::IsPreloadingFinished() const
+{
+    sf::Lock lock(mutex);
+    return preloadingImages.empty();
+}
+
+std::shared_ptr<SFMLTextureWrapper> ImageManager::CreatePlaceholderTexture(const gd::String & name) const
+{
+    //The placeholder draws the texture of the invalid image, like an image in an atlas page,
+    //so that no texture is created (GetSFMLTexture can be called from any thread).
+    auto texture = std::make_shared<SFMLTextureWrapper>();
+    texture->placeholder = true;
+    if ( badTexture )
+    {
+        texture->atlasPage = badTexture;
+        texture->atlasRect = badTexture->GetTextureRect();
+        texture->image = badTexture->image;
+    }
+
+    alreadyLoadedImages[name] = texture;
+    #if defined(GD_IDE_ONLY)
+    if ( preventUnloading ) unloadingPreventer.push_back(texture);
+    #endif
+
+    return texture;
+}
+
+std::shared_ptr<SFMLTextureWrapper> ImageManager::CreateTexture(const gd::String & name, const sf::Image & image) const
+{
+    //Update the placeholder returned by GetSFMLTexture if it is still used.
+    std::shared_ptr<SFMLTextureWrapper> texture;
+    if ( alreadyLoadedImages.find(name) != alreadyLoadedImages.end() )
+        texture = alreadyLoadedImages.find(name)->second.lock();
+    if ( !texture || !texture->IsPlaceholder() )
+        texture = std::make_shared<SFMLTextureWrapper>();
+
+    texture->placeholder = false;
+    texture->atlasPage.reset();
+    texture->image = image;
+    texture->texture.loadFromImage(texture->image);
+    if ( resourcesManager )
+    {
+        try
+        {
+            ImageResource & imageResource = dynamic_cast<ImageResource&>(resourcesManager->GetResource(name));
+            texture->texture.setSmooth(imageResource.smooth);
+        }
+        catch(...) { /*The resource is not an image anymore.*/}
+    }
+
+    alreadyLoadedImages[name] = texture;
+    #if defined(GD_IDE_ONLY)
+    if ( preventUnloading ) unloadingPreventer.push_back(texture);
+    #endif
+
+    if ( preloadingImages.erase(name) > 0 )
+        preloadedImages[name] = texture;
+
+    return texture;
+}
+
+std::shared_ptr<SFMLTextureWrapper> ImageManager::CreateAtlasTexture(const gd::String & name, const ImageResource & image) const
+{
+    //The page is loaded without placeholder, as the image is copied from it.
+    std::shared_ptr<SFMLTextureWrapper> page;
+    if ( HasLoadedSFMLTexture(image.atlasPage) )
+        page = alreadyLoadedImages.find(image.atlasPage)->second.lock();
+    if ( !page || page->IsPlaceholder() )
+    {
+        try
+        {
+            ImageResource & pageResource = dynamic_cast<ImageResource&>(resourcesManager->GetResource(image.atlasPage));
+
+            sf::Image pageImage;
+            if ( !decodingQueue.TakeImage(image.atlasPage, pageImage) )
+                ResourcesLoader::Get()->LoadSFMLImage(pageResource.GetFile(), pageImage);
+
+            page = CreateTexture(image.atlasPage, pageImage);
+        }
+        catch(...)
+        {
+            std::cout << "ImageManager: Atlas page " << image.atlasPage << " of " << name << " not found." << std::endl;
+            return badTexture;
+        }
+    }
+
+    auto texture = std::make_shared<SFMLTextureWrapper>();
+    texture->atlasPage = page;
+    texture->atlasRect = sf::IntRect(image.atlasX, image.atlasY, image.atlasWidth, image.atlasHeight);
+
+    //Keep a copy of the pixels of the image, used for pixel perfect collisions for example.
+    texture->image.create(image.atlasWidth, image.atlasHeight);
+    texture->image.copy(page->image, 0, 0, texture->atlasRect);
+
+    alreadyLoadedImages[name] = texture;
+    #if defined(GD_IDE_ONLY)
+    if ( preventUnloading ) unloadingPreventer.push_back(texture);
+    #endif
+
+    return texture;
+}
+
 #if defined(GD_IDE_ONLY)
 void ImageManager::PreventImagesUnloading()
 {
@@ -179,11 +449,13 @@ void ImageManager::EnableImagesUnloading()
 
 SFMLTextureWrapper::SFMLTextureWrapper(const sf::Texture & texture_) :
     texture(texture_),
-    image(texture.copyToImage())
+    image(texture.copyToImage()),
+    placeholder(false)
 {
 }
 
-SFMLTextureWrapper::SFMLTextureWrapper()
+SFMLTextureWrapper::SFMLTextureWrapper() :
+    placeholder(false)
 {
 }
 
@@ -191,6 +463,13 @@ SFMLTextureWrapper::~SFMLTextureWrapper()
 {
 }
 
+sf::IntRect SFMLTextureWrapper::GetTextureRect() const
+{
+    if ( atlasPage ) return atlasRect;
+
+    return sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y);
+}
+
 OpenGLTextureWrapper::OpenGLTextureWrapper(std::shared_ptr<SFMLTextureWrapper> sfmlTexture_)
 {
     sfmlTexture = sfmlTexture_;
@@ -9,13 +9,16 @@
 
 #include <iostream>
 #include <vector>
+#include <set>
 #include "GDCore/String.h"
+#include "GDCore/Project/ImageDecodingQueue.h"
 #include <memory>
 #include <memory>
 #include <SFML/System.hpp>
 #include <SFML/Graphics.hpp>
 #include <SFML/OpenGL.hpp>
 namespace gd { class ResourcesManager; }
+namespace gd { class ImageResource; }
 class OpenGLTextureWrapper;
 class SFMLTextureWrapper;
 #undef LoadImage //thx windows.h
@@ -31,6 +34,13 @@ namespace gd
  * Images are loaded dynamically when necessary, and are unloaded if there is no
  * more shared_ptr pointing on an image.
  *
+ * To avoid loading images when they are first used, images can be preloaded: they are
+ * decoded on background threads (see gd::ImageManager::PreloadImages) and the textures
+ * are then created, on the main thread, by gd::ImageManager::UploadDecodedImages.
+ *
+ * The manager can be used from several threads (for example when a scene is preloaded
+ * in the background by SceneStack::Preload).
+ *
  * You should in particular be interested by gd::ImageManager::GetOpenGLTexture and gd::ImageManager::GetSFMLTexture.
  *
  * \see SFMLTextureWrapper
@@ -42,7 +52,13 @@ class GD_CORE_API ImageManager
 {
 public:
     ImageManager();
-    virtual ~ImageManager() {};
+
+    /**
+     * \brief Copy the images loaded by another manager. Images being preloaded are not copied.
+     */
+    ImageManager(const ImageManager & other);
+    ImageManager & operator=(const ImageManager & other);
+    virtual ~ImageManager();
 
     /**
      * \brief Get a shared pointer to an OpenGL texture. The shared pointer must be kept alive as long as the texture is used.
@@ -54,6 +70,9 @@ public:
      *
      * For example, if the texture is used in an object, you should store the shared pointer in a member to make sure the texture
      * is available as long as the object is alive.
+     *
+     * If the image is being preloaded, this waits for it to be decoded, unless asynchronous
+     * loading is enabled (see gd::ImageManager::EnableAsynchronousLoading).
      */
     std::shared_ptr<SFMLTextureWrapper> GetSFMLTexture(const gd::String & name) const;
 
@@ -85,6 +104,68 @@ public:
      */
     void ReloadImage(const gd::String & name) const;
 
+    /** \name Preloading
+     * Members functions used to load images in the background.
+     */
+    ///@{
+    /**
+     * \brief Start to decode the specified images on background threads.
+     *
+     * The textures are created by UploadDecodedImages, which must be called regularly
+     * from the main thread. Images preloaded previously but not used yet are released.
+     *
+     * \see gd::Project::PreloadLayoutImages
+     */
+    void PreloadImages(const std::vector<gd::String> & names);
+
+    /**
+     * \brief Create the textures of the images decoded in the background, spending
+     * at most \a budget (at least one image is uploaded, if any is decoded).
+     *
+     * \note Must be called from the thread owning the OpenGL context, usually once per frame.
+     * \return The number of textures created.
+     */
+    std::size_t UploadDecodedImages(sf::Time budget);
+
+    /**
+     * \brief Create the textures of all the images given to PreloadImages, waiting
+     * for the images still being decoded (or decoding them on the calling thread).
+     *
+     * Used when the images are needed immediately, for example when a scene being
+     * preloaded is started: its objects then only find textures already created.
+     *
+     * \note Must be called from the thread owning the OpenGL context.
+     * \return The number of textures created.
+     */
+    std::size_t UploadAllPreloadingImages();
+
+    /**
+     * \brief Return the progress of the images preloading, between 0 and 1.
+     */
+    float GetPreloadingProgress() const;
+
+    /**
+     * \brief Return true if all the images given to PreloadImages have their texture created.
+     */
+    bool IsPreloadingFinished() const;
+
+    /**
+     * \brief When enabled, GetSFMLTexture returns immediately a placeholder showing
+     * the invalid image while the image is decoded in the background. The placeholder
+     * is updated in place by UploadDecodedImages.
+     *
+     * \note Objects caching the size of their images must refresh it once the placeholder
+     * is updated (see SFMLTextureWrapper::IsPlaceholder). RuntimeSpriteObject does it.
+     */
+    void EnableAsynchronousLoading(bool enable = true) { asynchronousLoading = enable; }
+
+    /**
+     * \brief Return true if asynchronous loading is enabled.
+     * \see gd::ImageManager::EnableAsynchronousLoading
+     */
+    bool IsAsynchronousLoadingEnabled() const { return asynchronousLoading; }
+    ///@}
+
     #if defined(GD_IDE_ONLY)
     /**
      * \brief When called, images won't be unloaded from memory until EnableImagesUnloading is called.
@@ -99,6 +180,28 @@ public:
     #endif
 
 private:
+    void Init(const ImageManager & other);
+
+    /**
+     * \brief Return a placeholder showing the invalid image, which is updated once the image is loaded.
+     */
+    std::shared_ptr<SFMLTextureWrapper> CreatePlaceholderTexture(const gd::String & name) const;
+
+    /**
+     * \brief Start to decode an image (or its atlas page), or keep it in \a newPreloadedImages if already loaded.
+     */
+    void PreloadImage(const gd::String & name, std::map < gd::String, std::shared_ptr<SFMLTextureWrapper> > & newPreloadedImages);
+
+    /**
+     * \brief Create (or update, if a placeholder was returned for it) the texture of an image.
+     */
+    std::shared_ptr<SFMLTextureWrapper> CreateTexture(const gd::String & name, const sf::Image & image) const;
+
+    /**
+     * \brief Create the texture of an image packed in an atlas, loading the atlas page if necessary.
+     */
+    std::shared_ptr<SFMLTextureWrapper> CreateAtlasTexture(const gd::String & name, const gd::ImageResource & image) const;
+
     mutable std::map < gd::String, std::weak_ptr<SFMLTextureWrapper> > alreadyLoadedImages; ///< Reference all images loaded in memory.
     mutable std::map < gd::String, std::shared_ptr<SFMLTextureWrapper> > permanentlyLoadedImages; ///< Contains (smart) pointers to images which should stay loaded even if they are not (currently) used.
 
@@ -120,6 +223,13 @@ private:
     mutable std::shared_ptr<SFMLTextureWrapper> badTexture;
     mutable std::shared_ptr<OpenGLTextureWrapper> badOpenGLTexture;
 
+    mutable gd::ImageDecodingQueue decodingQueue; ///< Images being decoded in the background.
+    mutable std::map < gd::String, std::shared_ptr<SFMLTextureWrapper> > preloadedImages; ///< Keep alive the preloaded images until they are used.
+    mutable std::set < gd::String > preloadingImages; ///< Images given to PreloadImages that have no texture yet.
+    std::size_t preloadingImagesCount; ///< The number of images given to the last call to PreloadImages.
+    bool asynchronousLoading; ///< True to return a placeholder for images not loaded yet.
+    mutable sf::Mutex mutex; ///< Protect the images, which can be requested from several threads.
+
     gd::ResourcesManager * resourcesManager;
 };
 
@@ -138,8 +248,33 @@ public:
     SFMLTextureWrapper();
     ~SFMLTextureWrapper();
 
-    sf::Texture texture;
+    /**
+     * \brief Return the texture to be used to draw the image: the atlas page if the image
+     * is packed in an atlas, \a texture otherwise.
+     */
+    const sf::Texture & GetTexture() const { return atlasPage ? atlasPage->texture : texture; }
+
+    /**
+     * \brief Return the area of GetTexture() covered by the image.
+     */
+    sf::IntRect GetTextureRect() const;
+
+    /**
+     * \brief Return true if the image is a part of an atlas page.
+     */
+    bool IsInAtlas() const { return atlasPage != std::shared_ptr<SFMLTextureWrapper>(); }
+
+    /**
+     * \brief Return true if the image is not loaded yet: the invalid image is displayed instead.
+     * \see gd::ImageManager::EnableAsynchronousLoading
+     */
+    bool IsPlaceholder() const { return placeholder; }
+
+    sf::Texture texture; ///< The texture of the image. Empty if the image is in an atlas: use GetTexture to draw it.
     sf::Image image; ///< Associated sfml image, used for pixel perfect collision for example. If you update the image, call LoadFromImage on texture to update it also.
+    std::shared_ptr<SFMLTextureWrapper> atlasPage; ///< The atlas page containing the image, if any.
+    sf::IntRect atlasRect; ///< The position of the image in the atlas page.
+    bool placeholder; ///< True while the image is being loaded.
 };
 
 /**
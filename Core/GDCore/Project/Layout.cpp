@@ -254,6 +254,14 @@ void Layout::SerializeTo(SerializerElement & element) const
         dataElement.SetAttribute("name", it->second->GetName());
         it->second->SerializeTo(dataElement);
     }
+
+    if ( !usedImages.empty() )
+    {
+        SerializerElement & usedImagesElement = element.AddChild("usedImages");
+        usedImagesElement.ConsiderAsArrayOf("image");
+        for (std::size_t i = 0;i < usedImages.size();++i)
+            usedImagesElement.AddChild("image").SetValue(usedImages[i]);
+    }
 }
 #endif
 
@@ -320,6 +328,15 @@ void Layout::UnserializeFrom(gd::Project & project, const SerializerElement & el
         }
 
     }
+
+    usedImages.clear();
+    if ( element.HasChild("usedImages") )
+    {
+        SerializerElement & usedImagesElement = element.GetChild("usedImages");
+        usedImagesElement.ConsiderAsArrayOf("image");
+        for (std::size_t i = 0; i < usedImagesElement.GetChildrenCount(); ++i)
+            usedImages.push_back(usedImagesElement.GetChild(i).GetValue().GetString());
+    }
 }
 
 void Layout::Init(const Layout & other)
@@ -338,6 +355,7 @@ void Layout::Init(const Layout & other)
     initialInstances = other.initialInstances;
     initialLayers = other.initialLayers;
     variables = other.GetVariables();
+    usedImages = other.usedImages;
 
     initialObjects = gd::Clone(other.initialObjects);
 
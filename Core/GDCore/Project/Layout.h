@@ -320,6 +320,20 @@ public:
      * Get OpenGL far clipping plan
      */
     float GetOpenGLZFar() const { return oglZFar; }
+
+    /**
+     * \brief Set the names of the images used by the objects of the layout.
+     *
+     * This list is filled when the game is exported, so that the images can be
+     * preloaded before the layout is launched (see gd::Project::PreloadLayoutImages).
+     */
+    void SetUsedImages(const std::vector<gd::String> & images) { usedImages = images; }
+
+    /**
+     * \brief Get the names of the images used by the objects of the layout.
+     * \see SetUsedImages
+     */
+    const std::vector<gd::String> & GetUsedImages() const { return usedImages; }
     ///@}
 
     /** \name Saving and loading
@@ -430,6 +444,7 @@ private:
     float                                       oglZNear; ///< OpenGL Near Z position
     float                                       oglZFar; ///< OpenGL Far Z position
     bool                                        disableInputWhenNotFocused; /// If set to true, the input must be disabled when the window do not have the focus.
+    std::vector<gd::String>                     usedImages; ///< Images used by the objects of the layout. Only filled for exported games.
     static gd::Layer                            badLayer; ///< Null object, returned when GetLayer can not find an appropriate layer.
     #if defined(GD_IDE_ONLY)
     EventsList                                  events; ///< Scene events
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <vector>
+#include <functional>
 #include "GDCore/String.h"
 #include <fstream>
 #include <stdio.h>
@@ -38,6 +39,7 @@
 #include "GDCore/Tools/Log.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/PolymorphicClone.h"
+#include "GDCore/Tools/ParallelTasks.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/Splitter.h"
 #include "Project.h"
@@ -67,7 +69,9 @@ Project::Project() :
     maxFPS(60),
     minFPS(10),
     verticalSync(false),
-    imageManager(std::make_shared<ImageManager>())
+    imageManager(std::make_shared<ImageManager>()),
+    loadingThreadsCount(1),
+    lazyLayoutsLoading(false)
     #if defined(GD_IDE_ONLY)
     ,useExternalSourceFiles(false),
     currentPlatform(NULL),
@@ -297,6 +301,44 @@ void Project::RemoveLayout(const gd::String & name)
     if ( scene == scenes.end() ) return;
 
     scenes.erase(scene);
+    layoutsElements.erase(name);
+    unloadedLayouts.erase(name);
+}
+
+bool Project::IsLayoutLoaded(const gd::String & name) const
+{
+    return unloadedLayouts.find(name) == unloadedLayouts.end();
+}
+
+bool Project::LoadLayout(const gd::String & name)
+{
+    if ( !HasLayoutNamed(name) ) return false;
+
+    std::set<gd::String>::iterator unloadedLayout = unloadedLayouts.find(name);
+    if ( unloadedLayout == unloadedLayouts.end() ) return true;
+
+    GetLayout(name).UnserializeFrom(*this, *layoutsElements[name]);
+    unloadedLayouts.erase(unloadedLayout);
+    return true;
+}
+
+void Project::UnloadLayout(const gd::String & name)
+{
+    if ( !HasLayoutNamed(name) || !IsLayoutLoaded(name) ) return;
+    if ( layoutsElements.find(name) == layoutsElements.end() ) return;
+
+    gd::Layout & layout = GetLayout(name);
+    layout = gd::Layout();
+    layout.SetName(name);
+    unloadedLayouts.insert(name);
+}
+
+bool Project::PreloadLayoutImages(const gd::String & name)
+{
+    if ( !LoadLayout(name) ) return false;
+
+    if ( imageManager ) imageManager->PreloadImages(GetLayout(name).GetUsedImages());
+    return true;
 }
 
 #if defined(GD_IDE_ONLY)
@@ -648,25 +690,30 @@ void Project::UnserializeFrom(const SerializerElement & element)
     UnserializeObjectsFrom(*this, element.GetChild("objects", 0, "Objects"));
     GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
+    //Layouts, external events and external layouts are first inserted in the project (in the
+    //order they were serialized), then unserialized, possibly on several threads.
+    std::vector<std::function<void()>> unserializationTasks;
+
     const SerializerElement & layoutsElement = element.GetChild("layouts", 0, "Scenes");
     layoutsElement.ConsiderAsArrayOf("layout", "Scene");
+    std::vector<gd::Layout*> unserializedLayouts;
     for(std::size_t i = 0;i<layoutsElement.GetChildrenCount();++i)
     {
         const SerializerElement & layoutElement = layoutsElement.GetChild(i);
 
         gd::Layout & layout = InsertNewLayout(layoutElement.GetStringAttribute("name", "", "nom"), -1);
-        layout.UnserializeFrom(*this, layoutElement);
-
-        //Compatibility code with GD 2.x
-        #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
-        if ( GDMajorVersion <= 2 )
+        if ( lazyLayoutsLoading )
         {
-            SpriteObjectsPositionUpdater updater(*this, layout);
-            gd::InitialInstancesContainer & instances = layout.GetInitialInstances();
-            instances.IterateOverInstances(updater);
+            //Keep the serialized layout, it will be unserialized by LoadLayout when needed.
+            layoutsElements[layout.GetName()] = std::make_shared<SerializerElement>(layoutElement);
+            unloadedLayouts.insert(layout.GetName());
+            continue;
         }
-        #endif
-        //End of compatibility code
+
+        unserializedLayouts.push_back(&layout);
+        unserializationTasks.push_back([this, &layout, &layoutElement]() {
+            layout.UnserializeFrom(*this, layoutElement);
+        });
     }
 
     #if defined(GD_IDE_ONLY)
@@ -678,7 +725,9 @@ void Project::UnserializeFrom(const SerializerElement & element)
 
         gd::ExternalEvents & externalEvents = InsertNewExternalEvents(externalEventElement.GetStringAttribute("name", "", "Name"),
             GetExternalEventsCount());
-        externalEvents.UnserializeFrom(*this, externalEventElement);
+        unserializationTasks.push_back([this, &externalEvents, &externalEventElement]() {
+            externalEvents.UnserializeFrom(*this, externalEventElement);
+        });
     }
     #endif
 
@@ -689,8 +738,28 @@ void Project::UnserializeFrom(const SerializerElement & element)
         const SerializerElement & externalLayoutElement = externalLayoutsElement.GetChild(i);
 
         gd::ExternalLayout & newExternalLayout = InsertNewExternalLayout("", GetExternalLayoutsCount());
-        newExternalLayout.UnserializeFrom(externalLayoutElement);
+        unserializationTasks.push_back([&newExternalLayout, &externalLayoutElement]() {
+            newExternalLayout.UnserializeFrom(externalLayoutElement);
+        });
+    }
+
+    gd::ParallelTasks::Run(unserializationTasks.size(), [&unserializationTasks](std::size_t i) {
+        unserializationTasks[i]();
+    }, loadingThreadsCount);
+
+    //Compatibility code with GD 2.x
+    #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
+    if ( GDMajorVersion <= 2 )
+    {
+        for (gd::Layout * layout : unserializedLayouts)
+        {
+            SpriteObjectsPositionUpdater updater(*this, *layout);
+            gd::InitialInstancesContainer & instances = layout->GetInitialInstances();
+            instances.IterateOverInstances(updater);
+        }
     }
+    #endif
+    //End of compatibility code
 
     #if defined(GD_IDE_ONLY)
     const SerializerElement & externalSourceFilesElement = element.GetChild("externalSourceFiles", 0, "ExternalSourceFiles");
@@ -1008,6 +1077,10 @@ void Project::Init(const gd::Project & game)
     maxFPS = game.maxFPS;
     minFPS = game.minFPS;
     verticalSync = game.verticalSync;
+    loadingThreadsCount = game.loadingThreadsCount;
+    lazyLayoutsLoading = game.lazyLayoutsLoading;
+    layoutsElements = game.layoutsElements;
+    unloadedLayouts = game.unloadedLayouts;
 
     #if defined(GD_IDE_ONLY)
     author = game.author;
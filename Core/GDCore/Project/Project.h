@@ -8,6 +8,8 @@
 #define GDCORE_PROJECT_H
 #include <memory>
 #include <vector>
+#include <map>
+#include <set>
 #include "GDCore/String.h"
 class wxPropertyGrid;
 class wxPropertyGridEvent;
@@ -373,9 +375,82 @@ public:
 
     /**
      * \brief Unserialize the project from an element.
+     *
+     * \see gd::Project::SetLoadingThreadsCount
      */
     void UnserializeFrom(const SerializerElement & element);
 
+    /**
+     * \brief Set the number of threads used to unserialize the layouts, external events
+     * and external layouts of the project.
+     *
+     * Project objects, variables and resources are always loaded first on the calling thread.
+     * Layouts, external events and external layouts are then unserialized concurrently, and
+     * stored in the same order as in the serialized project.
+     *
+     * \param threadsCount 1 to load everything on the calling thread (default), 0 to use as
+     * many threads as there are processors.
+     *
+     * \warning The unserialization of events (and of the objects, behaviors and events of
+     * extensions) has not been checked for thread safety: the IDE loads projects on a single thread.
+     */
+    void SetLoadingThreadsCount(std::size_t threadsCount) { loadingThreadsCount = threadsCount; }
+
+    /**
+     * \brief Get the number of threads used to unserialize the project.
+     * \see gd::Project::SetLoadingThreadsCount
+     */
+    std::size_t GetLoadingThreadsCount() const { return loadingThreadsCount; }
+
+    /**
+     * \brief Activate or deactivate the lazy loading of layouts.
+     *
+     * When activated, UnserializeFrom only creates empty layouts, and keeps the serialized layouts
+     * so that they are unserialized only when gd::Project::LoadLayout is called.
+     * This is intended to be used by the runtime, which only needs a few layouts at the same time.
+     */
+    void SetLazyLayoutsLoading(bool enable = true) { lazyLayoutsLoading = enable; }
+
+    /**
+     * \brief Return true if layouts are loaded lazily.
+     * \see gd::Project::SetLazyLayoutsLoading
+     */
+    bool IsLazyLayoutsLoadingEnabled() const { return lazyLayoutsLoading; }
+
+    /**
+     * \brief Return false if the layout called \a name exists but was not unserialized yet.
+     * \see gd::Project::SetLazyLayoutsLoading
+     */
+    bool IsLayoutLoaded(const gd::String & name) const;
+
+    /**
+     * \brief Unserialize the layout called \a name if it was not loaded yet.
+     * \return false if the layout does not exist.
+     * \see gd::Project::SetLazyLayoutsLoading
+     */
+    bool LoadLayout(const gd::String & name);
+
+    /**
+     * \brief Release the content of a layout that was loaded lazily. The layout is kept in the
+     * project, empty, and can be loaded again with gd::Project::LoadLayout.
+     *
+     * \note Nothing is done for layouts that were not loaded lazily.
+     */
+    void UnloadLayout(const gd::String & name);
+
+    /**
+     * \brief Start to decode, in the background, the images used by the layout called \a name,
+     * loading the layout if necessary.
+     *
+     * Call it before launching the layout to avoid a freeze while its textures are loaded.
+     * The progress is given by gd::ImageManager::GetPreloadingProgress.
+     *
+     * \return false if the layout does not exist.
+     * \see gd::Layout::GetUsedImages
+     * \see gd::ImageManager::PreloadImages
+     */
+    bool PreloadLayoutImages(const gd::String & name);
+
     #if defined(GD_IDE_ONLY)
     /**
      * \brief Called to serialize the project to a TiXmlElement.
@@ -731,6 +806,10 @@ private:
     std::vector < gd::String >                         extensionsUsed; ///< List of extensions used
     std::vector < gd::Platform* >                       platforms; ///< Pointers to the platforms this project supports.
     gd::String                                         firstLayout;
+    std::size_t                                         loadingThreadsCount; ///< The number of threads used by UnserializeFrom.
+    bool                                                lazyLayoutsLoading; ///< True to unserialize layouts only when LoadLayout is called.
+    std::map < gd::String, std::shared_ptr<gd::SerializerElement> > layoutsElements; ///< The serialized layouts, kept when they are loaded lazily.
+    std::set < gd::String >                            unloadedLayouts; ///< The layouts that are loaded lazily and not unserialized yet.
     #if defined(GD_IDE_ONLY)
     bool                                                useExternalSourceFiles; ///< True if game used external source files.
     std::vector < std::unique_ptr<gd::SourceFile> >   externalSourceFiles; ///< List of external source files used.
@@ -608,6 +608,12 @@ void ImageResource::UnserializeFrom(const SerializerElement & element)
     smooth = element.GetBoolAttribute("smoothed");
     SetUserAdded( element.GetBoolAttribute("userAdded") );
     SetFile(element.GetStringAttribute("file"));
+
+    atlasPage = element.GetStringAttribute("atlasPage");
+    atlasX = element.GetIntAttribute("atlasX");
+    atlasY = element.GetIntAttribute("atlasY");
+    atlasWidth = element.GetIntAttribute("atlasWidth");
+    atlasHeight = element.GetIntAttribute("atlasHeight");
 }
 
 #if defined(GD_IDE_ONLY)
@@ -617,6 +623,15 @@ void ImageResource::SerializeTo(SerializerElement & element) const
     element.SetAttribute("smoothed", smooth);
     element.SetAttribute("userAdded", IsUserAdded());
     element.SetAttribute("file", GetFile()); //Keep the resource path in the current locale (but save it in UTF8 for compatibility on other OSes)
+
+    if ( IsInAtlas() )
+    {
+        element.SetAttribute("atlasPage", atlasPage);
+        element.SetAttribute("atlasX", (int)atlasX);
+        element.SetAttribute("atlasY", (int)atlasY);
+        element.SetAttribute("atlasWidth", (int)atlasWidth);
+        element.SetAttribute("atlasHeight", (int)atlasHeight);
+    }
 }
 #endif
 
@@ -148,7 +148,7 @@ private:
 class GD_CORE_API ImageResource : public Resource
 {
 public:
-    ImageResource() : Resource(), smooth(true), alwaysLoaded(false) { SetKind("image"); };
+    ImageResource() : Resource(), smooth(true), alwaysLoaded(false), atlasX(0), atlasY(0), atlasWidth(0), atlasHeight(0) { SetKind("image"); };
     virtual ~ImageResource() {};
     virtual ImageResource* Clone() const { return new ImageResource(*this);}
 
@@ -214,8 +214,18 @@ public:
      */
     void UnserializeFrom(const SerializerElement & element);
 
+    /**
+     * \brief Return true if the image was packed into an atlas page (see gd::ImagesAtlasPacker).
+     */
+    bool IsInAtlas() const { return !atlasPage.empty(); }
+
     bool smooth; ///< True if smoothing filter is applied
     bool alwaysLoaded; ///< True if the image must always be loaded in memory.
+    gd::String atlasPage; ///< The name of the image containing this image when packed into an atlas, empty otherwise.
+    unsigned int atlasX; ///< X position of the image in its atlas page.
+    unsigned int atlasY; ///< Y position of the image in its atlas page.
+    unsigned int atlasWidth; ///< Width of the image in its atlas page.
+    unsigned int atlasHeight; ///< Height of the image in its atlas page.
 private:
     gd::String file;
 };
@@ -199,8 +199,18 @@ SerializerElement & SerializerElement::GetChild(gd::String name, std::size_t ind
 	return nullElement;
 }
 
+void SerializerElement::ConsiderAsArrayOf(const gd::String & name, const gd::String & deprecatedName) const
+{
+	if (this == &nullElement) return;
+
+	arrayOf = name;
+	deprecatedArrayOf = deprecatedName;
+}
+
 std::size_t SerializerElement::GetChildrenCount(gd::String name, gd::String deprecatedName) const
 {
+	if (children.empty()) return 0;
+
 	if (name.empty())
 	{
 		if ( arrayOf.empty() )
@@ -147,8 +147,10 @@ public:
      * the element will be serialized to an array.
      *
      * \param name The name of the children.
+     * \note Nothing is done when called on the null element returned for missing children,
+     * as it is shared (possibly by several threads) and must stay unchanged.
      */
-    void ConsiderAsArrayOf(const gd::String & name, const gd::String & deprecatedName = "") const { arrayOf = name; deprecatedArrayOf = deprecatedName; };
+    void ConsiderAsArrayOf(const gd::String & name, const gd::String & deprecatedName = "") const;
 
     /**
      * \brief Return the name of the children the element is considered an array of.
@@ -0,0 +1,73 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelTasks.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#if !defined(EMSCRIPTEN)
+#include <SFML/System/Thread.hpp>
+#endif
+#if defined(WINDOWS)
+#include "windows.h"
+#elif defined(LINUX) || defined(MACOS)
+#include <unistd.h>
+#endif
+
+namespace gd
+{
+
+void ParallelTasks::Run(std::size_t tasksCount, const std::function<void(std::size_t)> & task, std::size_t threadsCount)
+{
+    if (threadsCount == 0) threadsCount = GetProcessorsCount();
+    threadsCount = std::min(threadsCount, tasksCount);
+    #if defined(EMSCRIPTEN)
+    threadsCount = 1; //No threads available.
+    #endif
+
+    if (threadsCount <= 1)
+    {
+        for (std::size_t i = 0;i<tasksCount;++i)
+            task(i);
+
+        return;
+    }
+
+    #if !defined(EMSCRIPTEN)
+    std::atomic<std::size_t> nextTask(0);
+    auto worker = [&nextTask, &task, tasksCount]() {
+        for (std::size_t i = nextTask++;i<tasksCount;i = nextTask++)
+            task(i);
+    };
+
+    std::vector<std::unique_ptr<sf::Thread>> threads;
+    for (std::size_t i = 1;i<threadsCount;++i)
+    {
+        threads.push_back(std::unique_ptr<sf::Thread>(new sf::Thread(worker)));
+        threads.back()->launch();
+    }
+
+    worker(); //The calling thread is used as a worker too.
+    for (auto & thread : threads)
+        thread->wait();
+    #endif
+}
+
+std::size_t ParallelTasks::GetProcessorsCount()
+{
+#if defined(WINDOWS)
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return std::max<std::size_t>(1, systemInfo.dwNumberOfProcessors);
+#elif defined(LINUX) || defined(MACOS)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<std::size_t>(count) : 1;
+#else
+    return 1;
+#endif
+}
+
+}
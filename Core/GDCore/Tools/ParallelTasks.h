@@ -0,0 +1,50 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef GDCORE_PARALLELTASKS_H
+#define GDCORE_PARALLELTASKS_H
+#include <cstddef>
+#include <functional>
+
+namespace gd
+{
+
+/**
+ * \brief Tool class to run a set of independent tasks on several threads.
+ *
+ * Tasks are identified by their index and are distributed to the threads as soon
+ * as they are free. The calling thread works on the tasks too, and Run only returns
+ * when all the tasks are done.
+ *
+ * \note Tasks must not throw exceptions and must not share mutable state
+ * without synchronization.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API ParallelTasks
+{
+public:
+    /**
+     * \brief Run the task for each index between 0 and tasksCount - 1.
+     *
+     * \param tasksCount The number of tasks to be run.
+     * \param task The function called with the index of each task.
+     * \param threadsCount The maximum number of threads to use, including the calling thread.
+     * 0 to use as many threads as there are processors, 1 to run all tasks on the calling thread.
+     */
+    static void Run(std::size_t tasksCount, const std::function<void(std::size_t)> & task, std::size_t threadsCount = 0);
+
+    /**
+     * \brief Return the number of processors available on the system (at least 1).
+     */
+    static std::size_t GetProcessorsCount();
+
+private:
+    ParallelTasks() {};
+    virtual ~ParallelTasks() {};
+};
+
+}
+#endif // GDCORE_PARALLELTASKS_H
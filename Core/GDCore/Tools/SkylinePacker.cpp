@@ -0,0 +1,104 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCore/Tools/SkylinePacker.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace gd
+{
+
+SkylinePacker::SkylinePacker(unsigned int width_, unsigned int height_) :
+    width(width_),
+    height(height_),
+    usedWidth(0),
+    usedHeight(0)
+{
+    Segment segment = {0, 0, width};
+    skyline.push_back(segment);
+}
+
+bool SkylinePacker::Fits(std::size_t i, unsigned int rectWidth, unsigned int rectHeight, unsigned int & y) const
+{
+    if ( skyline[i].x + rectWidth > width ) return false;
+
+    y = skyline[i].y;
+    unsigned int widthLeft = rectWidth;
+    while ( widthLeft > 0 )
+    {
+        if ( i >= skyline.size() ) return false;
+
+        y = std::max(y, skyline[i].y);
+        if ( y + rectHeight > height ) return false;
+
+        widthLeft -= std::min(widthLeft, skyline[i].width);
+        ++i;
+    }
+
+    return true;
+}
+
+bool SkylinePacker::Insert(unsigned int rectWidth, unsigned int rectHeight, unsigned int & x, unsigned int & y)
+{
+    if ( rectWidth == 0 || rectHeight == 0 || rectWidth > width || rectHeight > height ) return false;
+
+    //Find the position where the top of the rectangle is the lowest (then the leftmost).
+    std::size_t bestIndex = skyline.size();
+    unsigned int bestTop = 0;
+    unsigned int bestY = 0;
+    for (std::size_t i = 0;i < skyline.size();++i)
+    {
+        unsigned int candidateY = 0;
+        if ( Fits(i, rectWidth, rectHeight, candidateY) &&
+            (bestIndex == skyline.size() || candidateY + rectHeight < bestTop) )
+        {
+            bestIndex = i;
+            bestY = candidateY;
+            bestTop = candidateY + rectHeight;
+        }
+    }
+
+    if ( bestIndex == skyline.size() ) return false;
+
+    x = skyline[bestIndex].x;
+    y = bestY;
+
+    //Add the top of the rectangle to the skyline, and shrink or remove the segments below it.
+    Segment segment = {x, bestTop, rectWidth};
+    skyline.insert(skyline.begin() + bestIndex, segment);
+    for (std::size_t i = bestIndex + 1;i < skyline.size();)
+    {
+        unsigned int rectRight = x + rectWidth;
+        if ( skyline[i].x >= rectRight ) break;
+
+        unsigned int shrink = rectRight - skyline[i].x;
+        if ( skyline[i].width <= shrink )
+            skyline.erase(skyline.begin() + i);
+        else
+        {
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+            break;
+        }
+    }
+
+    //Merge the neighbour segments at the same height.
+    for (std::size_t i = 0;i + 1 < skyline.size();)
+    {
+        if ( skyline[i].y == skyline[i + 1].y )
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+            ++i;
+    }
+
+    usedWidth = std::max(usedWidth, x + rectWidth);
+    usedHeight = std::max(usedHeight, bestTop);
+    return true;
+}
+
+}
@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef GDCORE_SKYLINEPACKER_H
+#define GDCORE_SKYLINEPACKER_H
+#include <vector>
+
+namespace gd
+{
+
+/**
+ * \brief Pack rectangles into a larger rectangle (a "page") using the skyline
+ * bottom-left algorithm.
+ *
+ * The packer keeps the top edge (the "skyline") of the rectangles already placed, and
+ * places each new rectangle at the position where its top is the lowest.
+ * Rectangles are never rotated. For best results, insert the highest rectangles first.
+ *
+ * \see gd::ImagesAtlasPacker
+ * \ingroup Tools
+ */
+class GD_CORE_API SkylinePacker
+{
+public:
+    SkylinePacker(unsigned int width, unsigned int height);
+    virtual ~SkylinePacker() {};
+
+    /**
+     * \brief Find a position for a rectangle of the specified size.
+     * \return true if the rectangle was placed, its position being stored in \a x and \a y.
+     */
+    bool Insert(unsigned int width, unsigned int height, unsigned int & x, unsigned int & y);
+
+    /**
+     * \brief Return the width of the page.
+     */
+    unsigned int GetWidth() const { return width; }
+
+    /**
+     * \brief Return the height of the page.
+     */
+    unsigned int GetHeight() const { return height; }
+
+    /**
+     * \brief Return the width actually used by the rectangles inserted.
+     */
+    unsigned int GetUsedWidth() const { return usedWidth; }
+
+    /**
+     * \brief Return the height actually used by the rectangles inserted.
+     */
+    unsigned int GetUsedHeight() const { return usedHeight; }
+
+private:
+    struct Segment
+    {
+        unsigned int x;
+        unsigned int y;
+        unsigned int width;
+    };
+
+    /**
+     * \brief Check if a rectangle can be placed with its left side on the segment at index \a i.
+     * \return true if it fits, the lowest possible position being stored in \a y.
+     */
+    bool Fits(std::size_t i, unsigned int rectWidth, unsigned int rectHeight, unsigned int & y) const;
+
+    std::vector<Segment> skyline; ///< The segments of the skyline, from left to right.
+    unsigned int width;
+    unsigned int height;
+    unsigned int usedWidth;
+    unsigned int usedHeight;
+};
+
+}
+
+#endif // GDCORE_SKYLINEPACKER_H
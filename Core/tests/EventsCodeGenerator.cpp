@@ -12,7 +12,11 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include <memory>
 
 TEST_CASE( "EventsCodeGenerator", "[common][events]" ) {
@@ -24,4 +28,110 @@ TEST_CASE( "EventsCodeGenerator", "[common][events]" ) {
 
         REQUIRE(codeGenerator.ConvertToString("Hello \"world\"!\nThis is a backslash \\") == "Hello \\\"world\\\"!\\nThis is a backslash \\\\");
     }
+    SECTION("Useless events") {
+        gd::Platform platform;
+        std::shared_ptr<gd::PlatformExtension> extension = std::make_shared<gd::PlatformExtension>();
+        extension->AddCondition("Paused", "", "", "", "", "", "")
+            .SetFunctionName("IsPaused");
+        extension->AddCondition("Once", "", "", "", "", "", "")
+            .codeExtraInformation.SetCustomCodeGenerator([](gd::Instruction &, gd::EventsCodeGenerator &, gd::EventsCodeGenerationContext &) {
+                return "conditionTrue = Once();\n";
+            });
+        platform.AddExtension(extension);
+
+        gd::Project project;
+        gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+        gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+        gd::StandardEvent emptyEvent;
+        gd::StandardEvent disabledEvent;
+        disabledEvent.GetActions().Insert(gd::Instruction("Action"));
+        disabledEvent.SetDisabled();
+        gd::StandardEvent event;
+        event.GetActions().Insert(gd::Instruction("Action"));
+        gd::StandardEvent eventWithSubEvents;
+        eventWithSubEvents.GetSubEvents().InsertEvent(emptyEvent);
+        gd::StandardEvent eventWithConditions;
+        eventWithConditions.GetConditions().Insert(gd::Instruction("Paused"));
+        gd::StandardEvent eventWithCustomCondition;
+        eventWithCustomCondition.GetConditions().Insert(gd::Instruction("Paused"));
+        eventWithCustomCondition.GetConditions().Insert(gd::Instruction("Once"));
+
+        REQUIRE(codeGenerator.IsUselessEvent(emptyEvent) == true);
+        REQUIRE(codeGenerator.IsUselessEvent(disabledEvent) == true);
+        REQUIRE(codeGenerator.IsUselessEvent(event) == false);
+        REQUIRE(codeGenerator.IsUselessEvent(eventWithSubEvents) == false);
+        REQUIRE(codeGenerator.IsUselessEvent(eventWithConditions) == true);
+        REQUIRE(codeGenerator.IsUselessEvent(eventWithCustomCondition) == false);
+
+        //Only events which are not executable or disabled are deleted.
+        eventWithSubEvents.GetSubEvents().InsertEvent(disabledEvent);
+        gd::EventsList events;
+        events.InsertEvent(emptyEvent);
+        events.InsertEvent(eventWithSubEvents);
+        events.InsertEvent(disabledEvent);
+        gd::EventsCodeGenerator::DeleteUselessEvents(events);
+        REQUIRE(events.size() == 2);
+        REQUIRE(events[1].GetSubEvents().size() == 1);
+
+        //Useless events are not generated.
+        gd::EventsCodeGenerationContext context;
+        gd::EventsList generatedEvents;
+        generatedEvents.InsertEvent(eventWithConditions);
+        REQUIRE(codeGenerator.GenerateEventsListCode(generatedEvents, context).find("IsPaused") == gd::String::npos);
+        generatedEvents.InsertEvent(eventWithCustomCondition);
+        REQUIRE(codeGenerator.GenerateEventsListCode(generatedEvents, context).find("IsPaused") != gd::String::npos);
+    }
+    SECTION("Invariant conditions") {
+        gd::Platform platform;
+        std::shared_ptr<gd::PlatformExtension> extension = std::make_shared<gd::PlatformExtension>();
+        extension->AddCondition("Paused", "", "", "", "", "", "")
+            .SetFunctionName("IsPaused");
+        extension->AddCondition("KeyPressed", "", "", "", "", "", "")
+            .SetCostHint(1)
+            .SetFunctionName("IsKeyPressed");
+        extension->AddCondition("Collision", "", "", "", "", "", "")
+            .AddParameter("objectList", "")
+            .SetFunctionName("Collision");
+        extension->AddCondition("Once", "", "", "", "", "", "")
+            .codeExtraInformation.SetCustomCodeGenerator([](gd::Instruction &, gd::EventsCodeGenerator &, gd::EventsCodeGenerationContext &) {
+                return "conditionTrue = Once();\n";
+            });
+        extension->AddCondition("Late", "", "", "", "", "", "")
+            .SetFunctionName("Late");
+        platform.AddExtension(extension);
+
+        gd::Project project;
+        gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+        gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+        gd::EventsCodeGenerationContext context;
+
+        gd::StandardEvent event;
+        event.GetConditions().Insert(gd::Instruction("Collision", {gd::Expression("MyObject")}));
+        event.GetConditions().Insert(gd::Instruction("Paused"));
+        event.GetConditions().Insert(gd::Instruction("KeyPressed"));
+        event.GetConditions().Insert(gd::Instruction("Once"));
+        event.GetConditions().Insert(gd::Instruction("Late"));
+        event.GetActions().Insert(gd::Instruction("Action"));
+        gd::EventsList events;
+        events.InsertEvent(event);
+
+        gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+
+        //Conditions not using objects and before "Once" are evaluated first, the cheapest first.
+        auto & conditions = dynamic_cast<gd::StandardEvent&>(events[0]).GetConditions();
+        REQUIRE(conditions.size() == 3);
+        REQUIRE(conditions[0].GetType() == "Collision");
+        REQUIRE(conditions[1].GetType() == "Once");
+        REQUIRE(conditions[2].GetType() == "Late");
+
+        std::size_t keyPressed = code.find("condition0IsTrue = IsKeyPressed();");
+        std::size_t paused = code.find("condition1IsTrue = IsPaused();");
+        std::size_t predicat = code.find("if (condition0IsTrue && condition1IsTrue)");
+        REQUIRE(keyPressed != gd::String::npos);
+        REQUIRE(paused != gd::String::npos);
+        REQUIRE(predicat != gd::String::npos);
+        REQUIRE(keyPressed < paused);
+        REQUIRE(paused < predicat);
+    }
 }
@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the folding of constants in the code generated from expressions.
+ */
+#include "catch.hpp"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Events/Parsers/ExpressionParser.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeTree.h"
+#include "GDCore/Events/CodeGeneration/ExpressionsCodeGeneration.h"
+#include <memory>
+
+namespace
+{
+    gd::String FoldCode(const gd::String & code)
+    {
+        gd::ExpressionCodeTree tree;
+        tree.AddCode(code);
+        return tree.GenerateCode();
+    }
+
+    double ToRad(double angle) { return angle*3.1415926/180.0; }
+}
+
+TEST_CASE( "ExpressionCodeTree", "[common][events]" ) {
+    SECTION("Constants") {
+        REQUIRE(FoldCode("360/60") == "6");
+        REQUIRE(FoldCode("1+2*3") == "7");
+        REQUIRE(FoldCode("(1+2)*3") == "9");
+        REQUIRE(FoldCode("-2*3") == "-6");
+        REQUIRE(FoldCode("10-(2+3)") == "5");
+        REQUIRE(FoldCode("7 % 4") == "3");
+        REQUIRE(FoldCode("1.5*2") == "3.0");
+        REQUIRE(FoldCode("1/2.0") == "0.5");
+        REQUIRE(FoldCode("2e3") == "2000.0");
+    }
+    SECTION("Operations keeping their result") {
+        //Integer divisions and modulo are only folded when they give the same result.
+        REQUIRE(FoldCode("1/2") == "1/2");
+        REQUIRE(FoldCode("1/0") == "1/0");
+        REQUIRE(FoldCode("5.5%2") == "5.5%2");
+        REQUIRE(FoldCode("2147483647+1") == "2147483647+1");
+    }
+    SECTION("Function calls") {
+        gd::ExpressionCodeTree tree;
+        tree.AddCode("2*3+");
+        tree.AddFunctionCall("GetX()");
+        tree.AddCode("*(4-1)");
+        REQUIRE(tree.GenerateCode() == "6+GetX()*3");
+
+        //Operations are never reordered.
+        gd::ExpressionCodeTree sum;
+        sum.AddFunctionCall("GetX()");
+        sum.AddCode("+1+2");
+        REQUIRE(sum.GenerateCode() == "GetX()+1+2");
+
+        gd::ExpressionCodeTree negated;
+        negated.AddFunctionCall("GetX()");
+        negated.AddCode("-(3-5)");
+        REQUIRE(negated.GenerateCode() == "GetX()-(-2)");
+
+        gd::ExpressionCodeTree constant;
+        constant.AddCode("2*");
+        constant.AddConstant(0.25);
+        REQUIRE(constant.GenerateCode() == "0.5");
+    }
+    SECTION("Constant values") {
+        double value = 0;
+        REQUIRE(gd::ExpressionCodeTree::GetConstantValue("(-45)", value));
+        REQUIRE(value == -45);
+        REQUIRE(gd::ExpressionCodeTree::GetConstantValue(gd::ExpressionCodeTree::GenerateNumber(0.1, false), value));
+        REQUIRE(value == 0.1);
+        REQUIRE(!gd::ExpressionCodeTree::GetConstantValue("GetX()", value));
+        REQUIRE(!gd::ExpressionCodeTree::GetConstantValue("1/2", value));
+    }
+    SECTION("Code generation") {
+        gd::Platform platform;
+        std::shared_ptr<gd::PlatformExtension> extension = std::make_shared<gd::PlatformExtension>();
+        extension->AddExpression("ToRad", "", "", "", "")
+            .AddParameter("expression", "")
+            .SetPure()
+            .SetFunctionName("ToRad")
+            .SetConstantEvaluator(&ToRad);
+        extension->AddExpression("Random", "", "", "", "")
+            .AddParameter("expression", "")
+            .SetFunctionName("Random");
+        platform.AddExtension(extension);
+
+        gd::Project project;
+        gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+        gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+        gd::EventsCodeGenerationContext context;
+
+        auto generate = [&](const gd::String & expression) {
+            gd::String code;
+            gd::CallbacksForGeneratingExpressionCode callbacks(code, codeGenerator, context);
+            gd::ExpressionParser parser(expression);
+            REQUIRE(parser.ParseMathExpression(platform, project, layout, callbacks));
+            return code;
+        };
+
+        REQUIRE(generate("360/60*ToRad(45)") == gd::ExpressionCodeTree::GenerateNumber(6*ToRad(45), false));
+        REQUIRE(generate("ToRad(90*2)") == gd::ExpressionCodeTree::GenerateNumber(ToRad(180), false));
+
+        //Functions which are not pure are always called.
+        REQUIRE(generate("Random(10/2)+1") == "Random(5)+1");
+        REQUIRE(generate("ToRad(Random(3))") == "ToRad(Random(3))");
+    }
+}
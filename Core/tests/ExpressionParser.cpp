@@ -0,0 +1,270 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the parsing of expressions and the trees kept in gd::Expression.
+ */
+#include "catch.hpp"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Parsers/ExpressionParser.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/Events/EventsVariablesFinder.h"
+#include <chrono>
+#include <memory>
+
+namespace
+{
+
+/**
+ * \brief Describe the tokens and functions found in an expression.
+ */
+class CallbacksForDescribingExpression : public gd::ParserCallbacks
+{
+public:
+    CallbacksForDescribingExpression(gd::String & description_) : description(description_) {};
+    virtual ~CallbacksForDescribingExpression() {};
+
+    virtual void OnConstantToken(gd::String text) { description += "["+text+"]"; }
+    virtual void OnStaticFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        DescribeFunction("static "+functionName, parameters);
+    }
+    virtual void OnObjectFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        DescribeFunction("object "+functionName, parameters);
+    }
+    virtual void OnObjectBehaviorFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        DescribeFunction("behavior "+functionName, parameters);
+    }
+
+    virtual bool OnSubMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        gd::String subDescription;
+        CallbacksForDescribingExpression callbacks(subDescription);
+
+        gd::ExpressionParser parser(expression);
+        bool valid = parser.ParseMathExpression(platform, project, layout, callbacks);
+        description += "{"+subDescription+"}";
+        if ( !valid )
+        {
+            firstErrorStr = parser.firstErrorStr;
+            firstErrorPos = parser.firstErrorPos;
+        }
+
+        return valid;
+    }
+
+    virtual bool OnSubTextExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        gd::String subDescription;
+        CallbacksForDescribingExpression callbacks(subDescription);
+
+        gd::ExpressionParser parser(expression);
+        bool valid = parser.ParseStringExpression(platform, project, layout, callbacks);
+        description += "{"+subDescription+"}";
+        if ( !valid )
+        {
+            firstErrorStr = parser.firstErrorStr;
+            firstErrorPos = parser.firstErrorPos;
+        }
+
+        return valid;
+    }
+
+private:
+    void DescribeFunction(const gd::String & name, const std::vector<gd::Expression> & parameters)
+    {
+        description += name+"(";
+        for (std::size_t i = 0;i<parameters.size();++i)
+            description += (i != 0 ? "," : "")+parameters[i].GetPlainString();
+        description += ")";
+    }
+
+    gd::String & description;
+};
+
+gd::String Describe(gd::ExpressionParser & parser, bool stringExpression, const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout)
+{
+    gd::String description;
+    CallbacksForDescribingExpression callbacks(description);
+    bool valid = stringExpression ?
+        parser.ParseStringExpression(platform, project, layout, callbacks) :
+        parser.ParseMathExpression(platform, project, layout, callbacks);
+
+    if ( !valid ) description += " error at "+gd::String::From(parser.firstErrorPos)+": "+parser.firstErrorStr;
+    return description;
+}
+
+void SetupPlatform(gd::Platform & platform)
+{
+    std::shared_ptr<gd::PlatformExtension> extension = std::make_shared<gd::PlatformExtension>();
+    extension->AddExpression("Abs", "", "", "", "").AddParameter("expression", "");
+    extension->AddStrExpression("ToString", "", "", "", "").AddParameter("expression", "");
+    extension->AddAction("Do", "", "", "", "", "", "")
+        .AddParameter("expression", "")
+        .AddParameter("string", "");
+
+    gd::ObjectMetadata & sprite = extension->AddObject<gd::Object>("Sprite", "", "", "");
+    sprite.AddExpression("X", "", "", "", "").AddParameter("object", "");
+    sprite.AddExpression("Variable", "", "", "", "").AddParameter("object", "").AddParameter("objectvar", "");
+    sprite.AddStrExpression("Name", "", "", "", "").AddParameter("object", "");
+    platform.AddExtension(extension);
+}
+
+gd::Object & InsertSprite(gd::Layout & layout, const gd::String & name)
+{
+    gd::Object object(name);
+    object.SetType("Sprite");
+    return layout.InsertObject(object, layout.GetObjectsCount());
+}
+
+}
+
+TEST_CASE( "ExpressionParser", "[common][events]" ) {
+    gd::Platform platform;
+    SetupPlatform(platform);
+
+    gd::Project project;
+    gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+    InsertSprite(layout, "Player");
+
+    SECTION("Trees give the same results as parsing") {
+        std::vector<gd::String> mathExpressions = {"1+Abs(-2)", "Player.X()*2", "Player.Unknown()+3", "cos(Abs(Player.X()))",
+            "Abs(1, 2)", "Abs(Player.X(", "2+", "Abs(2+)+1", "Abs()"};
+        for (std::size_t i = 0;i<mathExpressions.size();++i)
+        {
+            gd::ExpressionParser stringParser(mathExpressions[i]);
+            gd::String description = Describe(stringParser, false, platform, project, layout);
+
+            gd::Expression expression(mathExpressions[i]);
+            gd::ExpressionParser parser(expression);
+            REQUIRE(Describe(parser, false, platform, project, layout) == description);
+            gd::ExpressionParser parserUsingTree(expression);
+            REQUIRE(Describe(parserUsingTree, false, platform, project, layout) == description);
+            gd::Expression copiedExpression = expression;
+            gd::ExpressionParser parserUsingCopiedTree(copiedExpression);
+            REQUIRE(Describe(parserUsingCopiedTree, false, platform, project, layout) == description);
+        }
+
+        std::vector<gd::String> stringExpressions = {"\"Hello \"+ToString(Player.X())", "Player.Name()+\"!\"", "ToString(",
+            "ToString(2+)", "\"a\" \"b\"", "Unknown()"};
+        for (std::size_t i = 0;i<stringExpressions.size();++i)
+        {
+            gd::ExpressionParser stringParser(stringExpressions[i]);
+            gd::String description = Describe(stringParser, true, platform, project, layout);
+
+            gd::Expression expression(stringExpressions[i]);
+            gd::ExpressionParser parser(expression);
+            REQUIRE(Describe(parser, true, platform, project, layout) == description);
+            gd::ExpressionParser parserUsingTree(expression);
+            REQUIRE(Describe(parserUsingTree, true, platform, project, layout) == description);
+        }
+
+        gd::ExpressionParser parser(gd::Expression("Abs(Player.X())"));
+        REQUIRE(Describe(parser, false, platform, project, layout) == "{[]object X(Player)}[]static Abs(Player.X())");
+    }
+    SECTION("Trees are built again when objects change") {
+        gd::Expression expression("Player.X()+1");
+        gd::ExpressionParser parser(expression);
+        REQUIRE(Describe(parser, false, platform, project, layout) == "[]object X(Player)[+1]");
+
+        //The object is not a sprite anymore: X is not one of its expressions.
+        layout.GetObject("Player").SetType("");
+        gd::ExpressionParser parserWithBaseObject(expression);
+        REQUIRE(Describe(parserWithBaseObject, false, platform, project, layout) == "[Player.X()+1] error at 0: Syntax error");
+
+        layout.GetObject("Player").SetType("Sprite");
+        gd::ExpressionParser parserWithSprite(expression);
+        REQUIRE(Describe(parserWithSprite, false, platform, project, layout) == "[]object X(Player)[+1]");
+
+        //Another layout without the object.
+        gd::Layout & otherLayout = project.InsertNewLayout("Other scene", 1);
+        gd::ExpressionParser parserInOtherLayout(expression);
+        REQUIRE(Describe(parserInOtherLayout, false, platform, project, otherLayout) == "[Player.X()+1] error at 0: Syntax error");
+    }
+    SECTION("Refactoring") {
+        InsertSprite(layout, "Enemy");
+
+        gd::Instruction action("Do");
+        action.SetParametersCount(2);
+        action.SetParameter(0, gd::Expression("Player.X()+Abs(Enemy.Variable(Life))"));
+        action.SetParameter(1, gd::Expression("ToString(Player.X())"));
+        gd::StandardEvent event;
+        event.GetActions().Insert(action);
+        layout.GetEvents().InsertEvent(event);
+
+        std::set<gd::String> variables = gd::EventsVariablesFinder::FindAllObjectVariables(platform, project, layout, layout.GetObject("Enemy"));
+        REQUIRE(variables.size() == 1);
+        REQUIRE(*variables.begin() == "Life");
+
+        gd::EventsRefactorer::RenameObjectInEvents(platform, project, layout, layout.GetEvents(), "Player", "Hero");
+        gd::Instruction & renamedAction = dynamic_cast<gd::StandardEvent&>(layout.GetEvents().GetEvent(0)).GetActions()[0];
+        REQUIRE(renamedAction.GetParameter(0).GetPlainString() == "Hero.X()+Abs(Enemy.Variable(Life))");
+        REQUIRE(renamedAction.GetParameter(1).GetPlainString() == "ToString(Hero.X())");
+
+        //Expressions not using the object are kept.
+        gd::EventsRefactorer::RenameObjectInEvents(platform, project, layout, layout.GetEvents(), "Unused", "Other");
+        REQUIRE(renamedAction.GetParameter(0).GetPlainString() == "Hero.X()+Abs(Enemy.Variable(Life))");
+    }
+}
+
+TEST_CASE( "ExpressionParser refactoring benchmark", "[benchmark][.]" ) {
+    gd::Platform platform;
+    SetupPlatform(platform);
+
+    gd::Project project;
+    gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+    const std::size_t objectsCount = 50;
+    for (std::size_t i = 0;i<objectsCount;++i)
+        InsertSprite(layout, "Enemy"+gd::String::From(i));
+    InsertSprite(layout, "Player");
+
+    const std::size_t eventsCount = 20000;
+    for (std::size_t i = 0;i<eventsCount;++i)
+    {
+        gd::String enemy = "Enemy"+gd::String::From(i%objectsCount);
+
+        gd::Instruction action("Do");
+        action.SetParametersCount(2);
+        action.SetParameter(0, gd::Expression("Player.X()+Abs("+enemy+".Variable(Life)*2)-cos("+gd::String::From(i)+")"));
+        action.SetParameter(1, gd::Expression("\"Enemy: \"+"+enemy+".Name()+ToString(Abs("+enemy+".X()))"));
+        gd::StandardEvent event;
+        event.GetActions().Insert(action);
+        event.GetActions().Insert(action);
+        layout.GetEvents().InsertEvent(event);
+    }
+
+    //Walk all the expressions several times, like the IDE does when it opens the events or refactors them.
+    auto refactor = [&]() {
+        gd::EventsRefactorer::RenameObjectInEvents(platform, project, layout, layout.GetEvents(), "Unused", "Other");
+        return gd::EventsVariablesFinder::FindAllObjectVariables(platform, project, layout, layout.GetObject("Enemy0"));
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::set<gd::String> firstVariables = refactor();
+    auto firstDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    std::set<gd::String> variables;
+    for (std::size_t i = 0;i<5;++i)
+        variables = refactor();
+    auto cachedDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    REQUIRE(firstVariables == variables);
+    REQUIRE(variables.size() == 1);
+    WARN("Refactoring " << 4*eventsCount << " expressions: " << firstDuration.count()
+        << " milliseconds when parsed, " << cachedDuration.count()/5 << " milliseconds with the trees kept in the expressions");
+}
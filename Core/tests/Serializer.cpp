@@ -17,6 +17,7 @@
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Serialization.h"
+#include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/Splitter.h"
 
@@ -114,4 +115,46 @@ TEST_CASE( "Serializer", "[common]" ) {
             REQUIRE(root.GetChild("layouts").GetChild(2).GetChild("child").GetValue().GetInt() == 42);
         }
     }
+
+    SECTION("Project loaded on several threads") {
+        gd::Project project;
+        for(auto i = 0;i<20;++i) {
+            gd::Layout & layout = project.InsertNewLayout("layout" + gd::String::From(i), i);
+            layout.GetVariables().Get("index").SetValue(i);
+            project.InsertNewExternalLayout("externalLayout" + gd::String::From(i), i);
+        }
+
+        SerializerElement element;
+        project.SerializeTo(element);
+
+        gd::Project loadedProject;
+        loadedProject.SetLoadingThreadsCount(4);
+        loadedProject.UnserializeFrom(element);
+
+        REQUIRE(loadedProject.GetLayoutsCount() == 20);
+        REQUIRE(loadedProject.GetExternalLayoutsCount() == 20);
+        for(std::size_t i = 0;i<20;++i) {
+            REQUIRE(loadedProject.GetLayout(i).GetName() == "layout" + gd::String::From(i));
+            REQUIRE(loadedProject.GetLayout(i).GetVariables().Get("index").GetValue() == i);
+            REQUIRE(loadedProject.GetExternalLayout(i).GetName() == "externalLayout" + gd::String::From(i));
+        }
+    }
+
+    SECTION("Images used by a layout") {
+        gd::Project project;
+        gd::Layout & layout = project.InsertNewLayout("layout", 0);
+        project.InsertNewLayout("layoutWithoutImages", 1);
+        layout.SetUsedImages({"image1", "image2"});
+
+        SerializerElement element;
+        project.SerializeTo(element);
+
+        gd::Project loadedProject;
+        loadedProject.UnserializeFrom(element);
+
+        REQUIRE(loadedProject.GetLayout("layout").GetUsedImages().size() == 2);
+        REQUIRE(loadedProject.GetLayout("layout").GetUsedImages()[0] == "image1");
+        REQUIRE(loadedProject.GetLayout("layout").GetUsedImages()[1] == "image2");
+        REQUIRE(loadedProject.GetLayout("layoutWithoutImages").GetUsedImages().empty());
+    }
 }
@@ -0,0 +1,74 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the packing of rectangles used to build texture atlases.
+ */
+#include "catch.hpp"
+#include "GDCore/Tools/SkylinePacker.h"
+#include <vector>
+
+namespace
+{
+
+struct PackedRect
+{
+    unsigned int x, y, width, height;
+};
+
+bool Overlap(const PackedRect & a, const PackedRect & b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+        a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+}
+
+TEST_CASE( "SkylinePacker", "[common]" ) {
+    SECTION("Basics") {
+        gd::SkylinePacker packer(100, 100);
+        unsigned int x = 0, y = 0;
+
+        REQUIRE(packer.Insert(50, 30, x, y) == true);
+        REQUIRE(x == 0);
+        REQUIRE(y == 0);
+        REQUIRE(packer.Insert(50, 20, x, y) == true);
+        REQUIRE(x == 50);
+        REQUIRE(y == 0);
+        REQUIRE(packer.Insert(50, 10, x, y) == true);
+        REQUIRE(x == 50);
+        REQUIRE(y == 20);
+        REQUIRE(packer.GetUsedWidth() == 100);
+        REQUIRE(packer.GetUsedHeight() == 30);
+    }
+    SECTION("Rectangles too large") {
+        gd::SkylinePacker packer(100, 100);
+        unsigned int x = 0, y = 0;
+
+        REQUIRE(packer.Insert(101, 10, x, y) == false);
+        REQUIRE(packer.Insert(10, 101, x, y) == false);
+        REQUIRE(packer.Insert(100, 100, x, y) == true);
+        REQUIRE(packer.Insert(1, 1, x, y) == false);
+    }
+    SECTION("No overlapping") {
+        gd::SkylinePacker packer(256, 256);
+        std::vector<PackedRect> rects;
+        for (unsigned int i = 0;i < 64;++i)
+        {
+            PackedRect rect = {0, 0, 8 + (i * 7) % 25, 8 + (i * 13) % 19};
+            if ( packer.Insert(rect.width, rect.height, rect.x, rect.y) )
+                rects.push_back(rect);
+        }
+
+        REQUIRE(rects.size() == 64);
+        for (std::size_t i = 0;i < rects.size();++i)
+        {
+            REQUIRE((rects[i].x + rects[i].width <= 256));
+            REQUIRE((rects[i].y + rects[i].height <= 256));
+            for (std::size_t j = i + 1;j < rects.size();++j)
+                REQUIRE(!Overlap(rects[i], rects[j]));
+        }
+    }
+}
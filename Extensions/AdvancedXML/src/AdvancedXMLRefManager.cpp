@@ -11,11 +11,12 @@ This project is released under the MIT License.
 #include <vector>
 
 #include "GDCpp/Runtime/CommonTools.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/TinyXml/tinyxml.h"
 
 namespace AdvancedXML
 {
-    std::map< RuntimeScene*, RefManager* > *RefManager::inst = new std::map< RuntimeScene*, RefManager* >;
+    const SceneExtensionDataSlot<RefManager> RefManager::slot;
 
     RefManager::RefManager()
     {
@@ -35,21 +36,7 @@ namespace AdvancedXML
 
     RefManager* RefManager::Get(RuntimeScene *scene)
     {
-        if((*inst)[scene] == NULL)
-        {
-            (*inst)[scene] = new RefManager();
-        }
-        return inst->at(scene);
-    }
-
-    void RefManager::Destroy()
-    {
-        std::map<RuntimeScene*, RefManager*>::iterator it;
-        for(it = inst->begin(); it != inst->end(); it++)
-        {
-            if(it->second)
-                delete it->second;
-        }
+        return &scene->GetExtensionData(slot);
     }
 
     TiXmlNode* RefManager::GetRef(const gd::String &refName)
@@ -10,6 +10,7 @@ This project is released under the MIT License.
 
 #include <map>
 #include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 
 class TiXmlNode;
 class RuntimeScene;
@@ -19,9 +20,13 @@ namespace AdvancedXML
     class RefManager
     {
         public:
+        RefManager();
         ~RefManager();
+
+        /**
+            Get the manager of the refs of the scene.
+         */
         static RefManager* Get(RuntimeScene *scene);
-        static void Destroy();
 
         /**
             Get the TiXmlNode corresponding to the ref name.
@@ -63,12 +68,9 @@ namespace AdvancedXML
         void CreateElement(const gd::String &refName, const gd::String &content);
 
         private:
-        RefManager();
-
         std::map< gd::String, TiXmlNode* > m_refs;
 
-        //Singleton instance
-        static std::map< RuntimeScene*, RefManager* > *inst;
+        static const SceneExtensionDataSlot<RefManager> slot; ///< The slot used to store the manager of each scene.
     };
 
     //TEMPLATES IMPL
@@ -308,10 +308,7 @@ public:
 
         GD_COMPLETE_EXTENSION_COMPILATION_INFORMATION();
     };
-    virtual ~Extension()
-    {
-        AdvancedXML::RefManager::Destroy();
-    };
+    virtual ~Extension() {};
 };
 
 /**
@@ -27,7 +27,7 @@ DraggableBehavior::DraggableBehavior() :
 void DraggableBehavior::DoStepPreEvents(RuntimeScene & scene)
 {
     //Begin drag ?
-    if ( !dragged && scene.GetInputManager().IsMouseButtonPressed("Left") &&
+    if ( !dragged && scene.GetInputManager().IsMouseButtonPressed(sf::Mouse::Left) &&
         !leftPressedLastFrame && !somethingDragged )
     {
         RuntimeLayer & theLayer = scene.GetRuntimeLayer(object->GetLayer());
@@ -51,7 +51,7 @@ void DraggableBehavior::DoStepPreEvents(RuntimeScene & scene)
         }
     }
     //End dragging ?
-    else if ( !scene.GetInputManager().IsMouseButtonPressed("Left") ) {
+    else if ( !scene.GetInputManager().IsMouseButtonPressed(sf::Mouse::Left) ) {
         dragged = false;
         somethingDragged = false;
     }
@@ -70,7 +70,7 @@ void DraggableBehavior::DoStepPreEvents(RuntimeScene & scene)
 
 void DraggableBehavior::DoStepPostEvents(RuntimeScene & scene)
 {
-    leftPressedLastFrame = scene.GetInputManager().IsMouseButtonPressed("Left");
+    leftPressedLastFrame = scene.GetInputManager().IsMouseButtonPressed(sf::Mouse::Left);
 }
 
 void DraggableBehavior::OnDeActivate()
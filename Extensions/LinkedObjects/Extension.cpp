@@ -6,6 +6,7 @@ This project is released under the MIT License.
 */
 
 #include "GDCpp/Extensions/ExtensionBase.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
 #include "ObjectsLinksManager.h"
 
 
@@ -116,7 +117,7 @@ public:
      */
     virtual void ObjectDeletedFromScene(RuntimeScene & scene, RuntimeObject * object)
     {
-        GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene].RemoveAllLinksOf(object);
+        scene.GetExtensionData(GDpriv::LinkedObjects::ObjectsLinksManager::slot).RemoveAllLinksOf(object);
     }
 
     /**
@@ -124,7 +125,7 @@ public:
      */
     virtual void SceneLoaded(RuntimeScene & scene)
     {
-        GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene].ClearAll();
+        scene.GetExtensionData(GDpriv::LinkedObjects::ObjectsLinksManager::slot).ClearAll();
     }
 
     /**
@@ -132,7 +133,7 @@ public:
      */
     virtual void SceneUnloaded(RuntimeScene & scene)
     {
-        GDpriv::LinkedObjects::ObjectsLinksManager::managers.erase(&scene);
+        scene.ResetExtensionData(GDpriv::LinkedObjects::ObjectsLinksManager::slot);
     }
 };
 
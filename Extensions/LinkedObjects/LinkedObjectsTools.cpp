@@ -22,7 +22,7 @@ namespace GDpriv
 namespace LinkedObjects
 {
 
-std::map < RuntimeScene* , ObjectsLinksManager > ObjectsLinksManager::managers;
+const SceneExtensionDataSlot<ObjectsLinksManager> ObjectsLinksManager::slot;
 
 bool GD_EXTENSION_API PickObjectsLinkedTo(RuntimeScene & scene,
                                           std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectsLists,
@@ -30,7 +30,7 @@ bool GD_EXTENSION_API PickObjectsLinkedTo(RuntimeScene & scene,
 {
     if (!object) return false;
 
-    std::vector<RuntimeObject*> linkedObjects = ObjectsLinksManager::managers[&scene].GetObjectsLinkedWith(object);
+    std::vector<RuntimeObject*> linkedObjects = scene.GetExtensionData(ObjectsLinksManager::slot).GetObjectsLinkedWith(object);
     return PickObjectsIf(pickedObjectsLists, false, [&linkedObjects](RuntimeObject * obj) {
         return std::find(linkedObjects.begin(), linkedObjects.end(), obj) != linkedObjects.end();
     });
@@ -39,19 +39,19 @@ bool GD_EXTENSION_API PickObjectsLinkedTo(RuntimeScene & scene,
 void GD_EXTENSION_API LinkObjects(RuntimeScene & scene, RuntimeObject * a, RuntimeObject * b)
 {
     if (!a || !b) return;
-    ObjectsLinksManager::managers[&scene].LinkObjects(a, b);
+    scene.GetExtensionData(ObjectsLinksManager::slot).LinkObjects(a, b);
 }
 
 void GD_EXTENSION_API RemoveLinkBetween(RuntimeScene & scene, RuntimeObject * a, RuntimeObject * b )
 {
     if (!a || !b) return;
-    ObjectsLinksManager::managers[&scene].RemoveLinkBetween(a, b);
+    scene.GetExtensionData(ObjectsLinksManager::slot).RemoveLinkBetween(a, b);
 }
 
 void GD_EXTENSION_API RemoveAllLinksOf(RuntimeScene & scene, RuntimeObject * object)
 {
     if (!object) return;
-    ObjectsLinksManager::managers[&scene].RemoveAllLinksOf(object);
+    scene.GetExtensionData(ObjectsLinksManager::slot).RemoveAllLinksOf(object);
 }
 
 }
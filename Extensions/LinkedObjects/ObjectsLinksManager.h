@@ -11,6 +11,7 @@ This project is released under the MIT License.
 #include <map>
 #include <vector>
 #include <set>
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 
 class RuntimeObject;
 class RuntimeScene;
@@ -52,7 +53,7 @@ public:
      */
     void ClearAll();
 
-    static std::map < RuntimeScene* , ObjectsLinksManager > managers; //List of managers associated with scenes.
+    static const SceneExtensionDataSlot<ObjectsLinksManager> slot; ///< The slot used to store the manager of each scene.
 
 private:
     std::map < RuntimeObject *, std::set< RuntimeObject * > > links;
@@ -39,7 +39,7 @@ TEST_CASE( "LinkedObjects", "[game-engine][linked-objects]" ) {
 		RuntimeObject obj2C(scene, obj2);
 
 		//Link two objects
-		GDpriv::LinkedObjects::ObjectsLinksManager & manager = GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene];
+		GDpriv::LinkedObjects::ObjectsLinksManager & manager = scene.GetExtensionData(GDpriv::LinkedObjects::ObjectsLinksManager::slot);
 		manager.LinkObjects(&obj1A, &obj2A);
 		{
 			std::vector<RuntimeObject*> linkedObjects = manager.GetObjectsLinkedWith(&obj1A);
@@ -107,8 +107,9 @@ bool RuntimePanelSpriteObject::Draw( sf::RenderTarget& window )
 
     sf::Vector2f centerPosition = sf::Vector2f(GetX()+GetCenterX(),GetY()+GetCenterY());
 
-    float imageWidth = texture->texture.getSize().x;
-    float imageHeight = texture->texture.getSize().y;
+    const sf::IntRect textureRect = texture->GetTextureRect(); //The image can be a part of an atlas page.
+    float imageWidth = textureRect.width;
+    float imageHeight = textureRect.height;
 
     sf::Vertex centerVertices[] = {
         sf::Vertex( sf::Vector2f(-width/2 + leftMargin ,-height/2 + topMargin   ), sf::Vector2f(leftMargin              ,topMargin            )),
@@ -168,9 +169,16 @@ bool RuntimePanelSpriteObject::Draw( sf::RenderTarget& window )
     matrix.translate(centerPosition);
     matrix.rotate(angle);
 
+    const sf::Vector2f textureOffset(textureRect.left, textureRect.top);
+    for (auto & vertex : centerVertices) vertex.texCoords += textureOffset;
+    for (auto & vertex : topVertices) vertex.texCoords += textureOffset;
+    for (auto & vertex : rightVertices) vertex.texCoords += textureOffset;
+    for (auto & vertex : bottomVertices) vertex.texCoords += textureOffset;
+    for (auto & vertex : leftVertices) vertex.texCoords += textureOffset;
+
     sf::RenderStates states;
     states.transform = matrix;
-    states.texture = &texture->texture;
+    states.texture = &texture->GetTexture();
 
     window.draw(centerVertices, 4, sf::TrianglesStrip, states);
     window.draw(leftVertices, 4, sf::TrianglesStrip, states);
@@ -381,7 +381,7 @@ void PathfindingBehavior::MoveTo(RuntimeScene & scene, float x, float y)
     if ( parentScene != &scene ) //Parent scene has changed
     {
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePathfindingObstaclesManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePathfindingObstaclesManager::slot) : NULL;
     }
 
     path.clear();
@@ -450,7 +450,7 @@ void PathfindingBehavior::DoStepPreEvents(RuntimeScene & scene)
     if ( parentScene != &scene ) //Parent scene has changed
     {
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePathfindingObstaclesManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePathfindingObstaclesManager::slot) : NULL;
     }
 
     if ( !sceneManager ) return;
@@ -492,7 +492,7 @@ void PathfindingBehavior::DoStepPostEvents(RuntimeScene & scene)
     if ( parentScene != &scene ) //Parent scene has changed
     {
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePathfindingObstaclesManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePathfindingObstaclesManager::slot) : NULL;
     }
 }
 
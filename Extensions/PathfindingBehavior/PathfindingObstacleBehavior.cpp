@@ -42,7 +42,7 @@ void PathfindingObstacleBehavior::DoStepPreEvents(RuntimeScene & scene)
             sceneManager->RemoveObstacle(this);
 
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePathfindingObstaclesManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePathfindingObstaclesManager::slot) : NULL;
         registeredInManager = false;
     }
 
@@ -8,7 +8,7 @@ This project is released under the MIT License.
 #include "PathfindingObstacleBehavior.h"
 #include <iostream>
 
-std::map<RuntimeScene*, ScenePathfindingObstaclesManager> ScenePathfindingObstaclesManager::managers;
+const SceneExtensionDataSlot<ScenePathfindingObstaclesManager> ScenePathfindingObstaclesManager::slot;
 
 ScenePathfindingObstaclesManager::~ScenePathfindingObstaclesManager()
 {
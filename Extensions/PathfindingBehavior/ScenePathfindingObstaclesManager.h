@@ -9,6 +9,7 @@ This project is released under the MIT License.
 #include <map>
 #include <set>
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 class PathfindingObstacleBehavior;
 
 /**
@@ -18,9 +19,9 @@ class ScenePathfindingObstaclesManager
 {
 public:
     /**
-     * \brief Map containing, for each RuntimeScene, its associated ScenePathfindingObstaclesManager.
+     * \brief The slot used to store, in each RuntimeScene, its associated ScenePathfindingObstaclesManager.
      */
-    static std::map<RuntimeScene*, ScenePathfindingObstaclesManager> managers;
+    static const SceneExtensionDataSlot<ScenePathfindingObstaclesManager> slot;
 
 	ScenePathfindingObstaclesManager() {};
 	virtual ~ScenePathfindingObstaclesManager();
@@ -472,8 +472,7 @@ public:
      */
     virtual void SceneLoaded(RuntimeScene & scene)
     {
-        ScenePlatformObjectsManager emptyManager;
-        ScenePlatformObjectsManager::managers[&scene] = emptyManager;
+        scene.ResetExtensionData(ScenePlatformObjectsManager::slot);
     }
 
     /**
@@ -481,7 +480,7 @@ public:
      */
     virtual void SceneUnloaded(RuntimeScene & scene)
     {
-        ScenePlatformObjectsManager::managers.erase(&scene);
+        scene.ResetExtensionData(ScenePlatformObjectsManager::slot);
     }
 
 };
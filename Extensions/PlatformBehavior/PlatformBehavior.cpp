@@ -44,7 +44,7 @@ void PlatformBehavior::DoStepPreEvents(RuntimeScene & scene)
             sceneManager->RemovePlatform(this);
 
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePlatformObjectsManager::slot) : NULL;
         registeredInManager = false;
     }
 
@@ -90,7 +90,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
     if ( parentScene != &scene ) //Parent scene has changed
     {
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePlatformObjectsManager::slot) : NULL;
         floorPlatform = NULL;
     }
 
@@ -104,8 +104,8 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
     double requestedDeltaY = 0;
 
     //Change the speed according to the player's input.
-    leftKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Left");
-    rightKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Right");
+    leftKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Left);
+    rightKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Right);
     if ( leftKey )
         currentSpeed -= acceleration*timeDelta;
     if ( rightKey )
@@ -211,7 +211,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
     //2) Y axis:
 
     //Go on a ladder
-    ladderKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Up");
+    ladderKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Up);
     if (ladderKey && IsOverlappingLadder(potentialObjects))
     {
         canJump = true;
@@ -224,8 +224,8 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
 
     if ( isOnLadder )
     {
-        upKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Up");
-        downKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Down");
+        upKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Up);
+        downKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Down);
         if ( upKey )
             requestedDeltaY -= 150*timeDelta;
         if ( downKey )
@@ -279,7 +279,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
         }
     }
 
-    releaseKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Down");
+    releaseKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Down);
     if (isGrabbingPlatform && !releaseKey) {
         canJump = true;
         currentJumpSpeed = 0;
@@ -291,8 +291,8 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene & scene)
 
     //Jumping
     jumpKey |= !ignoreDefaultControls &&
-        (scene.GetInputManager().IsKeyPressed("LShift") || scene.GetInputManager().IsKeyPressed("RShift") ||
-        scene.GetInputManager().IsKeyPressed("Space"));
+        (scene.GetInputManager().IsKeyPressed(sf::Keyboard::LShift) || scene.GetInputManager().IsKeyPressed(sf::Keyboard::RShift) ||
+        scene.GetInputManager().IsKeyPressed(sf::Keyboard::Space));
     if ( canJump && jumpKey )
     {
         jumping = true;
@@ -612,7 +612,7 @@ void PlatformerObjectBehavior::DoStepPostEvents(RuntimeScene & scene)
     if ( parentScene != &scene ) //Parent scene has changed
     {
         parentScene = &scene;
-        sceneManager = parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        sceneManager = parentScene ? &scene.GetExtensionData(ScenePlatformObjectsManager::slot) : NULL;
         floorPlatform = NULL;
     }
 }
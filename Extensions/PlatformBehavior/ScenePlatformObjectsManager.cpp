@@ -1,7 +1,7 @@
 #include "ScenePlatformObjectsManager.h"
 #include "PlatformBehavior.h"
 
-std::map<RuntimeScene*, ScenePlatformObjectsManager> ScenePlatformObjectsManager::managers;
+const SceneExtensionDataSlot<ScenePlatformObjectsManager> ScenePlatformObjectsManager::slot;
 
 ScenePlatformObjectsManager::~ScenePlatformObjectsManager()
 {
@@ -6,9 +6,9 @@ This project is released under the MIT License.
 */
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
-#include <map>
 #include <set>
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 class PlatformBehavior;
 
 /**
@@ -18,9 +18,9 @@ class ScenePlatformObjectsManager
 {
 public:
     /**
-     * \brief Map containing, for each RuntimeScene, its associated ScenePlatformObjectsManager.
+     * \brief The slot used to store, in each RuntimeScene, its associated ScenePlatformObjectsManager.
      */
-    static std::map<RuntimeScene*, ScenePlatformObjectsManager> managers;
+    static const SceneExtensionDataSlot<ScenePlatformObjectsManager> slot;
 
 	ScenePlatformObjectsManager() {};
 	virtual ~ScenePlatformObjectsManager();
@@ -12,6 +12,8 @@ This project is released under the MIT License.
 #endif
 #include "TiledSpriteObject.h"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
 #include "GDCore/Tools/Localization.h"
 #include "GDCpp/Runtime/Project/Object.h"
 #include "GDCpp/Runtime/Project/Project.h"
@@ -107,74 +109,85 @@ bool RuntimeTiledSpriteObject::Draw( sf::RenderTarget& window )
     if ( hidden ) return true;
     if(!texture) return true;
 
-#if defined(ANDROID)
-    const unsigned int textureWidth = texture->texture.getSize().x;
-    const unsigned int textureHeight =  texture->texture.getSize().y;
+#if !defined(ANDROID)
+    if ( !texture->IsInAtlas() )
+    {
+        sf::Vector2f centerPosition = sf::Vector2f(GetX()+GetCenterX(),GetY()+GetCenterY());
+        float angleInRad = angle*3.14159/180.0;
+
+        texture->texture.setRepeated(true);
+        sf::Vertex vertices[] = {
+            sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(-width/2,-height/2), angleInRad), sf::Vector2f(0+xOffset,0+yOffset)),
+            sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(+width/2,-height/2), angleInRad), sf::Vector2f(width+xOffset,0+yOffset)),
+            sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(-width/2,+height/2), angleInRad), sf::Vector2f(0+xOffset, height+yOffset)),
+            sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(+width/2,+height/2), angleInRad), sf::Vector2f(width+xOffset, height+yOffset))
+        };
+
+        window.draw(vertices, 4, sf::TrianglesStrip, &texture->texture);
+        texture->texture.setRepeated(false);
+
+        return true;
+    }
+#endif
+
+    //Textures can't be repeated on Android, nor when the image is a part of an atlas page:
+    //draw two triangles for each tile.
+    const sf::IntRect textureRect = texture->GetTextureRect();
+    if ( textureRect.width <= 0 || textureRect.height <= 0 ) return true;
+
+    const float tileWidth = textureRect.width;
+    const float tileHeight = textureRect.height;
+    float startX = -std::fmod(xOffset, tileWidth);
+    if ( startX > 0 ) startX -= tileWidth;
+    float startY = -std::fmod(yOffset, tileHeight);
+    if ( startY > 0 ) startY -= tileHeight;
+
     std::vector<sf::Vertex> vertices;
-    vertices.resize(
-        (static_cast<std::size_t>(GetWidth() / textureWidth) + 1u) *
-        (static_cast<std::size_t>(GetHeight() / textureHeight) + 1u) *
-        6
-    );
-    for(unsigned int i = 0; i < (static_cast<std::size_t>(GetWidth() / textureWidth) + 1u); i++)
+    vertices.reserve((static_cast<std::size_t>(GetWidth() / tileWidth) + 2u) * (static_cast<std::size_t>(GetHeight() / tileHeight) + 2u) * 6);
+    for(float tileY = startY; tileY < GetHeight(); tileY += tileHeight)
     {
-        for(unsigned int j = 0; j < (static_cast<std::size_t>(GetHeight() / textureHeight) + 1u); j++)
+        for(float tileX = startX; tileX < GetWidth(); tileX += tileWidth)
         {
-            //Create the four vertices
-            sf::Vector2f textureEndPosition(
-                (i < static_cast<std::size_t>(GetWidth() / textureWidth)) ? textureWidth : (GetWidth() - i * textureWidth),
-                (j < static_cast<std::size_t>(GetHeight() / textureHeight)) ? textureHeight : (GetHeight() - j * textureHeight)
-            );
+            //Clip the tile to the object area
+            float left = std::max(tileX, 0.f);
+            float top = std::max(tileY, 0.f);
+            float right = std::min(tileX + tileWidth, GetWidth());
+            float bottom = std::min(tileY + tileHeight, GetHeight());
 
             sf::Vertex topLeftCorner(
-                sf::Vector2f(i * textureWidth, j * textureHeight),
-                sf::Vector2f(0.f, 0.f)
+                sf::Vector2f(left, top),
+                sf::Vector2f(textureRect.left + left - tileX, textureRect.top + top - tileY)
             );
             sf::Vertex topRightCorner(
-                sf::Vector2f(i * textureWidth + textureEndPosition.x, j * textureHeight),
-                sf::Vector2f(textureEndPosition.x, 0.f)
+                sf::Vector2f(right, top),
+                sf::Vector2f(textureRect.left + right - tileX, textureRect.top + top - tileY)
             );
             sf::Vertex bottomRightCorner(
-                sf::Vector2f(i * textureWidth + textureEndPosition.x, j * textureHeight + textureEndPosition.y),
-                sf::Vector2f(textureEndPosition.x, textureEndPosition.y)
+                sf::Vector2f(right, bottom),
+                sf::Vector2f(textureRect.left + right - tileX, textureRect.top + bottom - tileY)
             );
             sf::Vertex bottomLeftCorner(
-                sf::Vector2f(i * textureWidth, j * textureHeight + textureEndPosition.y),
-                sf::Vector2f(0.f, textureEndPosition.y)
+                sf::Vector2f(left, bottom),
+                sf::Vector2f(textureRect.left + left - tileX, textureRect.top + bottom - tileY)
             );
 
             //Insert them to create two triangles
-            const unsigned int firstVerticePos = (j * (static_cast<std::size_t>(GetWidth() / textureWidth) + 1u) + i) * 6;
-            vertices[firstVerticePos] = topLeftCorner;
-            vertices[firstVerticePos+1u] = topRightCorner;
-            vertices[firstVerticePos+2u] = bottomRightCorner;
-            vertices[firstVerticePos+3u] = topLeftCorner;
-            vertices[firstVerticePos+4u] = bottomRightCorner;
-            vertices[firstVerticePos+5u] = bottomLeftCorner;
+            vertices.push_back(topLeftCorner);
+            vertices.push_back(topRightCorner);
+            vertices.push_back(bottomRightCorner);
+            vertices.push_back(topLeftCorner);
+            vertices.push_back(bottomRightCorner);
+            vertices.push_back(bottomLeftCorner);
         }
     }
 
+    //Rotate the tiles around the center of the object
     sf::Transform transform;
-    transform.translate(-GetWidth()/2.f, -GetHeight()/2.f);
+    transform.translate(GetX()+GetCenterX(), GetY()+GetCenterY());
     transform.rotate(angle);
-    transform.translate(GetX()+GetWidth()/2.f, GetY()+GetHeight()/2.f);
-
-    window.draw(vertices.data(), vertices.size(), sf::Triangles, sf::RenderStates(sf::BlendAlpha, transform, &texture->texture, nullptr));
-#else
-    sf::Vector2f centerPosition = sf::Vector2f(GetX()+GetCenterX(),GetY()+GetCenterY());
-    float angleInRad = angle*3.14159/180.0;
+    transform.translate(-GetCenterX(), -GetCenterY());
 
-    texture->texture.setRepeated(true);
-    sf::Vertex vertices[] = {
-        sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(-width/2,-height/2), angleInRad), sf::Vector2f(0+xOffset,0+yOffset)),
-        sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(+width/2,-height/2), angleInRad), sf::Vector2f(width+xOffset,0+yOffset)),
-        sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(-width/2,+height/2), angleInRad), sf::Vector2f(0+xOffset, height+yOffset)),
-        sf::Vertex( centerPosition+RotatePoint(sf::Vector2f(+width/2,+height/2), angleInRad), sf::Vector2f(width+xOffset, height+yOffset))
-    };
-
-    window.draw(vertices, 4, sf::TrianglesStrip, &texture->texture);
-    texture->texture.setRepeated(false);
-#endif
+    window.draw(vertices.data(), vertices.size(), sf::Triangles, sf::RenderStates(sf::BlendAlpha, transform, &texture->GetTexture(), nullptr));
 
     return true;
 }
@@ -15,9 +15,30 @@ This project is released under the MIT License.
 #include "GDCore/Events/CodeGeneration/ExpressionsCodeGeneration.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 
+#if defined(GD_IDE_ONLY)
+namespace
+{
+
+/**
+ * \brief Declare a variable storing the index of the timer of a timed event, resolved
+ * once when the code is loaded, and return its name.
+ */
+gd::String GenerateTimedEventIndex(gd::EventsCodeGenerator & codeGenerator, const gd::String & codeName)
+{
+    gd::String indexName = EventsCodeNameMangler::Get()->GetMangledObjectsListName(codeName)+"Index";
+
+    codeGenerator.AddIncludeFile("GDCpp/Runtime/TimersContainer.h");
+    codeGenerator.AddGlobalDeclaration("static const std::size_t "+indexName+" = TimersContainer::GetTimerIndex(\""+codeName+"\");\n");
+    return indexName;
+}
+
+}
+#endif
+
 /**
  * \brief This class declares information about the extension.
  */
@@ -64,12 +85,20 @@ public:
                 gd::ExpressionParser parser(event.GetTimeoutExpression());
                 if (!parser.ParseMathExpression(codeGenerator.GetPlatform(), codeGenerator.GetProject(), codeGenerator.GetLayout(), callbacks) || timeOutCode.empty()) timeOutCode = "0";
 
-                //Prepare name
-                gd::String codeName = !event.GetName().empty() ? "GDNamedTimedEvent_"+codeGenerator.ConvertToString(event.GetName()) : "GDTimedEvent_"+gd::String::From(&event);
+                //Prepare name: unnamed timed events are numbered by the code generator, so that
+                //the same timer is used when the events are compiled again.
+                gd::String codeName;
+                if ( !event.GetName().empty() )
+                    codeName = "GDNamedTimedEvent_"+codeGenerator.ConvertToString(event.GetName());
+                else if ( EventsCodeGenerator * cppCodeGenerator = dynamic_cast<EventsCodeGenerator*>(&codeGenerator) )
+                    codeName = cppCodeGenerator->GenerateUnnamedElementName("GDTimedEvent_");
+                else
+                    codeName = "GDTimedEvent_"+codeGenerator.ConvertToString(codeGenerator.GetLayout().GetName());
+                event.codeGenerationName = codeName;
 
                 gd::String outputCode;
 
-                outputCode += "if ( static_cast<double>(GDpriv::TimedEvents::UpdateAndGetTimeOf(*runtimeContext->scene, \""+codeName+"\"))/1000000.0 > "+timeOutCode+")";
+                outputCode += "if ( static_cast<double>(GDpriv::TimedEvents::UpdateAndGetTimeOf(*runtimeContext->scene, "+GenerateTimedEventIndex(codeGenerator, codeName)+"))/1000000.0 > "+timeOutCode+")";
                 outputCode += "{";
 
                 outputCode += codeGenerator.GenerateConditionsListCode(event.GetConditions(), context);
@@ -117,7 +146,7 @@ public:
                 codeGenerator.AddIncludeFile("TimedEvent/TimedEventTools.h");
 
                 gd::String codeName = "GDNamedTimedEvent_"+codeGenerator.ConvertToString(instruction.GetParameter(1).GetPlainString());
-                return "GDpriv::TimedEvents::Reset(*runtimeContext->scene, \""+codeName+"\");\n";
+                return "GDpriv::TimedEvents::Reset(*runtimeContext->scene, "+GenerateTimedEventIndex(codeGenerator, codeName)+");\n";
 
                 return gd::String("");
             });
@@ -145,16 +174,9 @@ public:
                     {
                         TimedEvent & timedEvent = *TimedEvent::codeGenerationCurrentParents[i];
 
-                        gd::String code;
-                        {
-                            gd::String codeName = !timedEvent.GetName().empty() ? "GDNamedTimedEvent_"+codeGenerator.ConvertToString(timedEvent.GetName()) : "GDTimedEvent_"+gd::String::From(&timedEvent);
-                            code += "GDpriv::TimedEvents::Reset(*runtimeContext->scene, \""+codeName+"\");\n";
-                        }
+                        gd::String code = "GDpriv::TimedEvents::Reset(*runtimeContext->scene, "+GenerateTimedEventIndex(codeGenerator, timedEvent.codeGenerationName)+");\n";
                         for (std::size_t j = 0;j<timedEvent.codeGenerationChildren.size();++j)
-                        {
-                            gd::String codeName = !timedEvent.codeGenerationChildren[j]->GetName().empty() ? "GDNamedTimedEvent_"+codeGenerator.ConvertToString(timedEvent.codeGenerationChildren[j]->GetName()) : "GDTimedEvent_"+gd::String::From(timedEvent.codeGenerationChildren[j]);
-                            code += "GDpriv::TimedEvents::Reset(*runtimeContext->scene, \""+codeName+"\");\n";
-                        }
+                            code += "GDpriv::TimedEvents::Reset(*runtimeContext->scene, "+GenerateTimedEventIndex(codeGenerator, timedEvent.codeGenerationChildren[j]->codeGenerationName)+");\n";
                         return code;
                     }
                 }
@@ -172,56 +194,39 @@ public:
 
     void GetPropertyForDebugger(RuntimeScene & scene, std::size_t propertyNb, gd::String & name, gd::String & value) const
     {
-        std::size_t i = 0;
-        std::map < gd::String, ManualTimer >::const_iterator end = TimedEventsManager::managers[&scene].timedEvents.end();
-        for (std::map < gd::String, ManualTimer >::iterator iter = TimedEventsManager::managers[&scene].timedEvents.begin();iter != end;++iter)
-        {
-            if ( propertyNb == i )
-            {
-                name = iter->first;
-                //Unmangle name
-                if ( name.find("GDNamedTimedEvent_") == 0 && name.length() > 18 )
-                    name = name.substr(18, name.length());
-                else
-                    name = _("No name");
-
-                value = gd::String::From(static_cast<double>(iter->second.GetTime())/1000000.0)+"s";
-
-                return;
-            }
-
-            ++i;
-        }
+        TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+        std::vector<std::size_t> indices = manager.timedEvents.GetTimersIndices();
+        if ( propertyNb >= indices.size() ) return;
+
+        name = TimersContainer::GetTimerName(indices[propertyNb]);
+        //Unmangle name
+        if ( name.find("GDNamedTimedEvent_") == 0 && name.length() > 18 )
+            name = name.substr(18, name.length());
+        else
+            name = _("No name");
+
+        value = gd::String::From(static_cast<double>(manager.timedEvents.GetTimer(indices[propertyNb]).GetTime())/1000000.0)+"s";
     }
 
     bool ChangeProperty(RuntimeScene & scene, std::size_t propertyNb, gd::String newValue)
     {
-        std::size_t i = 0;
-        std::map < gd::String, ManualTimer >::const_iterator end = TimedEventsManager::managers[&scene].timedEvents.end();
-        for (std::map < gd::String, ManualTimer >::iterator iter = TimedEventsManager::managers[&scene].timedEvents.begin();iter != end;++iter)
-        {
-            if ( propertyNb == i )
-            {
-                iter->second.SetTime(newValue.To<double>()*1000000.0);
-
-                return true;
-            }
-
-            ++i;
-        }
+        TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+        std::vector<std::size_t> indices = manager.timedEvents.GetTimersIndices();
+        if ( propertyNb >= indices.size() ) return false;
 
-        return false;
+        manager.timedEvents.GetTimer(indices[propertyNb]).SetTime(newValue.To<double>()*1000000.0);
+        return true;
     }
 
     std::size_t GetNumberOfProperties(RuntimeScene & scene) const
     {
-        return TimedEventsManager::managers[&scene].timedEvents.size();
+        return scene.GetExtensionData(TimedEventsManager::slot).timedEvents.GetTimersCount();
     }
     #endif
 
     void SceneLoaded(RuntimeScene & scene)
     {
-        TimedEventsManager::managers[&scene].timedEvents.clear();
+        scene.ResetExtensionData(TimedEventsManager::slot);
     }
 };
 
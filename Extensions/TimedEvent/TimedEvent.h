@@ -78,6 +78,7 @@ public:
 
     static std::vector< TimedEvent* > codeGenerationCurrentParents;
     std::vector< TimedEvent* > codeGenerationChildren;
+    gd::String codeGenerationName; ///< The name of the timer of the event, set when its code is generated.
 
 private:
     gd::String name;
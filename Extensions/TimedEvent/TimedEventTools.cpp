@@ -16,15 +16,28 @@ namespace TimedEvents
 
 signed long long GD_EXTENSION_API UpdateAndGetTimeOf(RuntimeScene & scene, gd::String timedEventName)
 {
-    TimedEventsManager & manager = TimedEventsManager::managers[&scene];
-    manager.timedEvents[timedEventName].UpdateTime(scene.GetTimeManager().GetElapsedTime());
-    return manager.timedEvents[timedEventName].GetTime();
+    TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+    return UpdateAndGetTimeOf(scene, manager.timedEvents.GetIndexOf(timedEventName));
+}
+
+signed long long GD_EXTENSION_API UpdateAndGetTimeOf(RuntimeScene & scene, std::size_t timedEventIndex)
+{
+    TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+    ManualTimer & timer = manager.timedEvents.GetTimer(timedEventIndex);
+    timer.UpdateTime(scene.GetTimeManager().GetElapsedTime());
+    return timer.GetTime();
 }
 
 void GD_EXTENSION_API Reset(RuntimeScene & scene, gd::String timedEventName)
 {
-    TimedEventsManager & manager = TimedEventsManager::managers[&scene];
-    manager.timedEvents[timedEventName].Reset();
+    TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+    Reset(scene, manager.timedEvents.GetIndexOf(timedEventName));
+}
+
+void GD_EXTENSION_API Reset(RuntimeScene & scene, std::size_t timedEventIndex)
+{
+    TimedEventsManager & manager = scene.GetExtensionData(TimedEventsManager::slot);
+    manager.timedEvents.GetTimer(timedEventIndex).Reset();
 }
 
 }
@@ -23,6 +23,14 @@ namespace TimedEvents
  */
 signed long long GD_EXTENSION_API UpdateAndGetTimeOf(RuntimeScene & scene, gd::String mangledTimedEventName);
 
+/**
+ * Update timed event and return its time, in microseconds.
+ * \param scene Scene used
+ * \param timedEventIndex Index of the mangled timed event name, as returned by TimersContainer::GetTimerIndex.
+ * \return Time elapsed, in microseconds, of the timed event
+ */
+signed long long GD_EXTENSION_API UpdateAndGetTimeOf(RuntimeScene & scene, std::size_t timedEventIndex);
+
 /**
  * Reset a timed event.
  * \param scene Scene used
@@ -30,6 +38,13 @@ signed long long GD_EXTENSION_API UpdateAndGetTimeOf(RuntimeScene & scene, gd::S
  */
 void GD_EXTENSION_API Reset(RuntimeScene & scene, gd::String timedEventName);
 
+/**
+ * Reset a timed event.
+ * \param scene Scene used
+ * \param timedEventIndex Index of the mangled timed event name, as returned by TimersContainer::GetTimerIndex.
+ */
+void GD_EXTENSION_API Reset(RuntimeScene & scene, std::size_t timedEventIndex);
+
 }
 
 }
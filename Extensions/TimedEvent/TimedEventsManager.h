@@ -7,10 +7,10 @@ This project is released under the MIT License.
 
 #ifndef TIMEDEVENTMANAGER_H
 #define TIMEDEVENTMANAGER_H
-#include <map>
 #include <string>
 #include "GDCpp/Runtime/RuntimeScene.h"
-#include "GDCpp/Runtime/ManualTimer.h"
+#include "GDCpp/Runtime/TimersContainer.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 
 class TimedEventsManager
 {
@@ -18,9 +18,9 @@ public:
     TimedEventsManager() {};
     virtual ~TimedEventsManager() {};
 
-    std::map < gd::String, ManualTimer > timedEvents;
+    TimersContainer timedEvents; ///< The timers of the timed events, indexed using TimersContainer::GetTimerIndex.
 
-    static std::map < RuntimeScene* , TimedEventsManager > managers; //List of managers associated with scenes.
+    static const SceneExtensionDataSlot<TimedEventsManager> slot; ///< The slot used to store the manager of each scene.
 };
 
 #endif // TIMEDEVENTMANAGER_H
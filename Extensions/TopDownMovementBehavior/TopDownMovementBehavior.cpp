@@ -53,10 +53,10 @@ float TopDownMovementBehavior::GetSpeed()
 void TopDownMovementBehavior::DoStepPreEvents(RuntimeScene & scene)
 {
     //Get the player input:
-    leftKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Left");
-    rightKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Right");
-    downKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Down");
-    upKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed("Up");
+    leftKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Left);
+    rightKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Right);
+    downKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Down);
+    upKey |= !ignoreDefaultControls && scene.GetInputManager().IsKeyPressed(sf::Keyboard::Up);
 
     int direction = -1;
     float directionInRad = 0;
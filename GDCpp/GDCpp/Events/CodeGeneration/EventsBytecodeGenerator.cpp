@@ -0,0 +1,1338 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#if defined(GD_IDE_ONLY)
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "GDCpp/Events/CodeGeneration/EventsBytecodeGenerator.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Runtime/InputManager.h"
+#include "GDCore/Events/Parsers/ExpressionParser.h"
+#include "GDCore/Events/Parsers/VariableParser.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeTree.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace
+{
+
+/**
+ * \brief Check that an expression is valid, like gd::CallbacksForGeneratingExpressionCode does
+ * for the parameters of functions.
+ */
+class ExpressionValidationCallbacks : public gd::ParserCallbacks
+{
+public:
+    ExpressionValidationCallbacks() {};
+    virtual ~ExpressionValidationCallbacks() {};
+
+    void OnConstantToken(gd::String text) {};
+    void OnStaticFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo) {};
+    void OnObjectFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo) {};
+    void OnObjectBehaviorFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo) {};
+
+    bool OnSubMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        ExpressionValidationCallbacks callbacks;
+        gd::ExpressionParser parser(expression);
+        if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
+        {
+            firstErrorStr = callbacks.firstErrorStr;
+            firstErrorPos = callbacks.firstErrorPos;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool OnSubTextExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        ExpressionValidationCallbacks callbacks;
+        gd::ExpressionParser parser(expression);
+        if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
+        {
+            firstErrorStr = callbacks.firstErrorStr;
+            firstErrorPos = callbacks.firstErrorPos;
+            return false;
+        }
+
+        return true;
+    }
+};
+
+bool HasObjectOrGroupNamed(const gd::Project & project, const gd::Layout & layout, const gd::String & name)
+{
+    auto hasGroup = [&name](const std::vector<gd::ObjectGroup> & groups) {
+        return std::find_if(groups.begin(), groups.end(), [&name](const gd::ObjectGroup & group) {
+            return group.GetName() == name;
+        }) != groups.end();
+    };
+
+    return layout.HasObjectNamed(name) || project.HasObjectNamed(name) ||
+        hasGroup(layout.GetObjectGroups()) || hasGroup(project.GetObjectGroups());
+}
+
+}
+
+/**
+ * \brief Lower a math or a string expression, like gd::CallbacksForGeneratingExpressionCode
+ * generates its code.
+ *
+ * The results of the functions are stored in registers. For math expressions, the operations
+ * are lowered at the end from the tokens of a gd::ExpressionCodeTree, with the operations
+ * on constants computed.
+ */
+class EventsBytecodeGenerator::ExpressionCallbacks : public gd::ParserCallbacks
+{
+public:
+    ExpressionCallbacks(EventsBytecodeGenerator & generator_, Scope & scope_) :
+        generator(generator_),
+        scope(scope_),
+        position(0)
+    {};
+    virtual ~ExpressionCallbacks() {};
+
+    void OnConstantToken(gd::String text)
+    {
+        if ( GetReturnType() == "string" )
+        {
+            //Strings can only be concatenated.
+            for (auto character : text)
+            {
+                if ( character != U'+' && character != U' ' && character != U'\n' && character != U'\r' && character != U'\t' )
+                    generator.Unsupported("The string expression \""+text+"\" cannot be lowered.");
+            }
+            return;
+        }
+
+        tree.AddCode(text);
+    }
+
+    void OnStaticFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        if ( expressionInfo.codeExtraInformation.HasCustomCodeGenerator() )
+        {
+            generator.Unsupported("The expression "+functionName+" has a custom code generator.");
+            AddResult(GetDefaultResult());
+            return;
+        }
+
+        //Special case: For strings expressions, function without name is a string.
+        if ( GetReturnType() == "string" && functionName.empty() )
+        {
+            if ( parameters.empty() ) return;
+            AddResult(generator.StringConstant(parameters[0].GetPlainString()));
+            return;
+        }
+
+        std::vector<unsigned int> arguments = generator.LowerArguments(parameters, expressionInfo.parameters, false, scope);
+
+        //Pure functions called with constant parameters are computed now.
+        if ( AddPureFunctionValue(arguments, expressionInfo) ) return;
+
+        EventsBytecode::FunctionCall call = PrepareCall(functionName, arguments, expressionInfo);
+        generator.Emit(EventsBytecode::Call, generator.AddCall(call));
+        AddResult(call.result);
+    }
+
+    void OnObjectFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        if ( parameters.empty() ) return;
+        OnObjectOrBehaviorFunction(functionName, parameters, expressionInfo);
+    }
+
+    void OnObjectBehaviorFunction(gd::String functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        if ( parameters.size() < 2 ) return;
+        OnObjectOrBehaviorFunction(functionName, parameters, expressionInfo);
+    }
+
+    bool OnSubMathExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        ExpressionValidationCallbacks callbacks;
+        if ( !callbacks.OnSubMathExpression(platform, project, layout, expression) )
+        {
+            firstErrorStr = callbacks.firstErrorStr;
+            firstErrorPos = callbacks.firstErrorPos;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool OnSubTextExpression(const gd::Platform & platform, const gd::Project & project, const gd::Layout & layout, gd::Expression & expression)
+    {
+        ExpressionValidationCallbacks callbacks;
+        if ( !callbacks.OnSubTextExpression(platform, project, layout, expression) )
+        {
+            firstErrorStr = callbacks.firstErrorStr;
+            firstErrorPos = callbacks.firstErrorPos;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Lower the operations of the math expression and return the register of its value.
+     */
+    unsigned int GetNumberResult()
+    {
+        const std::vector<gd::ExpressionCodeTree::Token> & tokens = tree.GetTokens();
+        if ( tokens.empty() ) return generator.NumberConstant(0);
+
+        Operand result;
+        position = 0;
+        if ( !tree.CanBeAnalyzed() || !ParseSum(result) || position != tokens.size() )
+        {
+            generator.Unsupported("A math expression cannot be lowered.");
+            return generator.NumberConstant(0);
+        }
+
+        return ToRegister(result);
+    }
+
+    /**
+     * \brief Concatenate the parts of the string expression and return the register of its value.
+     */
+    unsigned int GetStringResult()
+    {
+        if ( stringParts.empty() ) return generator.StringConstant("");
+
+        unsigned int result = stringParts[0];
+        for (std::size_t i = 1;i<stringParts.size();++i)
+        {
+            gd::String left, right;
+            if ( generator.IsStringConstant(result, left) && generator.IsStringConstant(stringParts[i], right) )
+                result = generator.StringConstant(left+right);
+            else
+            {
+                unsigned int concatenation = generator.NewString();
+                generator.Emit(EventsBytecode::Concatenate, concatenation, result, stringParts[i]);
+                result = concatenation;
+            }
+        }
+
+        return result;
+    }
+
+private:
+    /**
+     * \brief An operand of the math expression: a constant or a register.
+     */
+    struct Operand
+    {
+        Operand() : constant(false), value(0), integer(false), reg(EventsBytecode::NoRegister) {};
+
+        bool constant;
+        double value;
+        bool integer; ///< True if the constant is an integer in the generated code.
+        unsigned int reg;
+    };
+
+    void OnObjectOrBehaviorFunction(const gd::String & functionName, const std::vector<gd::Expression> & parameters, const gd::ExpressionMetadata & expressionInfo)
+    {
+        if ( expressionInfo.codeExtraInformation.HasCustomCodeGenerator() )
+        {
+            generator.Unsupported("The expression "+functionName+" has a custom code generator.");
+            AddResult(GetDefaultResult());
+            return;
+        }
+
+        std::vector<unsigned int> arguments = generator.LowerArguments(parameters, expressionInfo.parameters, false, scope);
+
+        //Like the generated code, the function is called for the first object of the last non empty list.
+        std::vector<gd::String> realObjects = generator.codeGenerator.ExpandObjectsName(parameters[0].GetPlainString(), generator.objectContext);
+        if ( realObjects.empty() )
+        {
+            AddResult(GetDefaultResult());
+            return;
+        }
+
+        EventsBytecode::FunctionCall call = PrepareCall(functionName, arguments, expressionInfo);
+        if ( expressionInfo.codeExtraInformation.staticFunction )
+        {
+            for (auto & object : realObjects) generator.NeedList(scope, object);
+            generator.Emit(EventsBytecode::Call, generator.AddCall(call));
+        }
+        else
+        {
+            unsigned int object = generator.PickObject(scope, realObjects, true);
+            generator.Emit(EventsBytecode::CallForObject, generator.AddCall(call), object);
+        }
+
+        AddResult(call.result);
+    }
+
+    EventsBytecode::FunctionCall PrepareCall(const gd::String & functionName, const std::vector<unsigned int> & arguments, const gd::ExpressionMetadata & expressionInfo)
+    {
+        EventsBytecode::FunctionCall call;
+        call.function = generator.functionsTable.GetExpressionFunctionKey(expressionInfo);
+        if ( call.function.empty() )
+            generator.Unsupported("The expression "+functionName+" has no function in the events functions table.");
+
+        call.arguments = arguments;
+        call.resultType = GetReturnType() == "string" ? EventsBytecode::FunctionCall::StringResult : EventsBytecode::FunctionCall::NumberResult;
+        call.result = GetReturnType() == "string" ? generator.NewString() : generator.NewNumber();
+        return call;
+    }
+
+    bool AddPureFunctionValue(const std::vector<unsigned int> & arguments, const gd::ExpressionMetadata & expressionInfo)
+    {
+        if ( GetReturnType() == "string" || !expressionInfo.IsPure() || !expressionInfo.codeExtraInformation.HasConstantEvaluator() )
+            return false;
+
+        std::vector<double> values;
+        for (std::size_t i = 0;i<arguments.size();++i)
+        {
+            double value;
+            if ( expressionInfo.parameters[i].type != "expression" || !generator.IsNumberConstant(arguments[i], value) )
+                return false;
+
+            values.push_back(value);
+        }
+
+        double result = expressionInfo.codeExtraInformation.constantEvaluator(values);
+        if ( !std::isfinite(result) ) return false;
+
+        tree.AddConstant(result);
+        return true;
+    }
+
+    unsigned int GetDefaultResult()
+    {
+        return GetReturnType() == "string" ? generator.StringConstant("") : generator.NumberConstant(0);
+    }
+
+    void AddResult(unsigned int reg)
+    {
+        if ( GetReturnType() == "string" )
+            stringParts.push_back(reg);
+        else
+            tree.AddFunctionCall(gd::String::From(reg));
+    }
+
+    bool IsOperator(const gd::String & operators) const
+    {
+        const std::vector<gd::ExpressionCodeTree::Token> & tokens = tree.GetTokens();
+        return position < tokens.size() && tokens[position].type == gd::ExpressionCodeTree::Token::Operator &&
+            operators.find(tokens[position].code) != gd::String::npos;
+    }
+
+    bool ParseSum(Operand & result)
+    {
+        if ( !ParseProduct(result) ) return false;
+        while ( IsOperator("+-") )
+        {
+            gd::String op = tree.GetTokens()[position++].code;
+            Operand right;
+            if ( !ParseProduct(right) ) return false;
+            result = MakeOperation(result, op, right);
+        }
+
+        return true;
+    }
+
+    bool ParseProduct(Operand & result)
+    {
+        if ( !ParseUnary(result) ) return false;
+        while ( IsOperator("*/%") )
+        {
+            gd::String op = tree.GetTokens()[position++].code;
+            Operand right;
+            if ( !ParseUnary(right) ) return false;
+            result = MakeOperation(result, op, right);
+        }
+
+        return true;
+    }
+
+    bool ParseUnary(Operand & result)
+    {
+        if ( !IsOperator("+-") ) return ParsePrimary(result);
+
+        gd::String op = tree.GetTokens()[position++].code;
+        if ( !ParseUnary(result) ) return false;
+        if ( op == "+" ) return true;
+
+        if ( result.constant )
+            result.value = -result.value;
+        else
+        {
+            unsigned int negation = generator.NewNumber();
+            generator.Emit(EventsBytecode::Negate, negation, result.reg);
+            result.reg = negation;
+        }
+
+        return true;
+    }
+
+    bool ParsePrimary(Operand & result)
+    {
+        const std::vector<gd::ExpressionCodeTree::Token> & tokens = tree.GetTokens();
+        if ( position >= tokens.size() ) return false;
+
+        const gd::ExpressionCodeTree::Token & token = tokens[position++];
+        if ( token.type == gd::ExpressionCodeTree::Token::Number )
+        {
+            result.constant = true;
+            result.value = token.value;
+            result.integer = token.integer;
+            return true;
+        }
+        else if ( token.type == gd::ExpressionCodeTree::Token::FunctionCall )
+        {
+            result.constant = false;
+            result.reg = token.code.To<unsigned int>();
+            return true;
+        }
+        else if ( token.type == gd::ExpressionCodeTree::Token::OpeningParenthesis )
+        {
+            if ( !ParseSum(result) || position >= tokens.size() ||
+                tokens[position].type != gd::ExpressionCodeTree::Token::ClosingParenthesis )
+                return false;
+
+            position++;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * \brief Lower an operation, or compute it if both operands are constants. Operations on
+     * integers are computed like in the generated code ( `1/2` is 0 ).
+     */
+    Operand MakeOperation(const Operand & left, const gd::String & op, const Operand & right)
+    {
+        if ( left.constant && right.constant )
+        {
+            Operand result;
+            result.constant = true;
+            result.integer = left.integer && right.integer;
+
+            bool canBeFolded = true;
+            if ( op == "+" ) result.value = left.value + right.value;
+            else if ( op == "-" ) result.value = left.value - right.value;
+            else if ( op == "*" ) result.value = left.value * right.value;
+            else if ( op == "/" )
+            {
+                canBeFolded = right.value != 0;
+                result.value = result.integer ? std::trunc(left.value / right.value) : left.value / right.value;
+            }
+            else if ( op == "%" )
+            {
+                canBeFolded = right.value != 0;
+                result.value = std::fmod(left.value, right.value);
+            }
+
+            if ( canBeFolded && std::isfinite(result.value) ) return result;
+        }
+
+        EventsBytecode::Opcode opcode = EventsBytecode::Add;
+        if ( op == "-" ) opcode = EventsBytecode::Subtract;
+        else if ( op == "*" ) opcode = EventsBytecode::Multiply;
+        else if ( op == "/" ) opcode = EventsBytecode::Divide;
+        else if ( op == "%" ) opcode = EventsBytecode::Modulo;
+
+        Operand result;
+        result.reg = generator.NewNumber();
+        generator.Emit(opcode, result.reg, ToRegister(left), ToRegister(right));
+        return result;
+    }
+
+    unsigned int ToRegister(const Operand & operand)
+    {
+        return operand.constant ? generator.NumberConstant(operand.value) : operand.reg;
+    }
+
+    EventsBytecodeGenerator & generator;
+    Scope & scope;
+    gd::ExpressionCodeTree tree; ///< The tokens of a math expression.
+    std::size_t position; ///< The position in the tokens when lowering the operations.
+    std::vector<unsigned int> stringParts; ///< The registers of the parts of a string expression.
+};
+
+/**
+ * \brief Build the path to a variable, like VariableCodeGenerationCallbacks generates its code.
+ */
+class EventsBytecodeGenerator::VariableCallbacks : public gd::VariableParserCallbacks
+{
+public:
+    VariableCallbacks(EventsBytecodeGenerator & generator_, Scope & scope_, EventsBytecode::VariablePath & path_, const gd::String & object_) :
+        generator(generator_),
+        scope(scope_),
+        path(path_),
+        object(object_)
+    {};
+    virtual ~VariableCallbacks() {};
+
+    void OnRootVariable(gd::String variableName)
+    {
+        const gd::VariablesContainer * variables = NULL;
+        if ( path.root == EventsBytecode::VariablePath::SceneVariables )
+            variables = &generator.layout.GetVariables();
+        else if ( path.root == EventsBytecode::VariablePath::GameVariables )
+            variables = &generator.project.GetVariables();
+        else
+        {
+            std::vector<gd::String> realObjects = generator.codeGenerator.ExpandObjectsName(object, generator.objectContext);
+            if ( !realObjects.empty() )
+                path.object = generator.PickObject(scope, realObjects, true);
+
+            if ( generator.layout.HasObjectNamed(object) )
+                variables = &generator.layout.GetObject(object).GetVariables();
+            else if ( generator.project.HasObjectNamed(object) )
+                variables = &generator.project.GetObject(object).GetVariables();
+        }
+
+        //Declared variables are accessed with their index.
+        if ( variables && variables->Has(variableName) )
+        {
+            std::size_t index = variables->GetPosition(variableName);
+            if ( index < variables->Count() )
+            {
+                path.useIndex = true;
+                path.index = index;
+                return;
+            }
+        }
+
+        path.name = generator.StringConstant(variableName);
+    }
+
+    void OnChildVariable(gd::String variableName)
+    {
+        path.children.push_back(generator.StringConstant(variableName));
+    }
+
+    void OnChildSubscript(gd::String stringExpression)
+    {
+        path.children.push_back(generator.LowerStringExpression(gd::Expression(stringExpression), scope));
+    }
+
+private:
+    EventsBytecodeGenerator & generator;
+    Scope & scope;
+    EventsBytecode::VariablePath & path;
+    gd::String object;
+};
+
+EventsBytecodeGenerator::EventsBytecodeGenerator(gd::Project & project_, const gd::Layout & layout_, const gd::Platform & platform_) :
+    project(project_),
+    layout(layout_),
+    platform(platform_),
+    codeGenerator(project_, layout_, platform_),
+    functionsTable(platform_),
+    bytecode(NULL),
+    currentObject(EventsBytecode::NoRegister),
+    linkDepth(0)
+{
+}
+
+std::shared_ptr<EventsBytecode> EventsBytecodeGenerator::GenerateLayoutBytecode(gd::Project & project, const gd::Layout & layout)
+{
+    EventsBytecodeGenerator generator(project, layout, CppPlatform::Get());
+
+    std::shared_ptr<EventsBytecode> bytecode = std::make_shared<EventsBytecode>();
+    if ( !generator.Generate(layout.GetEvents(), *bytecode) )
+    {
+        std::cout << "Events of " << layout.GetName() << " must be compiled: " << generator.GetError() << std::endl;
+        return nullptr;
+    }
+
+    return bytecode;
+}
+
+bool EventsBytecodeGenerator::Generate(const gd::EventsList & events, EventsBytecode & bytecode_)
+{
+    bytecode = &bytecode_;
+    bytecode->name = "Scene "+layout.GetName();
+    error.clear();
+    numberConstants.clear();
+    stringConstants.clear();
+    numberConstantsValues.clear();
+    stringConstantsValues.clear();
+    linkDepth = 0;
+
+    //Preprocessing can make changes to the events, so the work is done on a copy of the events.
+    gd::EventsList generatedEvents = events;
+    gd::EventsCodeGenerator::DeleteUselessEvents(generatedEvents);
+    codeGenerator.PreprocessEventList(generatedEvents);
+
+    Scope root(NULL, false, false, NewScope());
+    Emit(EventsBytecode::DeclareLists, root.declarations);
+    LowerEventsList(generatedEvents, root);
+    Emit(EventsBytecode::Return);
+
+    RemoveEmptyDeclarations();
+    bytecode = NULL;
+    return error.empty();
+}
+
+void EventsBytecodeGenerator::LowerEventsList(gd::EventsList & events, Scope & parent)
+{
+    for (std::size_t eId = 0;eId < events.GetEventsCount() && error.empty();++eId)
+    {
+        gd::BaseEvent & event = events.GetEvent(eId);
+        if ( event.IsDisabled() || !event.IsExecutable() ) continue;
+
+        //Like the generated code, the last event of a list uses the same objects lists as its parent.
+        Scope scope(&parent, parent.canReuse && eId == events.GetEventsCount()-1, true, NewScope());
+        Emit(EventsBytecode::DeclareLists, scope.declarations);
+        LowerEvent(event, scope);
+    }
+}
+
+void EventsBytecodeGenerator::LowerEvent(gd::BaseEvent & event_, Scope & scope)
+{
+    const gd::String & type = event_.GetType();
+    if ( type == "BuiltinCommonInstructions::Standard" )
+    {
+        gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(event_);
+
+        unsigned int conditionsResult = LowerConditionsList(event.GetConditions(), scope);
+        std::size_t skipActions = conditionsResult != EventsBytecode::NoRegister ?
+            Emit(EventsBytecode::JumpIfFalse, conditionsResult) : 0;
+
+        //Actions use the objects lists picked by the conditions.
+        Scope actionsScope(&scope, true, scope.canReuse, NewScope());
+        Emit(EventsBytecode::DeclareLists, actionsScope.declarations);
+        LowerActionsList(event.GetActions(), actionsScope);
+        LowerEventsList(event.GetSubEvents(), actionsScope);
+
+        if ( conditionsResult != EventsBytecode::NoRegister ) PatchJump(skipActions);
+    }
+    else if ( type == "BuiltinCommonInstructions::While" )
+    {
+        gd::WhileEvent & event = dynamic_cast<gd::WhileEvent&>(event_);
+
+        //Objects are picked again at each iteration.
+        Scope loopScope(&scope, false, false, NewScope());
+        unsigned int loopCount = EventsBytecode::NoRegister;
+        if ( event.HasInfiniteLoopWarning() )
+        {
+            loopCount = NewNumber();
+            Emit(EventsBytecode::Move, loopCount, NumberConstant(0));
+        }
+
+        std::size_t start = Emit(EventsBytecode::DeclareLists, loopScope.declarations);
+        std::vector<std::size_t> exits;
+        unsigned int whileConditionsResult = LowerConditionsList(event.GetWhileConditions(), loopScope);
+        if ( whileConditionsResult != EventsBytecode::NoRegister )
+            exits.push_back(Emit(EventsBytecode::JumpIfFalse, whileConditionsResult));
+        if ( loopCount != EventsBytecode::NoRegister )
+            exits.push_back(Emit(EventsBytecode::InfiniteLoopWarning, loopCount));
+
+        unsigned int conditionsResult = LowerConditionsList(event.GetConditions(), loopScope);
+        if ( conditionsResult != EventsBytecode::NoRegister )
+            Emit(EventsBytecode::JumpIfFalse, conditionsResult, start);
+        LowerActionsList(event.GetActions(), loopScope);
+        LowerEventsList(event.GetSubEvents(), loopScope);
+        Emit(EventsBytecode::Jump, start);
+
+        for (auto exit : exits) PatchJump(exit);
+    }
+    else if ( type == "BuiltinCommonInstructions::Repeat" )
+    {
+        gd::RepeatEvent & event = dynamic_cast<gd::RepeatEvent&>(event_);
+
+        //The number of repetitions is an integer, computed with the objects lists of the event.
+        unsigned int repeatCount = NewNumber();
+        Emit(EventsBytecode::Truncate, repeatCount, LowerMathExpression(gd::Expression(event.GetRepeatExpression()), scope));
+        unsigned int repeatIndex = NewNumber();
+        Emit(EventsBytecode::Move, repeatIndex, NumberConstant(0));
+
+        //Objects are picked again at each iteration.
+        Scope loopScope(&scope, false, false, NewScope());
+        unsigned int repeatIndexIsValid = NewNumber();
+        std::size_t start = Emit(EventsBytecode::Less, repeatIndexIsValid, repeatIndex, repeatCount);
+        std::size_t exit = Emit(EventsBytecode::JumpIfFalse, repeatIndexIsValid);
+        Emit(EventsBytecode::DeclareLists, loopScope.declarations);
+
+        unsigned int conditionsResult = LowerConditionsList(event.GetConditions(), loopScope);
+        std::size_t skipActions = conditionsResult != EventsBytecode::NoRegister ?
+            Emit(EventsBytecode::JumpIfFalse, conditionsResult) : 0;
+        LowerActionsList(event.GetActions(), loopScope);
+        LowerEventsList(event.GetSubEvents(), loopScope);
+
+        if ( conditionsResult != EventsBytecode::NoRegister ) PatchJump(skipActions);
+        Emit(EventsBytecode::Increment, repeatIndex);
+        Emit(EventsBytecode::Jump, start);
+        PatchJump(exit);
+    }
+    else if ( type == "BuiltinCommonInstructions::ForEach" )
+    {
+        gd::ForEachEvent & event = dynamic_cast<gd::ForEachEvent&>(event_);
+
+        std::vector<gd::String> realObjects = codeGenerator.ExpandObjectsName(event.GetObjectToPick(), objectContext);
+        if ( realObjects.empty() ) return;
+
+        //The lists of the iterated objects only contain the current object: they are filled by the loop.
+        //The other lists are declared again at each iteration.
+        Scope loopScope(&scope, false, false, NewScope());
+        EventsBytecode::ForEachDescriptor loop;
+        for (auto & object : realObjects)
+        {
+            loop.sources.push_back(NeedList(scope, object));
+            loop.targets.push_back(NewList());
+            loopScope.lists[object] = loop.targets.back();
+        }
+        loop.objects = NewList();
+        bytecode->forEachLoops.push_back(loop);
+        unsigned int loopIndex = bytecode->forEachLoops.size()-1;
+
+        std::size_t start = Emit(EventsBytecode::ForEach, loopIndex);
+        std::size_t body = Emit(EventsBytecode::DeclareLists, loopScope.declarations);
+
+        unsigned int conditionsResult = LowerConditionsList(event.GetConditions(), loopScope);
+        std::size_t skipActions = conditionsResult != EventsBytecode::NoRegister ?
+            Emit(EventsBytecode::JumpIfFalse, conditionsResult) : 0;
+        LowerActionsList(event.GetActions(), loopScope);
+        LowerEventsList(event.GetSubEvents(), loopScope);
+
+        if ( conditionsResult != EventsBytecode::NoRegister ) PatchJump(skipActions);
+        Emit(EventsBytecode::ForEachNext, loopIndex, body);
+        PatchJump(start);
+    }
+    else if ( type == "BuiltinCommonInstructions::Group" )
+        LowerEventsList(event_.GetSubEvents(), scope);
+    else if ( type == "BuiltinCommonInstructions::Link" )
+        LowerLinkedEvents(dynamic_cast<gd::LinkEvent&>(event_).GetTarget());
+    else
+        Unsupported("The event "+type+" cannot be lowered.");
+}
+
+void EventsBytecodeGenerator::LowerLinkedEvents(const gd::String & target)
+{
+    //Links left by the preprocessing refer to external events compiled separately, which are
+    //called with their own objects lists.
+    if ( !project.HasExternalEventsNamed(target) )
+    {
+        Unsupported("The external events "+target+" do not exist.");
+        return;
+    }
+    if ( linkDepth >= 16 )
+    {
+        Unsupported("The external events "+target+" are linked too many times.");
+        return;
+    }
+
+    gd::EventsList linkedEvents = project.GetExternalEvents(target).GetEvents();
+    gd::EventsCodeGenerator::DeleteUselessEvents(linkedEvents);
+    codeGenerator.PreprocessEventList(linkedEvents);
+
+    linkDepth++;
+    Scope root(NULL, false, false, NewScope());
+    Emit(EventsBytecode::DeclareLists, root.declarations);
+    LowerEventsList(linkedEvents, root);
+    linkDepth--;
+}
+
+unsigned int EventsBytecodeGenerator::LowerConditionsList(gd::InstructionsList & conditions, Scope & scope)
+{
+    if ( conditions.empty() ) return EventsBytecode::NoRegister;
+
+    //Conditions are only checked if the previous ones are true.
+    unsigned int result = NewNumber();
+    std::vector<std::size_t> jumps;
+    for (std::size_t cId = 0;cId < conditions.size();++cId)
+    {
+        if ( cId != 0 ) jumps.push_back(Emit(EventsBytecode::JumpIfFalse, result));
+        LowerCondition(conditions[cId], result, scope);
+    }
+
+    for (auto jump : jumps) PatchJump(jump);
+    return result;
+}
+
+void EventsBytecodeGenerator::LowerCondition(gd::Instruction & condition, unsigned int result, Scope & scope)
+{
+    const gd::InstructionMetadata & metadata = gd::MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+    if ( metadata.codeExtraInformation.HasCustomCodeGenerator() )
+        LowerCustomCondition(condition, result, scope);
+    else
+        LowerInstruction(condition, metadata, result, scope);
+}
+
+void EventsBytecodeGenerator::LowerCustomCondition(gd::Instruction & condition, unsigned int result, Scope & scope)
+{
+    const gd::String & type = condition.GetType();
+    gd::InstructionsList & subConditions = condition.GetSubInstructions();
+    if ( type == "BuiltinCommonInstructions::Or" )
+    {
+        //Each sub condition picks objects in its own lists, which are then merged.
+        std::size_t finalDeclarations = NewScope();
+        Emit(EventsBytecode::DeclareLists, finalDeclarations);
+        Emit(EventsBytecode::Move, result, NumberConstant(0));
+
+        std::map<gd::String, unsigned int> finalLists;
+        for (std::size_t cId = 0;cId < subConditions.size();++cId)
+        {
+            Scope conditionScope(&scope, false, false, NewScope());
+            Emit(EventsBytecode::DeclareLists, conditionScope.declarations);
+            unsigned int conditionResult = NewNumber();
+            LowerCondition(subConditions[cId], conditionResult, conditionScope);
+
+            std::size_t skip = Emit(EventsBytecode::JumpIfFalse, conditionResult);
+            Emit(EventsBytecode::Move, result, NumberConstant(1));
+            for (auto & list : conditionScope.lists)
+            {
+                if ( finalLists.find(list.first) == finalLists.end() )
+                {
+                    finalLists[list.first] = NewList();
+                    bytecode->scopes[finalDeclarations].push_back(
+                        EventsBytecode::ListDeclaration(EventsBytecode::ListDeclaration::EmptyList, finalLists[list.first]));
+                }
+                Emit(EventsBytecode::MergeList, finalLists[list.first], list.second);
+            }
+            PatchJump(skip);
+        }
+
+        //The lists of the event are only made of the objects picked by the sub conditions.
+        for (auto & list : finalLists)
+            Emit(EventsBytecode::MoveList, NeedList(scope, list.first, true), list.second);
+    }
+    else if ( type == "BuiltinCommonInstructions::And" )
+    {
+        unsigned int conditionsResult = LowerConditionsList(subConditions, scope);
+        Emit(EventsBytecode::Move, result, conditionsResult != EventsBytecode::NoRegister ? conditionsResult : NumberConstant(1));
+    }
+    else if ( type == "BuiltinCommonInstructions::Not" )
+    {
+        //Sub conditions are checked until one is true.
+        std::vector<std::size_t> jumps;
+        unsigned int conditionResult = NewNumber();
+        for (std::size_t cId = 0;cId < subConditions.size();++cId)
+        {
+            LowerCondition(subConditions[cId], conditionResult, scope);
+            jumps.push_back(Emit(EventsBytecode::JumpIfTrue, conditionResult));
+        }
+
+        Emit(EventsBytecode::Move, result, NumberConstant(1));
+        std::size_t end = Emit(EventsBytecode::Jump);
+        for (auto jump : jumps) PatchJump(jump);
+        Emit(EventsBytecode::Move, result, NumberConstant(0));
+        PatchJump(end);
+    }
+    else if ( type == "BuiltinCommonInstructions::Once" )
+        Emit(EventsBytecode::TriggerOnce, result, bytecode->triggerOnceCount++);
+    else if ( type == "BuiltinCommonInstructions::OnceForEachObject" )
+    {
+        gd::String objects = condition.GetParametersCount() > 0 ? condition.GetParameter(0).GetPlainString() : "";
+        unsigned int group = NeedGroup(scope, codeGenerator.ExpandObjectsName(objects, objectContext));
+        Emit(EventsBytecode::TriggerOnceForEachObject, result, group, bytecode->triggerOnceCount++);
+    }
+    else if ( type == "Egal" )
+    {
+        //Compare two expressions.
+        if ( condition.GetParametersCount() < 3 )
+        {
+            Unsupported("The condition "+type+" has missing parameters.");
+            return;
+        }
+
+        unsigned int value1 = LowerMathExpression(condition.GetParameter(0), scope);
+        unsigned int value2 = LowerMathExpression(condition.GetParameter(2), scope);
+
+        const gd::String & op = condition.GetParameter(1).GetPlainString();
+        if ( op == "=" || op.empty() ) Emit(EventsBytecode::Equal, result, value1, value2);
+        else if ( op == ">" ) Emit(EventsBytecode::Less, result, value2, value1);
+        else if ( op == "<" ) Emit(EventsBytecode::Less, result, value1, value2);
+        else if ( op == "<=" ) Emit(EventsBytecode::LessOrEqual, result, value1, value2);
+        else if ( op == ">=" ) Emit(EventsBytecode::LessOrEqual, result, value2, value1);
+        else if ( op == "!=" ) Emit(EventsBytecode::NotEqual, result, value1, value2);
+        else Emit(EventsBytecode::Move, result, NumberConstant(0));
+    }
+    else
+        Unsupported("The condition "+type+" has a custom code generator.");
+}
+
+void EventsBytecodeGenerator::LowerActionsList(gd::InstructionsList & actions, Scope & scope)
+{
+    for (std::size_t aId = 0;aId < actions.size() && error.empty();++aId)
+        LowerAction(actions[aId], scope);
+}
+
+void EventsBytecodeGenerator::LowerAction(gd::Instruction & action, Scope & scope)
+{
+    const gd::InstructionMetadata & metadata = gd::MetadataProvider::GetActionMetadata(platform, action.GetType());
+    if ( metadata.codeExtraInformation.HasCustomCodeGenerator() )
+        Unsupported("The action "+action.GetType()+" has a custom code generator.");
+    else
+        LowerInstruction(action, metadata, EventsBytecode::NoRegister, scope);
+}
+
+void EventsBytecodeGenerator::LowerInstruction(gd::Instruction & instruction, const gd::InstructionMetadata & metadata,
+    unsigned int result, Scope & scope)
+{
+    bool isCondition = result != EventsBytecode::NoRegister;
+    const gd::String & type = instruction.GetType();
+
+    //Be sure there is no lack of parameter.
+    std::vector<gd::Expression> parameters = instruction.GetParameters();
+    while ( parameters.size() < metadata.parameters.size() )
+        parameters.push_back(gd::Expression(""));
+
+    //Like the generated code, do nothing if the objects of the parameters are not valid.
+    for (std::size_t pNb = 0;pNb < metadata.parameters.size();++pNb)
+    {
+        if ( !gd::ParameterMetadata::IsObject(metadata.parameters[pNb].type) ) continue;
+
+        const gd::String & objectInParameter = parameters[pNb].GetPlainString();
+        if ( !HasObjectOrGroupNamed(project, layout, objectInParameter) ||
+            (!metadata.parameters[pNb].supplementaryInformation.empty() &&
+             gd::GetTypeOfObject(project, layout, objectInParameter) != metadata.parameters[pNb].supplementaryInformation) )
+        {
+            if ( isCondition ) Emit(EventsBytecode::Move, result, NumberConstant(0));
+            return;
+        }
+    }
+
+    bool lowered = false;
+    if ( isCondition ? gd::MetadataProvider::HasCondition(platform, type) : gd::MetadataProvider::HasAction(platform, type) )
+    {
+        //Some conditions already have a "conditionInverted" parameter.
+        bool inversionInParameter = std::find_if(metadata.parameters.begin(), metadata.parameters.end(), [](const gd::ParameterMetadata & parameter) {
+            return parameter.type == "conditionInverted";
+        }) != metadata.parameters.end();
+
+        EventsBytecode::FunctionCall call = LowerInstructionCall(instruction, metadata, parameters, scope);
+        if ( isCondition )
+        {
+            call.resultType = EventsBytecode::FunctionCall::ConditionResult;
+            call.result = result;
+            call.inverted = instruction.IsInverted() && !inversionInParameter;
+        }
+        Emit(EventsBytecode::Call, AddCall(call));
+        lowered = true;
+    }
+
+    gd::String objectName = parameters.empty() ? "" : parameters[0].GetPlainString();
+    gd::String objectType = gd::GetTypeOfObject(project, layout, objectName);
+    if ( !objectName.empty() && !metadata.parameters.empty() && (isCondition ?
+        gd::MetadataProvider::HasObjectCondition(platform, objectType, type) :
+        gd::MetadataProvider::HasObjectAction(platform, objectType, type)) )
+    {
+        if ( isCondition && !lowered ) Emit(EventsBytecode::Move, result, NumberConstant(0));
+        lowered = true;
+
+        for (auto & object : codeGenerator.ExpandObjectsName(objectName, objectContext))
+            LowerObjectsLoop(instruction, metadata, parameters, object, result, scope);
+    }
+
+    gd::String behaviorName = parameters.size() < 2 ? "" : parameters[1].GetPlainString();
+    gd::String behaviorType = gd::GetTypeOfBehavior(project, layout, behaviorName);
+    if ( metadata.parameters.size() >= 2 && (isCondition ?
+        gd::MetadataProvider::HasBehaviorCondition(platform, behaviorType, type) :
+        gd::MetadataProvider::HasBehaviorAction(platform, behaviorType, type)) )
+    {
+        if ( isCondition && !lowered ) Emit(EventsBytecode::Move, result, NumberConstant(0));
+        lowered = true;
+
+        for (auto & object : codeGenerator.ExpandObjectsName(objectName, objectContext))
+        {
+            //Like the generated code, the list is needed even if the object has not the behavior.
+            NeedList(scope, object);
+
+            std::vector<gd::String> behaviors = gd::GetBehaviorsOfObject(project, layout, object);
+            if ( std::find(behaviors.begin(), behaviors.end(), behaviorName) == behaviors.end() )
+            {
+                std::cout << "Bad behavior requested" << std::endl;
+                continue;
+            }
+
+            LowerObjectsLoop(instruction, metadata, parameters, object, result, scope);
+        }
+    }
+
+    if ( isCondition && !lowered ) Emit(EventsBytecode::Move, result, NumberConstant(0));
+}
+
+void EventsBytecodeGenerator::LowerObjectsLoop(gd::Instruction & instruction, const gd::InstructionMetadata & metadata,
+    const std::vector<gd::Expression> & parameters, const gd::String & object, unsigned int result, Scope & scope)
+{
+    bool isCondition = result != EventsBytecode::NoRegister;
+
+    //The conditions remove from the list the objects for which they are false.
+    EventsBytecode::ObjectsLoopDescriptor loop;
+    loop.list = NeedList(scope, object);
+    loop.object = NewObject();
+    if ( isCondition )
+    {
+        loop.filterResult = NewNumber();
+        loop.conditionResult = result;
+    }
+    bytecode->objectsLoops.push_back(loop);
+    unsigned int loopIndex = bytecode->objectsLoops.size()-1;
+
+    objectContext.SetCurrentObject(object);
+    currentObject = loop.object;
+
+    std::size_t start = Emit(EventsBytecode::ObjectsLoop, loopIndex);
+    std::size_t body = Position();
+    EventsBytecode::FunctionCall call = LowerInstructionCall(instruction, metadata, parameters, scope);
+    if ( isCondition )
+    {
+        call.resultType = EventsBytecode::FunctionCall::ConditionResult;
+        call.result = loop.filterResult;
+        call.inverted = instruction.IsInverted();
+    }
+    Emit(EventsBytecode::CallForObject, AddCall(call), loop.object);
+    Emit(EventsBytecode::ObjectsLoopNext, loopIndex, body);
+    PatchJump(start);
+
+    objectContext.SetNoCurrentObject();
+    currentObject = EventsBytecode::NoRegister;
+}
+
+EventsBytecode::FunctionCall EventsBytecodeGenerator::LowerInstructionCall(const gd::Instruction & instruction,
+    const gd::InstructionMetadata & metadata, const std::vector<gd::Expression> & parameters, Scope & scope)
+{
+    //Instructions working on a number or a string have a function for each ( relational ) operator.
+    gd::String operatorString;
+    for (std::size_t i = metadata.parameters.size();i > 0;--i)
+    {
+        const gd::String & type = metadata.parameters[i-1].type;
+        if ( type != "relationalOperator" && type != "operator" ) continue;
+
+        operatorString = parameters[i-1].GetPlainString();
+        const std::vector<gd::String> & operators = type == "relationalOperator" ?
+            EventsFunctionsTableCodeGenerator::GetRelationalOperators() : EventsFunctionsTableCodeGenerator::GetOperators();
+        if ( type == "relationalOperator" && operatorString == "=" ) operatorString = "==";
+        if ( std::find(operators.begin(), operators.end(), operatorString) == operators.end() ) operatorString = operators[0];
+        break;
+    }
+
+    EventsBytecode::FunctionCall call;
+    call.function = functionsTable.GetInstructionFunctionKey(metadata, operatorString);
+    if ( call.function.empty() )
+        Unsupported("The instruction "+instruction.GetType()+" has no function in the events functions table.");
+
+    bool freeCondition = objectContext.GetCurrentObject().empty();
+    call.arguments = LowerArguments(parameters, metadata.parameters, freeCondition && instruction.IsInverted(), scope);
+    return call;
+}
+
+std::vector<unsigned int> EventsBytecodeGenerator::LowerArguments(const std::vector<gd::Expression> & parameters,
+    const std::vector<gd::ParameterMetadata> & parametersMetadata, bool conditionInverted, Scope & scope)
+{
+    std::vector<unsigned int> arguments;
+
+    std::vector<gd::Expression> defaultParameters(parametersMetadata.size());
+    const gd::Expression * previousParameter = NULL;
+    for (std::size_t pNb = 0;pNb < parametersMetadata.size();++pNb)
+    {
+        const gd::Expression * parameter = pNb < parameters.size() ? &parameters[pNb] : &defaultParameters[pNb];
+        if ( parameter->GetPlainString().empty() && parametersMetadata[pNb].optional )
+        {
+            defaultParameters[pNb] = gd::Expression(parametersMetadata[pNb].defaultValue);
+            parameter = &defaultParameters[pNb];
+        }
+
+        arguments.push_back(LowerArgument(*parameter, parametersMetadata[pNb],
+            previousParameter ? previousParameter->GetPlainString() : "", conditionInverted, scope));
+        previousParameter = parameter;
+    }
+
+    return arguments;
+}
+
+unsigned int EventsBytecodeGenerator::LowerArgument(const gd::Expression & parameter, const gd::ParameterMetadata & metadata,
+    const gd::String & previousParameter, bool conditionInverted, Scope & scope)
+{
+    const gd::String & type = metadata.type;
+    const gd::String & plainString = parameter.GetPlainString();
+
+    //The scene, the operators and inline code are directly written in the functions of the table.
+    if ( type == "currentScene" || type == "inlineCode" || type == "relationalOperator" || type == "operator" )
+        return 0;
+    else if ( type == "objectList" || type == "objectListWithoutPicking" )
+        return NeedGroup(scope, codeGenerator.ExpandObjectsName(plainString, objectContext), type == "objectListWithoutPicking");
+    else if ( type == "objectPtr" )
+        return PickObject(scope, codeGenerator.ExpandObjectsName(plainString, objectContext), false);
+    else if ( type == "scenevar" )
+        return LowerVariable(plainString, EventsBytecode::VariablePath::SceneVariables, "", scope);
+    else if ( type == "globalvar" )
+        return LowerVariable(plainString, EventsBytecode::VariablePath::GameVariables, "", scope);
+    else if ( type == "objectvar" )
+    {
+        //Object is either the object of the previous parameter or, if it is empty,
+        //the object being picked by the instruction.
+        gd::String object = previousParameter;
+        if ( object.empty() ) object = objectContext.GetCurrentObject();
+
+        return LowerVariable(plainString, EventsBytecode::VariablePath::ObjectVariables, object, scope);
+    }
+    else if ( type == "key" || type == "mouse" )
+    {
+        int code = type == "key" ? InputManager::GetKeyCode(plainString) : InputManager::GetButtonCode(plainString);
+        if ( code == -1 ) Unsupported("The "+type+" \""+plainString+"\" is unknown.");
+
+        return NumberConstant(code);
+    }
+    else if ( type == "expression" || type == "camera" )
+        return LowerMathExpression(parameter, scope);
+    else if ( type == "string" || type == "layer" || type == "color" || type == "file" || type == "joyaxis" )
+        return LowerStringExpression(parameter, scope);
+    else if ( type == "yesorno" )
+        return NumberConstant((plainString == "yes" || plainString == "oui") ? 1 : 0);
+    else if ( type == "trueorfalse" )
+        return NumberConstant((plainString == "True" || plainString == "Vrai") ? 1 : 0);
+    else if ( type == "conditionInverted" )
+        return NumberConstant(conditionInverted ? 1 : 0);
+
+    return StringConstant(plainString);
+}
+
+unsigned int EventsBytecodeGenerator::LowerMathExpression(const gd::Expression & expression, Scope & scope)
+{
+    std::size_t start = Position();
+
+    ExpressionCallbacks callbacks(*this, scope);
+    gd::ExpressionParser parser(expression);
+    if ( !parser.ParseMathExpression(platform, project, layout, callbacks) )
+    {
+        std::cout << "Error :" << parser.firstErrorStr << " in: "<< expression.GetPlainString() << std::endl;
+
+        //Like the generated code, use 0 for invalid expressions.
+        bytecode->instructions.erase(bytecode->instructions.begin()+start, bytecode->instructions.end());
+        return NumberConstant(0);
+    }
+
+    return callbacks.GetNumberResult();
+}
+
+unsigned int EventsBytecodeGenerator::LowerStringExpression(const gd::Expression & expression, Scope & scope)
+{
+    std::size_t start = Position();
+
+    ExpressionCallbacks callbacks(*this, scope);
+    gd::ExpressionParser parser(expression);
+    if ( !parser.ParseStringExpression(platform, project, layout, callbacks) )
+    {
+        std::cout << "Error in text expression" << parser.firstErrorStr << std::endl;
+
+        //Like the generated code, use an empty string for invalid expressions.
+        bytecode->instructions.erase(bytecode->instructions.begin()+start, bytecode->instructions.end());
+        return StringConstant("");
+    }
+
+    return callbacks.GetStringResult();
+}
+
+unsigned int EventsBytecodeGenerator::LowerVariable(const gd::String & variable, EventsBytecode::VariablePath::Root root,
+    const gd::String & object, Scope & scope)
+{
+    EventsBytecode::VariablePath path;
+    path.root = root;
+
+    VariableCallbacks callbacks(*this, scope, path, object);
+    gd::VariableParser parser(variable);
+    if ( !parser.Parse(callbacks) )
+        Unsupported("The variable \""+variable+"\" cannot be parsed.");
+
+    bytecode->variables.push_back(path);
+    unsigned int reg = bytecode->variablesCount++;
+    Emit(EventsBytecode::ResolveVariable, reg, bytecode->variables.size()-1);
+    return reg;
+}
+
+unsigned int EventsBytecodeGenerator::NeedList(Scope & scope, const gd::String & name, bool empty)
+{
+    auto it = scope.lists.find(name);
+    if ( it != scope.lists.end() ) return it->second;
+
+    //*Optimization*: Like the generated code, a scope reusing the lists of its parent does not
+    //declare again the lists already declared by its parent.
+    for (Scope * reusing = &scope;reusing->reuse && reusing->parent;reusing = reusing->parent)
+    {
+        auto parentList = reusing->parent->lists.find(name);
+        if ( parentList != reusing->parent->lists.end() )
+        {
+            scope.lists[name] = parentList->second;
+            return parentList->second;
+        }
+    }
+
+    unsigned int list = NewList();
+    scope.lists[name] = list;
+
+    //Copy the list of the nearest parent having it, otherwise pick all the objects.
+    for (Scope * parent = scope.parent;parent;parent = parent->parent)
+    {
+        auto parentList = parent->lists.find(name);
+        if ( parentList != parent->lists.end() )
+        {
+            bytecode->scopes[scope.declarations].push_back(EventsBytecode::ListDeclaration(
+                EventsBytecode::ListDeclaration::CopyOfList, list, parentList->second));
+            return list;
+        }
+    }
+
+    bytecode->scopes[scope.declarations].push_back(empty ?
+        EventsBytecode::ListDeclaration(EventsBytecode::ListDeclaration::EmptyList, list) :
+        EventsBytecode::ListDeclaration(EventsBytecode::ListDeclaration::AllObjects, list, StringConstant(name)));
+    return list;
+}
+
+unsigned int EventsBytecodeGenerator::NeedGroup(Scope & scope, const std::vector<gd::String> & objects, bool empty)
+{
+    EventsBytecode::ObjectsGroup group;
+    for (auto & object : objects)
+        group.lists.push_back(std::make_pair(object, NeedList(scope, object, empty)));
+
+    bytecode->groups.push_back(group);
+    return bytecode->groups.size()-1;
+}
+
+unsigned int EventsBytecodeGenerator::PickObject(Scope & scope, const std::vector<gd::String> & objects, bool lastNonEmptyList)
+{
+    //If the object currently used by the instruction is available, use it directly.
+    const gd::String & current = objectContext.GetCurrentObject();
+    if ( !current.empty() && std::find(objects.begin(), objects.end(), current) != objects.end() )
+        return currentObject;
+
+    unsigned int object = NewObject();
+    Emit(EventsBytecode::PickObject, object, NeedGroup(scope, objects), lastNonEmptyList ? 1 : 0);
+    return object;
+}
+
+unsigned int EventsBytecodeGenerator::NumberConstant(double value)
+{
+    auto it = numberConstants.find(value);
+    if ( it != numberConstants.end() ) return it->second;
+
+    unsigned int reg = NewNumber();
+    numberConstants[value] = reg;
+    numberConstantsValues[reg] = value;
+    bytecode->numberConstants.push_back(std::make_pair(reg, value));
+    return reg;
+}
+
+unsigned int EventsBytecodeGenerator::StringConstant(const gd::String & value)
+{
+    auto it = stringConstants.find(value);
+    if ( it != stringConstants.end() ) return it->second;
+
+    unsigned int reg = NewString();
+    stringConstants[value] = reg;
+    stringConstantsValues[reg] = value;
+    bytecode->stringConstants.push_back(std::make_pair(reg, value));
+    return reg;
+}
+
+bool EventsBytecodeGenerator::IsNumberConstant(unsigned int reg, double & value) const
+{
+    auto it = numberConstantsValues.find(reg);
+    if ( it == numberConstantsValues.end() ) return false;
+
+    value = it->second;
+    return true;
+}
+
+bool EventsBytecodeGenerator::IsStringConstant(unsigned int reg, gd::String & value) const
+{
+    auto it = stringConstantsValues.find(reg);
+    if ( it == stringConstantsValues.end() ) return false;
+
+    value = it->second;
+    return true;
+}
+
+std::size_t EventsBytecodeGenerator::NewScope()
+{
+    bytecode->scopes.push_back(std::vector<EventsBytecode::ListDeclaration>());
+    return bytecode->scopes.size()-1;
+}
+
+std::size_t EventsBytecodeGenerator::Emit(EventsBytecode::Opcode opcode, unsigned int a, unsigned int b, unsigned int c)
+{
+    bytecode->instructions.push_back(EventsBytecode::Instruction(opcode, a, b, c));
+    return bytecode->instructions.size()-1;
+}
+
+unsigned int EventsBytecodeGenerator::AddCall(const EventsBytecode::FunctionCall & call)
+{
+    bytecode->calls.push_back(call);
+    return bytecode->calls.size()-1;
+}
+
+void EventsBytecodeGenerator::PatchJump(std::size_t position)
+{
+    EventsBytecode::Instruction & instruction = bytecode->instructions[position];
+    if ( instruction.opcode == EventsBytecode::Jump )
+        instruction.a = Position();
+    else
+        instruction.b = Position();
+}
+
+void EventsBytecodeGenerator::RemoveEmptyDeclarations()
+{
+    std::vector<EventsBytecode::Instruction> & instructions = bytecode->instructions;
+
+    //Compute the new position of each instruction, then update the jumps.
+    std::vector<unsigned int> newPositions(instructions.size()+1);
+    unsigned int newPosition = 0;
+    for (std::size_t i = 0;i<instructions.size();++i)
+    {
+        newPositions[i] = newPosition;
+        if ( instructions[i].opcode != EventsBytecode::DeclareLists || !bytecode->scopes[instructions[i].a].empty() )
+            newPosition++;
+    }
+    newPositions[instructions.size()] = newPosition;
+
+    std::vector<EventsBytecode::Instruction> keptInstructions;
+    for (auto instruction : instructions)
+    {
+        if ( instruction.opcode == EventsBytecode::DeclareLists && bytecode->scopes[instruction.a].empty() )
+            continue;
+
+        switch ( instruction.opcode )
+        {
+            case EventsBytecode::Jump:
+                instruction.a = newPositions[instruction.a];
+                break;
+            case EventsBytecode::JumpIfFalse:
+            case EventsBytecode::JumpIfTrue:
+            case EventsBytecode::ObjectsLoop:
+            case EventsBytecode::ObjectsLoopNext:
+            case EventsBytecode::ForEach:
+            case EventsBytecode::ForEachNext:
+            case EventsBytecode::InfiniteLoopWarning:
+                instruction.b = newPositions[instruction.b];
+                break;
+            default:
+                break;
+        }
+        keptInstructions.push_back(instruction);
+    }
+
+    instructions.swap(keptInstructions);
+}
+
+void EventsBytecodeGenerator::Unsupported(const gd::String & reason)
+{
+    if ( error.empty() ) error = reason;
+}
+
+#endif
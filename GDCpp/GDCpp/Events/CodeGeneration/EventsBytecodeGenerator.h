@@ -0,0 +1,201 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#if defined(GD_IDE_ONLY)
+
+#ifndef EVENTSBYTECODEGENERATOR_H
+#define EVENTSBYTECODEGENERATOR_H
+#include <map>
+#include <memory>
+#include <vector>
+#include "GDCore/String.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCpp/Events/CodeGeneration/EventsFunctionsTableCodeGenerator.h"
+#include "GDCpp/Runtime/EventsBytecode.h"
+namespace gd { class Project; }
+namespace gd { class Layout; }
+namespace gd { class Platform; }
+namespace gd { class EventsList; }
+namespace gd { class BaseEvent; }
+namespace gd { class Instruction; }
+namespace gd { class InstructionMetadata; }
+namespace gd { class Expression; }
+namespace gd { class ParameterMetadata; }
+
+/**
+ * \brief Lower events to an EventsBytecode, run by the EventsBytecodeInterpreter without
+ * compiling anything.
+ *
+ * The bytecode does exactly what the code generated by EventsCodeGenerator does: the objects
+ * lists are declared, reused and copied the same way, and conditions, actions and expressions
+ * call the functions of the EventsFunctionsTable, which call the same runtime functions as the
+ * generated code. Math expressions are computed on doubles.
+ *
+ * Events, conditions, actions and expressions having a custom code generator ( except the
+ * common conditions of BuiltinCommonInstructions ) cannot be lowered: Generate returns false
+ * and the events must be compiled.
+ *
+ * \see EventsBytecodeInterpreter
+ * \ingroup CodeGeneration
+ */
+class GD_API EventsBytecodeGenerator
+{
+public:
+    EventsBytecodeGenerator(gd::Project & project, const gd::Layout & layout, const gd::Platform & platform);
+    virtual ~EventsBytecodeGenerator() {};
+
+    /**
+     * \brief Lower the events of \a layout to a bytecode using the functions of the extensions of
+     * the C++ platform.
+     * \return The bytecode, or nullptr if the events cannot be lowered.
+     */
+    static std::shared_ptr<EventsBytecode> GenerateLayoutBytecode(gd::Project & project, const gd::Layout & layout);
+
+    /**
+     * \brief Lower \a events to \a bytecode.
+     * \return false if the events cannot be lowered ( see GetError ).
+     */
+    bool Generate(const gd::EventsList & events, EventsBytecode & bytecode);
+
+    /**
+     * \brief Return the reason why the last call to Generate failed.
+     */
+    const gd::String & GetError() const { return error; }
+
+private:
+    /**
+     * \brief The objects lists of an event or of the actions of an event.
+     */
+    struct Scope
+    {
+        Scope(Scope * parent_, bool reuse_, bool canReuse_, std::size_t declarations_) :
+            parent(parent_), reuse(reuse_), canReuse(canReuse_), declarations(declarations_) {};
+
+        Scope * parent;
+        bool reuse; ///< True if the scope uses the same objects lists as its parent.
+        bool canReuse; ///< True if the last child of the scope can use the same objects lists.
+        std::size_t declarations; ///< The index of the declarations of the scope in the bytecode.
+        std::map<gd::String, unsigned int> lists; ///< The objects lists of the scope, with their names.
+    };
+
+    class ExpressionCallbacks;
+    class VariableCallbacks;
+
+    void LowerEventsList(gd::EventsList & events, Scope & parent);
+    void LowerEvent(gd::BaseEvent & event, Scope & scope);
+    void LowerLinkedEvents(const gd::String & target);
+
+    /**
+     * \brief Lower a list of conditions.
+     * \return The number register storing true if all the conditions are true, or NoRegister
+     * if there is no condition.
+     */
+    unsigned int LowerConditionsList(gd::InstructionsList & conditions, Scope & scope);
+    void LowerCondition(gd::Instruction & condition, unsigned int result, Scope & scope);
+    void LowerCustomCondition(gd::Instruction & condition, unsigned int result, Scope & scope);
+    void LowerActionsList(gd::InstructionsList & actions, Scope & scope);
+    void LowerAction(gd::Instruction & action, Scope & scope);
+
+    /**
+     * \brief Lower a condition or an action which is not a custom one.
+     * \param result The register of the result of a condition, or NoRegister for an action.
+     */
+    void LowerInstruction(gd::Instruction & instruction, const gd::InstructionMetadata & metadata,
+        unsigned int result, Scope & scope);
+
+    /**
+     * \brief Lower the loop calling an object or behavior instruction for each object of \a object.
+     */
+    void LowerObjectsLoop(gd::Instruction & instruction, const gd::InstructionMetadata & metadata,
+        const std::vector<gd::Expression> & parameters, const gd::String & object, unsigned int result, Scope & scope);
+
+    /**
+     * \brief Prepare the call to an instruction for the object currently set, or a free
+     * instruction if no object is set.
+     */
+    EventsBytecode::FunctionCall LowerInstructionCall(const gd::Instruction & instruction, const gd::InstructionMetadata & metadata,
+        const std::vector<gd::Expression> & parameters, Scope & scope);
+
+    /**
+     * \brief Lower the parameters of a condition, action or expression and return their registers.
+     * \param conditionInverted The value of the "conditionInverted" parameters.
+     */
+    std::vector<unsigned int> LowerArguments(const std::vector<gd::Expression> & parameters,
+        const std::vector<gd::ParameterMetadata> & parametersMetadata, bool conditionInverted, Scope & scope);
+    unsigned int LowerArgument(const gd::Expression & parameter, const gd::ParameterMetadata & metadata,
+        const gd::String & previousParameter, bool conditionInverted, Scope & scope);
+
+    unsigned int LowerMathExpression(const gd::Expression & expression, Scope & scope);
+    unsigned int LowerStringExpression(const gd::Expression & expression, Scope & scope);
+    unsigned int LowerVariable(const gd::String & variable, EventsBytecode::VariablePath::Root root,
+        const gd::String & object, Scope & scope);
+
+    /**
+     * \brief Return the register of an objects list, declaring it in the scope if needed.
+     * \param empty True if the list must be empty when it is not already declared.
+     */
+    unsigned int NeedList(Scope & scope, const gd::String & name, bool empty = false);
+
+    /**
+     * \brief Return the index of the group of the objects lists of \a objects.
+     */
+    unsigned int NeedGroup(Scope & scope, const std::vector<gd::String> & objects, bool empty = false);
+
+    /**
+     * \brief Return the register of the object used by a function of one of \a objects: the
+     * current object if it is one of them, otherwise the first object of the last non empty list.
+     */
+    unsigned int PickObject(Scope & scope, const std::vector<gd::String> & objects, bool lastNonEmptyList);
+
+    unsigned int NewNumber() { return bytecode->numbersCount++; }
+    unsigned int NewString() { return bytecode->stringsCount++; }
+    unsigned int NewList() { return bytecode->listsCount++; }
+    unsigned int NewObject() { return bytecode->objectsCount++; }
+    unsigned int NumberConstant(double value);
+    unsigned int StringConstant(const gd::String & value);
+    bool IsNumberConstant(unsigned int reg, double & value) const;
+    bool IsStringConstant(unsigned int reg, gd::String & value) const;
+
+    std::size_t NewScope();
+    std::size_t Emit(EventsBytecode::Opcode opcode, unsigned int a = 0, unsigned int b = 0, unsigned int c = 0);
+    std::size_t Position() const { return bytecode->instructions.size(); }
+    unsigned int AddCall(const EventsBytecode::FunctionCall & call);
+
+    /**
+     * \brief Set the jump target of the instruction at \a position to the current position.
+     */
+    void PatchJump(std::size_t position);
+
+    /**
+     * \brief Remove the declarations of scopes having no objects lists.
+     */
+    void RemoveEmptyDeclarations();
+
+    /**
+     * \brief Mark the events as not supported, storing the first reason.
+     */
+    void Unsupported(const gd::String & reason);
+
+    gd::Project & project;
+    const gd::Layout & layout;
+    const gd::Platform & platform;
+    gd::EventsCodeGenerator codeGenerator; ///< Used to preprocess events and to expand groups of objects.
+    EventsFunctionsTableCodeGenerator functionsTable; ///< Used to get the keys of the functions.
+
+    EventsBytecode * bytecode; ///< The bytecode being generated.
+    gd::EventsCodeGenerationContext objectContext; ///< Store the object used by the instruction being lowered.
+    unsigned int currentObject; ///< The register of the object used by the instruction being lowered.
+    std::map<double, unsigned int> numberConstants;
+    std::map<gd::String, unsigned int> stringConstants;
+    std::map<unsigned int, double> numberConstantsValues;
+    std::map<unsigned int, gd::String> stringConstantsValues;
+    std::size_t linkDepth;
+    gd::String error;
+};
+
+#endif // EVENTSBYTECODEGENERATOR_H
+#endif
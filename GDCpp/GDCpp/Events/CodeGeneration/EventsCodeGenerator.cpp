@@ -11,6 +11,8 @@
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/Layout.h"
@@ -20,11 +22,76 @@
 #include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCpp/IDE/BaseProfiler.h"
 #include "GDCpp/Runtime/SceneNameMangler.h"
+#include "GDCpp/Runtime/InputManager.h"
 #include "GDCpp/Events/Builtin/ProfileEvent.h"
 #include "GDCpp/Events/CodeGeneration/VariableParserCallbacks.h"
 
 using namespace std;
 
+namespace
+{
+
+bool IsIdentifier(const gd::String & name)
+{
+    if ( name.empty() ) return false;
+    for (auto character : name)
+    {
+        if ( !((character >= U'a' && character <= U'z') || (character >= U'A' && character <= U'Z') ||
+            (character >= U'0' && character <= U'9') || character == U'_') )
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Return true if \a codeInfo belongs to an expression declared for the objects described
+ * by \a objectMetadata ( and not for all objects ).
+ */
+bool IsDeclaredByObjectType(const gd::ObjectMetadata & objectMetadata, const gd::ExpressionCodeGenerationInformation & codeInfo)
+{
+    for (auto & it : objectMetadata.expressionsInfos)
+        if ( &it.second.codeExtraInformation == &codeInfo ) return true;
+    for (auto & it : objectMetadata.strExpressionsInfos)
+        if ( &it.second.codeExtraInformation == &codeInfo ) return true;
+
+    return false;
+}
+
+}
+
+gd::String EventsCodeGenerator::GetObjectRuntimeClassName(const gd::String & objectName)
+{
+    gd::String objectType = gd::GetTypeOfObject(project, scene, objectName);
+    if ( objectType.empty() ) return "";
+
+    //Objects of a type declared with ExtensionBase::AddRuntimeObject are always instances of its class.
+    const gd::ObjectMetadata & metadata = gd::MetadataProvider::GetObjectMetadata(platform, objectType);
+    if ( metadata.className.empty() ) return "";
+
+    AddIncludeFiles(metadata.includeFiles);
+    return metadata.className;
+}
+
+gd::String EventsCodeGenerator::GenerateObjectMemberFunction(const gd::String & objectName, const gd::String & index,
+    const gd::String & className, const gd::String & functionName, bool declaredByObjectType)
+{
+    gd::String object = ManObjListName(objectName)+"["+index+"]";
+
+    //*Optimization*: Call the function of the runtime class of the object without virtual
+    //dispatch, so that it can be inlined in the loops on the objects.
+    //Functions of instructions declared for all objects are not qualified: the runtime class
+    //can have a function with the same name but another meaning.
+    gd::String runtimeClassName = declaredByObjectType ? GetObjectRuntimeClassName(objectName) : "";
+    if ( !runtimeClassName.empty() && IsIdentifier(functionName) )
+        return "static_cast<"+runtimeClassName+"*>("+object+")->"+runtimeClassName+"::"+functionName;
+
+    if ( !className.empty() )
+        return "static_cast<"+className+"*>("+object+")->"+functionName;
+
+    return object+"->"+functionName;
+}
+
 gd::String EventsCodeGenerator::GenerateObjectFunctionCall(gd::String objectListName,
                                                       const gd::ObjectMetadata & objMetadata,
                                                       const gd::ExpressionCodeGenerationInformation & codeInfo,
@@ -33,6 +100,7 @@ gd::String EventsCodeGenerator::GenerateObjectFunctionCall(gd::String objectList
                                                       gd::EventsCodeGenerationContext & context)
 {
     bool castNeeded = !objMetadata.className.empty();
+    bool declaredByObjectType = IsDeclaredByObjectType(objMetadata, codeInfo);
 
     if ( codeInfo.staticFunction )
     {
@@ -42,19 +110,9 @@ gd::String EventsCodeGenerator::GenerateObjectFunctionCall(gd::String objectList
             return "("+objMetadata.className+"::"+codeInfo.functionCallName+"("+parametersStr+"))";
     }
     else if ( context.GetCurrentObject() == objectListName && !context.GetCurrentObject().empty())
-    {
-        if ( !castNeeded )
-            return "("+ManObjListName(objectListName)+"[i]->"+codeInfo.functionCallName+"("+parametersStr+"))";
-        else
-            return "(static_cast<"+objMetadata.className+"*>("+ManObjListName(objectListName)+"[i])->"+codeInfo.functionCallName+"("+parametersStr+"))";
-    }
+        return "("+GenerateObjectMemberFunction(objectListName, "i", objMetadata.className, codeInfo.functionCallName, declaredByObjectType)+"("+parametersStr+"))";
     else
-    {
-        if ( !castNeeded )
-            return "(( "+ManObjListName(objectListName)+".empty() ) ? "+defaultOutput+" :"+ ManObjListName(objectListName)+"[0]->"+codeInfo.functionCallName+"("+parametersStr+"))";
-        else
-            return "(( "+ManObjListName(objectListName)+".empty() ) ? "+defaultOutput+" : "+"static_cast<"+objMetadata.className+"*>("+ManObjListName(objectListName)+"[0])->"+codeInfo.functionCallName+"("+parametersStr+"))";
-    }
+        return "(( "+ManObjListName(objectListName)+".empty() ) ? "+defaultOutput+" : "+GenerateObjectMemberFunction(objectListName, "0", objMetadata.className, codeInfo.functionCallName, declaredByObjectType)+"("+parametersStr+"))";
 }
 
 gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(gd::String objectListName,
@@ -102,10 +160,11 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(const gd::String & objec
 
     //Prepare call
     //Add a static_cast if necessary
-    gd::String objectFunctionCallNamePart =
-    ( !instrInfos.parameters[0].supplementaryInformation.empty() ) ?
-        "static_cast<"+objInfo.className+"*>("+ManObjListName(objectName)+"[i])->"+instrInfos.codeExtraInformation.functionCallName
-    :   ManObjListName(objectName)+"[i]->"+instrInfos.codeExtraInformation.functionCallName;
+    //Instructions declared for a type of objects have the type in their first parameter.
+    bool declaredByObjectType = !instrInfos.parameters[0].supplementaryInformation.empty();
+    gd::String castClassName = declaredByObjectType ? objInfo.className : "";
+    gd::String objectFunctionCallNamePart = GenerateObjectMemberFunction(objectName, "i", castClassName,
+        instrInfos.codeExtraInformation.functionCallName, declaredByObjectType);
 
     //Create call
     gd::String predicat;
@@ -202,22 +261,27 @@ gd::String EventsCodeGenerator::GenerateObjectAction(const gd::String & objectNa
 
     //Prepare call
     //Add a static_cast if necessary
-    gd::String objectPart = ( !instrInfos.parameters[0].supplementaryInformation.empty() ) ? "static_cast<"+objInfo.className+"*>("+ManObjListName(objectName)+"[i])->" : ManObjListName(objectName)+"[i]->" ;
+    //Instructions declared for a type of objects have the type in their first parameter.
+    bool declaredByObjectType = !instrInfos.parameters[0].supplementaryInformation.empty();
+    gd::String castClassName = declaredByObjectType ? objInfo.className : "";
+    gd::String functionPart = GenerateObjectMemberFunction(objectName, "i", castClassName,
+        instrInfos.codeExtraInformation.functionCallName, declaredByObjectType);
 
     //Create call
     gd::String call;
     if ( instrInfos.codeExtraInformation.type == "number" || instrInfos.codeExtraInformation.type == "string")
     {
         if ( instrInfos.codeExtraInformation.accessType == gd::InstructionMetadata::ExtraInformation::MutatorAndOrAccessor )
-            call = GenerateOperatorCall(instrInfos, arguments, objectPart+instrInfos.codeExtraInformation.functionCallName, objectPart+instrInfos.codeExtraInformation.optionalAssociatedInstruction, 1);
+            call = GenerateOperatorCall(instrInfos, arguments, functionPart,
+                GenerateObjectMemberFunction(objectName, "i", castClassName, instrInfos.codeExtraInformation.optionalAssociatedInstruction, declaredByObjectType), 1);
         else if ( instrInfos.codeExtraInformation.accessType == gd::InstructionMetadata::ExtraInformation::Mutators )
-            call = GenerateMutatorCall(instrInfos, arguments, objectPart+instrInfos.codeExtraInformation.functionCallName, 1);
+            call = GenerateMutatorCall(instrInfos, arguments, functionPart, 1);
         else
-            call = GenerateCompoundOperatorCall(instrInfos, arguments, objectPart+instrInfos.codeExtraInformation.functionCallName, 1);
+            call = GenerateCompoundOperatorCall(instrInfos, arguments, functionPart, 1);
     }
     else
     {
-        call = objectPart+instrInfos.codeExtraInformation.functionCallName+"("+GenerateArgumentsList(arguments, 1)+")";
+        call = functionPart+"("+GenerateArgumentsList(arguments, 1)+")";
     }
 
     actionCode += "for(std::size_t i = 0;i < "+ManObjListName(objectName)+".size();++i)\n";
@@ -279,11 +343,12 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(const gd::String & object
     return actionCode;
 }
 
-gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                         gd::EventsCodeGenerationContext & context,
                                                         const gd::String & previousParameter,
                                                         std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes)
 {
+    const gd::String & parameter = expression.GetPlainString();
     gd::String argOutput;
 
     //Code only parameter type
@@ -368,7 +433,7 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parame
         gd::String object = previousParameter;
         if ( object.empty() ) object = context.GetCurrentObject();
 
-        VariableCodeGenerationCallbacks callbacks(argOutput, *this, context, object);
+        VariableCodeGenerationCallbacks callbacks(argOutput, *this, context, object, !generatingActions);
 
         gd::VariableParser parser(parameter);
         if ( !parser.Parse(callbacks) )
@@ -377,53 +442,144 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parame
             argOutput = "runtimeContext->GetGameVariables().GetBadVariable()";
         }
     }
+    else if (metadata.type == "key" || metadata.type == "mouse")
+    {
+        //Resolve the name to the SFML code, so that the key or button is not searched by its name at runtime.
+        int code = metadata.type == "key" ? InputManager::GetKeyCode(parameter) : InputManager::GetButtonCode(parameter);
+        if ( code != -1 )
+            argOutput += gd::String::From(code);
+        else
+            argOutput += gd::EventsCodeGenerator::GenerateParameterCodes(expression, metadata, context, previousParameter, supplementaryParametersTypes);
+    }
+    else if (metadata.type == "string" && metadata.supplementaryInformation == "timerName")
+    {
+        //If the name of the timer is a literal string, declare a variable storing the index of the timer,
+        //resolved once when the code is loaded. Otherwise, the timer is searched by its name at runtime.
+        gd::String name = parameter;
+        if ( name.size() >= 2 && name[0] == '"' && name[name.size()-1] == '"' &&
+            name.find_first_of("\"\\", 1) == name.size()-1 )
+        {
+            name = name.substr(1, name.size()-2);
+            gd::String indexName = "GDTimerIndex_"+EventsCodeNameMangler::Get()->GetMangledObjectsListName(name);
+
+            AddIncludeFile("GDCpp/Runtime/TimersContainer.h");
+            AddGlobalDeclaration("static const std::size_t "+indexName+" = TimersContainer::GetTimerIndex(\""+ConvertToString(name)+"\");\n");
+            argOutput += indexName;
+        }
+        else
+            argOutput += gd::EventsCodeGenerator::GenerateParameterCodes(expression, metadata, context, previousParameter, supplementaryParametersTypes);
+    }
     else
     {
-        argOutput += gd::EventsCodeGenerator::GenerateParameterCodes(parameter, metadata, context, previousParameter, supplementaryParametersTypes);
+        argOutput += gd::EventsCodeGenerator::GenerateParameterCodes(expression, metadata, context, previousParameter, supplementaryParametersTypes);
     }
 
     return argOutput;
 }
 
 gd::String EventsCodeGenerator::GenerateSceneEventsCompleteCode(gd::Project & project, gd::Layout & scene, const gd::EventsList & events, bool compilationForRuntime)
+{
+    EventsCodeGenerator codeGenerator(project, scene);
+    codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+    gd::String functionCode = codeGenerator.GenerateSceneEventsFunctionCode(scene, events);
+
+    return codeGenerator.GenerateFileCode("Scene "+scene.GetName(), functionCode);
+}
+
+gd::String EventsCodeGenerator::GenerateSceneEventsFunctionCode(gd::Layout & scene, const gd::EventsList & events)
 {
     // Preprocessing then code generation can make changes to the events, so we need to do
     // the work on a copy of the events.
     gd::EventsList generatedEvents = events;
 
-    gd::String output;
-
     //Prepare the global context ( Used to get needed header files )
     gd::EventsCodeGenerationContext context;
-    EventsCodeGenerator codeGenerator(project, scene);
 
     //Generate whole events code
+    PreprocessEventList(generatedEvents);
+    gd::String wholeEventsCode = GenerateEventsListCode(generatedEvents, context);
+
+    return "extern \"C\" int GDSceneEvents"+gd::SceneNameMangler::GetMangledSceneName(scene.GetName())+"(RuntimeContext * runtimeContext)\n"
+        "{\n"+
+        "runtimeContext->StartNewFrame();\n"+
+        GetCustomCodeInMain()+
+        wholeEventsCode+
+        "return 0;\n"
+        "}\n";
+}
+
+std::vector<gd::String> EventsCodeGenerator::GenerateSceneEventsSplitCode(gd::Project & project, gd::Layout & scene, const gd::EventsList & events, bool compilationForRuntime)
+{
+    #if !defined(GD_NO_WX_GUI)
+    //Profile events measure the time elapsed since the previous one: keep them in the same file.
+    if ( scene.GetProfiler() && scene.GetProfiler()->profilingActivated )
+        return std::vector<gd::String>(1, GenerateSceneEventsCompleteCode(project, scene, events, compilationForRuntime));
+    #endif
+
+    gd::EventsList generatedEvents = events;
+    gd::String mangledSceneName = gd::SceneNameMangler::GetMangledSceneName(scene.GetName());
+    std::vector<gd::String> files(1);
+
+    gd::EventsCodeGenerationContext context;
+    EventsCodeGenerator codeGenerator(project, scene);
     codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
-    codeGenerator.PreprocessEventList(generatedEvents);
-    gd::String wholeEventsCode = codeGenerator.GenerateEventsListCode(generatedEvents, context);
 
-    //Generate default code around events:
-    //Includes
-    output += "#include <vector>\n#include <map>\n#include <string>\n#include <algorithm>\n#include <SFML/System/Clock.hpp>\n#include <SFML/System/Vector2.hpp>\n#include <SFML/Graphics/Color.hpp>\n#include \"GDCpp/Runtime/RuntimeContext.h\"\n#include \"GDCpp/Runtime/RuntimeObject.h\"\n";
-    for ( set<gd::String>::iterator include = codeGenerator.GetIncludeFiles().begin() ; include != codeGenerator.GetIncludeFiles().end(); ++include )
-        output += "#include \""+*include+"\"\n";
+    //Events which are not in a group at the top level are generated in the first file, in the
+    //function of the scene. Groups are generated in their own file, as a function called by the
+    //function of the scene: top level events do not share objects lists, so they are independent.
+    gd::String wholeEventsCode;
+    gd::EventsList pendingEvents;
+    auto generatePendingEvents = [&]() {
+        codeGenerator.PreprocessEventList(pendingEvents);
+        wholeEventsCode += codeGenerator.GenerateEventsListCode(pendingEvents, context);
+        pendingEvents.Clear();
+    };
+
+    for (std::size_t i = 0;i<generatedEvents.size();++i)
+    {
+        if ( generatedEvents[i].GetType() != "BuiltinCommonInstructions::Group" )
+        {
+            pendingEvents.InsertEvent(generatedEvents.GetEventSmartPtr(i));
+            continue;
+        }
 
-    //Extra declarations needed by events
-    for ( set<gd::String>::iterator declaration = codeGenerator.GetCustomGlobalDeclaration().begin() ; declaration != codeGenerator.GetCustomGlobalDeclaration().end(); ++declaration )
-        output += *declaration+"\n";
+        generatePendingEvents();
 
-    output +=
-    codeGenerator.GetCustomCodeOutsideMain()+
-    "\n"
-    "extern \"C\" int GDSceneEvents"+gd::SceneNameMangler::GetMangledSceneName(scene.GetName())+"(RuntimeContext * runtimeContext)\n"
-    "{\n"+
-    "runtimeContext->StartNewFrame();\n"+
-    codeGenerator.GetCustomCodeInMain()+
-    wholeEventsCode+
-    "return 0;\n"
-    "}\n";
+        gd::String groupNumber = gd::String::From(files.size()-1);
+        gd::String groupFunctionName = "GDSceneEvents"+mangledSceneName+"Group"+groupNumber;
 
-    return output;
+        gd::EventsList groupEvents;
+        groupEvents.InsertEvent(generatedEvents.GetEventSmartPtr(i));
+
+        gd::EventsCodeGenerationContext groupContext;
+        EventsCodeGenerator groupCodeGenerator(project, scene);
+        groupCodeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+        groupCodeGenerator.unnamedElementsPrefix = "Scene "+scene.GetName()+" group "+groupNumber;
+        groupCodeGenerator.PreprocessEventList(groupEvents);
+        gd::String groupEventsCode = groupCodeGenerator.GenerateEventsListCode(groupEvents, groupContext);
+
+        files.push_back(groupCodeGenerator.GenerateFileCode("Scene "+scene.GetName()+" group "+groupNumber,
+            "void "+groupFunctionName+"(RuntimeContext * runtimeContext)\n"
+            "{\n"+
+            groupCodeGenerator.GetCustomCodeInMain()+
+            groupEventsCode+
+            "}\n"));
+
+        codeGenerator.AddGlobalDeclaration("void "+groupFunctionName+"(RuntimeContext * runtimeContext);\n");
+        wholeEventsCode += groupFunctionName+"(runtimeContext);\n";
+    }
+    generatePendingEvents();
+
+    files[0] = codeGenerator.GenerateFileCode("Scene "+scene.GetName(),
+        "extern \"C\" int GDSceneEvents"+mangledSceneName+"(RuntimeContext * runtimeContext)\n"
+        "{\n"+
+        "runtimeContext->StartNewFrame();\n"+
+        codeGenerator.GetCustomCodeInMain()+
+        wholeEventsCode+
+        "return 0;\n"
+        "}\n");
+
+    return files;
 }
 
 gd::String EventsCodeGenerator::GenerateExternalEventsCompleteCode(gd::Project & project, gd::ExternalEvents & events, bool compilationForRuntime)
@@ -437,42 +593,119 @@ gd::String EventsCodeGenerator::GenerateExternalEventsCompleteCode(gd::Project &
     }
     gd::Layout & associatedScene = project.GetLayout(project.GetLayoutPosition(associatedSceneName));
 
-    gd::String output;
+    EventsCodeGenerator codeGenerator(project, associatedScene);
+    codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+    gd::String functionCode = codeGenerator.GenerateExternalEventsFunctionCode(events);
+
+    return codeGenerator.GenerateFileCode("External events "+events.GetName(), functionCode);
+}
+
+gd::String EventsCodeGenerator::GenerateExternalEventsFunctionCode(gd::ExternalEvents & events)
+{
+    unnamedElementsPrefix = "External events "+events.GetName();
 
     //Prepare the global context ( Used to get needed header files )
     gd::EventsCodeGenerationContext context;
-    EventsCodeGenerator codeGenerator(project, associatedScene);
-    codeGenerator.PreprocessEventList(events.GetEvents());
-    codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+
+    //Preprocessing then code generation can make changes to the events, so we need to do
+    // the work on a copy of the events.
+    gd::EventsList generatedEvents = events.GetEvents();
+    PreprocessEventList(generatedEvents);
 
     //Generate whole events code
-    gd::String wholeEventsCode = codeGenerator.GenerateEventsListCode(events.GetEvents(), context);
+    gd::String wholeEventsCode = GenerateEventsListCode(generatedEvents, context);
+
+    return "void "+EventsCodeNameMangler::Get()->GetExternalEventsFunctionMangledName(events.GetName())+"(RuntimeContext * runtimeContext)\n"
+        "{\n"
+        +GetCustomCodeInMain()
+        +wholeEventsCode+
+        "return;\n"
+        "}\n";
+}
+
+gd::String EventsCodeGenerator::GenerateProjectEventsUnityCode(gd::Project & project)
+{
+    //The includes and the declarations needed by all the events are gathered: identical
+    //declarations (for example, the index of a timer used by several scenes) are made once.
+    std::set<gd::String> includeFiles;
+    std::set<gd::String> globalDeclarations;
+    gd::String eventsCode;
+    std::size_t partsCount = 0;
+
+    auto addGeneratedCode = [&](EventsCodeGenerator & codeGenerator, const gd::String & codeName, const gd::String & functionCode) {
+        includeFiles.insert(codeGenerator.GetIncludeFiles().begin(), codeGenerator.GetIncludeFiles().end());
+        globalDeclarations.insert(codeGenerator.GetCustomGlobalDeclaration().begin(), codeGenerator.GetCustomGlobalDeclaration().end());
+        eventsCode += codeGenerator.GenerateTriggerOnceConditionsDeclaration(codeName)+
+            codeGenerator.GetCustomCodeOutsideMain()+
+            "\n"+
+            functionCode+
+            "\n";
+    };
+
+    for (std::size_t i = 0;i<project.GetLayoutsCount();++i)
+    {
+        gd::Layout & scene = project.GetLayout(i);
+
+        EventsCodeGenerator codeGenerator(project, scene);
+        codeGenerator.SetGenerateCodeForRuntime(true);
+        codeGenerator.triggerOnceFirstIndexName = "GDTriggerOnceFirstIndex"+gd::String::From(partsCount++);
+        gd::String functionCode = codeGenerator.GenerateSceneEventsFunctionCode(scene, scene.GetEvents());
+        addGeneratedCode(codeGenerator, "Scene "+scene.GetName(), functionCode);
+    }
+    for (std::size_t i = 0;i<project.GetExternalEventsCount();++i)
+    {
+        gd::ExternalEvents & events = project.GetExternalEvents(i);
+
+        DependenciesAnalyzer analyzer(project, events);
+        gd::String associatedSceneName = analyzer.ExternalEventsCanBeCompiledForAScene();
+        if ( associatedSceneName.empty() || !project.HasLayoutNamed(associatedSceneName) ) continue;
+
+        EventsCodeGenerator codeGenerator(project, project.GetLayout(associatedSceneName));
+        codeGenerator.SetGenerateCodeForRuntime(true);
+        codeGenerator.triggerOnceFirstIndexName = "GDTriggerOnceFirstIndex"+gd::String::From(partsCount++);
+        gd::String functionCode = codeGenerator.GenerateExternalEventsFunctionCode(events);
+        addGeneratedCode(codeGenerator, "External events "+events.GetName(), functionCode);
+    }
+
+    return GenerateIncludesAndDeclarations(includeFiles, globalDeclarations)+"\n"+eventsCode;
+}
+
+gd::String EventsCodeGenerator::GenerateIncludesAndDeclarations(const std::set<gd::String> & includeFiles, const std::set<gd::String> & globalDeclarations)
+{
+    gd::String output;
 
     //Generate default code around events:
     //Includes
     output += "#include <vector>\n#include <map>\n#include <string>\n#include <algorithm>\n#include <SFML/System/Clock.hpp>\n#include <SFML/System/Vector2.hpp>\n#include <SFML/Graphics/Color.hpp>\n#include \"GDCpp/Runtime/RuntimeContext.h\"\n#include \"GDCpp/Runtime/RuntimeObject.h\"\n";
-    for ( set<gd::String>::iterator include = codeGenerator.GetIncludeFiles().begin() ; include != codeGenerator.GetIncludeFiles().end(); ++include )
+    for ( set<gd::String>::const_iterator include = includeFiles.begin() ; include != includeFiles.end(); ++include )
         output += "#include \""+*include+"\"\n";
 
     //Extra declarations needed by events
-    for ( set<gd::String>::iterator declaration = codeGenerator.GetCustomGlobalDeclaration().begin() ; declaration != codeGenerator.GetCustomGlobalDeclaration().end(); ++declaration )
+    for ( set<gd::String>::const_iterator declaration = globalDeclarations.begin() ; declaration != globalDeclarations.end(); ++declaration )
         output += *declaration+"\n";
 
+    return output;
+}
+
+gd::String EventsCodeGenerator::GenerateFileCode(const gd::String & codeName, const gd::String & functionCode)
+{
+    gd::String output = GenerateIncludesAndDeclarations(GetIncludeFiles(), GetCustomGlobalDeclaration());
+
     output +=
-    codeGenerator.GetCustomCodeOutsideMain()+
-    "\n"
-    "void "+EventsCodeNameMangler::Get()->GetExternalEventsFunctionMangledName(events.GetName())+"(RuntimeContext * runtimeContext)\n"
-    "{\n"
-	+codeGenerator.GetCustomCodeInMain()
-    +wholeEventsCode+
-    "return;\n"
-    "}\n";
+    GenerateTriggerOnceConditionsDeclaration(codeName)+
+    GetCustomCodeOutsideMain()+
+    "\n"+
+    functionCode;
 
     return output;
 }
 
 EventsCodeGenerator::EventsCodeGenerator(gd::Project & project, const gd::Layout & layout) :
-    gd::EventsCodeGenerator(project, layout, CppPlatform::Get())
+    gd::EventsCodeGenerator(project, layout, CppPlatform::Get()),
+    triggerOnceConditionsCount(0),
+    triggerOnceFirstIndexName("GDTriggerOnceFirstIndex"),
+    unnamedElementsPrefix("Scene "+layout.GetName()),
+    generatingActions(false)
 {
 }
 
@@ -480,6 +713,36 @@ EventsCodeGenerator::~EventsCodeGenerator()
 {
 }
 
+gd::String EventsCodeGenerator::GenerateTriggerOnceConditionIndex()
+{
+    return "("+triggerOnceFirstIndexName+"+"+gd::String::From(triggerOnceConditionsCount++)+")";
+}
+
+gd::String EventsCodeGenerator::GenerateActionsListCode(gd::InstructionsList & actions, gd::EventsCodeGenerationContext & context)
+{
+    //Only actions can modify the variables of objects: conditions and expressions
+    //read them without marking the objects as changed.
+    bool wasGeneratingActions = generatingActions;
+    generatingActions = true;
+    gd::String code = gd::EventsCodeGenerator::GenerateActionsListCode(actions, context);
+    generatingActions = wasGeneratingActions;
+
+    return code;
+}
+
+gd::String EventsCodeGenerator::GenerateUnnamedElementName(const gd::String & prefix)
+{
+    return prefix+ConvertToString(unnamedElementsPrefix)+"_"+gd::String::From(unnamedElementsCount[prefix]++);
+}
+
+gd::String EventsCodeGenerator::GenerateTriggerOnceConditionsDeclaration(const gd::String & codeName)
+{
+    if ( triggerOnceConditionsCount == 0 ) return "";
+
+    return "static const std::size_t "+triggerOnceFirstIndexName+" = TriggerOnceConditions::ReserveIndices(\""+
+        ConvertToString(codeName)+"\", "+gd::String::From(triggerOnceConditionsCount)+");\n";
+}
+
 void EventsCodeGenerator::PreprocessEventList( gd::EventsList & eventsList )
 {
     #if !defined(GD_NO_WX_GUI) //No support for profiling when wxWidgets is disabled.
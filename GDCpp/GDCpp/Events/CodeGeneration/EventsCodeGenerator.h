@@ -10,6 +10,7 @@
 #define EventsCodeGenerator_H
 #include <vector>
 #include <string>
+#include <map>
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 namespace gd { class ObjectMetadata; }
@@ -33,6 +34,20 @@ public:
      */
     static gd::String GenerateSceneEventsCompleteCode(gd::Project & project, gd::Layout & scene, const gd::EventsList & events, bool compilationForRuntime = false);
 
+    /**
+     * Generate C++ files for compiling events of a scene, each group of events at the top level
+     * of the scene being generated in its own file so that it can be compiled separately.
+     *
+     * \param project Game used
+     * \param scene Scene used
+     * \param events events of the scene
+     * \param compilationForRuntime Set this to true if the code is generated for runtime.
+     * \return The C++ code of each file. The first file contains the function running the events
+     * of the scene, calling the functions defined by the other files. If the profiler of the scene
+     * is activated, only one file is generated.
+     */
+    static std::vector<gd::String> GenerateSceneEventsSplitCode(gd::Project & project, gd::Layout & scene, const gd::EventsList & events, bool compilationForRuntime = false);
+
     /**
      * Generate complete C++ file for compiling external events.
      * \note If events.AreCompiled() == false, no code is generated.
@@ -44,13 +59,43 @@ public:
      */
     static gd::String GenerateExternalEventsCompleteCode(gd::Project & project, gd::ExternalEvents & events, bool compilationForRuntime = false);
 
+    /**
+     * Generate a single C++ file for compiling, for runtime, the events of all the scenes of the project
+     * and the external events which can be compiled for a scene, so that the compiler can inline
+     * and optimize the code of all events together.
+     *
+     * \param project Game used. Events are preprocessed and modified: use a copy of the project.
+     * \return C++ code
+     */
+    static gd::String GenerateProjectEventsUnityCode(gd::Project & project);
+
     /**
      * \brief GD C++ Platform has a specific processing function so as to handle profiling.
      */
     void PreprocessEventList( gd::EventsList & listEvent );
 
+    /**
+     * \brief Generate the code of the index of a new "Trigger once" condition.
+     *
+     * Conditions are numbered densely in the generated code, starting from the first index
+     * of the range reserved by TriggerOnceConditions::ReserveIndices when the code is loaded.
+     */
+    gd::String GenerateTriggerOnceConditionIndex();
+
+    /**
+     * \brief Generate a name for a new element of the events which is not named by the user
+     * (like a timed event), starting with \a prefix.
+     *
+     * Elements are numbered in the order of the generation, inside the code being generated
+     * (scene, group of a scene or external events): the name stays the same when the code is
+     * generated again, as long as the events are not modified.
+     */
+    gd::String GenerateUnnamedElementName(const gd::String & prefix);
+
 protected:
-    virtual gd::String GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+    virtual gd::String GenerateActionsListCode(gd::InstructionsList & actions, gd::EventsCodeGenerationContext & context);
+
+    virtual gd::String GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                gd::EventsCodeGenerationContext & context,
                                                const gd::String & previousParameter,
                                                std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes);
@@ -105,6 +150,59 @@ protected:
      */
     EventsCodeGenerator(gd::Project & project, const gd::Layout & layout);
     virtual ~EventsCodeGenerator();
+
+private:
+    /**
+     * \brief Return the C++ class of the runtime objects called \a objectName, if they are all
+     * instances of the same class, or an empty string.
+     */
+    gd::String GetObjectRuntimeClassName(const gd::String & objectName);
+
+    /**
+     * \brief Generate the code designating the member function \a functionName of the object
+     * at \a index in the list of \a objectName.
+     *
+     * The function of the runtime class of the object is called directly when the class is known
+     * and \a declaredByObjectType is true ( the instruction or expression is declared for this type
+     * of objects, not for all objects ). Otherwise the object is cast to \a className if it is not empty.
+     */
+    gd::String GenerateObjectMemberFunction(const gd::String & objectName, const gd::String & index,
+        const gd::String & className, const gd::String & functionName, bool declaredByObjectType);
+
+    /**
+     * \brief Generate the includes needed by every events file, followed by \a includeFiles
+     * and the extra declarations \a globalDeclarations.
+     */
+    static gd::String GenerateIncludesAndDeclarations(const std::set<gd::String> & includeFiles, const std::set<gd::String> & globalDeclarations);
+
+    /**
+     * \brief Generate the function running the events of the scene.
+     */
+    gd::String GenerateSceneEventsFunctionCode(gd::Layout & scene, const gd::EventsList & events);
+
+    /**
+     * \brief Generate the function running the external events.
+     */
+    gd::String GenerateExternalEventsFunctionCode(gd::ExternalEvents & events);
+
+    /**
+     * \brief Generate the content of a file, with the includes and declarations needed by
+     * the code generated so far, followed by \a functionCode.
+     * \param codeName The name identifying the generated code (see GenerateTriggerOnceConditionsDeclaration).
+     */
+    gd::String GenerateFileCode(const gd::String & codeName, const gd::String & functionCode);
+
+    /**
+     * \brief Generate the declaration of the first index of the "Trigger once" conditions
+     * of the code called \a codeName, if any.
+     */
+    gd::String GenerateTriggerOnceConditionsDeclaration(const gd::String & codeName);
+
+    std::size_t triggerOnceConditionsCount; ///< The number of "Trigger once" conditions in the generated code.
+    gd::String triggerOnceFirstIndexName; ///< The name of the variable storing the first index of "Trigger once" conditions, unique in the generated file.
+    gd::String unnamedElementsPrefix; ///< The name of the code being generated, used to name the unnamed elements of the events.
+    std::map<gd::String, std::size_t> unnamedElementsCount; ///< The number of unnamed elements generated, for each prefix.
+    bool generatingActions; ///< True when the code of actions is being generated: object variables can be modified.
 };
 
 #endif // EventsCodeGenerator_H
@@ -0,0 +1,372 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#if defined(GD_IDE_ONLY)
+#include <algorithm>
+#include <set>
+#include "GDCpp/Events/CodeGeneration/EventsFunctionsTableCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+
+namespace
+{
+
+/**
+ * \brief Give access to the functions generating the calls of instructions working on numbers
+ * and strings, so that the functions of the table generate exactly the same calls.
+ */
+class FunctionsCodeGenerator : public gd::EventsCodeGenerator
+{
+public:
+    FunctionsCodeGenerator(gd::Project & project, const gd::Layout & layout, const gd::Platform & platform) :
+        gd::EventsCodeGenerator(project, layout, platform)
+    {};
+
+    using gd::EventsCodeGenerator::GenerateRelationalOperatorCall;
+    using gd::EventsCodeGenerator::GenerateOperatorCall;
+    using gd::EventsCodeGenerator::GenerateCompoundOperatorCall;
+    using gd::EventsCodeGenerator::GenerateMutatorCall;
+    using gd::EventsCodeGenerator::GenerateArgumentsList;
+};
+
+gd::String ConvertToCppString(const gd::String & str)
+{
+    return "\""+str.FindAndReplace("\\", "\\\\").FindAndReplace("\"", "\\\"")+"\"";
+}
+
+/**
+ * \brief Return a copy of \a arguments with the last parameter of type \a type ( starting from
+ * \a startFrom ) replaced by \a value.
+ */
+std::vector<gd::String> ReplaceLastArgumentOfType(const gd::InstructionMetadata & metadata, std::vector<gd::String> arguments,
+    const gd::String & type, std::size_t startFrom, const gd::String & value)
+{
+    for (std::size_t i = metadata.parameters.size()-1;i >= startFrom && i < metadata.parameters.size();--i)
+    {
+        if ( metadata.parameters[i].type == type )
+        {
+            arguments[i] = value;
+            break;
+        }
+    }
+
+    return arguments;
+}
+
+}
+
+EventsFunctionsTableCodeGenerator::EventsFunctionsTableCodeGenerator(const gd::Platform & platform_,
+    const std::vector<gd::String> & extensionsNames) :
+    platform(platform_)
+{
+    for (auto & extension : platform.GetAllPlatformExtensions())
+    {
+        if ( !extensionsNames.empty() &&
+            std::find(extensionsNames.begin(), extensionsNames.end(), extension->GetName()) == extensionsNames.end() )
+            continue;
+
+        AddInstructions(extension->GetAllConditions(), true, Entry::Free, "");
+        AddInstructions(extension->GetAllActions(), false, Entry::Free, "");
+        AddExpressions(extension->GetAllExpressions(), false, Entry::Free, "", "", std::vector<gd::String>());
+        AddExpressions(extension->GetAllStrExpressions(), true, Entry::Free, "", "", std::vector<gd::String>());
+
+        for (auto & objectType : extension->GetExtensionObjectsTypes())
+        {
+            const gd::ObjectMetadata & objectMetadata = extension->GetObjectMetadata(objectType);
+
+            AddInstructions(extension->GetAllConditionsForObject(objectType), true, Entry::Object, objectType);
+            AddInstructions(extension->GetAllActionsForObject(objectType), false, Entry::Object, objectType);
+            AddExpressions(extension->GetAllExpressionsForObject(objectType), false, Entry::Object, objectType,
+                objectMetadata.className, objectMetadata.includeFiles);
+            AddExpressions(extension->GetAllStrExpressionsForObject(objectType), true, Entry::Object, objectType,
+                objectMetadata.className, objectMetadata.includeFiles);
+        }
+
+        for (auto & behaviorType : extension->GetBehaviorsTypes())
+        {
+            const gd::BehaviorMetadata & behaviorMetadata = extension->GetBehaviorMetadata(behaviorType);
+
+            AddInstructions(extension->GetAllConditionsForBehavior(behaviorType), true, Entry::Behavior, behaviorType);
+            AddInstructions(extension->GetAllActionsForBehavior(behaviorType), false, Entry::Behavior, behaviorType);
+            AddExpressions(extension->GetAllExpressionsForBehavior(behaviorType), false, Entry::Behavior, behaviorType,
+                behaviorMetadata.className, behaviorMetadata.includeFiles);
+            AddExpressions(extension->GetAllStrExpressionsForBehavior(behaviorType), true, Entry::Behavior, behaviorType,
+                behaviorMetadata.className, behaviorMetadata.includeFiles);
+        }
+    }
+}
+
+void EventsFunctionsTableCodeGenerator::AddInstructions(std::map<gd::String, gd::InstructionMetadata> & instructions, bool condition,
+    Entry::Owner owner, const gd::String & ownerType)
+{
+    static const gd::String prefixes[] = { "", "Object", "Behavior" };
+
+    for (auto & it : instructions)
+    {
+        const gd::InstructionMetadata & metadata = it.second;
+        if ( metadata.codeExtraInformation.HasCustomCodeGenerator() || metadata.codeExtraInformation.functionCallName.empty() )
+            continue;
+        if ( (owner == Entry::Object && metadata.parameters.empty()) || (owner == Entry::Behavior && metadata.parameters.size() < 2) )
+            continue;
+
+        //Instructions are searched by their type only ( see gd::MetadataProvider ): only the first one is used.
+        const gd::InstructionMetadata & usedMetadata = condition ?
+            gd::MetadataProvider::GetConditionMetadata(platform, it.first) :
+            gd::MetadataProvider::GetActionMetadata(platform, it.first);
+        if ( &usedMetadata != &metadata )
+            continue;
+
+        Entry entry;
+        entry.key = prefixes[owner]+(condition ? "Condition:" : "Action:")+ownerType+":"+it.first;
+        entry.owner = owner;
+        entry.instruction = &metadata;
+        entry.condition = condition;
+        entry.includeFiles = metadata.codeExtraInformation.GetIncludeFiles();
+        if ( owner == Entry::Object && !metadata.parameters[0].supplementaryInformation.empty() )
+        {
+            const gd::ObjectMetadata & objectMetadata = gd::MetadataProvider::GetObjectMetadata(platform, metadata.parameters[0].supplementaryInformation);
+            entry.includeFiles.insert(entry.includeFiles.end(), objectMetadata.includeFiles.begin(), objectMetadata.includeFiles.end());
+        }
+        else if ( owner == Entry::Behavior && !metadata.parameters[1].supplementaryInformation.empty() )
+        {
+            const gd::BehaviorMetadata & behaviorMetadata = gd::MetadataProvider::GetBehaviorMetadata(platform, metadata.parameters[1].supplementaryInformation);
+            entry.includeFiles.insert(entry.includeFiles.end(), behaviorMetadata.includeFiles.begin(), behaviorMetadata.includeFiles.end());
+        }
+
+        instructionsKeys[&metadata] = entry.key;
+        entries.push_back(entry);
+    }
+}
+
+void EventsFunctionsTableCodeGenerator::AddExpressions(std::map<gd::String, gd::ExpressionMetadata> & expressions, bool stringExpression,
+    Entry::Owner owner, const gd::String & ownerType, const gd::String & ownerClassName,
+    const std::vector<gd::String> & ownerIncludeFiles)
+{
+    static const gd::String prefixes[] = { "", "Object", "Behavior" };
+
+    for (auto & it : expressions)
+    {
+        const gd::ExpressionMetadata & metadata = it.second;
+        if ( metadata.codeExtraInformation.HasCustomCodeGenerator() || metadata.codeExtraInformation.functionCallName.empty() )
+            continue;
+
+        Entry entry;
+        entry.key = prefixes[owner]+(stringExpression ? "StrExpression:" : "Expression:")+ownerType+":"+it.first;
+        entry.owner = owner;
+        entry.ownerClassName = ownerClassName;
+        entry.expression = &metadata;
+        entry.stringExpression = stringExpression;
+        entry.includeFiles = metadata.codeExtraInformation.GetIncludeFiles();
+        entry.includeFiles.insert(entry.includeFiles.end(), ownerIncludeFiles.begin(), ownerIncludeFiles.end());
+
+        expressionsKeys[&metadata] = entry.key;
+        entries.push_back(entry);
+    }
+}
+
+gd::String EventsFunctionsTableCodeGenerator::GetInstructionFunctionKey(const gd::InstructionMetadata & metadata, const gd::String & operatorString) const
+{
+    auto it = instructionsKeys.find(&metadata);
+    if ( it == instructionsKeys.end() ) return "";
+
+    const gd::String & type = metadata.codeExtraInformation.type;
+    return (type == "number" || type == "string") ? it->second+"/"+operatorString : it->second;
+}
+
+gd::String EventsFunctionsTableCodeGenerator::GetExpressionFunctionKey(const gd::ExpressionMetadata & metadata) const
+{
+    auto it = expressionsKeys.find(&metadata);
+    return it != expressionsKeys.end() ? it->second : "";
+}
+
+EventsFunctionsTableCodeGenerator::ArgumentType EventsFunctionsTableCodeGenerator::GetArgumentType(const gd::ParameterMetadata & parameter)
+{
+    const gd::String & type = parameter.type;
+    if ( type == "expression" || type == "camera" ) return NumberArgument;
+    else if ( type == "key" || type == "mouse" ) return IntegerArgument;
+    else if ( type == "yesorno" || type == "trueorfalse" || type == "conditionInverted" ) return BooleanArgument;
+    else if ( type == "currentScene" ) return SceneArgument;
+    else if ( type == "objectList" || type == "objectListWithoutPicking" ) return ObjectsListsArgument;
+    else if ( type == "objectPtr" ) return ObjectArgument;
+    else if ( type == "scenevar" || type == "globalvar" || type == "objectvar" ) return VariableArgument;
+    else if ( type == "inlineCode" ) return InlineCodeArgument;
+
+    return StringArgument;
+}
+
+const std::vector<gd::String> & EventsFunctionsTableCodeGenerator::GetRelationalOperators()
+{
+    static const std::vector<gd::String> operators = { "==", "<", ">", "<=", ">=", "!=" };
+    return operators;
+}
+
+const std::vector<gd::String> & EventsFunctionsTableCodeGenerator::GetOperators()
+{
+    static const std::vector<gd::String> operators = { "=", "+", "-", "/", "*" };
+    return operators;
+}
+
+gd::String EventsFunctionsTableCodeGenerator::GenerateArgumentCode(const gd::ParameterMetadata & parameter, std::size_t index)
+{
+    gd::String indexStr = gd::String::From(index);
+    switch ( GetArgumentType(parameter) )
+    {
+        case NumberArgument: return "call.GetNumber("+indexStr+")";
+        case IntegerArgument: return "call.GetInteger("+indexStr+")";
+        case BooleanArgument: return "call.GetBoolean("+indexStr+")";
+        case SceneArgument: return "*call.runtimeContext->scene";
+        case ObjectsListsArgument: return "call.GetObjectsLists("+indexStr+")";
+        case ObjectArgument: return "call.GetObject("+indexStr+")";
+        case VariableArgument: return "call.GetVariable("+indexStr+")";
+        case InlineCodeArgument: return parameter.supplementaryInformation;
+        default: return "call.GetString("+indexStr+")";
+    }
+}
+
+std::map<gd::String, gd::String> EventsFunctionsTableCodeGenerator::GenerateFunctionsBodies(const Entry & entry, gd::EventsCodeGenerator & codeGenerator_) const
+{
+    FunctionsCodeGenerator & codeGenerator = static_cast<FunctionsCodeGenerator&>(codeGenerator_);
+    std::map<gd::String, gd::String> bodies;
+
+    const std::vector<gd::ParameterMetadata> & parameters = entry.instruction ? entry.instruction->parameters : entry.expression->parameters;
+    std::vector<gd::String> arguments;
+    for (std::size_t i = 0;i<parameters.size();++i)
+        arguments.push_back(GenerateArgumentCode(parameters[i], i));
+
+    std::size_t startFrom = entry.owner == Entry::Free ? 0 : (entry.owner == Entry::Object ? 1 : 2);
+
+    if ( entry.expression )
+    {
+        const gd::ExpressionCodeGenerationInformation & codeInfo = entry.expression->codeExtraInformation;
+        bool castNeeded = !entry.ownerClassName.empty();
+
+        //Like the code generated from events, cast the object or the behavior if possible.
+        gd::String callStart;
+        if ( entry.owner == Entry::Object )
+        {
+            if ( codeInfo.staticFunction )
+                callStart = castNeeded ? entry.ownerClassName+"::" : "RuntimeObject::";
+            else
+                callStart = castNeeded ? "static_cast<"+entry.ownerClassName+"*>(call.object)->" : "call.object->";
+        }
+        else if ( entry.owner == Entry::Behavior )
+        {
+            gd::String behavior = "call.object->GetBehaviorRawPointer(call.GetString(1))";
+            if ( codeInfo.staticFunction )
+                callStart = castNeeded ? entry.ownerClassName+"::" : "gd::Behavior::";
+            else
+                callStart = castNeeded ? "static_cast<"+entry.ownerClassName+"*>("+behavior+")->" : behavior+"->";
+        }
+
+        gd::String functionCall = callStart+codeInfo.functionCallName+"("+codeGenerator.GenerateArgumentsList(arguments, startFrom)+")";
+        bodies[entry.key] = gd::String(entry.stringExpression ? "call.SetStringResult(" : "call.SetNumberResult(")+functionCall+");";
+        return bodies;
+    }
+
+    const gd::InstructionMetadata & metadata = *entry.instruction;
+    const gd::InstructionMetadata::ExtraInformation & codeInfo = metadata.codeExtraInformation;
+
+    gd::String objectPart;
+    if ( entry.owner == Entry::Object )
+    {
+        gd::String className = parameters[0].supplementaryInformation.empty() ? "" :
+            gd::MetadataProvider::GetObjectMetadata(platform, parameters[0].supplementaryInformation).className;
+        objectPart = className.empty() ? "call.object->" : "static_cast<"+className+"*>(call.object)->";
+    }
+    else if ( entry.owner == Entry::Behavior )
+    {
+        gd::String className = parameters[1].supplementaryInformation.empty() ? "" :
+            gd::MetadataProvider::GetBehaviorMetadata(platform, parameters[1].supplementaryInformation).className;
+        gd::String behavior = "call.object->GetBehaviorRawPointer(call.GetString(1))";
+        objectPart = className.empty() ? behavior+"->" : "static_cast<"+className+"*>("+behavior+")->";
+    }
+
+    bool operatorFunctions = codeInfo.type == "number" || codeInfo.type == "string";
+    if ( entry.condition )
+    {
+        if ( !operatorFunctions )
+        {
+            bodies[entry.key] = "call.SetConditionResult("+objectPart+codeInfo.functionCallName+"("+
+                codeGenerator.GenerateArgumentsList(arguments, startFrom)+"));";
+            return bodies;
+        }
+
+        for (auto & relationalOperator : GetRelationalOperators())
+        {
+            std::vector<gd::String> operatorArguments = ReplaceLastArgumentOfType(metadata, arguments, "relationalOperator", startFrom, "\""+relationalOperator+"\"");
+            gd::String predicate = codeGenerator.GenerateRelationalOperatorCall(metadata, operatorArguments, objectPart+codeInfo.functionCallName, startFrom);
+            if ( !predicate.empty() ) bodies[entry.key+"/"+relationalOperator] = "call.SetConditionResult("+predicate+");";
+        }
+    }
+    else
+    {
+        if ( !operatorFunctions )
+        {
+            bodies[entry.key] = objectPart+codeInfo.functionCallName+"("+codeGenerator.GenerateArgumentsList(arguments, startFrom)+");";
+            return bodies;
+        }
+
+        for (auto & operatorString : GetOperators())
+        {
+            std::vector<gd::String> operatorArguments = ReplaceLastArgumentOfType(metadata, arguments, "operator", startFrom, "\""+operatorString+"\"");
+
+            gd::String call;
+            if ( codeInfo.accessType == gd::InstructionMetadata::ExtraInformation::MutatorAndOrAccessor )
+                call = codeGenerator.GenerateOperatorCall(metadata, operatorArguments, objectPart+codeInfo.functionCallName,
+                    objectPart+codeInfo.optionalAssociatedInstruction, startFrom);
+            else if ( codeInfo.accessType == gd::InstructionMetadata::ExtraInformation::Mutators )
+                call = codeGenerator.GenerateMutatorCall(metadata, operatorArguments, objectPart+codeInfo.functionCallName, startFrom);
+            else
+                call = codeGenerator.GenerateCompoundOperatorCall(metadata, operatorArguments, objectPart+codeInfo.functionCallName, startFrom);
+
+            if ( !call.empty() ) bodies[entry.key+"/"+operatorString] = call+";";
+        }
+    }
+
+    return bodies;
+}
+
+gd::String EventsFunctionsTableCodeGenerator::GenerateCode() const
+{
+    gd::Project project;
+    gd::Layout layout;
+    FunctionsCodeGenerator codeGenerator(project, layout, platform);
+
+    std::set<gd::String> includeFiles;
+    gd::String functionsCode;
+    gd::String registrationCode;
+    std::size_t functionsCount = 0;
+    for (auto & entry : entries)
+    {
+        includeFiles.insert(entry.includeFiles.begin(), entry.includeFiles.end());
+        for (auto & body : GenerateFunctionsBodies(entry, codeGenerator))
+        {
+            gd::String functionName = "GDEventsFunction"+gd::String::From(functionsCount++);
+            functionsCode += "void "+functionName+"(EventsFunctionCall & call)\n{\n    "+body.second+"\n}\n";
+            registrationCode += "    table.Add("+ConvertToCppString(body.first)+", &"+functionName+");\n";
+        }
+    }
+
+    gd::String output = "#include <vector>\n#include <map>\n#include <string>\n#include <algorithm>\n#include <SFML/System/Clock.hpp>\n#include <SFML/System/Vector2.hpp>\n#include <SFML/Graphics/Color.hpp>\n"
+        "#include \"GDCpp/Runtime/RuntimeContext.h\"\n#include \"GDCpp/Runtime/RuntimeObject.h\"\n#include \"GDCpp/Runtime/EventsFunctionsTable.h\"\n";
+    for (auto & includeFile : includeFiles)
+        output += "#include \""+includeFile+"\"\n";
+
+    output += "\nnamespace\n{\n\n"+functionsCode+"\n}\n\n";
+    output += "extern \"C\" void GDRegisterEventsFunctions(EventsFunctionsTable & table)\n{\n"+registrationCode+"}\n";
+
+    return output;
+}
+
+#endif
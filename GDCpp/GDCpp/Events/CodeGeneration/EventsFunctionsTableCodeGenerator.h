@@ -0,0 +1,139 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+
+#if defined(GD_IDE_ONLY)
+
+#ifndef EVENTSFUNCTIONSTABLECODEGENERATOR_H
+#define EVENTSFUNCTIONSTABLECODEGENERATOR_H
+#include <map>
+#include <vector>
+#include "GDCore/String.h"
+namespace gd { class Platform; }
+namespace gd { class InstructionMetadata; }
+namespace gd { class ExpressionMetadata; }
+namespace gd { class ParameterMetadata; }
+namespace gd { class EventsCodeGenerator; }
+
+/**
+ * \brief Generate the code of the dynamic library filling the EventsFunctionsTable used by
+ * the events bytecode interpreter.
+ *
+ * A function is generated for each condition, action and expression of the extensions of the
+ * platform, calling the same code as the one generated by EventsCodeGenerator. Conditions and
+ * actions working on a number or a string have a function for each operator, named with the key
+ * of the instruction followed by `/` and the operator ( for example `ObjectCondition:Sprite:Opacity/<=` ).
+ *
+ * Instructions and expressions having a custom code generator can only be compiled: they have
+ * no function in the table.
+ *
+ * \see EventsBytecodeGenerator
+ * \see EventsFunctionsTable
+ * \ingroup CodeGeneration
+ */
+class GD_API EventsFunctionsTableCodeGenerator
+{
+public:
+    /**
+     * \brief The type of the value read by a function of the table for an argument.
+     */
+    enum ArgumentType
+    {
+        NumberArgument,
+        IntegerArgument,
+        BooleanArgument,
+        StringArgument,
+        SceneArgument,          ///< The scene, without register.
+        ObjectsListsArgument,   ///< The index of a group of objects lists.
+        ObjectArgument,
+        VariableArgument,
+        InlineCodeArgument      ///< Code written in the function, without register.
+    };
+
+    /**
+     * \brief Prepare the generation of the functions of the extensions of \a platform.
+     * \param extensionsNames If not empty, only the functions of these extensions are generated.
+     */
+    EventsFunctionsTableCodeGenerator(const gd::Platform & platform,
+        const std::vector<gd::String> & extensionsNames = std::vector<gd::String>());
+    virtual ~EventsFunctionsTableCodeGenerator() {};
+
+    /**
+     * \brief Generate the C++ file of the dynamic library, exporting `GDRegisterEventsFunctions`.
+     */
+    gd::String GenerateCode() const;
+
+    /**
+     * \brief Return the key of the function calling the condition or action \a metadata ( a reference
+     * to the metadata stored by the platform ), or an empty string if there is none.
+     * \param operatorString The ( relational ) operator used by the instruction, if it works on
+     * a number or a string.
+     */
+    gd::String GetInstructionFunctionKey(const gd::InstructionMetadata & metadata, const gd::String & operatorString) const;
+
+    /**
+     * \brief Return the key of the function calling the expression \a metadata ( a reference
+     * to the metadata stored by the platform ), or an empty string if there is none.
+     */
+    gd::String GetExpressionFunctionKey(const gd::ExpressionMetadata & metadata) const;
+
+    /**
+     * \brief Return the type of the value read for a parameter.
+     */
+    static ArgumentType GetArgumentType(const gd::ParameterMetadata & parameter);
+
+    /**
+     * \brief Return the relational operators of the functions of conditions.
+     */
+    static const std::vector<gd::String> & GetRelationalOperators();
+
+    /**
+     * \brief Return the operators of the functions of actions.
+     */
+    static const std::vector<gd::String> & GetOperators();
+
+private:
+    /**
+     * \brief A condition, action or expression having functions in the table.
+     */
+    struct Entry
+    {
+        enum Owner { Free, Object, Behavior };
+
+        Entry() : owner(Free), instruction(nullptr), condition(false), expression(nullptr), stringExpression(false) {};
+
+        gd::String key;
+        Owner owner;
+        gd::String ownerClassName; ///< The class of the object or behavior owning an expression.
+        std::vector<gd::String> includeFiles;
+        const gd::InstructionMetadata * instruction;
+        bool condition;
+        const gd::ExpressionMetadata * expression;
+        bool stringExpression;
+    };
+
+    void AddInstructions(std::map<gd::String, gd::InstructionMetadata> & instructions, bool condition,
+        Entry::Owner owner, const gd::String & ownerType);
+    void AddExpressions(std::map<gd::String, gd::ExpressionMetadata> & expressions, bool stringExpression,
+        Entry::Owner owner, const gd::String & ownerType, const gd::String & ownerClassName,
+        const std::vector<gd::String> & ownerIncludeFiles);
+
+    /**
+     * \brief Generate the body of the functions of an entry, associated to their keys.
+     * \param codeGenerator The code generator used to generate the calls to instructions working on
+     * numbers and strings.
+     */
+    std::map<gd::String, gd::String> GenerateFunctionsBodies(const Entry & entry, gd::EventsCodeGenerator & codeGenerator) const;
+
+    static gd::String GenerateArgumentCode(const gd::ParameterMetadata & parameter, std::size_t index);
+
+    const gd::Platform & platform;
+    std::vector<Entry> entries;
+    std::map<const gd::InstructionMetadata*, gd::String> instructionsKeys;
+    std::map<const gd::ExpressionMetadata*, gd::String> expressionsKeys;
+};
+
+#endif // EVENTSFUNCTIONSTABLECODEGENERATOR_H
+#endif
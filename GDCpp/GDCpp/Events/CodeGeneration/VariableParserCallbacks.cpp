@@ -28,7 +28,8 @@ VariableCodeGenerationCallbacks::VariableCodeGenerationCallbacks(gd::String & ou
     output(output_),
     codeGenerator(codeGenerator_),
     context(context_),
-    scope(scope_)
+    scope(scope_),
+    readOnly(false)
 {
 	if ( scope == OBJECT_VARIABLE ) {
 		std::cout << "ERROR: Initializing VariableCodeGenerationCallbacks with OBJECT_VARIABLE without object.";
@@ -38,12 +39,14 @@ VariableCodeGenerationCallbacks::VariableCodeGenerationCallbacks(gd::String & ou
 VariableCodeGenerationCallbacks::VariableCodeGenerationCallbacks(gd::String & output_,
                                                                gd::EventsCodeGenerator & codeGenerator_,
                                                                gd::EventsCodeGenerationContext & context_,
-                                                               const gd::String & object_) :
+                                                               const gd::String & object_,
+                                                               bool readOnly_) :
     output(output_),
     codeGenerator(codeGenerator_),
     context(context_),
     scope(OBJECT_VARIABLE),
-    object(object_)
+    object(object_),
+    readOnly(readOnly_)
 {
 }
 
@@ -62,16 +65,17 @@ void VariableCodeGenerationCallbacks::OnRootVariable(gd::String variableName)
 	    std::vector<gd::String> realObjects = codeGenerator.ExpandObjectsName(object, context);
 
 	    output = "RuntimeVariablesContainer::GetBadVariablesContainer()";
+	    gd::String getVariables = readOnly ? "->GetConstVariables()" : "->GetVariables()";
 	    for (std::size_t i = 0;i<realObjects.size();++i)
 	    {
         	context.ObjectsListNeeded(realObjects[i]);
 
 	        //Generate the call to GetVariables() method.
 	        if ( context.GetCurrentObject() == realObjects[i] && !context.GetCurrentObject().empty())
-	            output = codeGenerator.GetObjectListName(realObjects[i], context)+"[i]->GetVariables()";
+	            output = codeGenerator.GetObjectListName(realObjects[i], context)+"[i]"+getVariables;
 	        else
 	            output = "(("+codeGenerator.GetObjectListName(realObjects[i], context)+".empty() ) ? "+output+" : "+
-	            	codeGenerator.GetObjectListName(realObjects[i], context)+"[0]->GetVariables())";
+	            	codeGenerator.GetObjectListName(realObjects[i], context)+"[0]"+getVariables+")";
 	    }
 
 	    if ( codeGenerator.GetLayout().HasObjectNamed(object) ) //We check first layout's objects' list.
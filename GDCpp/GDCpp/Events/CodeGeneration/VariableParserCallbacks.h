@@ -55,9 +55,11 @@ public:
      * \param codeGenerator The code generator being used.
      * \param context The current code generation context.
      * \param object The name of the object
+     * \param readOnly Set this to true if the variable is only read, so that the object is not
+     * marked as changed (see RuntimeObject::GetConstVariables).
      */
     VariableCodeGenerationCallbacks(gd::String & output, gd::EventsCodeGenerator & codeGenerator_,
-        gd::EventsCodeGenerationContext & context_, const gd::String & object);
+        gd::EventsCodeGenerationContext & context_, const gd::String & object, bool readOnly = false);
 
     /**
      * \brief Called when the first variable has been parsed.
@@ -84,6 +86,7 @@ private:
     gd::EventsCodeGenerationContext & context;
     VariableScope scope;
     const gd::String object; ///< The object name, when scope == OBJECT_VARIABLE.
+    bool readOnly; ///< True if the object variable is only read.
 };
 
 #endif // VARIABLEPARSERCALLBACKS_H
@@ -100,11 +100,98 @@ BaseObjectExtension::BaseObjectExtension()
     GetAllConditions()["Distance"].SetFunctionName("DistanceBetweenObjects").SetIncludeFile("GDCpp/Extensions/Builtin/ObjectTools.h");
     GetAllConditions()["AjoutObjConcern"].SetFunctionName("PickAllObjects").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
     GetAllConditions()["AjoutHasard"].SetFunctionName("PickRandomObject").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
-    GetAllConditions()["PickNearest"].SetFunctionName("PickNearestObject").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+    GetAllConditions()["PickNearest"].AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("PickNearestObject").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
     GetAllConditions()["NbObjet"].SetFunctionName("PickedObjectsCount").SetManipulatedType("number").SetIncludeFile("GDCpp/Extensions/Builtin/ObjectTools.h");
     GetAllConditions()["CollisionNP"].SetFunctionName("HitBoxesCollision").SetIncludeFile("GDCpp/Extensions/Builtin/ObjectTools.h");
     GetAllConditions()["EstTourne"].SetFunctionName("ObjectsTurnedToward").SetIncludeFile("GDCpp/Extensions/Builtin/ObjectTools.h");
 
     GetAllExpressions()["Count"].SetFunctionName("PickedObjectsCount").SetIncludeFile("GDCpp/Extensions/Builtin/ObjectTools.h");
+
+    AddCondition("PickWithinRadius",
+                   _("Pick objects within a radius"),
+                   _("Among the objects, pick the ones that are within the specified distance (or further if condition is inverted) from the specified position."),
+                   _("Pick _PARAM0_ within _PARAM3_ pixels of _PARAM1_;_PARAM2_"),
+                   _("Objects"),
+                   "res/conditions/distance24.png",
+                   "res/conditions/distance.png")
+        .AddParameter("objectList", _("Object"))
+        .AddParameter("expression", _("X position"))
+        .AddParameter("expression", _("Y position"))
+        .AddParameter("expression", _("Radius (in pixels)"))
+        .AddCodeOnlyParameter("conditionInverted", "")
+        .AddCodeOnlyParameter("currentScene", "")
+        .MarkAsSimple()
+        .SetFunctionName("PickObjectsWithinRadius").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddCondition("PickNearestObjects",
+                   _("Pick the nearest objects"),
+                   _("Among the objects, pick the specified number of objects that are the nearest (or the furthest if condition is inverted) from the specified position."),
+                   _("Pick the _PARAM3_ nearest _PARAM0_ to _PARAM1_;_PARAM2_"),
+                   _("Objects"),
+                   "res/conditions/distance24.png",
+                   "res/conditions/distance.png")
+        .AddParameter("objectList", _("Object"))
+        .AddParameter("expression", _("X position"))
+        .AddParameter("expression", _("Y position"))
+        .AddParameter("expression", _("Number of objects"))
+        .AddCodeOnlyParameter("conditionInverted", "")
+        .AddCodeOnlyParameter("currentScene", "")
+        .MarkAsAdvanced()
+        .SetFunctionName("PickNearestObjects").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddCondition("Raycast",
+                   _("Raycast"),
+                   _("Send a ray from the specified position and pick the nearest object hit by the ray (or the furthest if condition is inverted).\nThe intersection can then be read with the raycast expressions."),
+                   _("Cast a ray from _PARAM1_;_PARAM2_ with angle _PARAM3_ and max distance _PARAM4_ against _PARAM0_"),
+                   _("Objects"),
+                   "res/conditions/distance24.png",
+                   "res/conditions/distance.png")
+        .AddParameter("objectList", _("Object"))
+        .AddParameter("expression", _("Ray source X position"))
+        .AddParameter("expression", _("Ray source Y position"))
+        .AddParameter("expression", _("Ray angle (in degrees)"))
+        .AddParameter("expression", _("Ray maximum distance (in pixels)"))
+        .AddCodeOnlyParameter("conditionInverted", "")
+        .AddCodeOnlyParameter("currentScene", "")
+        .MarkAsAdvanced()
+        .SetFunctionName("RaycastObjects").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddCondition("RaycastAll",
+                   _("Raycast (all objects)"),
+                   _("Send a ray from the specified position and pick all the objects hit by the ray (or not hit if condition is inverted).\nThe nearest intersection can then be read with the raycast expressions."),
+                   _("Cast a ray from _PARAM1_;_PARAM2_ with angle _PARAM3_ and max distance _PARAM4_ against all _PARAM0_"),
+                   _("Objects"),
+                   "res/conditions/distance24.png",
+                   "res/conditions/distance.png")
+        .AddParameter("objectList", _("Object"))
+        .AddParameter("expression", _("Ray source X position"))
+        .AddParameter("expression", _("Ray source Y position"))
+        .AddParameter("expression", _("Ray angle (in degrees)"))
+        .AddParameter("expression", _("Ray maximum distance (in pixels)"))
+        .AddCodeOnlyParameter("conditionInverted", "")
+        .AddCodeOnlyParameter("currentScene", "")
+        .MarkAsAdvanced()
+        .SetFunctionName("RaycastAllObjects").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddExpression("RaycastDistance", _("Raycast distance"), _("Distance between the source of the last ray and the object hit (or the maximum distance if no object was hit)"), _("Objects"), "res/conditions/distance.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("GetRaycastDistance").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddExpression("RaycastX", _("Raycast X position"), _("X position of the intersection of the last ray with the object hit"), _("Objects"), "res/conditions/distance.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("GetRaycastX").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddExpression("RaycastY", _("Raycast Y position"), _("Y position of the intersection of the last ray with the object hit"), _("Objects"), "res/conditions/distance.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("GetRaycastY").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddExpression("RaycastNormalX", _("Raycast normal X"), _("X coordinate of the normal of the hitbox edge hit by the last ray"), _("Objects"), "res/conditions/distance.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("GetRaycastNormalX").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddExpression("RaycastNormalY", _("Raycast normal Y"), _("Y coordinate of the normal of the hitbox edge hit by the last ray"), _("Objects"), "res/conditions/distance.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .SetFunctionName("GetRaycastNormalY").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
     #endif
 }
@@ -1,5 +1,6 @@
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
 #include "GDCpp/Extensions/Builtin/CommonConversionsExtension.h"
+#include "GDCpp/Extensions/Builtin/CommonInstructionsTools.h"
 #if !defined(GD_IDE_ONLY)
 #include "GDCore/Extensions/Builtin/CommonConversionsExtension.cpp"
 #endif
@@ -12,8 +13,8 @@ CommonConversionsExtension::CommonConversionsExtension()
     GetAllExpressions()["ToNumber"].SetFunctionName("GDpriv::CommonInstructions::ToDouble").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h");
     GetAllStrExpressions()["ToString"].SetFunctionName("GDpriv::CommonInstructions::ToString").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h");
     GetAllStrExpressions()["LargeNumberToString"].SetFunctionName("GDpriv::CommonInstructions::LargeNumberToString").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h");
-    GetAllExpressions()["ToRad"].SetFunctionName("GDpriv::CommonInstructions::ToRad").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h");
-    GetAllExpressions()["ToDeg"].SetFunctionName("GDpriv::CommonInstructions::ToDeg").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h");
+    GetAllExpressions()["ToRad"].SetFunctionName("GDpriv::CommonInstructions::ToRad").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h").SetConstantEvaluator(&GDpriv::CommonInstructions::ToRad);
+    GetAllExpressions()["ToDeg"].SetFunctionName("GDpriv::CommonInstructions::ToDeg").SetIncludeFile("GDCpp/Extensions/Builtin/CommonInstructionsTools.h").SetConstantEvaluator(&GDpriv::CommonInstructions::ToDeg);
     #endif
 }
 
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <string>
 #include <set>
+#include <iostream>
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/Events/Event.h"
@@ -16,6 +17,7 @@
 #include "GDCore/Events/Builtin/WhileEvent.h"
 #include "GDCore/Events/Builtin/RepeatEvent.h"
 #include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
 #endif
 #include "GDCpp/Extensions/Builtin/CommonInstructionsExtension.h"
 #include "GDCpp/Extensions/Builtin/CommonInstructionsTools.h"
@@ -38,6 +40,58 @@
 
 using namespace std;
 
+#if defined(GD_IDE_ONLY)
+namespace
+{
+
+/**
+ * \brief Generate the declarations of the objects lists used by a "For each object" event,
+ * and the code refilling them at the beginning of each iteration.
+ *
+ * Lists are declared once, before the loop, so that their memory is reused by all the
+ * iterations. Lists of the iterated objects are not handled here.
+ */
+void GenerateForEachObjectsListsCode(gd::EventsCodeGenerator & codeGenerator, gd::EventsCodeGenerationContext & context,
+    const std::vector<gd::String> & realObjects, gd::String & declarationsCode, gd::String & resetCode)
+{
+    auto declareObjectList = [&](const gd::String & object, bool empty) {
+        if (std::find(realObjects.begin(), realObjects.end(), object) != realObjects.end())
+            return;
+
+        gd::String objectListName = codeGenerator.GetObjectListName(object, context);
+        if (!context.ObjectAlreadyDeclared(object))
+        {
+            declarationsCode += "std::vector<RuntimeObject*> "+objectListName+";\n";
+            if (empty)
+                resetCode += objectListName+".clear();\n";
+            else
+                resetCode += objectListName+" = runtimeContext->GetObjectsRawPointers(\""+codeGenerator.ConvertToString(object)+"\");\n";
+
+            context.SetObjectDeclared(object);
+        }
+        else if (!context.GetParentContext())
+            declarationsCode += "/* Could not declare " + objectListName + " */\n";
+        else if (context.IsSameObjectsList(object, *context.GetParentContext()))
+            declarationsCode += "/* Reuse " + objectListName + " */\n";
+        else
+        {
+            //Use a temporary variable as the names of lists are the same between contexts.
+            gd::String copiedListName = codeGenerator.GetObjectListName(object, *context.GetParentContext());
+            declarationsCode += "std::vector<RuntimeObject*> & " + objectListName + "T = " + copiedListName + ";\n";
+            declarationsCode += "std::vector<RuntimeObject*> " + objectListName + ";\n";
+            resetCode += objectListName + " = " + objectListName + "T;\n";
+        }
+    };
+
+    for (auto object : context.GetObjectsListsToBeDeclared())
+        declareObjectList(object, false);
+    for (auto object : context.GetObjectsListsToBeDeclaredEmpty())
+        declareObjectList(object, true);
+}
+
+}
+#endif
+
 CommonInstructionsExtension::CommonInstructionsExtension()
 {
     gd::BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(*this);
@@ -164,8 +218,45 @@ CommonInstructionsExtension::CommonInstructionsExtension()
 
     GetAllConditions()["BuiltinCommonInstructions::Once"].codeExtraInformation
         .SetCustomCodeGenerator([](gd::Instruction & instruction, gd::EventsCodeGenerator & codeGenerator, gd::EventsCodeGenerationContext & parentContext) {
-            size_t uniqueId = (size_t)&instruction;
-            return "conditionTrue = runtimeContext->TriggerOnce("+gd::String::From(uniqueId)+");\n";
+            EventsCodeGenerator * cppCodeGenerator = dynamic_cast<EventsCodeGenerator*>(&codeGenerator);
+            if ( !cppCodeGenerator )
+            {
+                std::cout << "ERROR: \"Trigger once\" conditions can only be generated by the C++ events code generator." << std::endl;
+                return gd::String("conditionTrue = false;\n");
+            }
+
+            gd::String conditionIndex = cppCodeGenerator->GenerateTriggerOnceConditionIndex();
+            return "conditionTrue = runtimeContext->TriggerOnce("+conditionIndex+");\n";
+        });
+
+    AddCondition("OnceForEachObject",
+                   _("Trigger once for each object"),
+                   _("Among the objects, pick only the ones for which the conditions were not met during the last frame, so that actions are run only once for each object each time the conditions are met."),
+                   _("Trigger once for each _PARAM0_"),
+                   _("Advanced"),
+                   "res/conditions/once24.png",
+                   "res/conditions/once.png")
+        .AddParameter("objectList", _("Object"))
+        .MarkAsAdvanced()
+        .codeExtraInformation.SetCustomCodeGenerator([](gd::Instruction & instruction, gd::EventsCodeGenerator & codeGenerator, gd::EventsCodeGenerationContext & context) {
+            EventsCodeGenerator * cppCodeGenerator = dynamic_cast<EventsCodeGenerator*>(&codeGenerator);
+            if ( !cppCodeGenerator )
+            {
+                std::cout << "ERROR: \"Trigger once for each object\" conditions can only be generated by the C++ events code generator." << std::endl;
+                return gd::String("conditionTrue = false;\n");
+            }
+
+            gd::String conditionIndex = cppCodeGenerator->GenerateTriggerOnceConditionIndex();
+
+            gd::String objectsListsMap = "runtimeContext->ClearObjectListsMap()";
+            for (auto object : codeGenerator.ExpandObjectsName(instruction.GetParameter(0).GetPlainString(), context))
+            {
+                context.ObjectsListNeeded(object);
+                objectsListsMap += ".AddObjectListToMap(\""+codeGenerator.ConvertToString(object)+"\", "+codeGenerator.GetObjectListName(object, context)+")";
+            }
+            objectsListsMap += ".ReturnObjectListsMap()";
+
+            return "conditionTrue = runtimeContext->TriggerOnceForEachObject("+objectsListsMap+", "+conditionIndex+");\n";
         });
 
     GetAllEvents()["BuiltinCommonInstructions::Standard"]
@@ -366,7 +457,10 @@ CommonInstructionsExtension::CommonInstructionsExtension()
             //Prepare object declaration and sub events
             gd::String subevents = codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
 
-            gd::String objectDeclaration = codeGenerator.GenerateObjectsDeclarationCode(context)+"\n";
+            //*Optimization*: Objects lists are declared before the loop and refilled at each iteration,
+            //so that no memory is allocated by the iterations.
+            gd::String objectsDeclaration, objectsReset;
+            GenerateForEachObjectsListsCode(codeGenerator, context, realObjects, objectsDeclaration, objectsReset);
 
             if ( realObjects.size() != 1) //(We write a slighty more simple ( and optimized ) output code when only one object list is used.)
             {
@@ -380,27 +474,31 @@ CommonInstructionsExtension::CommonInstructionsExtension()
             }
 
             //Write final code :
+            outputCode += "{\n"; //This scope is used as the lists of the iterated objects are replaced.
+            if ( realObjects.size() == 1 ) //We write a slighty more simple ( and optimized ) output code when only one object list is used.
+                outputCode += "std::vector<RuntimeObject*> & forEachObjects = "+ManObjListName(realObjects[0])+";\n";
+
+            //Declare all lists of concerned objects, and the other lists used in the loop.
+            for (std::size_t j = 0;j<realObjects.size();++j)
+                outputCode += "std::vector<RuntimeObject*> "+ManObjListName(realObjects[j])+";\n";
+            outputCode += objectsDeclaration;
 
             //For loop declaration
-            if ( realObjects.size() == 1 ) //We write a slighty more simple ( and optimized ) output code when only one object list is used.
-                outputCode += "for(std::size_t forEachIndex = 0;forEachIndex < "+ManObjListName(realObjects[0])+".size();++forEachIndex)\n";
+            if ( realObjects.size() == 1 )
+                outputCode += "for(std::size_t forEachIndex = 0;forEachIndex < forEachObjects.size();++forEachIndex)\n";
             else
                 outputCode += "for(std::size_t forEachIndex = 0;forEachIndex < forEachTotalCount;++forEachIndex)\n";
 
             outputCode += "{\n";
 
             //Clear all concerned objects lists and keep only one object
+            for (std::size_t j = 0;j<realObjects.size();++j)
+                outputCode += ManObjListName(realObjects[j])+".clear();\n";
+
             if ( realObjects.size() == 1 )
-            {
-                outputCode += "std::vector<RuntimeObject*> temporaryForEachList; temporaryForEachList.push_back("+ManObjListName(realObjects[0])+"[forEachIndex]);";
-                outputCode += "std::vector<RuntimeObject*> "+ManObjListName(realObjects[0])+" = temporaryForEachList;\n";
-            }
+                outputCode += ManObjListName(realObjects[0])+".push_back(forEachObjects[forEachIndex]);\n";
             else
             {
-                //Declare all lists of concerned objects empty
-                for (std::size_t j = 0;j<realObjects.size();++j)
-                    outputCode += "std::vector<RuntimeObject*> "+ManObjListName(realObjects[j])+";\n";
-
                 for (std::size_t i = 0;i<realObjects.size();++i) //Pick then only one object
                 {
                     gd::String count;
@@ -417,8 +515,7 @@ CommonInstructionsExtension::CommonInstructionsExtension()
                 }
             }
 
-            outputCode += "{"; //This scope is used as the for loop modified the objects list.
-            outputCode += objectDeclaration;
+            outputCode += objectsReset;
 
             outputCode += conditionsCode;
             outputCode += "if (" +ifPredicat+ ")\n";
@@ -432,9 +529,8 @@ CommonInstructionsExtension::CommonInstructionsExtension()
             }
             outputCode += "}\n";
 
-            outputCode += "}";
-
             outputCode += "}\n"; //End of for loop
+            outputCode += "}\n";
 
             return outputCode;
         });
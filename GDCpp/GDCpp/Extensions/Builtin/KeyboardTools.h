@@ -13,7 +13,9 @@
 class RuntimeScene;
 
 bool IsKeyPressed(RuntimeScene & scene, gd::String key);
+bool IsKeyPressed(RuntimeScene & scene, int key); ///< Used by generated code when the key name is known at compile time.
 bool WasKeyReleased(RuntimeScene & scene, gd::String key);
+bool WasKeyReleased(RuntimeScene & scene, int key); ///< Used by generated code when the key name is known at compile time.
 bool AnyKeyIsPressed(RuntimeScene & scene);
 gd::String LastPressedKey(RuntimeScene & scene);
 
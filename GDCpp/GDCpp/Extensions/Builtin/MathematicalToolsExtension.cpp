@@ -5,6 +5,7 @@
  */
 
 #include "MathematicalToolsExtension.h"
+#include "GDCpp/Extensions/Builtin/MathematicalTools.h"
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
 #if !defined(GD_IDE_ONLY)
 #include "GDCore/Extensions/Builtin/MathematicalToolsExtension.cpp"
@@ -16,44 +17,44 @@ MathematicalToolsExtension::MathematicalToolsExtension()
 
     #if defined(GD_IDE_ONLY)
 
-    GetAllExpressions()["AngleDifference"].SetFunctionName("GDpriv::MathematicalTools::angleDifference").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["mod"].SetFunctionName("GDpriv::MathematicalTools::mod").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["min"].SetFunctionName("GDpriv::MathematicalTools::Minimal").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["max"].SetFunctionName("GDpriv::MathematicalTools::Maximal").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["abs"].SetFunctionName("GDpriv::MathematicalTools::abs").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["acos"].SetFunctionName("GDpriv::MathematicalTools::acos").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["acosh"].SetFunctionName("GDpriv::MathematicalTools::acosh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["asin"].SetFunctionName("GDpriv::MathematicalTools::asin").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["asinh"].SetFunctionName("GDpriv::MathematicalTools::asinh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["atan"].SetFunctionName("GDpriv::MathematicalTools::atan").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["atan2"].SetFunctionName("GDpriv::MathematicalTools::atan2").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["atanh"].SetFunctionName("GDpriv::MathematicalTools::atanh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["cbrt"].SetFunctionName("GDpriv::MathematicalTools::cbrt").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["ceil"].SetFunctionName("GDpriv::MathematicalTools::ceil").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["floor"].SetFunctionName("GDpriv::MathematicalTools::floor").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["cos"].SetFunctionName("GDpriv::MathematicalTools::cos").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["cosh"].SetFunctionName("GDpriv::MathematicalTools::cosh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["cot"].SetFunctionName("GDpriv::MathematicalTools::cot").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["csc"].SetFunctionName("GDpriv::MathematicalTools::csc").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["int"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["rint"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["round"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["exp"].SetFunctionName("GDpriv::MathematicalTools::exp").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["log"].SetFunctionName("GDpriv::MathematicalTools::log").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["ln"].SetFunctionName("GDpriv::MathematicalTools::log").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["log2"].SetFunctionName("GDpriv::MathematicalTools::log2").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["log10"].SetFunctionName("GDpriv::MathematicalTools::log10").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["nthroot"].SetFunctionName("GDpriv::MathematicalTools::nthroot").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["pow"].SetFunctionName("GDpriv::MathematicalTools::pow").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["sec"].SetFunctionName("GDpriv::MathematicalTools::sec").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["sign"].SetFunctionName("GDpriv::MathematicalTools::sign").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["sin"].SetFunctionName("GDpriv::MathematicalTools::sin").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["sinh"].SetFunctionName("GDpriv::MathematicalTools::sinh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["sqrt"].SetFunctionName("GDpriv::MathematicalTools::sqrt").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["tan"].SetFunctionName("GDpriv::MathematicalTools::tan").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["tanh"].SetFunctionName("GDpriv::MathematicalTools::tanh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["trunc"].SetFunctionName("GDpriv::MathematicalTools::trunc").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
-    GetAllExpressions()["lerp"].SetFunctionName("GDpriv::MathematicalTools::lerp").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h");
+    GetAllExpressions()["AngleDifference"].SetFunctionName("GDpriv::MathematicalTools::angleDifference").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::angleDifference);
+    GetAllExpressions()["mod"].SetFunctionName("GDpriv::MathematicalTools::mod").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::mod);
+    GetAllExpressions()["min"].SetFunctionName("GDpriv::MathematicalTools::Minimal").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::Minimal);
+    GetAllExpressions()["max"].SetFunctionName("GDpriv::MathematicalTools::Maximal").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::Maximal);
+    GetAllExpressions()["abs"].SetFunctionName("GDpriv::MathematicalTools::abs").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::abs);
+    GetAllExpressions()["acos"].SetFunctionName("GDpriv::MathematicalTools::acos").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::acos);
+    GetAllExpressions()["acosh"].SetFunctionName("GDpriv::MathematicalTools::acosh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::acosh);
+    GetAllExpressions()["asin"].SetFunctionName("GDpriv::MathematicalTools::asin").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::asin);
+    GetAllExpressions()["asinh"].SetFunctionName("GDpriv::MathematicalTools::asinh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::asinh);
+    GetAllExpressions()["atan"].SetFunctionName("GDpriv::MathematicalTools::atan").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::atan);
+    GetAllExpressions()["atan2"].SetFunctionName("GDpriv::MathematicalTools::atan2").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::atan2);
+    GetAllExpressions()["atanh"].SetFunctionName("GDpriv::MathematicalTools::atanh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::atanh);
+    GetAllExpressions()["cbrt"].SetFunctionName("GDpriv::MathematicalTools::cbrt").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::cbrt);
+    GetAllExpressions()["ceil"].SetFunctionName("GDpriv::MathematicalTools::ceil").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::ceil);
+    GetAllExpressions()["floor"].SetFunctionName("GDpriv::MathematicalTools::floor").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::floor);
+    GetAllExpressions()["cos"].SetFunctionName("GDpriv::MathematicalTools::cos").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::cos);
+    GetAllExpressions()["cosh"].SetFunctionName("GDpriv::MathematicalTools::cosh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::cosh);
+    GetAllExpressions()["cot"].SetFunctionName("GDpriv::MathematicalTools::cot").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::cot);
+    GetAllExpressions()["csc"].SetFunctionName("GDpriv::MathematicalTools::csc").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::csc);
+    GetAllExpressions()["int"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::Round);
+    GetAllExpressions()["rint"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::Round);
+    GetAllExpressions()["round"].SetFunctionName("GDpriv::MathematicalTools::Round").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::Round);
+    GetAllExpressions()["exp"].SetFunctionName("GDpriv::MathematicalTools::exp").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::exp);
+    GetAllExpressions()["log"].SetFunctionName("GDpriv::MathematicalTools::log").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::log);
+    GetAllExpressions()["ln"].SetFunctionName("GDpriv::MathematicalTools::log").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::log);
+    GetAllExpressions()["log2"].SetFunctionName("GDpriv::MathematicalTools::log2").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::log2);
+    GetAllExpressions()["log10"].SetFunctionName("GDpriv::MathematicalTools::log10").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::log10);
+    GetAllExpressions()["nthroot"].SetFunctionName("GDpriv::MathematicalTools::nthroot").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::nthroot);
+    GetAllExpressions()["pow"].SetFunctionName("GDpriv::MathematicalTools::pow").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::pow);
+    GetAllExpressions()["sec"].SetFunctionName("GDpriv::MathematicalTools::sec").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::sec);
+    GetAllExpressions()["sign"].SetFunctionName("GDpriv::MathematicalTools::sign").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::sign);
+    GetAllExpressions()["sin"].SetFunctionName("GDpriv::MathematicalTools::sin").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::sin);
+    GetAllExpressions()["sinh"].SetFunctionName("GDpriv::MathematicalTools::sinh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::sinh);
+    GetAllExpressions()["sqrt"].SetFunctionName("GDpriv::MathematicalTools::sqrt").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::sqrt);
+    GetAllExpressions()["tan"].SetFunctionName("GDpriv::MathematicalTools::tan").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::tan);
+    GetAllExpressions()["tanh"].SetFunctionName("GDpriv::MathematicalTools::tanh").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::tanh);
+    GetAllExpressions()["trunc"].SetFunctionName("GDpriv::MathematicalTools::trunc").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::trunc);
+    GetAllExpressions()["lerp"].SetFunctionName("GDpriv::MathematicalTools::lerp").SetIncludeFile("GDCpp/Extensions/Builtin/MathematicalTools.h").SetConstantEvaluator(&GDpriv::MathematicalTools::lerp);
 
     #endif
 }
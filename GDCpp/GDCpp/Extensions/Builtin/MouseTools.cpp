@@ -3,6 +3,8 @@
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <unordered_set>
 
 void GD_API CenterCursor( RuntimeScene & scene )
 {
@@ -59,11 +61,21 @@ bool GD_API MouseButtonPressed(RuntimeScene & scene, const gd::String & button)
     return scene.GetInputManager().IsMouseButtonPressed(button);
 }
 
+bool GD_API MouseButtonPressed(RuntimeScene & scene, int button)
+{
+    return scene.GetInputManager().IsMouseButtonPressed(button);
+}
+
 bool GD_API MouseButtonReleased(RuntimeScene & scene, const gd::String & button)
 {
     return scene.GetInputManager().IsMouseButtonReleased(button);
 }
 
+bool GD_API MouseButtonReleased(RuntimeScene & scene, int button)
+{
+    return scene.GetInputManager().IsMouseButtonReleased(button);
+}
+
 int GD_API GetMouseWheelDelta(RuntimeScene & scene)
 {
     return scene.GetInputManager().GetMouseWheelDelta();
@@ -71,7 +83,68 @@ int GD_API GetMouseWheelDelta(RuntimeScene & scene)
 
 bool GD_API CursorOnObject(std::map <gd::String, std::vector<RuntimeObject*> *> objectsLists, RuntimeScene & scene, bool precise, bool conditionInverted)
 {
-    return PickObjectsIf(objectsLists, conditionInverted, [&scene, precise](RuntimeObject * obj) {
-        return obj->CursorOnObject(scene, precise);
-    });
+    if (conditionInverted || !scene.renderWindow)
+    {
+        return PickObjectsIf(objectsLists, conditionInverted, [&scene, precise](RuntimeObject * obj) {
+            return obj->CursorOnObject(scene, precise);
+        });
+    }
+
+    //Get the position of the mouse and of the touches on each layer.
+    std::vector< std::pair<gd::String, sf::Vector2f> > positions;
+    for (std::size_t i = 0;i<scene.GetLayersCount();++i)
+    {
+        const gd::String & layerName = scene.GetLayer(i).GetName();
+        const RuntimeLayer & layer = scene.GetRuntimeLayer(layerName);
+        for (std::size_t cameraIndex = 0;cameraIndex < layer.GetCameraCount();++cameraIndex)
+        {
+            const auto & view = layer.GetCamera(cameraIndex).GetSFMLView();
+            positions.push_back(std::make_pair(layerName,
+                scene.renderWindow->mapPixelToCoords(scene.GetInputManager().GetMousePosition(), view)));
+
+            for (auto & it : scene.GetInputManager().GetAllTouches())
+                positions.push_back(std::make_pair(layerName, scene.renderWindow->mapPixelToCoords(it.second, view)));
+        }
+    }
+
+    //Only objects found at these positions by the spatial index need to be tested.
+    bool isTrue = false;
+    std::vector<RuntimeObject*> candidates;
+    std::unordered_set<RuntimeObject*> picked;
+    for (auto it = objectsLists.begin();it!=objectsLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+        std::vector<RuntimeObject*> & list = *it->second;
+
+        if (CanUseSpatialIndex(scene, it->first, list))
+        {
+            picked.clear();
+            const ObjectsSpatialIndex & index = scene.GetSpatialIndex(it->first);
+            for (std::size_t i = 0;i<positions.size();++i)
+            {
+                index.GetAtPoint(positions[i].second.x, positions[i].second.y, candidates);
+                for (std::size_t j = 0;j<candidates.size();++j)
+                {
+                    RuntimeObject * object = candidates[j];
+                    if (object->GetLayer() == positions[i].first && picked.find(object) == picked.end()
+                        && object->CursorOnObject(scene, precise))
+                        picked.insert(object);
+                }
+            }
+
+            list.erase(std::remove_if(list.begin(), list.end(), [&picked](RuntimeObject * object) {
+                return picked.find(object) == picked.end();
+            }), list.end());
+        }
+        else
+        {
+            list.erase(std::remove_if(list.begin(), list.end(), [&scene, precise](RuntimeObject * object) {
+                return !object->CursorOnObject(scene, precise);
+            }), list.end());
+        }
+
+        if (!list.empty()) isTrue = true;
+    }
+
+    return isTrue;
 }
@@ -18,7 +18,9 @@ void GD_API ShowCursor(RuntimeScene & scene);
 double GD_API GetCursorXPosition(RuntimeScene & scene, const gd::String & layer, std::size_t camera);
 double GD_API GetCursorYPosition(RuntimeScene & scene, const gd::String & layer, std::size_t camera);
 bool GD_API MouseButtonPressed(RuntimeScene & scene, const gd::String & key);
+bool GD_API MouseButtonPressed(RuntimeScene & scene, int button); ///< Used by generated code when the button name is known at compile time.
 bool GD_API MouseButtonReleased(RuntimeScene & scene, const gd::String & key);
+bool GD_API MouseButtonReleased(RuntimeScene & scene, int button); ///< Used by generated code when the button name is known at compile time.
 int GD_API GetMouseWheelDelta(RuntimeScene & scene);
 bool GD_API CursorOnObject(std::map <gd::String, std::vector<RuntimeObject*> *> objectsLists, RuntimeScene & scene, bool precise, bool conditionInverted);
 
@@ -7,6 +7,10 @@
 #include <wx/msgdlg.h> //Must be placed first
 #endif
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
 #include "GDCore/Tools/Log.h"
 #include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
@@ -17,6 +21,7 @@
 #include "GDCpp/Extensions/CppPlatform.h"
 #include "GDCpp/Runtime/RuntimeObjectHelpers.h"
 #include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
+#include "GDCpp/Runtime/PolygonCollision.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/profile.h"
 #include "GDCpp/Runtime/CommonTools.h"
@@ -75,6 +80,17 @@ void GD_API PopScene(RuntimeScene & scene)
     scene.RequestChange(RuntimeScene::SceneChange::POP_SCENE);
 }
 
+void GD_API PreloadScene(RuntimeScene & scene, const gd::String & sceneName)
+{
+    if (!scene.game->HasLayoutNamed(sceneName)) return;
+    scene.RequestPreload(sceneName);
+}
+
+bool GD_API ScenePreloaded(RuntimeScene & scene, const gd::String & sceneName)
+{
+    return scene.IsScenePreloaded(sceneName);
+}
+
 bool GD_API SceneJustBegins(RuntimeScene & scene )
 {
     return scene.GetTimeManager().IsFirstLoop();
@@ -187,7 +203,7 @@ bool GD_API PickNearestObject(std::map <gd::String, std::vector<RuntimeObject*>
     for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
     {
         if ( it->second == NULL ) continue;
-        auto list = *it->second;
+        const std::vector<RuntimeObject*> & list = *it->second;
 
         for (std::size_t i = 0;i<list.size();++i)
         {
@@ -208,6 +224,269 @@ bool GD_API PickNearestObject(std::map <gd::String, std::vector<RuntimeObject*>
     return true;
 }
 
+bool GD_API PickNearestObject(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, bool inverted, RuntimeScene & scene)
+{
+    if (inverted)
+        return PickNearestObject(pickedObjectLists, x, y, inverted);
+
+    double best = 0;
+    RuntimeObject * bestObject = NULL;
+    std::vector<RuntimeObject*> nearest;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+
+        //Only the nearest object of each list is a candidate if the spatial index can be used.
+        const std::vector<RuntimeObject*> * candidates = it->second;
+        if (CanUseSpatialIndex(scene, it->first, *it->second))
+        {
+            scene.GetSpatialIndex(it->first).GetNearest(x, y, 1, nearest);
+            candidates = &nearest;
+        }
+
+        for (std::size_t i = 0;i<candidates->size();++i)
+        {
+            double value = (*candidates)[i]->GetSqDistanceTo(x, y);
+            if (!bestObject || value < best) {
+                bestObject = (*candidates)[i];
+                best = value;
+            }
+        }
+    }
+
+    if (!bestObject)
+        return false;
+
+    PickOnly(pickedObjectLists, bestObject);
+    return true;
+}
+
+bool GD_API PickObjectsWithinRadius(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double radius, bool inverted, RuntimeScene & scene)
+{
+    bool isTrue = false;
+    double sqRadius = radius*radius;
+    std::vector<RuntimeObject*> picked;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+        std::vector<RuntimeObject*> & list = *it->second;
+
+        if (!inverted && CanUseSpatialIndex(scene, it->first, list))
+            scene.GetSpatialIndex(it->first).GetWithinRadius(x, y, radius, picked);
+        else
+        {
+            picked.clear();
+            for (std::size_t i = 0;i<list.size();++i)
+            {
+                if (inverted ^ (list[i]->GetSqDistanceTo(x, y) <= sqRadius))
+                    picked.push_back(list[i]);
+            }
+        }
+
+        if (!picked.empty()) isTrue = true;
+        list.swap(picked);
+    }
+
+    return isTrue;
+}
+
+bool GD_API PickNearestObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double count, bool inverted, RuntimeScene & scene)
+{
+    std::size_t maxCount = count > 0 ? static_cast<std::size_t>(count) : 0;
+
+    //Gather the candidates of each list: only the nearest objects if the spatial index can be used.
+    std::vector< std::pair<double, RuntimeObject*> > candidates;
+    std::vector<RuntimeObject*> nearest;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+
+        const std::vector<RuntimeObject*> * list = it->second;
+        if (!inverted && CanUseSpatialIndex(scene, it->first, *list))
+        {
+            scene.GetSpatialIndex(it->first).GetNearest(x, y, maxCount, nearest);
+            list = &nearest;
+        }
+
+        for (std::size_t i = 0;i<list->size();++i)
+            candidates.push_back(std::make_pair((*list)[i]->GetSqDistanceTo(x, y), (*list)[i]));
+    }
+
+    //Keep the nearest (or the furthest if inverted) candidates among all lists.
+    if (candidates.size() > maxCount)
+    {
+        std::nth_element(candidates.begin(), candidates.begin()+maxCount, candidates.end(),
+            [inverted](const std::pair<double, RuntimeObject*> & a, const std::pair<double, RuntimeObject*> & b) {
+                return inverted ? a.first > b.first : a.first < b.first;
+            });
+        candidates.resize(maxCount);
+    }
+
+    std::unordered_set<RuntimeObject*> picked;
+    for (std::size_t i = 0;i<candidates.size();++i)
+        picked.insert(candidates[i].second);
+
+    bool isTrue = false;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+        std::vector<RuntimeObject*> & list = *it->second;
+
+        list.erase(std::remove_if(list.begin(), list.end(), [&picked](RuntimeObject * object) {
+            return picked.find(object) == picked.end();
+        }), list.end());
+        if (!list.empty()) isTrue = true;
+    }
+
+    return isTrue;
+}
+
+namespace
+{
+
+/**
+ * \brief Cast a ray against the objects of the lists, and store the objects hit with the intersections.
+ * \param nearestOnly If true, only the nearest object hit is stored and objects further are not tested.
+ */
+void RaycastObjectsLists(std::map <gd::String, std::vector<RuntimeObject*> *> & pickedObjectLists, float x1, float y1, float x2, float y2,
+    bool nearestOnly, RuntimeScene & scene, std::vector< std::pair<RuntimeObject*, RaycastResult> > & hits)
+{
+    float nearestDistance = std::numeric_limits<float>::max();
+    std::vector< std::pair<float, RuntimeObject*> > candidates;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+        const std::vector<RuntimeObject*> & list = *it->second;
+
+        //Only the objects in the cells crossed by the ray are tested if the spatial index can be used.
+        candidates.clear();
+        if (CanUseSpatialIndex(scene, it->first, list))
+            scene.GetSpatialIndex(it->first).GetAlongSegment(x1, y1, x2, y2, candidates);
+        else
+        {
+            for (std::size_t i = 0;i<list.size();++i)
+                candidates.push_back(std::make_pair(0.0f, list[i]));
+        }
+
+        for (std::size_t i = 0;i<candidates.size();++i)
+        {
+            //Candidates are sorted by the distance before which they can't be hit.
+            if (nearestOnly && candidates[i].first > nearestDistance) break;
+
+            RaycastResult result = candidates[i].second->RaycastTest(x1, y1, x2, y2);
+            if (!result.collision) continue;
+
+            if (nearestOnly)
+            {
+                if (result.distance >= nearestDistance) continue;
+
+                nearestDistance = result.distance;
+                hits.clear();
+            }
+            hits.push_back(std::make_pair(candidates[i].second, result));
+        }
+    }
+}
+
+/**
+ * \brief Return the result of a raycast which did not hit any object.
+ */
+RaycastResult MissedRaycast(float endX, float endY, float maxDistance)
+{
+    RaycastResult result;
+    result.distance = maxDistance;
+    result.point = sf::Vector2f(endX, endY);
+
+    return result;
+}
+
+}
+
+bool GD_API RaycastObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double angle, double maxDistance, bool inverted, RuntimeScene & scene)
+{
+    float endX = x + cos(angle*3.14159/180.0)*maxDistance;
+    float endY = y + sin(angle*3.14159/180.0)*maxDistance;
+
+    std::vector< std::pair<RuntimeObject*, RaycastResult> > hits;
+    RaycastObjectsLists(pickedObjectLists, x, y, endX, endY, !inverted, scene, hits);
+
+    //Keep the nearest object hit, or the furthest one if inverted.
+    const std::pair<RuntimeObject*, RaycastResult> * chosen = NULL;
+    for (std::size_t i = 0;i<hits.size();++i)
+    {
+        if (!chosen || ((hits[i].second.distance < chosen->second.distance) ^ inverted))
+            chosen = &hits[i];
+    }
+
+    if (!chosen)
+    {
+        scene.SetLastRaycast(MissedRaycast(endX, endY, maxDistance));
+        return false;
+    }
+
+    scene.SetLastRaycast(chosen->second);
+    PickOnly(pickedObjectLists, chosen->first);
+    return true;
+}
+
+bool GD_API RaycastAllObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double angle, double maxDistance, bool inverted, RuntimeScene & scene)
+{
+    float endX = x + cos(angle*3.14159/180.0)*maxDistance;
+    float endY = y + sin(angle*3.14159/180.0)*maxDistance;
+
+    std::vector< std::pair<RuntimeObject*, RaycastResult> > hits;
+    RaycastObjectsLists(pickedObjectLists, x, y, endX, endY, false, scene, hits);
+
+    RaycastResult nearest = MissedRaycast(endX, endY, maxDistance);
+    std::unordered_set<RuntimeObject*> hitObjects;
+    for (std::size_t i = 0;i<hits.size();++i)
+    {
+        hitObjects.insert(hits[i].first);
+        if (!nearest.collision || hits[i].second.distance < nearest.distance)
+            nearest = hits[i].second;
+    }
+    scene.SetLastRaycast(nearest);
+
+    bool isTrue = false;
+    for (auto it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
+    {
+        if ( it->second == NULL ) continue;
+        std::vector<RuntimeObject*> & list = *it->second;
+
+        list.erase(std::remove_if(list.begin(), list.end(), [&hitObjects, inverted](RuntimeObject * object) {
+            return (hitObjects.find(object) == hitObjects.end()) ^ inverted;
+        }), list.end());
+        if (!list.empty()) isTrue = true;
+    }
+
+    return isTrue;
+}
+
+double GD_API GetRaycastDistance(RuntimeScene & scene)
+{
+    return scene.GetLastRaycast().distance;
+}
+
+double GD_API GetRaycastX(RuntimeScene & scene)
+{
+    return scene.GetLastRaycast().point.x;
+}
+
+double GD_API GetRaycastY(RuntimeScene & scene)
+{
+    return scene.GetLastRaycast().point.y;
+}
+
+double GD_API GetRaycastNormalX(RuntimeScene & scene)
+{
+    return scene.GetLastRaycast().normal.x;
+}
+
+double GD_API GetRaycastNormalY(RuntimeScene & scene)
+{
+    return scene.GetLastRaycast().normal.y;
+}
+
 bool GD_API SceneVariableExists(RuntimeScene & scene, const gd::String & variable)
 {
     return scene.GetVariables().Has(variable);
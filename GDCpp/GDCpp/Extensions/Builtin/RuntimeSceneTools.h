@@ -48,6 +48,16 @@ void GD_API PushScene(RuntimeScene & scene, gd::String newSceneName);
  */
 void GD_API PopScene(RuntimeScene & scene);
 
+/**
+ * Only used internally by GD events generated code.
+ */
+void GD_API PreloadScene(RuntimeScene & scene, const gd::String & sceneName);
+
+/**
+ * Only used internally by GD events generated code.
+ */
+bool GD_API ScenePreloaded(RuntimeScene & scene, const gd::String & sceneName);
+
 /**
  * Only used internally by GD events generated code.
  */
@@ -94,6 +104,72 @@ bool GD_API PickRandomObject(RuntimeScene & scene, std::map <gd::String, std::ve
  */
 bool GD_API PickNearestObject(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, bool inverted);
 
+/**
+ * Only used internally by GD events generated code.
+ * Same as PickNearestObject, but uses the spatial index of the scene when possible.
+ *
+ * \return true if an object was picked, false otherwise
+ */
+bool GD_API PickNearestObject(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, bool inverted, RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ *
+ * \return true if at least one object was picked, false otherwise
+ */
+bool GD_API PickObjectsWithinRadius(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double radius, bool inverted, RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ *
+ * \return true if at least one object was picked, false otherwise
+ */
+bool GD_API PickNearestObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double count, bool inverted, RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ * Pick the nearest object (or the furthest if inverted) hit by the ray, and store the
+ * intersection so that it can be read with the GetRaycast* functions.
+ *
+ * \return true if an object was picked, false otherwise
+ */
+bool GD_API RaycastObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double angle, double maxDistance, bool inverted, RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ * Pick all the objects hit by the ray (or not hit if inverted), and store the nearest
+ * intersection so that it can be read with the GetRaycast* functions.
+ *
+ * \return true if at least one object was picked, false otherwise
+ */
+bool GD_API RaycastAllObjects(std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists, double x, double y, double angle, double maxDistance, bool inverted, RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ * \return The distance of the intersection found by the last raycast, or its maximum distance if no object was hit.
+ */
+double GD_API GetRaycastDistance(RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ */
+double GD_API GetRaycastX(RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ */
+double GD_API GetRaycastY(RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ */
+double GD_API GetRaycastNormalX(RuntimeScene & scene);
+
+/**
+ * Only used internally by GD events generated code.
+ */
+double GD_API GetRaycastNormalY(RuntimeScene & scene);
+
 /**
  * Only used internally by GD events generated code.
  */
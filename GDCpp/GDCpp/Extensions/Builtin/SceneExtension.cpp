@@ -32,6 +32,30 @@ SceneExtension::SceneExtension()
     GetAllActions()["SceneBackground"].SetFunctionName("ChangeSceneBackground").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
     GetAllActions()["DisableInputWhenFocusIsLost"].SetFunctionName("DisableInputWhenFocusIsLost").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
 
+    AddAction("PreloadScene",
+                   _("Preload a scene"),
+                   _("Start to load the specified scene in the background, so that it can be started later without freezing the game.\nOnly one scene can be preloaded at a time."),
+                   _("Preload scene _PARAM1_"),
+                   _("Scene"),
+                   "res/actions/replaceScene24.png",
+                   "res/actions/replaceScene.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .AddParameter("string", _("Name of the scene"))
+        .MarkAsAdvanced()
+        .SetFunctionName("PreloadScene").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
+    AddCondition("ScenePreloaded",
+                   _("Scene preloaded"),
+                   _("Test if the specified scene is preloaded and can be started without delay."),
+                   _("Scene _PARAM1_ is preloaded"),
+                   _("Scene"),
+                   "res/actions/replaceScene24.png",
+                   "res/actions/replaceScene.png")
+        .AddCodeOnlyParameter("currentScene", "")
+        .AddParameter("string", _("Name of the scene"))
+        .MarkAsAdvanced()
+        .SetFunctionName("ScenePreloaded").SetIncludeFile("GDCpp/Extensions/Builtin/RuntimeSceneTools.h");
+
     GetAllConditions()["Egal"].codeExtraInformation
         .SetCustomCodeGenerator([](gd::Instruction & instruction, gd::EventsCodeGenerator & codeGenerator, gd::EventsCodeGenerationContext & context) {
             gd::String value1Code;
@@ -37,40 +37,42 @@ TimeExtension::TimeExtension()
     GetAllExpressions()["TimeScale"].SetFunctionName("GetTimeScale").SetIncludeFile("GDCpp/Extensions/Builtin/TimeTools.h");
     GetAllExpressions()["TimeScale"].SetFunctionName("GetTimeScale").SetIncludeFile("GDCpp/Extensions/Builtin/TimeTools.h");
     GetAllExpressions()["Time"].SetFunctionName("GetTime").SetIncludeFile("GDCpp/Extensions/Builtin/TimeTools.h");
+
+    //Mark the timers names, so that the code generator can resolve the timers indices.
+    GetAllConditions()["Timer"].parameters[2].supplementaryInformation = "timerName";
+    GetAllConditions()["TimerPaused"].parameters[1].supplementaryInformation = "timerName";
+    GetAllActions()["ResetTimer"].parameters[1].supplementaryInformation = "timerName";
+    GetAllActions()["PauseTimer"].parameters[1].supplementaryInformation = "timerName";
+    GetAllActions()["UnPauseTimer"].parameters[1].supplementaryInformation = "timerName";
+    GetAllActions()["RemoveTimer"].parameters[1].supplementaryInformation = "timerName";
+    GetAllExpressions()["TimerElapsedTime"].parameters[1].supplementaryInformation = "timerName";
     #endif
 }
 
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
 void TimeExtension::GetPropertyForDebugger(RuntimeScene & scene, std::size_t propertyNb, gd::String & name, gd::String & value) const
 {
-    auto timers = scene.GetTimeManager().GetTimers();
-    size_t i = 0;
-    for(auto it = timers.begin();it != timers.end();++i, ++it) {
-        if (i != propertyNb) continue;
+    TimersContainer & timers = scene.GetTimeManager().GetTimers();
+    std::vector<std::size_t> indices = timers.GetTimersIndices();
+    if (propertyNb >= indices.size()) return;
 
-        name = it->first;
-        value = gd::String::From(static_cast<double>(it->second.GetTime())/1000000.0)+"s";
-    }
+    name = TimersContainer::GetTimerName(indices[propertyNb]);
+    value = gd::String::From(static_cast<double>(timers.GetTimer(indices[propertyNb]).GetTime())/1000000.0)+"s";
 
 }
 
 bool TimeExtension::ChangeProperty(RuntimeScene & scene, std::size_t propertyNb, gd::String newValue)
 {
-    auto timers = scene.GetTimeManager().GetTimers();
-    size_t i = 0;
-    for(auto it = timers.begin();it != timers.end();++i, ++it) {
-        if (i != propertyNb) continue;
-
-        it->second.SetTime(newValue.To<double>()*1000000.0);
-        return true;
-    }
+    TimersContainer & timers = scene.GetTimeManager().GetTimers();
+    std::vector<std::size_t> indices = timers.GetTimersIndices();
+    if (propertyNb >= indices.size()) return false;
 
-    return false;
+    timers.GetTimer(indices[propertyNb]).SetTime(newValue.To<double>()*1000000.0);
+    return true;
 }
 
 std::size_t TimeExtension::GetNumberOfProperties(RuntimeScene & scene) const
 {
-    auto timers = scene.GetTimeManager().GetTimers();
-    return timers.size();
+    return scene.GetTimeManager().GetTimers().GetTimersCount();
 }
 #endif
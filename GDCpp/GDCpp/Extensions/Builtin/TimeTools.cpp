@@ -56,6 +56,55 @@ void GD_API RemoveTimer( RuntimeScene & scene, const gd::String & timerName )
     scene.GetTimeManager().RemoveTimer(timerName);
 }
 
+bool GD_API TimerElapsedTime( RuntimeScene & scene, double timeInSeconds, std::size_t timerIndex )
+{
+    if (!scene.GetTimeManager().HasTimer(timerIndex)) 
+        return true; //Inconsistency to keep compatibility with games relying on this behavior.
+
+    return scene.GetTimeManager().GetTimer(timerIndex).GetTime() >= timeInSeconds*1000000.0;
+}
+
+double GD_API GetTimerElapsedTimeInSeconds( RuntimeScene & scene, std::size_t timerIndex )
+{
+    return static_cast<double>(scene.GetTimeManager().GetTimer(timerIndex).GetTime())/1000000.0;
+}
+
+bool GD_API TimerPaused( RuntimeScene & scene, std::size_t timerIndex )
+{
+    if (!scene.GetTimeManager().HasTimer(timerIndex)) return false;
+
+    return scene.GetTimeManager().GetTimer(timerIndex).IsPaused();
+}
+
+void GD_API ResetTimer( RuntimeScene & scene, std::size_t timerIndex )
+{
+    if (!scene.GetTimeManager().HasTimer(timerIndex))
+        scene.GetTimeManager().AddTimer(timerIndex);
+
+    scene.GetTimeManager().GetTimer(timerIndex).Reset();
+}
+
+void GD_API PauseTimer( RuntimeScene & scene, std::size_t timerIndex )
+{
+    if (!scene.GetTimeManager().HasTimer(timerIndex))
+        scene.GetTimeManager().AddTimer(timerIndex);
+
+    scene.GetTimeManager().GetTimer(timerIndex).SetPaused(true);
+}
+
+void GD_API UnPauseTimer( RuntimeScene & scene, std::size_t timerIndex )
+{
+    if (!scene.GetTimeManager().HasTimer(timerIndex))
+        scene.GetTimeManager().AddTimer(timerIndex);
+
+    scene.GetTimeManager().GetTimer(timerIndex).SetPaused(false);
+}
+
+void GD_API RemoveTimer( RuntimeScene & scene, std::size_t timerIndex )
+{
+    scene.GetTimeManager().RemoveTimer(timerIndex);
+}
+
 void GD_API SetTimeScale( RuntimeScene & scene, double value )
 {
     scene.GetTimeManager().SetTimeScale(value);
@@ -14,6 +14,16 @@ void GD_API ResetTimer( RuntimeScene & scene, const gd::String & timerName );
 void GD_API PauseTimer( RuntimeScene & scene, const gd::String & timerName );
 void GD_API UnPauseTimer( RuntimeScene & scene, const gd::String & timerName );
 void GD_API RemoveTimer( RuntimeScene & scene, const gd::String & timerName );
+
+//Overloads used by the generated code when the timer name is known: the timer index is resolved once.
+bool GD_API TimerElapsedTime( RuntimeScene & scene, double time, std::size_t timerIndex );
+bool GD_API TimerPaused( RuntimeScene & scene, std::size_t timerIndex );
+double GD_API GetTimerElapsedTimeInSeconds( RuntimeScene & scene, std::size_t timerIndex );
+void GD_API ResetTimer( RuntimeScene & scene, std::size_t timerIndex );
+void GD_API PauseTimer( RuntimeScene & scene, std::size_t timerIndex );
+void GD_API UnPauseTimer( RuntimeScene & scene, std::size_t timerIndex );
+void GD_API RemoveTimer( RuntimeScene & scene, std::size_t timerIndex );
+
 void GD_API SetTimeScale( RuntimeScene & scene, double value );
 double GD_API GetElapsedTimeInSeconds(RuntimeScene & scene);
 double GD_API GetTimeFromStartInSeconds(RuntimeScene & scene);
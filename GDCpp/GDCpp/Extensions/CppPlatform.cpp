@@ -69,11 +69,11 @@ CppPlatform::CppPlatform() :
         CodeCompiler::Get()->SetOutputDirectory(eventsCompilerTempDir);
     else
         CodeCompiler::Get()->SetOutputDirectory(wxFileName::GetTempDir()+"/GDTemporaries");
-    int eventsCompilerMaxThread = 0;
+    int eventsCompilerMaxThread = 0; //By default, launch one compiler process for each processor.
     if ( wxConfigBase::Get()->Read("/CodeCompiler/MaxThread", &eventsCompilerMaxThread, 0) && eventsCompilerMaxThread >= 0 )
-        CodeCompiler::Get()->AllowMultithread(eventsCompilerMaxThread > 1, eventsCompilerMaxThread);
+        CodeCompiler::Get()->AllowMultithread(eventsCompilerMaxThread != 1, eventsCompilerMaxThread);
     else
-        CodeCompiler::Get()->AllowMultithread(false);
+        CodeCompiler::Get()->AllowMultithread(true, 0);
 
     cout << "* Loading events code compiler configuration" << endl;
     bool deleteTemporaries;
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <algorithm>
 #include <wx/filefn.h>
 #include <wx/filename.h>
 #include <wx/datetime.h>
@@ -24,7 +25,9 @@
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCpp/Events/CodeGeneration/EventsFunctionsTableCodeGenerator.h"
 #include "GDCpp/Runtime/CodeExecutionEngine.h"
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
 #include "GDCpp/IDE/DependenciesAnalyzer.h"
 #include "GDCpp/IDE/BaseProfiler.h"
 #include "GDCpp/Extensions/ExtensionBase.h"
@@ -40,6 +43,84 @@ using namespace gd;
 //Tool functions
 namespace
 {
+    /**
+     * \brief The number of files generated for the events of each scene by EventsCodeCompilerPreWork,
+     * so that the object files of all of them are linked.
+     */
+    std::map<const gd::Layout*, std::size_t> & GetSceneEventsFilesCount()
+    {
+        static std::map<const gd::Layout*, std::size_t> filesCount;
+        return filesCount;
+    }
+
+    /**
+     * \brief The state of the compilation of the events functions table used by the previews.
+     */
+    struct EventsFunctionsTableState
+    {
+        EventsFunctionsTableState() : compilationsCount(0) {};
+
+        std::vector<gd::String> loadedExtensions; ///< The extensions of the functions loaded in EventsFunctionsTable::Get().
+        std::vector<gd::String> requestedExtensions; ///< The extensions of the last compilation requested.
+        std::vector<gd::String> compiledExtensions; ///< The extensions of compiledLibrary.
+        gd::String compiledLibrary; ///< The library compiled and not loaded yet, if any.
+        std::size_t compilationsCount; ///< Used to name the libraries, so that a loaded library is never overwritten.
+    };
+
+    EventsFunctionsTableState & GetEventsFunctionsTableState()
+    {
+        static EventsFunctionsTableState state;
+        return state;
+    }
+
+    /**
+     * \brief Return the names of the libraries of the extensions, to be linked with code calling them.
+     */
+    std::vector<gd::String> GetExtensionsLibFiles(const std::vector<gd::String> & extensionsNames)
+    {
+        std::vector<gd::String> libFiles;
+        for (std::size_t i = 0;i<extensionsNames.size();++i)
+        {
+            std::shared_ptr<gd::PlatformExtension> gdExtension = CppPlatform::Get().GetExtension(extensionsNames[i]);
+            std::shared_ptr<ExtensionBase> extension = std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
+            if ( extension == std::shared_ptr<ExtensionBase>() ) continue;
+
+            if ( wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".a") ||
+                 wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".dll.a") ||
+                 wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".dylib") )
+                libFiles.push_back(extension->GetName());
+
+            for (std::size_t j =0;j<extension->GetSupplementaryLibFiles().size();++j)
+            {
+                if ( wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".a") ||
+                     wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".dll.a") ||
+                     wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".dylib"))
+                    libFiles.push_back(extension->GetSupplementaryLibFiles()[j]);
+            }
+        }
+
+        return libFiles;
+    }
+
+    /**
+     * \brief Return the full path of the C++ source files of the game: events can include them,
+     * so their modification invalidates the compilation cache.
+     */
+    std::vector<gd::String> GetSourceFilesPaths(gd::Project & game)
+    {
+        std::vector<gd::String> paths;
+        for (std::size_t i = 0;i<game.GetAllSourceFiles().size();++i)
+        {
+            if ( game.GetAllSourceFiles()[i]->GetLanguage() != "C++" ) continue;
+
+            wxFileName file(game.GetAllSourceFiles()[i]->GetFileName());
+            file.MakeAbsolute(wxFileName::FileName(game.GetProjectFile()).GetPath());
+            paths.push_back(file.GetFullPath());
+        }
+
+        return paths;
+    }
+
     bool SourceFileNeedRecompilation(gd::Project & game, SourceFile & sourceFile)
     {
         if ( !wxFileExists(gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&sourceFile)+"ObjectFile.o") ))
@@ -84,9 +165,10 @@ namespace
      * Check each dependencies listed in a DependencyAnalyzer and make sure that they are compiled into bitcode.
      * If it is not the case, a compilation is requested and the function return false.
      *
+     * \param dependencies Filled with the object files of the compilations requested.
      * \return true if each dependency is already compiled.
      */
-    bool EnsureDependenciesAreOrWillBeCompiled(gd::Project & game, const DependenciesAnalyzer & analyzer, gd::Layout * optionalScene = NULL)
+    bool EnsureDependenciesAreOrWillBeCompiled(gd::Project & game, const DependenciesAnalyzer & analyzer, std::vector<gd::String> & dependencies, gd::Layout * optionalScene = NULL)
     {
         bool aDependencyIsNotCompiled = false;
         for (std::set<gd::String>::const_iterator i = analyzer.GetSourceFilesDependencies().begin();i!=analyzer.GetSourceFilesDependencies().end();++i)
@@ -97,6 +179,7 @@ namespace
             if (SourceFileNeedRecompilation(game, sourceFile))
             {
                 CodeCompilationHelpers::CreateExternalSourceFileCompilationTask(game, sourceFile, optionalScene);
+                dependencies.push_back(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&sourceFile)+"ObjectFile.o");
                 aDependencyIsNotCompiled = true;
             }
         }
@@ -107,6 +190,7 @@ namespace
                 if (ExternalEventsNeedRecompilation(game, game.GetExternalEvents(*i)))
                 {
                     CodeCompilationHelpers::CreateExternalEventsCompilationTask(game, game.GetExternalEvents(*i));
+                    dependencies.push_back(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game.GetExternalEvents(*i))+"ObjectFile.o");
                     aDependencyIsNotCompiled = true;
                 }
             }
@@ -115,9 +199,8 @@ namespace
         return !aDependencyIsNotCompiled;
     }
 
-    bool EnsureDependenciesAreOrWillBeCompiledForRuntime(gd::Project & game, const DependenciesAnalyzer & analyzer, gd::Layout * optionalScene, gd::ArbitraryResourceWorker & resourceWorker)
+    void CreateSourceFilesRuntimeCompilationTasks(gd::Project & game, const DependenciesAnalyzer & analyzer, gd::Layout * optionalScene)
     {
-        bool aDependencyIsNotCompiled = false;
         for (std::set<gd::String>::const_iterator i = analyzer.GetSourceFilesDependencies().begin();i!=analyzer.GetSourceFilesDependencies().end();++i)
         {
             if (!game.HasSourceFile(*i, "C++")) continue;
@@ -139,6 +222,12 @@ namespace
 
             CodeCompiler::Get()->AddTask(task);
         }
+    }
+
+    bool EnsureDependenciesAreOrWillBeCompiledForRuntime(gd::Project & game, const DependenciesAnalyzer & analyzer, gd::Layout * optionalScene, gd::ArbitraryResourceWorker & resourceWorker)
+    {
+        bool aDependencyIsNotCompiled = false;
+        CreateSourceFilesRuntimeCompilationTasks(game, analyzer, optionalScene);
         for (std::set<gd::String>::const_iterator i = analyzer.GetExternalEventsDependencies().begin();i!=analyzer.GetExternalEventsDependencies().end();++i)
         {
             if (game.HasExternalEventsNamed(*i))
@@ -187,6 +276,11 @@ namespace
         task.scene = &scene;
         task.userFriendlyName = "Linking code for scene "+scene.GetName();
 
+        //Add the object files of the groups of events compiled separately
+        auto filesCount = GetSceneEventsFilesCount().find(&scene);
+        for (std::size_t i = 1;filesCount != GetSceneEventsFilesCount().end() && i<filesCount->second;++i)
+            task.compilerCall.extraObjectFiles.push_back(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&scene)+"ObjectFile"+gd::String::From(i)+".o");
+
         //Also add scene dependencies to the files to be linked.
         DependenciesAnalyzer analyzer(game, scene);
         if ( !analyzer.Analyze() )
@@ -216,25 +310,7 @@ namespace
         }
 
         //Construct the list of the external shared libraries files to be used
-        for (std::size_t i = 0;i<game.GetUsedExtensions().size();++i)
-        {
-            std::shared_ptr<gd::PlatformExtension> gdExtension = CppPlatform::Get().GetExtension(game.GetUsedExtensions()[i]);
-            std::shared_ptr<ExtensionBase> extension = std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
-            if ( extension == std::shared_ptr<ExtensionBase>() ) continue;
-
-            if ( wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".a") ||
-                 wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".dll.a") ||
-                 wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetName()+".dylib") )
-                task.compilerCall.extraLibFiles.push_back(extension->GetName());
-
-            for (std::size_t j =0;j<extension->GetSupplementaryLibFiles().size();++j)
-            {
-                if ( wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".a") ||
-                     wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".dll.a") ||
-                     wxFileExists(CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Extensions/"+"lib"+extension->GetSupplementaryLibFiles()[j]+".dylib"))
-                    task.compilerCall.extraLibFiles.push_back(extension->GetSupplementaryLibFiles()[j]);
-            }
-        }
+        task.compilerCall.extraLibFiles = GetExtensionsLibFiles(game.GetUsedExtensions());
 
         CodeCompiler::Get()->AddTask(task);
     }
@@ -259,7 +335,7 @@ bool EventsCodeCompilerPreWork::Execute()
 
     //Bail out now if others task must be completed before:
     //The scene compilation has to be made when all its dependencies are compiled ( When the dependencies bitcode are available precisely ).
-    if ( !EnsureDependenciesAreOrWillBeCompiled(*game, analyzer, scene) )
+    if ( !EnsureDependenciesAreOrWillBeCompiled(*game, analyzer, dependencies, scene) )
     {
         requestRelaunchCompilationLater = true;
         return true;
@@ -273,11 +349,36 @@ bool EventsCodeCompilerPreWork::Execute()
     if ( sceneCopy.GetProfiler() != NULL ) sceneCopy.GetProfiler()->profileEventsInformation.clear();
     gd::EventsCodeGenerator::DeleteUselessEvents(sceneCopy.GetEvents());
 
-    gd::String eventsOutput = ::EventsCodeGenerator::GenerateSceneEventsCompleteCode(gameCopy, sceneCopy, sceneCopy.GetEvents(), false /*Compilation for edittime*/);
-    gd::FileStream myfile;
-    myfile.open ( CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(scene)+"EventsSource.cpp", std::ios_base::out );
-    myfile << eventsOutput.c_str();
-    myfile.close();
+    std::vector<gd::String> eventsOutput = ::EventsCodeGenerator::GenerateSceneEventsSplitCode(gameCopy, sceneCopy, sceneCopy.GetEvents(), false /*Compilation for edittime*/);
+    for (std::size_t i = 0;i<eventsOutput.size();++i)
+    {
+        gd::String fileNumber = i == 0 ? "" : gd::String::From(i);
+
+        gd::FileStream myfile;
+        myfile.open ( CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(scene)+"EventsSource"+fileNumber+".cpp", std::ios_base::out );
+        myfile << eventsOutput[i].c_str();
+        myfile.close();
+
+        //Groups of events are compiled by their own task, so that a group which did not change
+        //is reused from the compilation cache. They are compiled before the linking task, added
+        //when the compilation of the first file is over.
+        if ( i == 0 ) continue;
+
+        CodeCompilerTask task;
+        task.compilerCall.compilationForRuntime = false;
+        task.compilerCall.optimize = false;
+        task.compilerCall.eventsGeneratedCode = true;
+        task.compilerCall.useCache = true;
+        task.compilerCall.extraDependencies = GetSourceFilesPaths(*game);
+        task.compilerCall.inputFile = CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(scene)+"EventsSource"+fileNumber+".cpp";
+        task.compilerCall.outputFile = CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(scene)+"ObjectFile"+fileNumber+".o";
+        task.scene = scene;
+        task.postWork = std::make_shared<SourceFileCodeCompilerPostWork>(scene);
+        task.userFriendlyName = "Compilation of events of scene "+scene->GetName()+" (group "+fileNumber+")";
+
+        CodeCompiler::Get()->AddTask(task);
+    }
+    GetSceneEventsFilesCount()[scene] = eventsOutput.size();
 
     return true;
 }
@@ -322,6 +423,46 @@ bool EventsCodeCompilerRuntimePreWork::Execute()
     return true;
 }
 
+bool ProjectEventsCodeCompilerRuntimeUnityPreWork::Execute()
+{
+    if ( game == NULL )
+    {
+        std::cout << "WARNING: Cannot execute pre work: No valid associated game." << std::endl;
+        return false;
+    }
+
+    //External events are compiled in the same file as the scenes: only source files are compiled separately.
+    for (std::size_t i = 0;i<game->GetLayoutsCount();++i)
+    {
+        DependenciesAnalyzer analyzer(*game, game->GetLayout(i));
+        if ( !analyzer.Analyze() )
+        {
+            //Circular dependency exists
+            std::cout << "WARNING: Circular dependency for scene " << game->GetLayout(i).GetName() << std::endl;
+            return false;
+        }
+
+        CreateSourceFilesRuntimeCompilationTasks(*game, analyzer, NULL);
+    }
+
+    gd::Project gameCopy = *game;
+
+    //Generate the code
+    cout << "Generating C++ code...\n";
+    for (std::size_t i = 0;i<gameCopy.GetLayoutsCount();++i)
+        gd::EventsCodeGenerator::DeleteUselessEvents(gameCopy.GetLayout(i).GetEvents());
+    for (std::size_t i = 0;i<gameCopy.GetExternalEventsCount();++i)
+        gd::EventsCodeGenerator::DeleteUselessEvents(gameCopy.GetExternalEvents(i).GetEvents());
+
+    gd::String eventsOutput = ::EventsCodeGenerator::GenerateProjectEventsUnityCode(gameCopy);
+    gd::FileStream myfile;
+    myfile.open ( CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(game)+"RuntimeUnityEventsSource.cpp", std::ios_base::out );
+    myfile << eventsOutput.c_str();
+    myfile.close();
+
+    return true;
+}
+
 bool EventsCodeCompilerPostWork::Execute()
 {
     if ( scene == NULL || game == NULL )
@@ -400,7 +541,7 @@ bool ExternalEventsCodeCompilerPreWork::Execute()
     }
 
     //Bail out now if others task must be completed before:
-    if ( !EnsureDependenciesAreOrWillBeCompiled(*game, analyzer) )
+    if ( !EnsureDependenciesAreOrWillBeCompiled(*game, analyzer, dependencies) )
     {
         requestRelaunchCompilationLater = true;
         return true;
@@ -497,12 +638,43 @@ bool ExternalEventsCodeCompilerRuntimePreWork::Execute()
     return true;
 }
 
+//Events functions table workers
+bool EventsFunctionsTableCompilerPreWork::Execute()
+{
+    cout << "Generating C++ code of the events functions table...\n";
+    EventsFunctionsTableCodeGenerator generator(CppPlatform::Get(), extensions);
+
+    gd::FileStream myfile;
+    myfile.open ( sourceFile, std::ios_base::out );
+    myfile << generator.GenerateCode().c_str();
+    myfile.close();
+
+    return true;
+}
+
+bool EventsFunctionsTableLinkingPostWork::Execute()
+{
+    if ( !compilationSucceeded || !wxFileExists(libraryFile) )
+    {
+        std::cout << "Events functions table linking failed." << std::endl;
+        return false;
+    }
+
+    //The library is loaded by CodeCompilationHelpers::GetEventsFunctionsTable. The interpreters
+    //running bytecode keep the previous library loaded until they are destroyed.
+    GetEventsFunctionsTableState().compiledExtensions = extensions;
+    GetEventsFunctionsTableState().compiledLibrary = libraryFile;
+    return true;
+}
+
 void GD_API CodeCompilationHelpers::CreateSceneEventsCompilationTask(gd::Project & game, gd::Layout & scene)
 {
     CodeCompilerTask task;
     task.compilerCall.compilationForRuntime = false;
     task.compilerCall.optimize = false;
     task.compilerCall.eventsGeneratedCode = true;
+    task.compilerCall.useCache = true;
+    task.compilerCall.extraDependencies = GetSourceFilesPaths(game);
     task.compilerCall.inputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&scene)+"EventsSource.cpp");
     task.compilerCall.outputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&scene)+"ObjectFile.o");
     task.scene = &scene;
@@ -540,6 +712,8 @@ void  GD_API CodeCompilationHelpers::CreateExternalEventsCompilationTask(gd::Pro
     task.compilerCall.compilationForRuntime = false;
     task.compilerCall.optimize = false;
     task.compilerCall.eventsGeneratedCode = true;
+    task.compilerCall.useCache = true;
+    task.compilerCall.extraDependencies = GetSourceFilesPaths(game);
     task.compilerCall.inputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&events)+"EventsSource.cpp");
     task.compilerCall.outputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&events)+"ObjectFile.o");
 
@@ -550,4 +724,59 @@ void  GD_API CodeCompilationHelpers::CreateExternalEventsCompilationTask(gd::Pro
     CodeCompiler::Get()->AddTask(task);
 }
 
+const EventsFunctionsTable * GD_API CodeCompilationHelpers::GetEventsFunctionsTable(gd::Project & game)
+{
+    std::vector<gd::String> extensions = game.GetUsedExtensions();
+    std::sort(extensions.begin(), extensions.end());
+
+    EventsFunctionsTableState & state = GetEventsFunctionsTableState();
+    EventsFunctionsTable & table = EventsFunctionsTable::Get();
+    if ( !table.IsEmpty() && state.loadedExtensions == extensions )
+        return &table;
+
+    if ( !state.compiledLibrary.empty() && state.compiledExtensions == extensions )
+    {
+        gd::String library = state.compiledLibrary;
+        state.compiledLibrary.clear();
+        if ( table.LoadFromDynamicLibrary(library) )
+        {
+            state.loadedExtensions = extensions;
+            return &table;
+        }
+    }
+
+    //The table only depends on the extensions: it is compiled once for each set of extensions.
+    if ( state.requestedExtensions != extensions )
+    {
+        state.requestedExtensions = extensions;
+        gd::String baseName = CodeCompiler::Get()->GetOutputDirectory()+"GDEventsFunctionsTable"+gd::String::From(state.compilationsCount++);
+
+        CodeCompilerTask task;
+        task.compilerCall.compilationForRuntime = false;
+        task.compilerCall.optimize = false;
+        task.compilerCall.eventsGeneratedCode = true;
+        task.compilerCall.useCache = true;
+        task.compilerCall.inputFile = baseName+"Source.cpp";
+        task.compilerCall.outputFile = baseName+"ObjectFile.o";
+        task.preWork = std::make_shared<EventsFunctionsTableCompilerPreWork>(extensions, task.compilerCall.inputFile);
+        task.userFriendlyName = "Compilation of the events functions table";
+        CodeCompiler::Get()->AddTask(task);
+
+        //The linking task waits for the object file, being the output of the previous task.
+        CodeCompilerTask linkingTask;
+        linkingTask.compilerCall.link = true;
+        linkingTask.compilerCall.compilationForRuntime = false;
+        linkingTask.compilerCall.optimize = false;
+        linkingTask.compilerCall.eventsGeneratedCode = true;
+        linkingTask.compilerCall.inputFile = baseName+"ObjectFile.o";
+        linkingTask.compilerCall.outputFile = baseName+".dll";
+        linkingTask.compilerCall.extraLibFiles = GetExtensionsLibFiles(extensions);
+        linkingTask.postWork = std::make_shared<EventsFunctionsTableLinkingPostWork>(extensions, linkingTask.compilerCall.outputFile);
+        linkingTask.userFriendlyName = "Linking the events functions table";
+        CodeCompiler::Get()->AddTask(linkingTask);
+    }
+
+    return NULL;
+}
+
 #endif
@@ -19,6 +19,7 @@
 #include "GDCpp/IDE/CodeCompiler.h"
 namespace gd {class ArbitraryResourceWorker;}
 class CodeExecutionEngine;
+class EventsFunctionsTable;
 namespace gd { class Layout; }
 namespace gd { class SourceFile; }
 namespace gd { class ExternalEvents; }
@@ -61,6 +62,17 @@ public:
      * \param events External events to compile.
      */
     static void CreateExternalEventsCompilationTask(gd::Project & game, gd::ExternalEvents & events);
+
+    /**
+     * Return the table of the functions of the extensions used by the game, called by events
+     * lowered to bytecode ( see EventsBytecodeGenerator ), loading it if it was just compiled.
+     *
+     * If the table is not compiled for the extensions used by the game, a task compiling it is
+     * created ( only once for a set of extensions ) and NULL is returned.
+     *
+     * \warning Must be called from the main thread, when no bytecode is run.
+     */
+    static const EventsFunctionsTable * GetEventsFunctionsTable(gd::Project & game);
 };
 
 /**
@@ -145,6 +157,30 @@ public:
     virtual ~EventsCodeCompilerRuntimePreWork() {};
 };
 
+/**
+ * \brief Define the work to be done before the compilation of all the events of a project
+ * in a single file.
+ *
+ * This code compiler extra worker generates, for runtime, a single file with the code of the events
+ * of all the scenes and external events of the project, and creates the tasks compiling the source
+ * files they depend on.
+ *
+ * \see CodeCompiler
+ * \see CodeCompilerExtraWork
+ * \see EventsCodeGenerator::GenerateProjectEventsUnityCode
+ */
+class GD_API ProjectEventsCodeCompilerRuntimeUnityPreWork : public CodeCompilerExtraWork
+{
+public:
+    virtual bool Execute();
+
+    gd::Project * game;
+    gd::ArbitraryResourceWorker & resourceWorker;
+
+    ProjectEventsCodeCompilerRuntimeUnityPreWork(gd::Project * game_, gd::ArbitraryResourceWorker & resourceWorker_) : game(game_), resourceWorker(resourceWorker_) {};
+    virtual ~ProjectEventsCodeCompilerRuntimeUnityPreWork() {};
+};
+
 /**
  * \brief Define the work to be done before external events compilation
  *
@@ -207,6 +243,49 @@ public:
     virtual ~ExternalEventsCodeCompilerRuntimePreWork() {};
 };
 
+/**
+ * \brief Define the work to be done before the compilation of the events functions table.
+ *
+ * This code compiler extra worker generates the code of the functions of the extensions
+ * called by events lowered to bytecode.
+ *
+ * \see CodeCompiler
+ * \see CodeCompilerExtraWork
+ * \see EventsFunctionsTableCodeGenerator
+ */
+class GD_API EventsFunctionsTableCompilerPreWork : public CodeCompilerExtraWork
+{
+public:
+    virtual bool Execute();
+
+    std::vector<gd::String> extensions; ///< The extensions having their functions in the table.
+    gd::String sourceFile;
+
+    EventsFunctionsTableCompilerPreWork(const std::vector<gd::String> & extensions_, const gd::String & sourceFile_) : extensions(extensions_), sourceFile(sourceFile_) {};
+    virtual ~EventsFunctionsTableCompilerPreWork() {};
+};
+
+/**
+ * \brief Define the work to be done after the linking of the events functions table.
+ *
+ * This code compiler extra worker marks the library as ready to be loaded by
+ * CodeCompilationHelpers::GetEventsFunctionsTable.
+ *
+ * \see CodeCompiler
+ * \see CodeCompilerExtraWork
+ */
+class GD_API EventsFunctionsTableLinkingPostWork : public CodeCompilerExtraWork
+{
+public:
+    virtual bool Execute();
+
+    std::vector<gd::String> extensions; ///< The extensions having their functions in the table.
+    gd::String libraryFile;
+
+    EventsFunctionsTableLinkingPostWork(const std::vector<gd::String> & extensions_, const gd::String & libraryFile_) : extensions(extensions_), libraryFile(libraryFile_) {};
+    virtual ~EventsFunctionsTableLinkingPostWork() {};
+};
+
 /**
  * \brief Define the work to be done after source file compilation
  *
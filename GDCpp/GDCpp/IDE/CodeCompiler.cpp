@@ -10,6 +10,8 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <sstream>
+#include <algorithm>
 #include <wx/filename.h>
 #include <wx/filefn.h>
 #include <wx/txtstrm.h>
@@ -17,6 +19,8 @@
 #include "GDCpp/Runtime/Project/Layout.h"
 #include "GDCore/Tools/Log.h"
 #include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/VersionWrapper.h"
+#include "GDCore/Tools/ParallelTasks.h"
 
 using namespace std;
 
@@ -28,15 +32,65 @@ const wxEventType CodeCompiler::processEndedEventType = wxNewEventType();
 namespace {
 
 /**
- * \brief Tool function to create a task which is empty.
+ * \brief Tool function updating a 64 bits FNV-1a hash with the specified data.
  */
-CodeCompilerTask ConstructEmptyTask()
+void UpdateHash(unsigned long long & hash, const char * data, std::size_t size)
 {
-    CodeCompilerTask task;
-    task.emptyTask = true;
-    return task;
+    for (std::size_t i = 0;i<size;++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+}
+
+/**
+ * \brief Tool function updating a hash with the modification time of a file, if it exists.
+ */
+void UpdateHashWithModificationTime(unsigned long long & hash, const gd::String & file)
+{
+    gd::String time = wxFileExists(file) ? gd::String::From(wxFileModificationTime(file)) : "-";
+    UpdateHash(hash, time.c_str(), time.size());
+}
+
+/**
+ * \brief Tool function returning the events precompiled header of GDCpp.
+ */
+gd::String GetEventsPrecompiledHeaderSource()
+{
+    return CodeCompiler::Get()->GetBaseDirectory()+"CppPlatform/Sources/GDCpp/GDCpp/Runtime/EventsPrecompiledHeader.h";
+}
+
+/**
+ * \brief The maximum number of reports of tasks kept by the CodeCompiler.
+ */
+const std::size_t maxTasksReports = 100;
+
 }
 
+gd::String CodeCompilerCall::GetCacheKey() const
+{
+    ifstream input(inputFile.ToLocale().c_str(), ios_base::in | ios_base::binary);
+    if ( !input.is_open() ) return "";
+
+    unsigned long long hash = 14695981039346656037ULL;
+    char buffer[4096];
+    while ( input.read(buffer, sizeof(buffer)) || input.gcount() > 0 )
+        UpdateHash(hash, buffer, input.gcount());
+
+    //Input and output paths are excluded from the key, as they change each time GDevelop is launched.
+    CodeCompilerCall call = *this;
+    call.inputFile.clear();
+    call.outputFile.clear();
+    gd::String fullCall = call.GetFullCall()+gd::VersionWrapper::FullString();
+    UpdateHash(hash, fullCall.c_str(), fullCall.size());
+
+    UpdateHashWithModificationTime(hash, GetEventsPrecompiledHeaderSource());
+    for (std::size_t i = 0;i<extraDependencies.size();++i)
+        UpdateHashWithModificationTime(hash, extraDependencies[i]);
+
+    std::ostringstream key;
+    key << std::hex << hash;
+    return gd::String::FromUTF8(key.str());
 }
 
 gd::String CodeCompilerCall::GetFullCall() const
@@ -64,11 +118,18 @@ gd::String CodeCompilerCall::GetFullCall() const
         args.push_back(extraOptions[i]);
 
     args.push_back("-o \""+outputFile+"\"");
-    if ( optimize ) args.push_back("-O1");
+    if ( optimize ) args.push_back("-O"+gd::String::From(optimizationLevel));
 
     if ( !link ) //Generate argument for compiling a file
     {
-        if ( !compilationForRuntime ) args.push_back("-include \""+baseDir+"CppPlatform/Sources/GDCpp/GDCpp/Runtime/EventsPrecompiledHeader.h\"");
+        if ( precompiledHeader )
+            args.push_back("-x c++-header");
+        else if ( UsePrecompiledHeader() )
+        {
+            //Include the header using the precompiled header if it was built, or else the events header itself.
+            gd::String header = CodeCompiler::Get()->GetPrecompiledHeaderFile(optimize);
+            args.push_back("-include \""+(wxFileExists(header+".gch") ? header : GetEventsPrecompiledHeaderSource())+"\"");
+        }
         args.push_back("-c \""+inputFile+"\"");
 
         //Compiler default directories
@@ -228,99 +289,168 @@ gd::String CodeCompilerCall::GetFullCall() const
     return compilerExecutable+" "+argsStr;
 }
 
-void CodeCompiler::StartTheNextTask()
+std::vector<gd::String> CodeCompilerTask::GetRequiredFiles() const
 {
-    //Check if there is a task to be made
+    std::vector<gd::String> files = dependencies;
+    if ( compilerCall.link )
     {
-        sf::Lock lock(pendingTasksMutex); //Disallow modifying pending tasks.
+        files.push_back(compilerCall.inputFile);
+        files.insert(files.end(), compilerCall.extraObjectFiles.begin(), compilerCall.extraObjectFiles.end());
+    }
+    else if ( compilerCall.UsePrecompiledHeader() )
+        files.push_back(CodeCompiler::Get()->GetPrecompiledHeaderFile(compilerCall.optimize)+".gch");
 
-        if ( !currentTask.emptyTask )
+    return files;
+}
+
+gd::String CodeCompiler::GetPrecompiledHeaderFile(bool optimize) const
+{
+    //The name identifies the configuration, so that the header is built again when GDevelop is updated.
+    unsigned long long hash = 14695981039346656037ULL;
+    gd::String configuration = gd::VersionWrapper::FullString()+(optimize ? "-O1" : "-O0");
+    UpdateHash(hash, configuration.c_str(), configuration.size());
+    UpdateHashWithModificationTime(hash, GetEventsPrecompiledHeaderSource());
+
+    std::ostringstream name;
+    name << "EventsPrecompiledHeader" << std::hex << hash << ".h";
+    return GetCacheDirectory()+gd::String::FromUTF8(name.str());
+}
+
+void CodeCompiler::StartTheNextTasks()
+{
+    if ( startingTasks ) return; //Tasks are already being started (i.e: this is a task added by a pre work).
+
+    startingTasks = true;
+    while ( true )
+    {
+        CodeCompilerTask task;
         {
-           //currentTask is not empty: Do it.
+            sf::Lock lock(pendingTasksMutex); //Disallow modifying pending tasks.
+            if ( workers.size() >= maxWorkersCount ) break;
+
+            std::size_t i = 0;
+            while ( i < pendingTasks.size() && !IsTaskReady(i) ) ++i;
+            if ( i >= pendingTasks.size() ) break; //No task can be made for now
+
+            task = pendingTasks[i];
+            pendingTasks.erase(pendingTasks.begin()+i);
         }
-        else
+
+        StartTask(task);
+    }
+    startingTasks = false;
+
+    {
+        sf::Lock lock(pendingTasksMutex);
+        if ( workers.empty() ) //Bail out if no task is being made
         {
-            bool newTaskFound = false;
-            for (std::size_t i = 0;i<pendingTasks.size();++i)
-            {
-                //Be sure that the task is not disabled
-                if ( find(compilationDisallowed.begin(), compilationDisallowed.end(), pendingTasks[i].scene) == compilationDisallowed.end() )
-                {
-                    currentTask = pendingTasks[i];
-                    pendingTasks.erase(pendingTasks.begin()+i);
-
-                    newTaskFound = true;
-                    break;
-                }
-            }
-            if ( !newTaskFound ) //Bail out if no task can be made
-            {
-                if ( pendingTasks.empty() )
-                    std::cout << "No more task to be processed." << std::endl;
-                else
-                    std::cout << "No more task to be processed ( But "+gd::String::From(pendingTasks.size())+" disabled task(s) waiting for being enabled )." << std::endl;
-
-                processLaunched = false;
-                NotifyControls();
-                return;
-            }
+            if ( pendingTasks.empty() )
+                std::cout << "No more task to be processed." << std::endl;
+            else
+                std::cout << "No more task to be processed ( But "+gd::String::From(pendingTasks.size())+" disabled task(s) waiting for being enabled )." << std::endl;
 
+            processLaunched = false;
         }
     }
 
-    std::cout << "Processing task " << currentTask.userFriendlyName << "..." << std::endl;
+    NotifyControls();
+}
+
+bool CodeCompiler::IsTaskReady(std::size_t index) const
+{
+    const CodeCompilerTask & task = pendingTasks[index];
+
+    //Be sure that the task is not disabled
+    if ( find(compilationDisallowed.begin(), compilationDisallowed.end(), task.scene) != compilationDisallowed.end() )
+        return false;
+
+    //Be sure that the files needed by the task are not being written. Equivalent tasks are also not
+    //processed at the same time, the last one being launched when the first one is over.
+    std::vector<gd::String> files = task.GetRequiredFiles();
+    files.push_back(task.compilerCall.outputFile);
+    for (std::size_t i = 0;i<files.size();++i)
+    {
+        if ( files[i].empty() ) continue;
+
+        for (std::size_t j = 0;j<workers.size();++j)
+        {
+            if ( workers[j]->task.compilerCall.outputFile == files[i] ) return false;
+        }
+        for (std::size_t j = 0;j<index;++j)
+        {
+            if ( pendingTasks[j].compilerCall.outputFile == files[i] ) return false;
+        }
+    }
+
+    return true;
+}
+
+void CodeCompiler::StartTask(CodeCompilerTask task)
+{
+    std::cout << "Processing task " << task.userFriendlyName << "..." << std::endl;
     lastTaskFailed = false;
     NotifyControls();
-    bool skip = false; //Set to true if the preworker of the task asked to relaunch the task later.
 
-    if ( currentTask.preWork != std::shared_ptr<CodeCompilerExtraWork>() )
+    if ( task.preWork != std::shared_ptr<CodeCompilerExtraWork>() )
     {
         std::cout << "Launching pre work..." << std::endl;
-        bool result = currentTask.preWork->Execute();
+        task.preWork->dependencies.clear();
+        bool result = task.preWork->Execute();
 
         if ( !result )
         {
             std::cout << "Preworker execution failed, task skipped." << std::endl;
-            skip = true;
+            return;
         }
-        else if ( currentTask.preWork->requestRelaunchCompilationLater )
+        else if ( task.preWork->requestRelaunchCompilationLater )
         {
+            //The task will be launched again when its dependencies are compiled.
             std::cout << "Preworker asked to launch the task later" << std::endl;
             sf::Lock lock(pendingTasksMutex); //Disallow modifying pending tasks.
-            pendingTasks.push_back(currentTask);
+            pendingTasks.push_back(task);
+            pendingTasks.back().dependencies = task.preWork->dependencies;
             pendingTasks.back().preWork->requestRelaunchCompilationLater = false;
-
-            skip = true;
+            return;
         }
     }
 
-    if ( skip ) //The preworker asked to skip the task
+    std::shared_ptr<CodeCompilerWorker> worker = std::make_shared<CodeCompilerWorker>(task);
     {
-        currentTask = ConstructEmptyTask();
-        NotifyControls();
-        StartTheNextTask(); //Calling recursively StartTheNextTask() is not a problem: The function will be called until a process is launched
-                            //or until all tasks are skipped
-        return;
+        sf::Lock lock(pendingTasksMutex);
+        workers.push_back(worker);
     }
 
-    lastTaskMessages.clear();
+    //Reuse the output file from the compilation cache if nothing changed
+    if ( task.compilerCall.useCache && !task.compilerCall.link )
+    {
+        gd::String cacheKey = task.compilerCall.GetCacheKey();
+        if ( !cacheKey.empty() ) worker->cacheFile = GetCacheDirectory()+cacheKey+".o";
+    }
+    if ( !worker->cacheFile.empty() && wxFileExists(worker->cacheFile) &&
+        wxCopyFile(worker->cacheFile, task.compilerCall.outputFile) )
+    {
+        std::cout << "Output file reused from the compilation cache." << std::endl;
+        EndTask(worker, true, true);
+        return;
+    }
 
     //Launching the process
     std::cout << "Launching compiler process...\n";
-    std::cout << currentTask.compilerCall.GetFullCall() << "\n";
-    currentTaskProcess = new CodeCompilerProcess(this);
-    currentTaskProcess->Redirect();
-    if ( wxExecute(currentTask.compilerCall.GetFullCall(), wxEXEC_ASYNC, currentTaskProcess) == 0 )
+    std::cout << task.compilerCall.GetFullCall() << "\n";
+    worker->process = new CodeCompilerProcess(this);
+    worker->process->Redirect();
+    if ( wxExecute(task.compilerCall.GetFullCall(), wxEXEC_ASYNC, worker->process) == 0 )
     {
         gd::LogError(_("Unable to launch the internal compiler: Try to reinstall GDevelop to make sure that every needed file are present."));
-        delete currentTaskProcess;
-        currentTaskProcess = NULL;
+        delete worker->process;
+        worker->process = NULL;
+        EndTask(worker, false, false);
     }
     else
     {
         //Also launch the thread which will read the output of the process
-        currentTaskOutputThread = new sf::Thread(&CodeCompilerProcess::WatchOutput, currentTaskProcess);
-        currentTaskOutputThread->launch();
+        worker->outputThread = new sf::Thread(&CodeCompilerProcess::WatchOutput, worker->process);
+        worker->outputThread->launch();
 
         //When the process ends, it will call ProcessEndedWork()...
     }
@@ -341,31 +471,44 @@ void CodeCompilerProcess::OnTerminate( int pid, int status )
 
     exitCode = status;
     stopWatchOutput = true;
-    #if defined(WINDOWS)
     wxCommandEvent processEndedEvent( CodeCompiler::processEndedEventType );
+    processEndedEvent.SetClientData(this);
+    #if defined(WINDOWS)
     if ( parent != NULL) wxPostEvent(parent, processEndedEvent);
     #else
-    wxCommandEvent useless;
-    CodeCompiler::Get()->ProcessEndedWork(useless);
+    CodeCompiler::Get()->ProcessEndedWork(processEndedEvent);
     #endif
 }
 
 void CodeCompiler::ProcessEndedWork(wxCommandEvent & event)
 {
     //...This function is called when a CodeCompilerProcess ends its job.
-    std::cout << "CodeCompiler notified that the current process ended work." << std::endl;
+    std::cout << "CodeCompiler notified that a process ended work." << std::endl;
+
+    std::shared_ptr<CodeCompilerWorker> worker;
+    {
+        sf::Lock lock(pendingTasksMutex);
+        for (std::size_t i = 0;i<workers.size();++i)
+        {
+            if ( workers[i]->process == event.GetClientData() ) worker = workers[i];
+        }
+    }
+    if ( !worker )
+    {
+        std::cout << "No task is associated to the process." << std::endl;
+        return;
+    }
 
     //Also terminate the thread which was reading the output
-    currentTaskOutputThread->wait();
-    delete currentTaskOutputThread;
-    currentTaskOutputThread = NULL;
+    worker->outputThread->wait();
+    delete worker->outputThread;
+    worker->outputThread = NULL;
 
     // Check if compilation was successful
-    bool compilationSucceeded = (currentTaskProcess->exitCode == 0);
+    bool compilationSucceeded = (worker->process->exitCode == 0);
     if (!compilationSucceeded)
     {
-        std::cout << "Compilation failed with exit code " << currentTaskProcess->exitCode << ".\n";
-        lastTaskFailed = true;
+        std::cout << "Compilation failed with exit code " << worker->process->exitCode << ".\n";
     }
     else
     {
@@ -375,11 +518,11 @@ void CodeCompiler::ProcessEndedWork(wxCommandEvent & event)
     //Compilation ended, saving diagnostics
     {
         lastTaskMessages.clear();
-        for (std::size_t i = 0;i<currentTaskProcess->output.size();++i)
-            lastTaskMessages += currentTaskProcess->output[i]+"\n";
+        for (std::size_t i = 0;i<worker->process->output.size();++i)
+            lastTaskMessages += worker->process->output[i]+"\n";
 
-        for (std::size_t i = 0;i<currentTaskProcess->outputErrors.size();++i)
-            lastTaskMessages += currentTaskProcess->outputErrors[i]+"\n";
+        for (std::size_t i = 0;i<worker->process->outputErrors.size();++i)
+            lastTaskMessages += worker->process->outputErrors[i]+"\n";
 
         ofstream outputFile;
         outputFile.open (gd::String(outputDir+"LatestCompilationOutput.txt").ToLocale().c_str());
@@ -391,32 +534,72 @@ void CodeCompiler::ProcessEndedWork(wxCommandEvent & event)
         else cout << "Unable to open LatestCompilationOutput for writing compiler output!";
     }
 
+    //Store the output file in the compilation cache
+    if ( compilationSucceeded && !worker->cacheFile.empty() )
+    {
+        if ( !wxDirExists(GetCacheDirectory()) ) wxMkdir(GetCacheDirectory());
+        if ( !wxCopyFile(worker->task.compilerCall.outputFile, worker->cacheFile) )
+            std::cout << "Unable to store the output file in the compilation cache." << std::endl;
+    }
+
+    delete worker->process;
+    worker->process = NULL;
+    EndTask(worker, compilationSucceeded, false);
+}
+
+void CodeCompiler::EndTask(std::shared_ptr<CodeCompilerWorker> worker, bool succeeded, bool cacheHit)
+{
+    const CodeCompilerTask & task = worker->task;
+    if ( !succeeded ) lastTaskFailed = true;
+    if ( !succeeded && task.compilerCall.precompiledHeader )
+    {
+        std::cout << "Events will be compiled without precompiled header." << std::endl;
+        failedPrecompiledHeaders.insert(task.compilerCall.inputFile);
+    }
+
+    //Save the report of the task and free the worker
+    {
+        CodeCompilerTaskReport report;
+        report.number = tasksCount++;
+        report.userFriendlyName = task.userFriendlyName;
+        report.succeeded = succeeded;
+        report.cacheUsed = !worker->cacheFile.empty();
+        report.cacheHit = cacheHit;
+        report.duration = worker->clock.getElapsedTime().asMilliseconds();
+        if ( report.cacheUsed && cacheHit ) cacheHitsCount++;
+        else if ( report.cacheUsed ) cacheMissesCount++;
+
+        sf::Lock lock(pendingTasksMutex);
+        tasksReports.push_back(report);
+        if ( tasksReports.size() > maxTasksReports ) tasksReports.pop_front();
+
+        workers.erase(std::remove(workers.begin(), workers.end(), worker), workers.end());
+    }
+
     //Now do post work and notify task has been done.
     {
-        if (currentTask.postWork != std::shared_ptr<CodeCompilerExtraWork>() )
+        if (task.postWork != std::shared_ptr<CodeCompilerExtraWork>() )
         {
             std::cout << "Launching post task" << std::endl;
-            currentTask.postWork->compilationSucceeded = compilationSucceeded;
-            currentTask.postWork->Execute();
+            task.postWork->compilationSucceeded = succeeded;
+            task.postWork->Execute();
 
-            if ( currentTask.postWork->requestRelaunchCompilationLater )
+            if ( task.postWork->requestRelaunchCompilationLater )
             {
                 std::cout << "Postworker asked to launch again the task later" << std::endl;
 
-                pendingTasks.push_back(currentTask);
+                sf::Lock lock(pendingTasksMutex);
+                pendingTasks.push_back(task);
                 pendingTasks.back().postWork->requestRelaunchCompilationLater = false;
             }
         }
 
         std::cout << "Task ended." << std::endl;
-        currentTask = ConstructEmptyTask();
         NotifyControls();
     }
 
-    //Launch the next task ( even if there is no task to be done )
-    delete currentTaskProcess;
-    currentTaskProcess = NULL;
-    StartTheNextTask();
+    //Launch the next tasks ( even if there is no task to be done )
+    StartTheNextTasks();
 }
 
 void CodeCompiler::NotifyControls()
@@ -427,18 +610,6 @@ void CodeCompiler::NotifyControls()
         if ( (*it) != NULL) wxPostEvent((*it), refreshEvent);
     }
 }
-/* TODO
-void CodeCompiler::SendCurrentThreadToGarbage()
-{
-    sf::Lock lock(garbageThreadsMutex); //Disallow modifying garbageThreads.
-    std::cout << "Old thread (" << currentTaskThread.get() << ") sent to garbage." << std::endl;
-
-    garbageThreads.push_back(currentTaskThread);
-    livingGarbageThreadsCount++; //We increment livingGarbageThreadsCount as the thread sent to garbageThreads was alive ( i.e. : doing work )
-
-    currentTaskThread = std::shared_ptr<sf::Thread>();
-    processLaunched = false;
-}*/
 
 void CodeCompiler::AddTask(CodeCompilerTask task)
 {
@@ -451,42 +622,65 @@ void CodeCompiler::AddTask(CodeCompilerTask task)
             if ( task.IsSameTaskAs(pendingTasks[i]) ) return;
         }
 
-        //If the task is equivalent to the current one, abort it.
-        if ( processLaunched && task.IsSameTaskAs(currentTask) )
-        {
-            std::cout << "Task requested is equivalent to the current one (" << task.userFriendlyName << ")" << std::endl;
-
-            /*if ( livingGarbageThreadsCount < maxGarbageThread ) TODO
-            {
-                SendCurrentProcessToGarbage();
-            }
-            else*/
-            {
-                pendingTasks.push_back(task);
-                std::cout << "Max thread count reached, new pending task added (" << task.userFriendlyName << ")" << std::endl;
-            }
-        }
-        else
-        {
-            pendingTasks.push_back(task);
-            std::cout << "New pending task added (" << task.userFriendlyName << ")" << std::endl;
-        }
+        //If the task is equivalent to one being processed, it will be launched when this one is over (see IsTaskReady).
+        AddPrecompiledHeaderTaskIfNeeded(task);
+        pendingTasks.push_back(task);
+        std::cout << "New pending task added (" << task.userFriendlyName << ")" << std::endl;
     }
 
-    if ( !processLaunched )
+    if ( !processLaunched ) std::cout << "Launching new compilation run" << std::endl;
+    processLaunched = true;
+    StartTheNextTasks();
+}
+
+void CodeCompiler::AddPrecompiledHeaderTaskIfNeeded(const CodeCompilerTask & task)
+{
+    if ( !task.compilerCall.UsePrecompiledHeader() ) return;
+
+    gd::String header = GetPrecompiledHeaderFile(task.compilerCall.optimize);
+    if ( wxFileExists(header+".gch") || failedPrecompiledHeaders.find(header) != failedPrecompiledHeaders.end() )
+        return;
+
+    for (std::size_t i = 0;i<pendingTasks.size();++i)
     {
-        std::cout << "Launching new compilation run";
-        processLaunched = true;
-        StartTheNextTask();
+        if ( pendingTasks[i].compilerCall.outputFile == header+".gch" ) return;
+    }
+    for (std::size_t i = 0;i<workers.size();++i)
+    {
+        if ( workers[i]->task.compilerCall.outputFile == header+".gch" ) return;
     }
+
+    //The header only includes the events header: it is used as is if the precompiled header can't be built.
+    if ( !wxDirExists(GetCacheDirectory()) ) wxMkdir(GetCacheDirectory());
+    ofstream headerFile(header.ToLocale().c_str());
+    headerFile << "#include \"" << GetEventsPrecompiledHeaderSource() << "\"\n";
+    headerFile.close();
+
+    CodeCompilerTask headerTask;
+    headerTask.compilerCall.precompiledHeader = true;
+    headerTask.compilerCall.compilationForRuntime = false;
+    headerTask.compilerCall.optimize = task.compilerCall.optimize;
+    headerTask.compilerCall.inputFile = header;
+    headerTask.compilerCall.outputFile = header+".gch";
+    headerTask.userFriendlyName = "Precompilation of the events header";
+    pendingTasks.push_back(headerTask);
+}
+
+std::vector < CodeCompilerTaskReport > CodeCompiler::GetTasksReports() const
+{
+    sf::Lock lock(pendingTasksMutex);
+
+    return std::vector < CodeCompilerTaskReport >(tasksReports.begin(), tasksReports.end());
 }
 
 std::vector < CodeCompilerTask > CodeCompiler::GetCurrentTasks() const
 {
     sf::Lock lock(pendingTasksMutex); //Disallow modifying pending tasks.
 
-    std::vector < CodeCompilerTask > allTasks = pendingTasks;
-    if (processLaunched) allTasks.insert(allTasks.begin(), currentTask);
+    std::vector < CodeCompilerTask > allTasks;
+    for (std::size_t i = 0;i<workers.size();++i)
+        allTasks.push_back(workers[i]->task);
+    allTasks.insert(allTasks.end(), pendingTasks.begin(), pendingTasks.end());
 
     return allTasks;
 }
@@ -495,7 +689,10 @@ bool CodeCompiler::HasTaskRelatedTo(gd::Layout & scene) const
 {
     sf::Lock lock(pendingTasksMutex); //Disallow modifying pending tasks.
 
-    if ( processLaunched && currentTask.scene == &scene ) return true;
+    for (std::size_t i = 0;i<workers.size();++i)
+    {
+        if ( workers[i]->task.scene == &scene ) return true;
+    }
 
     for (std::size_t i = 0;i<pendingTasks.size();++i)
     {
@@ -521,11 +718,11 @@ void CodeCompiler::EnableTaskRelatedTo(gd::Layout & scene)
     }
 
     //Launch pending tasks if needed
-    if ( !processLaunched && mustLaunchCompilation )
+    if ( mustLaunchCompilation )
     {
-        std::cout << "Launching compilation thread...";
+        if ( !processLaunched ) std::cout << "Launching new compilation run" << std::endl;
         processLaunched = true;
-        StartTheNextTask();
+        StartTheNextTasks();
     }
 }
 
@@ -581,6 +778,18 @@ void CodeCompiler::ClearOutputDirectory()
     }
 }
 
+void CodeCompiler::ClearCache()
+{
+    wxString file = wxFindFirstFile( GetCacheDirectory() + "*" );
+    while ( !file.empty() )
+    {
+        if ( !wxRemoveFile( file ) )
+            std::cout << _( "Unable to delete file" ) + file + _(" in compilation cache directory.\n" );
+
+        file = wxFindNextFile();
+    }
+}
+
 void CodeCompiler::AddHeaderDirectory(const gd::String & dir)
 {
     wxFileName filename = wxFileName::FileName(dir);
@@ -600,19 +809,22 @@ void CodeCompiler::SetBaseDirectory(gd::String baseDir_)
 
 void CodeCompiler::AllowMultithread(bool allow, unsigned int maxThread)
 {
-    /*if (!allow || maxThread == 1)
-        maxGarbageThread = 0;
+    if ( !allow )
+        maxWorkersCount = 1;
     else
-        maxGarbageThread = maxThread-1;*/
+        maxWorkersCount = maxThread == 0 ? gd::ParallelTasks::GetProcessorsCount() : maxThread;
+
+    std::cout << "Code compiler launching up to " << maxWorkersCount << " process(es) at the same time." << std::endl;
 }
 
 CodeCompiler::CodeCompiler() :
     processLaunched(false),
-    currentTask(ConstructEmptyTask()),
-    currentTaskProcess(NULL),
-    currentTaskOutputThread(NULL),
-    //maxGarbageThread(2),
-    lastTaskFailed(false)
+    maxWorkersCount(gd::ParallelTasks::GetProcessorsCount()),
+    startingTasks(false),
+    lastTaskFailed(false),
+    tasksCount(0),
+    cacheHitsCount(0),
+    cacheMissesCount(0)
 {
     Connect(wxID_ANY, processEndedEventType, (wxObjectEventFunction) (wxEventFunction) (wxCommandEventFunction) &CodeCompiler::ProcessEndedWork);
 }
@@ -667,7 +879,10 @@ CodeCompilerCall::CodeCompilerCall() :
     link(false),
     compilationForRuntime(false),
     optimize(false),
-    eventsGeneratedCode(true)
+    optimizationLevel(1),
+    eventsGeneratedCode(true),
+    useCache(false),
+    precompiledHeader(false)
 {
 }
 
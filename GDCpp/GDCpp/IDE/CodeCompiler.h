@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <deque>
 #include <SFML/System.hpp>
 #include <memory>
 #include "GDCpp/Runtime/String.h"
@@ -42,6 +43,14 @@ public:
      */
     gd::String GetFullCall() const;
 
+    /**
+     * Return the key identifying the output file in the compilation cache: a hash of the content of
+     * the input file, of the call (without the input and output paths), of the version of GDevelop
+     * and of the modification time of the headers and of the extra dependencies.
+     * \return The key, or an empty string if the input file cannot be read.
+     */
+    gd::String GetCacheKey() const;
+
     const gd::String & GetCompilerExecutable() const { return compilerExecutable; }
     void SetCompilerExecutable(const gd::String & compilerExecutableFullPath) { compilerExecutable = compilerExecutableFullPath; }
 
@@ -55,15 +64,25 @@ public:
     std::vector<gd::String> extraOptions; ///< Extra options that will be added raw as the end of the command line.
 
     bool optimize; ///< Activate optimization flag if set to true
+    unsigned int optimizationLevel; ///< The level of optimization ( i.e. 2 for -O2 ) used when optimize is set to true.
     bool compilationForRuntime; ///< Automatically define GD_IDE_ONLY if set to true
     bool eventsGeneratedCode; ///< If set to true, the compiler will be set up with common options for events compilation.
+    bool useCache; ///< If set to true, the output file is reused from the compilation cache when nothing changed. ( Only relevant when link == false )
+    bool precompiledHeader; ///< If set to true, the input file is a header compiled into a precompiled header. ( Only relevant when link == false )
+    std::vector<gd::String> extraDependencies; ///< Additional files (i.e: headers of the project) invalidating the cached output file when modified. ( Only relevant when useCache == true )
+
+    /**
+     * Return true if the events precompiled header is included when compiling the input file.
+     * \see CodeCompiler::GetPrecompiledHeaderFile
+     */
+    bool UsePrecompiledHeader() const { return !link && !precompiledHeader && !compilationForRuntime; }
 
     /**
      * Method to check if the task is the same as another. ( Compare files/options but does not take in account pre/post work )
      */
     bool IsSameAs(CodeCompilerCall & other) const {
         return (inputFile == other.inputFile && outputFile == other.outputFile && compilationForRuntime == other.compilationForRuntime
-                && optimize == other.optimize && eventsGeneratedCode == other.eventsGeneratedCode );
+                && optimize == other.optimize && optimizationLevel == other.optimizationLevel && eventsGeneratedCode == other.eventsGeneratedCode );
     }
 
 private:
@@ -90,6 +109,14 @@ public:
 
     gd::String userFriendlyName; ///< Task name displayed to the user
     gd::Layout * scene; ///< Optional pointer to a scene to specify that the task work is related to this scene.
+    std::vector<gd::String> dependencies; ///< Output files of other tasks which must be over before the task is launched.
+
+    /**
+     * Return the files which must not be written by another task when the task is launched:
+     * its dependencies, the object files to be linked and the precompiled header.
+     * \see CodeCompiler::AddTask
+     */
+    std::vector<gd::String> GetRequiredFiles() const;
 
     /**
      * Method to check if the task is the same as another. ( Compare files/options but does not take in account pre/post work )
@@ -99,6 +126,24 @@ public:
     }
 };
 
+/**
+ * \brief Information about a task processed by the code compiler.
+ * \see CodeCompiler::GetTasksReports
+ */
+class GD_API CodeCompilerTaskReport
+{
+public:
+    CodeCompilerTaskReport() : number(0), succeeded(false), cacheUsed(false), cacheHit(false), duration(0) {};
+    virtual ~CodeCompilerTaskReport() {};
+
+    std::size_t number; ///< The number of the task, incremented for each task processed.
+    gd::String userFriendlyName; ///< Task name displayed to the user
+    bool succeeded; ///< true if the task was successful.
+    bool cacheUsed; ///< true if the task used the compilation cache.
+    bool cacheHit; ///< true if the output file was reused from the compilation cache.
+    sf::Int64 duration; ///< The time spent on the task, in milliseconds.
+};
+
 /**
  * \brief Define a special work to be done after/before a task
  * \see CodeCompiler
@@ -113,6 +158,7 @@ public:
     virtual bool Execute() {return true;};
 
     bool requestRelaunchCompilationLater; ///< If the task set this bool to true, the task will be skipped and relaunched later.
+    std::vector<gd::String> dependencies; ///< Output files of the tasks which must be over before the task is relaunched. ( Only relevant when requestRelaunchCompilationLater is set to true by a pre work )
     bool compilationSucceeded; ///< Set to true by the CodeCompiler if the compilation associated to the task was a success. Only applicable for post work.
 
     CodeCompilerExtraWork();
@@ -151,9 +197,27 @@ private:
     bool stopWatchOutput;
 };
 
+/**
+ * \brief Internal class storing a task being processed by the CodeCompiler, and the process doing its work.
+ */
+class CodeCompilerWorker
+{
+public:
+    CodeCompilerWorker(const CodeCompilerTask & task_) : task(task_), process(NULL), outputThread(NULL) {};
+    virtual ~CodeCompilerWorker() {};
+
+    CodeCompilerTask task; ///< The task being processed.
+    CodeCompilerProcess * process; ///< The process doing the task, if launched.
+    sf::Thread * outputThread; ///< The thread used to read the output of the compiler.
+    gd::String cacheFile; ///< The file of the compilation cache storing the output of the task, if the task uses the cache.
+    sf::Clock clock; ///< Measure the time spent on the task.
+};
+
 /**
  * \brief C++ Code compiler
- * This class uses a thread to launch Clang compiler according to the task added using AddTask.
+ * This class launches compiler processes according to the task added using AddTask.
+ * Tasks are processed in parallel by a pool of workers, a task being launched only when the tasks writing
+ * the files it needs are over (see CodeCompilerTask::GetRequiredFiles).
  * Specific functions are available for preventing the compiler to start a new task involving a specific scene.
  *
  * \see CodeCompilerTask
@@ -163,9 +227,13 @@ class GD_API CodeCompiler : public wxEvtHandler
 public:
 
     /**
-     * Add a task. It will be directly processed or added to a list of pending task if another task is running.
+     * Add a task. It will be directly processed or added to a list of pending task if all workers are busy
+     * or if the files it needs are written by other tasks.
      * If a similar task ( as defined by CodeCompilerTask::IsSameTaskAs ) is waiting in pending task list, the task
      * won't be added to this pending task list.
+     *
+     * If the task includes the events precompiled header and if it was not built yet, a task building it
+     * is added before the task.
      */
     void AddTask(CodeCompilerTask task);
 
@@ -198,7 +266,7 @@ public:
     bool CompilationInProcess() const;
 
     /**
-     * Return a list of tasks containing the current task and tasks waiting to be processed
+     * Return a list of tasks containing the tasks being processed and tasks waiting to be processed
      */
     std::vector < CodeCompilerTask > GetCurrentTasks() const;
 
@@ -225,7 +293,7 @@ public:
     void RemoveNotifiedControl(wxEvtHandler * control) { notifiedControls.erase(control); };
 
     /**
-     * Return true if the latest task has failed.
+     * Return true if the latest task ended has failed.
      */
     bool LastTaskFailed() { return lastTaskFailed; };
 
@@ -268,18 +336,61 @@ public:
 
     /**
      * Erase all files in the output directory ( Even if MustDeleteTemporaries() == false ).
+     * \note The compilation cache, stored in a sub directory, is not erased.
      */
     void ClearOutputDirectory();
 
     /**
-     * Set if CodeCompiler is allowed to launch more than one thread.
+     * Return the directory where the compilation cache stores the output files of the tasks,
+     * so that they are reused when nothing changed, even after GDevelop is restarted.
+     */
+    gd::String GetCacheDirectory() const { return outputDir+"Cache/"; };
+
+    /**
+     * Erase all files of the compilation cache.
+     */
+    void ClearCache();
+
+    /**
+     * Return the reports of the latest tasks processed, the most recent being the last one.
+     */
+    std::vector < CodeCompilerTaskReport > GetTasksReports() const;
+
+    /**
+     * Return the number of tasks whose output file was reused from the compilation cache.
+     */
+    std::size_t GetCacheHitsCount() const { return cacheHitsCount; };
+
+    /**
+     * Return the number of tasks using the compilation cache which had to be compiled.
+     */
+    std::size_t GetCacheMissesCount() const { return cacheMissesCount; };
+
+    /**
+     * Return the header included when compiling events for edittime, which includes the
+     * events precompiled header of GDCpp. It is compiled once for each configuration into
+     * a precompiled header, the same file with a ".gch" extension, stored in the cache directory.
      *
-     * For example, if a task is requested twice in a short time, CodeCompiler can launch a 2nd
-     * thread to do the work and discard the result of the 1st as it is useless.
-     * If multithread is disabled or if maxThread count is reached, then the second task is added
-     * to pending tasks.
+     * \param optimize The optimization of the compilation, as the precompiled header must be
+     * built with the same flags as the files including it.
+     */
+    gd::String GetPrecompiledHeaderFile(bool optimize) const;
+
+    /**
+     * Set if CodeCompiler is allowed to launch more than one compiler process at the same time.
+     *
+     * Independent tasks ( for example, the compilation of the events of several scenes ) are then
+     * processed in parallel.
+     * If multithread is disabled, tasks are processed one by one.
+     *
+     * \param maxThread The maximum number of compiler processes, 0 to launch one process for each processor.
+     */
+    void AllowMultithread(bool allow = true, unsigned int maxThread = 0);
+
+    /**
+     * Return the maximum number of tasks processed at the same time.
      */
-    void AllowMultithread(bool allow = true, unsigned int maxThread = 3);
+    std::size_t GetMaxWorkersCount() const { return maxWorkersCount; };
 
     static CodeCompiler * Get();
     static void DestroySingleton();
@@ -291,48 +402,70 @@ public:
 private:
 
     /**
-     * \brief Execute the next task to be done.
+     * \brief Start the pending tasks which can be done, until all workers are busy.
      *
      * Return without doing nothing special if no task has to be done.<br>
-     * If a task must be done, a compilation process is executed ( see CodeCompilerProgress ) and then the function returns.
+     * For each task started, a compilation process is executed ( see CodeCompilerProcess ).
      * The process will call ProcessEndedWork when it is over.
      */
-    void StartTheNextTask();
+    void StartTheNextTasks();
 
     /**
-     * Post an event to notifiedControls to notify them that progress has been made.
+     * \brief Launch the pre work of the task, then reuse its output file from the compilation cache
+     * or launch the compilation process.
      */
-    void NotifyControls();
+    void StartTask(CodeCompilerTask task);
 
     /**
-     * Set the current process to be considered as garbage.
+     * \brief End a task: save its report, launch the post task worker if needed,
+     * and call StartTheNextTasks() to launch the next tasks if any.
      */
-    void SendCurrentProcessToGarbage();
+    void EndTask(std::shared_ptr<CodeCompilerWorker> worker, bool succeeded, bool cacheHit);
+
+    /**
+     * \brief Return true if the pending task at the specified position can be launched: it is not disabled
+     * and the files it needs are not written by a task being processed or by a task added before it.
+     * \note pendingTasksMutex must be locked.
+     */
+    bool IsTaskReady(std::size_t index) const;
+
+    /**
+     * \brief Add a task building the precompiled header used by the task, if it was not built yet.
+     * \note pendingTasksMutex must be locked.
+     */
+    void AddPrecompiledHeaderTaskIfNeeded(const CodeCompilerTask & task);
+
+    /**
+     * Post an event to notifiedControls to notify them that progress has been made.
+     */
+    void NotifyControls();
 
 #if !defined(WINDOWS)
 public:
 #endif
     /**
-     * Called by processes ( CodeCompilerProgress )  when they end they work.
+     * Called by processes ( CodeCompilerProcess ) when they end their work. The client data of the event
+     * is the process.
      *
-     * Take care of launching the post task worker if needed, and then call StartTheNextTask() to
-     * launch the next task if any.
+     * Take care of launching the post task worker if needed, and then call StartTheNextTasks() to
+     * launch the next tasks if any.
      */
     void ProcessEndedWork(wxCommandEvent& event);
 #if !defined(WINDOWS)
 private:
 #endif
 
-    //Current task
-    bool processLaunched; ///< Set to true when the thread is working, and to false when the pending task list has been exhausted.
-    CodeCompilerTask currentTask; ///< When a task is being done, it is removed from pendingTasks and stored here.
-    CodeCompilerProcess * currentTaskProcess; ///< The process doing the current task
-    sf::Thread * currentTaskOutputThread; ///< The wxWidgets thread used to read the output of the compiler.
+    //Tasks being processed
+    bool processLaunched; ///< Set to true when tasks are being processed, and to false when the pending task list has been exhausted.
+    std::vector < std::shared_ptr<CodeCompilerWorker> > workers; ///< When a task is being done, it is removed from pendingTasks and stored in a worker.
+    std::size_t maxWorkersCount; ///< The maximum number of tasks processed at the same time.
+    bool startingTasks; ///< Set to true while StartTheNextTasks is launching tasks.
 
     //Pending task management
     std::vector < CodeCompilerTask > pendingTasks; ///< Compilation task waiting to be launched.
     mutable sf::Mutex pendingTasksMutex; ///< A mutex is used to be sure that pending tasks are not modified by the thread and another method at the same time.
     std::vector < gd::Layout* > compilationDisallowed; ///< List of scenes which disallow their events to be compiled. (However, if a compilation is being made, it will not be stopped)
+    std::set < gd::String > failedPrecompiledHeaders; ///< The precompiled headers which could not be built: the header is then included as is.
 
     //Global compiler configuration
     gd::String baseDir; ///< The directory used as the base directory for searching for includes files.
@@ -344,6 +477,10 @@ private:
     std::set<wxEvtHandler*> notifiedControls; ///< List of wxWidgets controls to be notified when some progress has been made.
     gd::String lastTaskMessages;  ///< String containing the messages emitted by the compiler for the latest task.
     bool lastTaskFailed; ///< Set to true when a task fail.
+    std::deque < CodeCompilerTaskReport > tasksReports; ///< The reports of the latest tasks processed.
+    std::size_t tasksCount; ///< The number of tasks processed.
+    std::size_t cacheHitsCount; ///< The number of tasks whose output file was reused from the cache.
+    std::size_t cacheMissesCount; ///< The number of tasks using the cache which had to be compiled.
 
     CodeCompiler();
     virtual ~CodeCompiler();
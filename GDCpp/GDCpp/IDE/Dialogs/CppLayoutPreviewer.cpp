@@ -30,6 +30,10 @@
 #include "GDCpp/Runtime/FontManager.h"
 #include "GDCpp/Runtime/Project/Object.h"
 #include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/EventsBytecode.h"
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
+#include "GDCpp/Events/CodeGeneration/EventsBytecodeGenerator.h"
 #include "GDCpp/IDE/CodeCompilationHelpers.h"
 #include "GDCpp/IDE/Dialogs/DebuggerGUI.h"
 #include "GDCpp/IDE/Dialogs/ProfileDlg.h"
@@ -72,6 +76,9 @@ CppLayoutPreviewer::CppLayoutPreviewer(gd::LayoutEditorCanvas & editor_) :
     //Useful when opening a scene for the first time for example.
     if ( editor.GetLayout().CompilationNeeded() && !CodeCompiler::Get()->HasTaskRelatedTo(editor.GetLayout()) )
         CodeCompilationHelpers::CreateSceneEventsCompilationTask(editor.GetProject(), editor.GetLayout());
+
+    //Also launch the compilation of the functions used to preview events without compiling them.
+    CodeCompilationHelpers::GetEventsFunctionsTable(editor.GetProject());
 }
 
 CppLayoutPreviewer::~CppLayoutPreviewer()
@@ -194,6 +201,7 @@ void CppLayoutPreviewer::RefreshFromLayout()
     //Reset scene
     RuntimeScene newScene(&editor, &previewGame);
     previewScene = newScene;
+    bytecode = nullptr;
     playing = false;
 
     if ( debugger ) previewScene.debugger = debugger.get();
@@ -208,13 +216,29 @@ void CppLayoutPreviewer::RefreshFromLayout()
         mainFrameWrapper.GetInfoBar()->ShowMessage(_("Changes made to events will be taken into account when you switch to Edition mode"));
     }
 
+    //If the events are being compiled, preview them now by interpreting them, while the compilation
+    //goes on. Events are always compiled when profiling.
+    const EventsFunctionsTable * functionsTable = NULL;
+    if ( editor.GetLayout().CompilationNeeded() && !(profiler && profiler->profilingActivated) &&
+        (functionsTable = CodeCompilationHelpers::GetEventsFunctionsTable(editor.GetProject())) != NULL )
+    {
+        bytecode = EventsBytecodeGenerator::GenerateLayoutBytecode(editor.GetProject(), editor.GetLayout());
+        if ( bytecode && EventsBytecodeInterpreter::CanRun(*bytecode, *functionsTable) )
+        {
+            RefreshFromLayoutSecondPart();
+            return;
+        }
+
+        bytecode = nullptr;
+    }
+
     return; //RefreshFromLayoutSecondPart() will be called by OnUpdate() when appropriate
 }
 
 void CppLayoutPreviewer::RefreshFromLayoutSecondPart()
 {
     cout << "Scene canvas reloading... (step 2/2)" << endl;
-    CodeCompiler::Get()->DisableTaskRelatedTo(editor.GetLayout());
+    if ( !bytecode ) CodeCompiler::Get()->DisableTaskRelatedTo(editor.GetLayout()); //The compiled code is not loaded when bytecode is used.
 
     //Switch the working directory as we are making calls to the runtime scene
     if ( wxDirExists(wxFileName::FileName(editor.GetProject().GetProjectFile()).GetPath()))
@@ -224,8 +248,15 @@ void CppLayoutPreviewer::RefreshFromLayoutSecondPart()
     std::cout << "Initializing RuntimeScene from layout..." << std::endl;
     previewScene.LoadFromScene( editor.GetLayout() );
 
-    std::cout << "Loading compiled code..." << std::endl;
-    if ( !previewScene.GetCodeExecutionEngine()->LoadFromDynamicLibrary(editor.GetLayout().GetCompiledEventsFile(),
+    if ( bytecode )
+    {
+        std::cout << "Loading events bytecode..." << std::endl;
+        previewScene.GetCodeExecutionEngine()->LoadFromBytecode(bytecode, EventsFunctionsTable::Get());
+    }
+    else
+        std::cout << "Loading compiled code..." << std::endl;
+
+    if ( !bytecode && !previewScene.GetCodeExecutionEngine()->LoadFromDynamicLibrary(editor.GetLayout().GetCompiledEventsFile(),
                                                                         "GDSceneEvents"+gd::SceneNameMangler::GetMangledSceneName(editor.GetLayout().GetName())) )
     {
         gd::LogError(_("Compilation of events failed, and scene cannot be previewed. Please report this problem to GDevelop's developer, joining this file:\n")
@@ -23,6 +23,7 @@ class DebuggerGUI;
 class ProfileDlg;
 class RenderDialog;
 class InstancesRenderer;
+class EventsBytecode;
 
 /**
  * \brief The new scene editor canvas
@@ -92,6 +93,7 @@ private:
     //Members used during preview or compilation
     RuntimeGame previewGame; ///< Runtime game used during preview.
     RuntimeScene previewScene; ///< Runtime scene used to render or preview the scene.
+    std::shared_ptr<EventsBytecode> bytecode; ///< The events lowered to bytecode, if they are previewed without waiting for their compilation.
     static sf::Texture reloadingIconImage;
     static sf::Sprite reloadingIconSprite;
     static sf::Text reloadingText;
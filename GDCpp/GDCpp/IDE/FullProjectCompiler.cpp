@@ -41,6 +41,8 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
+#include "GDCore/IDE/Project/ImagesUsedInventorizer.h"
+#include "GDCore/IDE/Project/ImagesAtlasPacker.h"
 #include "GDCpp/IDE/ExecutableIconChanger.h"
 #include "GDCpp/IDE/BaseProfiler.h"
 #include "GDCpp/IDE/DependenciesAnalyzer.h"
@@ -58,9 +60,10 @@ namespace GDpriv
  * Automatically create and submit a task to the code compiler for linking the whole code of a game.
  *
  * \param game Game associated with the scene
- * \param scene Scene with events to compile
+ * \param outputFilename The file to be created
+ * \param unityBuild True if the events were compiled in a single object file.
  */
-bool CreateWholeProjectRuntimeLinkingTask(gd::Project & game, const gd::String & outputFilename)
+bool CreateWholeProjectRuntimeLinkingTask(gd::Project & game, const gd::String & outputFilename, bool unityBuild)
 {
     std::cout << "Preparing linking task for project " << game.GetName() << "..." << std::endl;
     CodeCompilerTask task;
@@ -90,10 +93,18 @@ bool CreateWholeProjectRuntimeLinkingTask(gd::Project & game, const gd::String &
     }
 
     //Add all the object files of the game
+    if ( unityBuild )
+    {
+        std::cout << "Added GD" << gd::String::From(&game) << "RuntimeUnityObjectFile.o (Project events object file) to the linking." << std::endl;
+        task.compilerCall.extraObjectFiles.push_back(gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game))+"RuntimeUnityObjectFile.o");
+    }
     for (unsigned int l= 0;l<game.GetLayoutsCount();++l)
     {
-        std::cout << "Added GD" << gd::String::From(&game.GetLayout(l)) << "RuntimeObjectFile.o (Layout object file) to the linking." << std::endl;
-        task.compilerCall.extraObjectFiles.push_back(gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game.GetLayout(l)))+"RuntimeObjectFile.o");
+        if ( !unityBuild )
+        {
+            std::cout << "Added GD" << gd::String::From(&game.GetLayout(l)) << "RuntimeObjectFile.o (Layout object file) to the linking." << std::endl;
+            task.compilerCall.extraObjectFiles.push_back(gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game.GetLayout(l)))+"RuntimeObjectFile.o");
+        }
 
         DependenciesAnalyzer analyzer(game, game.GetLayout(l));
         if ( !analyzer.Analyze() )
@@ -111,7 +122,7 @@ bool CreateWholeProjectRuntimeLinkingTask(gd::Project & game, const gd::String &
             task.compilerCall.extraObjectFiles.push_back(gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&sourceFile)+"RuntimeObjectFile.o"));
         }
     }
-    for (unsigned int l= 0;l<game.GetExternalEventsCount();++l)
+    for (unsigned int l= 0;l<game.GetExternalEventsCount() && !unityBuild;++l)
     {
         gd::ExternalEvents & externalEvents = game.GetExternalEvents(l);
 
@@ -191,15 +202,61 @@ void FullProjectCompiler::LaunchProjectCompilation()
     //Prepare resources to copy
     diagnosticManager.OnMessage( _("Preparing resources...") );
 
+    //Pack the images of sprites, tiled sprites and panel sprites into atlases.
+    //Images used by other objects or by events are kept as is.
+    {
+        std::set<gd::String> atlasAwareObjectTypes = {"Sprite", "TiledSpriteObject::TiledSprite", "PanelSpriteObject::PanelSprite"};
+        gd::ImagesAtlasPacker atlasPacker(NativeFileSystem::Get());
+        atlasPacker.SetBaseDirectory(wxFileName::FileName(gameToCompile.GetProjectFile()).GetPath());
+        gd::ImagesUsedInventorizer otherImages;
+
+        auto exposeObjectImages = [&](gd::Object & object) {
+            if ( atlasAwareObjectTypes.find(object.GetType()) != atlasAwareObjectTypes.end() )
+                object.ExposeResources(atlasPacker);
+            else
+                object.ExposeResources(otherImages);
+        };
+        for (unsigned int i = 0;i<game.GetLayoutsCount();++i)
+        {
+            for (std::size_t j = 0;j<game.GetLayout(i).GetObjectsCount();++j)
+                exposeObjectImages(game.GetLayout(i).GetObject(j));
+
+            gd::LaunchResourceWorkerOnEvents(game, game.GetLayout(i).GetEvents(), otherImages);
+        }
+        for (unsigned int i = 0;i<game.GetExternalEventsCount();++i)
+            gd::LaunchResourceWorkerOnEvents(game, game.GetExternalEvents(i).GetEvents(), otherImages);
+        for (std::size_t j = 0;j<game.GetObjectsCount();++j)
+            exposeObjectImages(game.GetObject(j));
+
+        atlasPacker.ExcludeImages(otherImages.GetAllUsedImages());
+        std::size_t packedImagesCount = atlasPacker.PackInto(game, CodeCompiler::Get()->GetOutputDirectory());
+        std::cout << packedImagesCount << " images packed into atlases." << std::endl;
+    }
+
     //Add resources
     game.ExposeResources(resourcesMergingHelper);
 
-    //Compile all scene events to object files
+    //List the images used by each scene, so that they can be preloaded by the runtime
+    for (unsigned int i = 0;i<game.GetLayoutsCount();++i)
+    {
+        gd::ImagesUsedInventorizer inventorizer;
+        for (std::size_t j = 0;j<game.GetLayout(i).GetObjectsCount();++j)
+            game.GetLayout(i).GetObject(j).ExposeResources(inventorizer);
+        for (std::size_t j = 0;j<game.GetObjectsCount();++j)
+            game.GetObject(j).ExposeResources(inventorizer);
+
+        std::set<gd::String> & usedImages = inventorizer.GetAllUsedImages();
+        game.GetLayout(i).SetUsedImages(std::vector<gd::String>(usedImages.begin(), usedImages.end()));
+    }
+
+    //Compile all scene events to object files: all the tasks are added at once,
+    //so that the scenes are compiled in parallel by the CodeCompiler.
+    std::vector<CodeCompilerTask> scenesTasks;
     for (unsigned int i = 0;i<game.GetLayoutsCount();++i)
     {
         if ( game.GetLayout(i).GetProfiler() ) game.GetLayout(i).GetProfiler()->profilingActivated = false;
+        if ( unityBuild ) continue;
 
-        diagnosticManager.OnMessage(_("Compiling scene ")+game.GetLayout(i).GetName()+_("."));
         CodeCompilerTask task;
         task.compilerCall.compilationForRuntime = true;
         task.compilerCall.optimize = false;
@@ -210,8 +267,29 @@ void FullProjectCompiler::LaunchProjectCompilation()
         task.preWork = std::make_shared<EventsCodeCompilerRuntimePreWork>(&game, &game.GetLayout(i), resourcesMergingHelper);
         task.scene = &game.GetLayout(i);
 
-        CodeCompiler::Get()->AddTask(task);
+        scenesTasks.push_back(task);
+    }
+    if ( unityBuild )
+    {
+        //All the events are compiled in a single file, so that the compiler can inline and optimize them together.
+        CodeCompilerTask task;
+        task.compilerCall.compilationForRuntime = true;
+        task.compilerCall.optimize = true;
+        task.compilerCall.optimizationLevel = 2;
+        task.compilerCall.eventsGeneratedCode = true;
+        task.compilerCall.inputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game)+"RuntimeUnityEventsSource.cpp");
+        task.compilerCall.outputFile = gd::String(CodeCompiler::Get()->GetOutputDirectory()+"GD"+gd::String::From(&game)+"RuntimeUnityObjectFile.o");
+        task.userFriendlyName = "Compilation of events of project "+game.GetName();
+        task.preWork = std::make_shared<ProjectEventsCodeCompilerRuntimeUnityPreWork>(&game, resourcesMergingHelper);
+
+        scenesTasks.push_back(task);
+    }
+
+    diagnosticManager.OnMessage(_("Compiling scenes..."));
+    for (std::size_t i = 0;i<scenesTasks.size();++i)
+        CodeCompiler::Get()->AddTask(scenesTasks[i]);
 
+    {
         wxStopWatch yieldClock;
         while (CodeCompiler::Get()->CompilationInProcess())
         {
@@ -221,19 +299,23 @@ void FullProjectCompiler::LaunchProjectCompilation()
                 yieldClock.Start();
             }
         }
+    }
 
-        if ( !wxFileExists(task.compilerCall.outputFile) )
+    for (unsigned int i = 0;i<scenesTasks.size();++i)
+    {
+        gd::String compiledName = unityBuild ? game.GetName() : game.GetLayout(i).GetName();
+        if ( !wxFileExists(scenesTasks[i].compilerCall.outputFile) )
         {
-            diagnosticManager.AddError(_("Compilation of scene ")+game.GetLayout(i).GetName()+_(" failed: Please go on our website to report this error, joining this file:\n")
+            diagnosticManager.AddError(_("Compilation of scene ")+compiledName+_(" failed: Please go on our website to report this error, joining this file:\n")
                                                     +CodeCompiler::Get()->GetOutputDirectory()+"LatestCompilationOutput.txt"
                                                     +_("\n\nIf you think the error is related to an extension, please contact its developer."));
             diagnosticManager.OnCompilationFailed();
             return;
         }
         else
-            diagnosticManager.OnMessage(_("Compiling scene ")+game.GetLayout(i).GetName()+_(" succeeded"));
+            diagnosticManager.OnMessage(_("Compiling scene ")+compiledName+_(" succeeded"));
 
-        diagnosticManager.OnPercentUpdate( static_cast<float>(i) / static_cast<float>(game.GetLayoutsCount())*50.0 );
+        diagnosticManager.OnPercentUpdate( static_cast<float>(i) / static_cast<float>(scenesTasks.size())*50.0 );
     }
 
     //Now copy resources
@@ -350,7 +432,7 @@ void FullProjectCompiler::LaunchProjectCompilation()
         #endif
         codeOutputFile = tempDir+"/"+codeOutputFile;
 
-        if ( !CreateWholeProjectRuntimeLinkingTask(game, codeOutputFile) )
+        if ( !CreateWholeProjectRuntimeLinkingTask(game, codeOutputFile, unityBuild) )
         {
             std::cout << "Linking cannot be done (Probably circular dependency?)." << std::endl;
             return;
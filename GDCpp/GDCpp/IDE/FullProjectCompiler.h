@@ -28,7 +28,8 @@ public:
         outDir(outDir_),
         windowsTarget(false),
         linuxTarget(false),
-        macTarget(false)
+        macTarget(false),
+        unityBuild(false)
         {};
     virtual ~FullProjectCompiler() {};
 
@@ -38,6 +39,12 @@ public:
     gd::String GetTempDir();
     void SetForcedTempDir(const gd::String & dir) { forcedTempDir = dir; };
 
+    /**
+     * \brief Set if the events of all the scenes and external events must be compiled in a single
+     * file, with more optimizations. Compilation is slower but the game runs faster.
+     */
+    void SetUnityBuild(bool enable = true) { unityBuild = enable; };
+
 private:
     gd::Project & gameToCompile;
     FullProjectCompilerDiagnosticManager & diagnosticManager;
@@ -47,6 +54,7 @@ private:
     bool windowsTarget;
     bool linuxTarget;
     bool macTarget;
+    bool unityBuild; ///< True to compile all the events in a single file.
 };
 
 /**
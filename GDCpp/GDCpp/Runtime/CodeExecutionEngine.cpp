@@ -16,7 +16,8 @@ CodeExecutionEngine::CodeExecutionEngine() :
     runtimeContext(NULL),
     loaded(false),
     dynamicLibrary(NULL),
-    function(NULL)
+    function(NULL),
+    functionsTable(NULL)
 {
 }
 
@@ -33,6 +34,8 @@ void CodeExecutionEngine::Unload()
     if ( dynamicLibrary != NULL ) gd::CloseLibrary(dynamicLibrary);
     dynamicLibrary = NULL;
     function = NULL;
+    interpreter.reset();
+    functionsTable = NULL;
     dynamicLibraryFilename.clear();
     functionName.clear();
 }
@@ -85,10 +88,31 @@ bool CodeExecutionEngine::LoadFunction(functionType fn)
     return true;
 }
 
+bool CodeExecutionEngine::LoadFromBytecode(std::shared_ptr<const EventsBytecode> bytecode, const EventsFunctionsTable & table)
+{
+    if ( loaded ) Unload();
+    if ( !bytecode ) return false;
+
+    std::unique_ptr<EventsBytecodeInterpreter> newInterpreter(new EventsBytecodeInterpreter(bytecode, table));
+    if ( !newInterpreter->IsValid() )
+    {
+        std::cout << "ERROR: Unable to run the events bytecode, as " << newInterpreter->GetMissingFunction() << " is missing." << std::endl;
+        return false;
+    }
+
+    interpreter = std::move(newInterpreter);
+    functionsTable = &table;
+    std::cout << "Loaded events bytecode (" << bytecode->instructions.size() << " instructions)" << std::endl;
+
+    loaded = true;
+    return true;
+}
+
 void CodeExecutionEngine::Init(const CodeExecutionEngine & other)
 {
     runtimeContext = other.runtimeContext;
 
     if ( loaded ) Unload();
-    if ( other.Ready() ) LoadFromDynamicLibrary(other.dynamicLibraryFilename, other.functionName);
+    if ( other.interpreter ) LoadFromBytecode(other.interpreter->GetBytecode(), *other.functionsTable);
+    else if ( other.Ready() ) LoadFromDynamicLibrary(other.dynamicLibraryFilename, other.functionName);
 }
@@ -7,8 +7,12 @@
 #define CODEEXECUTIONENGINE_H
 #include "GDCpp/Runtime/Tools/DynamicLibrariesTools.h"
 #include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+#include <memory>
 #include <vector>
 #include <string>
+class EventsBytecode;
+class EventsFunctionsTable;
 
 /**
  * \brief Wrapper allowing to load a dynamic library and launch a specific function.
@@ -19,6 +23,8 @@
 void functionName(RuntimeContext *);
  \endcode
  *
+ * Events lowered to bytecode can also be run by the engine, without being compiled ( see LoadFromBytecode ).
+ *
  * \TODO: This class is unecessarily complicated.
  * \see CodeCompilationHelpers
  * \see CodeCompiler
@@ -53,7 +59,13 @@ public:
     /**
      * Execute the loaded function.
      */
-    void Execute() { if (Ready()) ((functionType)function)(&runtimeContext); };
+    void Execute()
+    {
+        if (!Ready()) return;
+
+        if (interpreter) interpreter->Execute(runtimeContext);
+        else ((functionType)function)(&runtimeContext);
+    };
 
     /**
      * Return true if an initialization from a dynamic library has been made successfully and if Execute can be called.
@@ -79,6 +91,19 @@ public:
 
     bool LoadFunction(functionType fn);
 
+    /**
+     * Initialize the engine so that Execute() runs the events lowered to \a bytecode, using the functions of \a table.
+     *
+     * \return true if all the functions called by the bytecode were found in the table and Execute() can be called.
+     * \see EventsBytecodeGenerator
+     */
+    bool LoadFromBytecode(std::shared_ptr<const EventsBytecode> bytecode, const EventsFunctionsTable & table);
+
+    /**
+     * Return true if the engine runs events lowered to bytecode.
+     */
+    bool IsRunningBytecode() const { return interpreter != nullptr; };
+
     RuntimeContext runtimeContext; ///< The object passed as parameter to the function of the dynamic library.
 
 private:
@@ -88,6 +113,8 @@ private:
     Handle dynamicLibrary; ///< The dynamic library loaded in memory.
     gd::String functionName; ///< The name of the function of the dynamic library to be executed.
     void * function; ///< Pointer to function to be executed.
+    std::unique_ptr<EventsBytecodeInterpreter> interpreter; ///< The interpreter of the bytecode, if the engine runs bytecode.
+    const EventsFunctionsTable * functionsTable; ///< The table of the functions called by the bytecode.
 
     void Init(const CodeExecutionEngine & other);
 };
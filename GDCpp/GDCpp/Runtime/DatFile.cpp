@@ -211,6 +211,32 @@ char* DatFile::GetFile (gd::String filename)
     return (NULL);
 }
 
+bool DatFile::ReadFile (const gd::String & filename, std::vector<char> & buffer) const
+{
+    for (std::size_t i=0; i<m_header.nb_files && i<m_entries.size();i++)
+    {
+        if (gd::String(m_entries[i].name) == filename)
+        {
+            //Each call opens its own stream, so that files can be read concurrently.
+            gd::FileStream datfile;
+            datfile.open (m_datfile, std::ios_base::in | std::ios_base::binary);
+            if (!datfile.is_open())
+            {
+                cout << "Unable to open file " << m_datfile << " when loading " << filename << endl;
+                return false;
+            }
+
+            buffer.resize(m_entries[i].size);
+            datfile.seekg (m_entries[i].offset, std::ios::beg);
+            datfile.read (buffer.data(), m_entries[i].size);
+            datfile.close();
+            return true;
+        }
+    }
+
+    return false;
+}
+
 long int DatFile::GetFileSize (gd::String filename)
 {
     //First, we have to find the file needed
@@ -56,6 +56,15 @@ public :
     bool ContainsFile(const gd::String & filename);
     bool Read (gd::String source);
     char* GetFile (gd::String filename);
+
+    /**
+     * \brief Read a file of the DAT file into \a buffer.
+     *
+     * Contrary to GetFile, the internal buffer is not used so that this method
+     * can be called from several threads at the same time.
+     * \return true if the file was found and read.
+     */
+    bool ReadFile (const gd::String & filename, std::vector<char> & buffer) const;
     long int GetFileSize (gd::String filename);
 };
 
@@ -0,0 +1,192 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef EVENTSBYTECODE_H
+#define EVENTSBYTECODE_H
+#include <utility>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+
+/**
+ * \brief Events lowered to a register based bytecode, run by EventsBytecodeInterpreter.
+ *
+ * The bytecode is a list of instructions with up to three operands, working on registers:
+ * numbers ( also used for booleans ), strings, objects lists, objects and variables.
+ * Instructions needing more operands ( calls to the functions of the extensions, declarations
+ * of objects lists, groups of objects, paths to variables and loops ) refer to descriptors
+ * stored in the bytecode.
+ *
+ * Constants have their own registers, which are never written by instructions: their values
+ * are stored once in their registers when the bytecode is loaded.
+ *
+ * \see EventsBytecodeGenerator
+ * \see EventsBytecodeInterpreter
+ * \ingroup CodeExecutionEngine
+ */
+class GD_API EventsBytecode
+{
+public:
+    EventsBytecode() :
+        numbersCount(0),
+        stringsCount(0),
+        listsCount(0),
+        objectsCount(0),
+        variablesCount(0),
+        triggerOnceCount(0)
+    {};
+    virtual ~EventsBytecode() {};
+
+    static const unsigned int NoRegister = static_cast<unsigned int>(-1);
+
+    enum Opcode
+    {
+        Return,                     ///< Stop the execution.
+        Jump,                       ///< Go to the instruction \a a.
+        JumpIfFalse,                ///< Go to the instruction \a b if the number \a a is 0.
+        JumpIfTrue,                 ///< Go to the instruction \a b if the number \a a is not 0.
+        Move,                       ///< Number \a a = number \a b.
+        Add,                        ///< Number \a a = \a b + \a c.
+        Subtract,                   ///< Number \a a = \a b - \a c.
+        Multiply,                   ///< Number \a a = \a b * \a c.
+        Divide,                     ///< Number \a a = \a b / \a c.
+        Modulo,                     ///< Number \a a = \a b modulo \a c.
+        Negate,                     ///< Number \a a = - \a b.
+        Truncate,                   ///< Number \a a = integral part of \a b.
+        Less,                       ///< Number \a a = 1 if \a b < \a c, 0 otherwise.
+        LessOrEqual,                ///< Number \a a = 1 if \a b <= \a c, 0 otherwise.
+        Equal,                      ///< Number \a a = 1 if \a b == \a c, 0 otherwise.
+        NotEqual,                   ///< Number \a a = 1 if \a b != \a c, 0 otherwise.
+        Increment,                  ///< Add 1 to number \a a.
+        Concatenate,                ///< String \a a = string \a b + string \a c.
+        DeclareLists,               ///< Fill the objects lists of the scope \a a.
+        Call,                       ///< Call the function \a a.
+        CallForObject,              ///< Call the function \a a for object \a b ( or set the default result if there is no object ).
+        ObjectsLoop,                ///< Start the loop \a a over an objects list, or go to the instruction \a b if the list is empty.
+        ObjectsLoopNext,            ///< Go on with the next object of the loop \a a, at instruction \a b.
+        PickObject,                 ///< Object \a a = first object of the group \a b ( of its last non empty list if \a c is 1 ).
+        ResolveVariable,            ///< Variable \a a = variable designated by the path \a b.
+        MergeList,                  ///< Add to the list \a a the objects of the list \a b which are not already in it.
+        MoveList,                   ///< List \a a = list \a b, and clear the list \a b.
+        ForEach,                    ///< Start the loop \a a over all objects of a group, or go to the instruction \a b if there is none.
+        ForEachNext,                ///< Go on with the next object of the loop \a a, at instruction \a b.
+        TriggerOnce,                ///< Number \a a = result of the "Trigger once" condition \a b.
+        TriggerOnceForEachObject,   ///< Number \a a = result of the "Trigger once for each object" condition \a c for the group \a b.
+        InfiniteLoopWarning         ///< Count the iterations of a loop in number \a a, and go to the instruction \a b if the user stops the loop.
+    };
+
+    struct Instruction
+    {
+        Instruction(Opcode opcode_, unsigned int a_ = 0, unsigned int b_ = 0, unsigned int c_ = 0) :
+            opcode(opcode_), a(a_), b(b_), c(c_) {};
+
+        Opcode opcode;
+        unsigned int a;
+        unsigned int b;
+        unsigned int c;
+    };
+
+    /**
+     * \brief A call to a function of the EventsFunctionsTable.
+     */
+    struct FunctionCall
+    {
+        enum ResultType { NoResult, ConditionResult, NumberResult, StringResult };
+
+        FunctionCall() : resultType(NoResult), result(NoRegister), inverted(false) {};
+
+        gd::String function; ///< The key of the function in the EventsFunctionsTable.
+        std::vector<unsigned int> arguments; ///< The registers of the arguments.
+        ResultType resultType;
+        unsigned int result; ///< The register of the result.
+        bool inverted; ///< True to invert the result of a condition.
+    };
+
+    /**
+     * \brief The declaration of an objects list at the start of a scope.
+     */
+    struct ListDeclaration
+    {
+        enum Type { AllObjects, CopyOfList, EmptyList };
+
+        ListDeclaration(Type type_, unsigned int list_, unsigned int source_ = NoRegister) :
+            type(type_), list(list_), source(source_) {};
+
+        Type type;
+        unsigned int list;
+        unsigned int source; ///< The string register of the name of the objects ( AllObjects ), or the list to be copied ( CopyOfList ).
+    };
+
+    /**
+     * \brief The objects lists of a group of objects, with their names.
+     */
+    struct ObjectsGroup
+    {
+        std::vector< std::pair<gd::String, unsigned int> > lists;
+    };
+
+    /**
+     * \brief A path to a variable, like `Variable.Child[Expression]`.
+     */
+    struct VariablePath
+    {
+        enum Root { SceneVariables, GameVariables, ObjectVariables };
+
+        VariablePath() : root(SceneVariables), object(NoRegister), useIndex(false), index(0), name(NoRegister) {};
+
+        Root root;
+        unsigned int object; ///< The register of the object owning the variable, or NoRegister if there is none.
+        bool useIndex; ///< True if the variable is declared and is accessed with its index.
+        std::size_t index;
+        unsigned int name; ///< The string register of the name of the variable, if not accessed with its index.
+        std::vector<unsigned int> children; ///< The string registers of the names of the children.
+    };
+
+    /**
+     * \brief A loop over the objects of a list, running conditions or actions on each object.
+     */
+    struct ObjectsLoopDescriptor
+    {
+        ObjectsLoopDescriptor() : list(NoRegister), object(NoRegister), filterResult(NoRegister), conditionResult(NoRegister) {};
+
+        unsigned int list;
+        unsigned int object; ///< The register set to each object of the list.
+        unsigned int filterResult; ///< If set, the objects for which this number is 0 are removed from the list.
+        unsigned int conditionResult; ///< If set, this number is set to 1 when an object is kept in the list.
+    };
+
+    /**
+     * \brief A "For each object" loop.
+     */
+    struct ForEachDescriptor
+    {
+        ForEachDescriptor() : objects(NoRegister) {};
+
+        std::vector<unsigned int> sources; ///< The lists of the objects to be iterated.
+        std::vector<unsigned int> targets; ///< For each source, the list containing only the current object.
+        unsigned int objects; ///< The list storing all the iterated objects.
+    };
+
+    gd::String name; ///< The name of the code, used to reserve the indices of "Trigger once" conditions.
+
+    std::vector<Instruction> instructions;
+    std::vector<FunctionCall> calls;
+    std::vector< std::vector<ListDeclaration> > scopes;
+    std::vector<ObjectsGroup> groups;
+    std::vector<VariablePath> variables;
+    std::vector<ObjectsLoopDescriptor> objectsLoops;
+    std::vector<ForEachDescriptor> forEachLoops;
+
+    std::vector< std::pair<unsigned int, double> > numberConstants; ///< The value of the constant registers.
+    std::vector< std::pair<unsigned int, gd::String> > stringConstants; ///< The value of the constant registers.
+
+    unsigned int numbersCount;
+    unsigned int stringsCount;
+    unsigned int listsCount;
+    unsigned int objectsCount;
+    unsigned int variablesCount;
+    std::size_t triggerOnceCount; ///< The number of "Trigger once" conditions.
+};
+
+#endif // EVENTSBYTECODE_H
@@ -0,0 +1,331 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCpp/Runtime/TriggerOnceConditions.h"
+#include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
+#include "GDCore/Project/Variable.h"
+
+EventsBytecodeInterpreter::EventsBytecodeInterpreter(std::shared_ptr<const EventsBytecode> bytecode_, const EventsFunctionsTable & table) :
+    bytecode(bytecode_),
+    functionsLibrary(table.GetDynamicLibrary()),
+    firstTriggerOnceIndex(0),
+    numbers(bytecode_->numbersCount, 0),
+    strings(bytecode_->stringsCount),
+    lists(bytecode_->listsCount),
+    objects(bytecode_->objectsCount, NULL),
+    variables(bytecode_->variablesCount, &RuntimeVariablesContainer::GetBadVariable()),
+    objectsLoopsPositions(bytecode_->objectsLoops.size(), 0),
+    forEachPositions(bytecode_->forEachLoops.size(), 0),
+    forEachCounts(bytecode_->forEachLoops.size())
+{
+    for (auto & constant : bytecode->numberConstants)
+        numbers[constant.first] = constant.second;
+    for (auto & constant : bytecode->stringConstants)
+        strings[constant.first] = constant.second;
+
+    for (auto & call : bytecode->calls)
+    {
+        functions.push_back(table.GetFunction(call.function));
+        if ( functions.back() == NULL && missingFunction.empty() )
+        {
+            std::cout << "ERROR: The function " << call.function << " is missing from the events functions table." << std::endl;
+            missingFunction = call.function;
+        }
+    }
+
+    if ( bytecode->triggerOnceCount != 0 )
+        firstTriggerOnceIndex = TriggerOnceConditions::ReserveIndices(bytecode->name, bytecode->triggerOnceCount);
+}
+
+bool EventsBytecodeInterpreter::CanRun(const EventsBytecode & bytecode, const EventsFunctionsTable & table)
+{
+    for (auto & call : bytecode.calls)
+    {
+        if ( table.GetFunction(call.function) == NULL )
+            return false;
+    }
+
+    return true;
+}
+
+void EventsBytecodeInterpreter::Execute(RuntimeContext & runtimeContext)
+{
+    runtimeContext.StartNewFrame();
+
+    const std::vector<EventsBytecode::Instruction> & instructions = bytecode->instructions;
+    std::size_t position = 0;
+    while ( position < instructions.size() )
+    {
+        const EventsBytecode::Instruction & instruction = instructions[position++];
+        switch ( instruction.opcode )
+        {
+            case EventsBytecode::Return:
+                return;
+            case EventsBytecode::Jump:
+                position = instruction.a;
+                break;
+            case EventsBytecode::JumpIfFalse:
+                if ( numbers[instruction.a] == 0 ) position = instruction.b;
+                break;
+            case EventsBytecode::JumpIfTrue:
+                if ( numbers[instruction.a] != 0 ) position = instruction.b;
+                break;
+            case EventsBytecode::Move:
+                numbers[instruction.a] = numbers[instruction.b];
+                break;
+            case EventsBytecode::Add:
+                numbers[instruction.a] = numbers[instruction.b] + numbers[instruction.c];
+                break;
+            case EventsBytecode::Subtract:
+                numbers[instruction.a] = numbers[instruction.b] - numbers[instruction.c];
+                break;
+            case EventsBytecode::Multiply:
+                numbers[instruction.a] = numbers[instruction.b] * numbers[instruction.c];
+                break;
+            case EventsBytecode::Divide:
+                numbers[instruction.a] = numbers[instruction.b] / numbers[instruction.c];
+                break;
+            case EventsBytecode::Modulo:
+                numbers[instruction.a] = std::fmod(numbers[instruction.b], numbers[instruction.c]);
+                break;
+            case EventsBytecode::Negate:
+                numbers[instruction.a] = -numbers[instruction.b];
+                break;
+            case EventsBytecode::Truncate:
+                numbers[instruction.a] = std::trunc(numbers[instruction.b]);
+                break;
+            case EventsBytecode::Less:
+                numbers[instruction.a] = numbers[instruction.b] < numbers[instruction.c] ? 1 : 0;
+                break;
+            case EventsBytecode::LessOrEqual:
+                numbers[instruction.a] = numbers[instruction.b] <= numbers[instruction.c] ? 1 : 0;
+                break;
+            case EventsBytecode::Equal:
+                numbers[instruction.a] = numbers[instruction.b] == numbers[instruction.c] ? 1 : 0;
+                break;
+            case EventsBytecode::NotEqual:
+                numbers[instruction.a] = numbers[instruction.b] != numbers[instruction.c] ? 1 : 0;
+                break;
+            case EventsBytecode::Increment:
+                numbers[instruction.a] += 1;
+                break;
+            case EventsBytecode::Concatenate:
+                strings[instruction.a] = strings[instruction.b] + strings[instruction.c];
+                break;
+            case EventsBytecode::DeclareLists:
+            {
+                for (auto & declaration : bytecode->scopes[instruction.a])
+                {
+                    std::vector<RuntimeObject*> & list = lists[declaration.list];
+                    if ( declaration.type == EventsBytecode::ListDeclaration::AllObjects )
+                        list = runtimeContext.GetObjectsRawPointers(strings[declaration.source]);
+                    else if ( declaration.type == EventsBytecode::ListDeclaration::CopyOfList )
+                        list = lists[declaration.source];
+                    else
+                        list.clear();
+                }
+                break;
+            }
+            case EventsBytecode::Call:
+                CallFunction(instruction.a, runtimeContext, NULL);
+                break;
+            case EventsBytecode::CallForObject:
+            {
+                RuntimeObject * object = objects[instruction.b];
+                if ( object )
+                    CallFunction(instruction.a, runtimeContext, object);
+                else
+                {
+                    //Like the generated code, use a default value if there is no object.
+                    const EventsBytecode::FunctionCall & call = bytecode->calls[instruction.a];
+                    if ( call.resultType == EventsBytecode::FunctionCall::StringResult )
+                        strings[call.result].clear();
+                    else if ( call.resultType != EventsBytecode::FunctionCall::NoResult )
+                        numbers[call.result] = 0;
+                }
+                break;
+            }
+            case EventsBytecode::ObjectsLoop:
+            {
+                const EventsBytecode::ObjectsLoopDescriptor & loop = bytecode->objectsLoops[instruction.a];
+                const std::vector<RuntimeObject*> & list = lists[loop.list];
+                if ( list.empty() )
+                    position = instruction.b;
+                else
+                {
+                    objectsLoopsPositions[instruction.a] = 0;
+                    objects[loop.object] = list[0];
+                }
+                break;
+            }
+            case EventsBytecode::ObjectsLoopNext:
+            {
+                const EventsBytecode::ObjectsLoopDescriptor & loop = bytecode->objectsLoops[instruction.a];
+                std::vector<RuntimeObject*> & list = lists[loop.list];
+                std::size_t & i = objectsLoopsPositions[instruction.a];
+                if ( loop.filterResult == EventsBytecode::NoRegister || numbers[loop.filterResult] != 0 )
+                {
+                    if ( loop.conditionResult != EventsBytecode::NoRegister ) numbers[loop.conditionResult] = 1;
+                    ++i;
+                }
+                else
+                    list.erase(list.begin()+i);
+
+                if ( i < list.size() )
+                {
+                    objects[loop.object] = list[i];
+                    position = instruction.b;
+                }
+                break;
+            }
+            case EventsBytecode::PickObject:
+            {
+                const EventsBytecode::ObjectsGroup & group = bytecode->groups[instruction.b];
+                RuntimeObject * object = NULL;
+                for (auto & list : group.lists)
+                {
+                    if ( lists[list.second].empty() ) continue;
+
+                    object = lists[list.second][0];
+                    if ( instruction.c == 0 ) break;
+                }
+                objects[instruction.a] = object;
+                break;
+            }
+            case EventsBytecode::ResolveVariable:
+            {
+                const EventsBytecode::VariablePath & path = bytecode->variables[instruction.b];
+                RuntimeVariablesContainer * container = &RuntimeVariablesContainer::GetBadVariablesContainer();
+                if ( path.root == EventsBytecode::VariablePath::SceneVariables )
+                    container = &runtimeContext.GetSceneVariables();
+                else if ( path.root == EventsBytecode::VariablePath::GameVariables )
+                    container = &runtimeContext.GetGameVariables();
+                else if ( path.object != EventsBytecode::NoRegister && objects[path.object] )
+                    container = &objects[path.object]->GetVariables();
+
+                gd::Variable * variable = path.useIndex ? &container->Get(path.index) : &container->Get(strings[path.name]);
+                for (auto child : path.children)
+                    variable = &variable->GetChild(strings[child]);
+
+                variables[instruction.a] = variable;
+                break;
+            }
+            case EventsBytecode::MergeList:
+            {
+                std::vector<RuntimeObject*> & list = lists[instruction.a];
+                for (auto object : lists[instruction.b])
+                {
+                    if ( std::find(list.begin(), list.end(), object) == list.end() )
+                        list.push_back(object);
+                }
+                break;
+            }
+            case EventsBytecode::MoveList:
+                lists[instruction.a].swap(lists[instruction.b]);
+                lists[instruction.b].clear();
+                break;
+            case EventsBytecode::ForEach:
+            {
+                const EventsBytecode::ForEachDescriptor & loop = bytecode->forEachLoops[instruction.a];
+                std::vector<RuntimeObject*> & forEachObjects = lists[loop.objects];
+                std::vector<std::size_t> & counts = forEachCounts[instruction.a];
+
+                forEachObjects.clear();
+                counts.clear();
+                for (auto source : loop.sources)
+                {
+                    forEachObjects.insert(forEachObjects.end(), lists[source].begin(), lists[source].end());
+                    counts.push_back(forEachObjects.size());
+                }
+
+                forEachPositions[instruction.a] = 0;
+                if ( forEachObjects.empty() )
+                    position = instruction.b;
+                else
+                    SetForEachObject(instruction.a);
+                break;
+            }
+            case EventsBytecode::ForEachNext:
+            {
+                std::size_t & i = forEachPositions[instruction.a];
+                ++i;
+                if ( i < lists[bytecode->forEachLoops[instruction.a].objects].size() )
+                {
+                    SetForEachObject(instruction.a);
+                    position = instruction.b;
+                }
+                break;
+            }
+            case EventsBytecode::TriggerOnce:
+                numbers[instruction.a] = runtimeContext.TriggerOnce(firstTriggerOnceIndex+instruction.b) ? 1 : 0;
+                break;
+            case EventsBytecode::TriggerOnceForEachObject:
+                numbers[instruction.a] = runtimeContext.TriggerOnceForEachObject(GetObjectsLists(instruction.b),
+                    firstTriggerOnceIndex+instruction.c) ? 1 : 0;
+                break;
+            case EventsBytecode::InfiniteLoopWarning:
+                #if defined(GD_IDE_ONLY)
+                if ( numbers[instruction.a] == 100000 && WarnAboutInfiniteLoop(*runtimeContext.scene) )
+                {
+                    position = instruction.b;
+                    break;
+                }
+                #endif
+                numbers[instruction.a] += 1;
+                break;
+        }
+    }
+}
+
+void EventsBytecodeInterpreter::CallFunction(std::size_t callIndex, RuntimeContext & runtimeContext, RuntimeObject * object)
+{
+    const EventsBytecode::FunctionCall & descriptor = bytecode->calls[callIndex];
+
+    EventsFunctionCall call(*this, &runtimeContext, descriptor.arguments, object);
+    functions[callIndex](call);
+
+    if ( descriptor.resultType == EventsBytecode::FunctionCall::ConditionResult )
+        numbers[descriptor.result] = (call.conditionResult != descriptor.inverted) ? 1 : 0;
+    else if ( descriptor.resultType == EventsBytecode::FunctionCall::NumberResult )
+        numbers[descriptor.result] = call.numberResult;
+    else if ( descriptor.resultType == EventsBytecode::FunctionCall::StringResult )
+        strings[descriptor.result] = call.stringResult;
+}
+
+void EventsBytecodeInterpreter::SetForEachObject(std::size_t loopIndex)
+{
+    const EventsBytecode::ForEachDescriptor & loop = bytecode->forEachLoops[loopIndex];
+    std::size_t i = forEachPositions[loopIndex];
+    const std::vector<std::size_t> & counts = forEachCounts[loopIndex];
+
+    //Keep only the current object in the list it comes from.
+    for (auto target : loop.targets)
+        lists[target].clear();
+
+    for (std::size_t j = 0;j<loop.targets.size();++j)
+    {
+        if ( i < counts[j] )
+        {
+            lists[loop.targets[j]].push_back(lists[loop.objects][i]);
+            break;
+        }
+    }
+}
+
+std::map <gd::String, std::vector<RuntimeObject*> *> EventsBytecodeInterpreter::GetObjectsLists(std::size_t groupIndex)
+{
+    std::map <gd::String, std::vector<RuntimeObject*> *> objectsLists;
+    for (auto & list : bytecode->groups[groupIndex].lists)
+        objectsLists[list.first] = &lists[list.second];
+
+    return objectsLists;
+}
@@ -0,0 +1,90 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef EVENTSBYTECODEINTERPRETER_H
+#define EVENTSBYTECODEINTERPRETER_H
+#include <memory>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/EventsBytecode.h"
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
+class RuntimeContext;
+class RuntimeObject;
+namespace gd { class Variable; }
+
+/**
+ * \brief Run events lowered to EventsBytecode, calling the functions of an EventsFunctionsTable.
+ *
+ * The interpreter gives the same results as the code generated from the events, so that events
+ * can be previewed without being compiled. The registers are kept between frames: no memory
+ * is allocated by the interpreter once the events were run once.
+ *
+ * \see CodeExecutionEngine::LoadFromBytecode
+ * \ingroup CodeExecutionEngine
+ */
+class GD_API EventsBytecodeInterpreter
+{
+    friend class EventsFunctionCall;
+public:
+    /**
+     * \brief Prepare the interpreter to run \a bytecode.
+     *
+     * The functions called by the bytecode are searched in \a table: if one of them is missing,
+     * IsValid() returns false and GetMissingFunction() returns its key. The dynamic library of the
+     * table stays loaded as long as the interpreter exists, even if the table is cleared or reloaded.
+     */
+    EventsBytecodeInterpreter(std::shared_ptr<const EventsBytecode> bytecode, const EventsFunctionsTable & table);
+    virtual ~EventsBytecodeInterpreter() {};
+
+    /**
+     * \brief Return true if all the functions called by the bytecode were found.
+     */
+    bool IsValid() const { return missingFunction.empty(); }
+
+    /**
+     * \brief Return the key of a function called by the bytecode but missing from the table.
+     */
+    const gd::String & GetMissingFunction() const { return missingFunction; }
+
+    /**
+     * \brief Return true if all the functions called by \a bytecode are in \a table.
+     *
+     * Unlike creating an interpreter, this has no side effect: in particular, no indices
+     * are reserved for the "Trigger once" conditions.
+     */
+    static bool CanRun(const EventsBytecode & bytecode, const EventsFunctionsTable & table);
+
+    /**
+     * \brief Return the bytecode run by the interpreter.
+     */
+    std::shared_ptr<const EventsBytecode> GetBytecode() const { return bytecode; }
+
+    /**
+     * \brief Run the events for a frame.
+     */
+    void Execute(RuntimeContext & runtimeContext);
+
+private:
+    void CallFunction(std::size_t callIndex, RuntimeContext & runtimeContext, RuntimeObject * object);
+    void SetForEachObject(std::size_t loopIndex);
+    std::map <gd::String, std::vector<RuntimeObject*> *> GetObjectsLists(std::size_t groupIndex);
+
+    std::shared_ptr<const EventsBytecode> bytecode;
+    std::vector<EventsFunction> functions; ///< For each call of the bytecode, the function to be called.
+    std::shared_ptr<const void> functionsLibrary; ///< Keep the dynamic library of the functions loaded while the interpreter exists.
+    gd::String missingFunction;
+    std::size_t firstTriggerOnceIndex; ///< The first index reserved for the "Trigger once" conditions.
+
+    std::vector<double> numbers;
+    std::vector<gd::String> strings;
+    std::vector< std::vector<RuntimeObject*> > lists;
+    std::vector<RuntimeObject*> objects;
+    std::vector<gd::Variable*> variables;
+    std::vector<std::size_t> objectsLoopsPositions; ///< For each objects loop, the position of the current object.
+    std::vector<std::size_t> forEachPositions; ///< For each "For each object" loop, the position of the current object.
+    std::vector< std::vector<std::size_t> > forEachCounts; ///< For each "For each object" loop, the number of objects of each list.
+};
+
+#endif // EVENTSBYTECODEINTERPRETER_H
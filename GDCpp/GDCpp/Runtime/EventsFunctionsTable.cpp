@@ -0,0 +1,83 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include <iostream>
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+
+double EventsFunctionCall::GetNumber(std::size_t index) const
+{
+    return interpreter.numbers[arguments[index]];
+}
+
+const gd::String & EventsFunctionCall::GetString(std::size_t index) const
+{
+    return interpreter.strings[arguments[index]];
+}
+
+gd::Variable & EventsFunctionCall::GetVariable(std::size_t index) const
+{
+    return *interpreter.variables[arguments[index]];
+}
+
+RuntimeObject * EventsFunctionCall::GetObject(std::size_t index) const
+{
+    return interpreter.objects[arguments[index]];
+}
+
+std::map <gd::String, std::vector<RuntimeObject*> *> EventsFunctionCall::GetObjectsLists(std::size_t index) const
+{
+    return interpreter.GetObjectsLists(arguments[index]);
+}
+
+EventsFunctionsTable::~EventsFunctionsTable()
+{
+    Clear();
+}
+
+EventsFunctionsTable & EventsFunctionsTable::Get()
+{
+    static EventsFunctionsTable table;
+    return table;
+}
+
+EventsFunction EventsFunctionsTable::GetFunction(const gd::String & key) const
+{
+    auto it = functions.find(key);
+    return it != functions.end() ? it->second : NULL;
+}
+
+void EventsFunctionsTable::Clear()
+{
+    functions.clear();
+    dynamicLibrary.reset();
+}
+
+bool EventsFunctionsTable::LoadFromDynamicLibrary(const gd::String & filename)
+{
+    Handle library = gd::OpenLibrary(filename.ToLocale().c_str());
+    if ( library == NULL )
+    {
+        std::cout << "ERROR: Unable to load " << filename << std::endl;
+        std::cout << "Full error message: " << gd::DynamicLibraryLastError() << std::endl;
+        return false;
+    }
+
+    typedef void (*RegisterFunctionsType)(EventsFunctionsTable &);
+    RegisterFunctionsType registerFunctions = reinterpret_cast<RegisterFunctionsType>(gd::GetSymbol(library, "GDRegisterEventsFunctions"));
+    if ( registerFunctions == NULL )
+    {
+        std::cout << "ERROR: Unable to find GDRegisterEventsFunctions in " << filename << std::endl;
+        gd::CloseLibrary(library);
+        return false;
+    }
+
+    Clear();
+    dynamicLibrary = std::shared_ptr<void>(library, [](Handle handle) { gd::CloseLibrary(handle); });
+    registerFunctions(*this);
+
+    std::cout << "Loaded " << functions.size() << " events functions from " << filename << std::endl;
+    return true;
+}
@@ -0,0 +1,170 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef EVENTSFUNCTIONSTABLE_H
+#define EVENTSFUNCTIONSTABLE_H
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/Tools/DynamicLibrariesTools.h"
+class RuntimeContext;
+class RuntimeObject;
+class EventsBytecodeInterpreter;
+namespace gd { class Variable; }
+
+/**
+ * \brief The arguments and the result of a call, made by the events bytecode interpreter,
+ * to a function of the EventsFunctionsTable.
+ *
+ * The functions of the table are thin wrappers generated from the metadata of the extensions
+ * ( see EventsFunctionsTableCodeGenerator ): they read their arguments with the accessors of
+ * this class and call the same runtime functions as the code generated from events.
+ *
+ * \see EventsBytecodeInterpreter
+ * \ingroup CodeExecutionEngine
+ */
+class GD_API EventsFunctionCall
+{
+public:
+    EventsFunctionCall(EventsBytecodeInterpreter & interpreter_, RuntimeContext * runtimeContext_,
+        const std::vector<unsigned int> & arguments_, RuntimeObject * object_) :
+        runtimeContext(runtimeContext_),
+        object(object_),
+        conditionResult(false),
+        numberResult(0),
+        interpreter(interpreter_),
+        arguments(arguments_)
+    {};
+
+    /**
+     * \brief Return the argument \a index, which is a number.
+     */
+    double GetNumber(std::size_t index) const;
+
+    /**
+     * \brief Return the argument \a index, which is an integer ( a key or a mouse button for example ).
+     */
+    int GetInteger(std::size_t index) const { return static_cast<int>(GetNumber(index)); }
+
+    /**
+     * \brief Return the argument \a index, which is a boolean.
+     */
+    bool GetBoolean(std::size_t index) const { return GetNumber(index) != 0; }
+
+    /**
+     * \brief Return the argument \a index, which is a string.
+     */
+    const gd::String & GetString(std::size_t index) const;
+
+    /**
+     * \brief Return the argument \a index, which is a variable.
+     */
+    gd::Variable & GetVariable(std::size_t index) const;
+
+    /**
+     * \brief Return the argument \a index, which is an object ( or NULL if no object was picked ).
+     */
+    RuntimeObject * GetObject(std::size_t index) const;
+
+    /**
+     * \brief Return the argument \a index, which is a map of the objects lists of a group of objects.
+     */
+    std::map <gd::String, std::vector<RuntimeObject*> *> GetObjectsLists(std::size_t index) const;
+
+    void SetConditionResult(bool result) { conditionResult = result; }
+    void SetNumberResult(double result) { numberResult = result; }
+    void SetStringResult(const gd::String & result) { stringResult = result; }
+
+    RuntimeContext * runtimeContext; ///< The context of the scene.
+    RuntimeObject * object; ///< The object of the call, for the functions of objects and behaviors.
+
+    bool conditionResult; ///< The result of a condition.
+    double numberResult; ///< The result of an expression.
+    gd::String stringResult; ///< The result of a string expression.
+
+private:
+    EventsBytecodeInterpreter & interpreter;
+    const std::vector<unsigned int> & arguments; ///< The registers of the arguments.
+};
+
+/**
+ * \brief Function called by the events bytecode interpreter.
+ */
+typedef void (*EventsFunction)(EventsFunctionCall & call);
+
+/**
+ * \brief Associate the conditions, actions and expressions of the extensions to the functions
+ * called by the events bytecode interpreter.
+ *
+ * The table is filled by the function `GDRegisterEventsFunctions`, exported by a dynamic library
+ * compiled once from the code generated by EventsFunctionsTableCodeGenerator. The library
+ * only depends on the extensions and not on the events: it is not compiled again when events
+ * are modified.
+ *
+ * \see EventsBytecodeInterpreter
+ * \ingroup CodeExecutionEngine
+ */
+class GD_API EventsFunctionsTable
+{
+public:
+    EventsFunctionsTable() {};
+    virtual ~EventsFunctionsTable();
+
+    /**
+     * \brief Return the table used by the previews.
+     */
+    static EventsFunctionsTable & Get();
+
+    /**
+     * \brief Add a function to the table.
+     * \param key The key of the function ( see EventsFunctionsTableCodeGenerator ).
+     */
+    void Add(const gd::String & key, EventsFunction function) { functions[key] = function; }
+
+    /**
+     * \brief Return the function associated to \a key, or NULL if there is none.
+     */
+    EventsFunction GetFunction(const gd::String & key) const;
+
+    /**
+     * \brief Return true if the table has no functions.
+     */
+    bool IsEmpty() const { return functions.empty(); }
+
+    /**
+     * \brief Remove all the functions.
+     *
+     * The dynamic library registering them is unloaded once no interpreter uses it anymore.
+     */
+    void Clear();
+
+    /**
+     * \brief Replace the functions by the ones registered by the dynamic library \a filename,
+     * which is kept loaded in memory.
+     *
+     * The interpreters created with the previous functions keep the previous library loaded,
+     * so they can still be run.
+     * \return true if the library was loaded.
+     */
+    bool LoadFromDynamicLibrary(const gd::String & filename);
+
+    /**
+     * \brief Return the dynamic library registering the functions, if any.
+     *
+     * The library stays loaded as long as a copy of the returned pointer is kept.
+     */
+    std::shared_ptr<const void> GetDynamicLibrary() const { return dynamicLibrary; }
+
+private:
+    std::unordered_map<gd::String, EventsFunction> functions;
+    std::shared_ptr<void> dynamicLibrary; ///< The dynamic library registering the functions, if any. Closed when not used anymore.
+
+    EventsFunctionsTable(const EventsFunctionsTable&) = delete;
+    EventsFunctionsTable & operator=(const EventsFunctionsTable&) = delete;
+};
+
+#endif // EVENTSFUNCTIONSTABLE_H
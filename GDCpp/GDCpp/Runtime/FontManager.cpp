@@ -1,5 +1,6 @@
 #include "GDCpp/Runtime/FontManager.h"
 #include <SFML/Graphics.hpp>
+#include <SFML/System/Lock.hpp>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -51,6 +52,8 @@ void FontManager::EnsureDefaultFontIsLoaded()
 
 const sf::Font * FontManager::GetFont(const gd::String & fontName)
 {
+    sf::Lock lock(mutex);
+
     //Use default font if no font is specified
     if (fontName.empty())
     {
@@ -6,6 +6,7 @@
 #ifndef FONTMANAGER_H
 #define FONTMANAGER_H
 #include <SFML/Graphics.hpp>
+#include <SFML/System/Mutex.hpp>
 #include <string>
 #include <vector>
 #include "GDCpp/Runtime/String.h"
@@ -29,6 +30,8 @@ public:
      * \code
      * sfmlText.SetFont(*fontManager->GetFont(fontName));
      * \endcode
+     *
+     * \note Can be called from several threads at once.
      */
     const sf::Font * GetFont(const gd::String & fontName);
 
@@ -62,6 +65,7 @@ private:
     std::map < gd::String, sf::Font* > fonts; ///< The font being loaded.
     std::map < gd::String, gd::StreamHolder* > fontsBuffer; ///< The buffer associated to each font, if any.
     sf::Font * defaultFont; ///< The default font used when no font is specified. Initialized at first use.
+    sf::Mutex mutex; ///< Protect the fonts, which can be loaded by scenes played on different threads.
 
     FontManager() : defaultFont(NULL) {};
     virtual ~FontManager();
@@ -4,6 +4,7 @@
  * This project is released under the MIT License.
  */
 #include "InputManager.h"
+#include <utility>
 
 InputManager::InputManager(sf::Window * win) :
     window(win),
@@ -19,7 +20,7 @@ InputManager::InputManager(sf::Window * win) :
 void InputManager::SimulateMousePressed(sf::Vector2i pos)
 {
     mousePosition = pos;
-    buttonsPressed["Left"] = true;
+    buttonsPressed.set(sf::Mouse::Left);
 }
 
 void InputManager::NextFrame()
@@ -27,21 +28,19 @@ void InputManager::NextFrame()
     keyWasPressed = false;
     charactersEntered.clear();
 
-    oldKeysPressed = keysPressed;
-    keysPressed.clear();
-    const auto & keyMap = GetKeyNameToSfKeyMap();
-    for(auto it = keyMap.begin();it != keyMap.end();++it) {
-        keysPressed[it->first] =
-            sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(it->second));
+    std::swap(oldKeysPressed, keysPressed);
+    keysPressed.reset();
+    for(int key = 0;key < sf::Keyboard::KeyCount;++key) {
+        if (sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(key)))
+            keysPressed.set(key);
     }
 
 	mouseWheelDelta = 0;
-    oldButtonsPressed = buttonsPressed;
-    buttonsPressed.clear();
-    const auto & buttonMap = GetButtonNameToSfButtonMap();
-    for(auto it = buttonMap.begin();it != buttonMap.end();++it) {
-        buttonsPressed[it->first] =
-            sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(it->second));
+    std::swap(oldButtonsPressed, buttonsPressed);
+    buttonsPressed.reset();
+    for(int button = 0;button < sf::Mouse::ButtonCount;++button) {
+        if (sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(button)))
+            buttonsPressed.set(button);
     }
 
     if (window) mousePosition = sf::Mouse::getPosition(*window);
@@ -84,21 +83,37 @@ void InputManager::HandleEvent(sf::Event & event)
 }
 
 bool InputManager::IsKeyPressed(gd::String key) const
+{
+    return IsKeyPressed(GetKeyCode(key));
+}
+
+bool InputManager::IsKeyPressed(int key) const
 {
     if (!windowHasFocus && disableInputWhenNotFocused)
         return false;
 
-    return keysPressed.find(key) != keysPressed.end() &&
-        keysPressed.find(key)->second;
+    return key >= 0 && key < sf::Keyboard::KeyCount && keysPressed[key];
 }
 
 bool InputManager::WasKeyReleased(gd::String key) const
 {
-    return oldKeysPressed.find(key) != oldKeysPressed.end() &&
-        oldKeysPressed.find(key)->second &&
+    return WasKeyReleased(GetKeyCode(key));
+}
+
+bool InputManager::WasKeyReleased(int key) const
+{
+    return key >= 0 && key < sf::Keyboard::KeyCount &&
+        oldKeysPressed[key] &&
         !IsKeyPressed(key);
 }
 
+int InputManager::GetKeyCode(const gd::String & keyName)
+{
+    const auto & keyMap = GetKeyNameToSfKeyMap();
+    auto it = keyMap.find(keyName);
+    return it != keyMap.end() ? it->second : -1;
+}
+
 gd::String InputManager::GetLastPressedKey() const
 {
     const auto & keyMap = GetSfKeyToKeyNameMap();
@@ -115,7 +130,7 @@ bool InputManager::AnyKeyIsPressed() const
     if (!windowHasFocus && disableInputWhenNotFocused)
         return false;
 
-    return keyWasPressed;
+    return keyWasPressed || keysPressed.any();
 }
 
 sf::Vector2i InputManager::GetMousePosition() const
@@ -124,21 +139,37 @@ sf::Vector2i InputManager::GetMousePosition() const
 }
 
 bool InputManager::IsMouseButtonPressed(const gd::String & button) const
+{
+    return IsMouseButtonPressed(GetButtonCode(button));
+}
+
+bool InputManager::IsMouseButtonPressed(int button) const
 {
     if (!windowHasFocus && disableInputWhenNotFocused)
         return false;
 
-    return buttonsPressed.find(button) != buttonsPressed.end() &&
-        buttonsPressed.find(button)->second;
+    return button >= 0 && button < sf::Mouse::ButtonCount && buttonsPressed[button];
 }
 
 bool InputManager::IsMouseButtonReleased(const gd::String & button) const
 {
-    return oldButtonsPressed.find(button) != oldButtonsPressed.end() &&
-        oldButtonsPressed.find(button)->second &&
+    return IsMouseButtonReleased(GetButtonCode(button));
+}
+
+bool InputManager::IsMouseButtonReleased(int button) const
+{
+    return button >= 0 && button < sf::Mouse::ButtonCount &&
+        oldButtonsPressed[button] &&
         !IsMouseButtonPressed(button);
 }
 
+int InputManager::GetButtonCode(const gd::String & buttonName)
+{
+    const auto & buttonMap = GetButtonNameToSfButtonMap();
+    auto it = buttonMap.find(buttonName);
+    return it != buttonMap.end() ? it->second : -1;
+}
+
 int InputManager::GetMouseWheelDelta() const
 {
     if (!windowHasFocus && disableInputWhenNotFocused)
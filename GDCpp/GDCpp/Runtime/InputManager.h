@@ -9,6 +9,7 @@
 #include <map>
 #include <string>
 #include <set>
+#include <bitset>
 #include <SFML/Window.hpp>
 #include "GDCpp/Runtime/String.h"
 
@@ -82,17 +83,34 @@ public:
      */
     bool IsKeyPressed(gd::String key) const;
 
+    /**
+     * \brief Return true if the specified key is pressed.
+     * \param key The SFML code of the key (see sf::Keyboard::Key)
+     */
+    bool IsKeyPressed(int key) const;
+
     /**
      * \brief Return true if the specified key name was just released.
      */
     bool WasKeyReleased(gd::String key) const;
 
     /**
-     * \brief Return true if any key was pressed since the last call
-     * to NextFrame.
+     * \brief Return true if the specified key was just released.
+     * \param key The SFML code of the key (see sf::Keyboard::Key)
+     */
+    bool WasKeyReleased(int key) const;
+
+    /**
+     * \brief Return true if any key is pressed, or was pressed since the
+     * last call to NextFrame.
      */
     bool AnyKeyIsPressed() const;
 
+    /**
+     * \brief Return the SFML code of the key with the specified name, or -1 if the name is unknown.
+     */
+    static int GetKeyCode(const gd::String & keyName);
+
     /**
      * @brief Get the unicode value of the characters entered during the last frame.
      */
@@ -115,11 +133,28 @@ public:
      */
     bool IsMouseButtonPressed(const gd::String & button) const;
 
+    /**
+     * @brief Return true if the specified mouse button is pressed.
+     * \param button The SFML code of the button (see sf::Mouse::Button)
+     */
+    bool IsMouseButtonPressed(int button) const;
+
     /**
      * @brief Return true if the specified mouse button was released in this frame.
      */
     bool IsMouseButtonReleased(const gd::String & button) const;
 
+    /**
+     * @brief Return true if the specified mouse button was released in this frame.
+     * \param button The SFML code of the button (see sf::Mouse::Button)
+     */
+    bool IsMouseButtonReleased(int button) const;
+
+    /**
+     * \brief Return the SFML code of the button with the specified name, or -1 if the name is unknown.
+     */
+    static int GetButtonCode(const gd::String & buttonName);
+
     /**
      * @brief Get the number of ticks the wheel moved during last frame.
      */
@@ -143,14 +178,14 @@ private:
 
     int lastPressedKey; ///< SFML key code of the last pressed key.
     bool keyWasPressed; ///< True if a key was pressed during the last step.
-    std::map<gd::String, bool> keysPressed; ///< The keys pressed for this frame.
-    std::map<gd::String, bool> oldKeysPressed; ///< The keys pressed during the last frame.
+    std::bitset<sf::Keyboard::KeyCount> keysPressed; ///< The keys pressed for this frame, indexed by SFML key code.
+    std::bitset<sf::Keyboard::KeyCount> oldKeysPressed; ///< The keys pressed during the last frame.
     std::vector<sf::Uint32> charactersEntered; ///< The characters entered for this frame.
 
     int mouseWheelDelta;
     sf::Vector2i mousePosition; ///< The mouse position for this frame.
-    std::map<gd::String, bool> buttonsPressed; ///< The buttons pressed for this frame.
-    std::map<gd::String, bool> oldButtonsPressed; ///< The buttons pressed during the last frame.
+    std::bitset<sf::Mouse::ButtonCount> buttonsPressed; ///< The buttons pressed for this frame, indexed by SFML button code.
+    std::bitset<sf::Mouse::ButtonCount> oldButtonsPressed; ///< The buttons pressed during the last frame.
 
     void SimulateMousePressed(sf::Vector2i pos);
     bool touchSimulateMouse;
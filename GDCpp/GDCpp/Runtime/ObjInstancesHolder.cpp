@@ -9,6 +9,10 @@
 
 RuntimeObject * ObjInstancesHolder::AddObject(RuntimeObjSPtr && object)
 {
+    unsigned int & geometryVersion = geometryVersions[object->GetName()];
+    object->geometryVersion = &geometryVersion;
+    ++geometryVersion;
+
     auto it = objectsInstances[object->GetName()].insert(
         objectsInstances[object->GetName()].end(),
         std::move(object));
@@ -24,7 +28,21 @@ RuntimeObject * ObjInstancesHolder::AddObject(RuntimeObjSPtr && object)
     return it->get();
 }
 
-RuntimeObjNonOwningPtrList ObjInstancesHolder::GetObjectsRawPointers(const gd::String & name)
+void ObjInstancesHolder::MarkGeometryChanged(const RuntimeObject * object)
+{
+    if ( object->geometryVersion ) ++(*object->geometryVersion);
+}
+
+void ObjInstancesHolder::Reserve(const gd::String & name, std::size_t count)
+{
+    RuntimeObjList & list = objectsInstances[name];
+    list.reserve(list.size() + count);
+
+    RuntimeObjNonOwningPtrList & refsList = objectsInstancesRefs[name];
+    refsList.reserve(refsList.size() + count);
+}
+
+const RuntimeObjNonOwningPtrList & ObjInstancesHolder::GetObjectsRawPointers(const gd::String & name)
 {
     return objectsInstancesRefs[name];
 }
@@ -63,6 +81,7 @@ void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject * object)
             associatedList.end());
     }
 
+    if ( theObject ) MarkGeometryChanged(theObject.get());
     AddObject(std::move(theObject));
 }
 
@@ -57,6 +57,11 @@ public:
      */
     RuntimeObject * AddObject(RuntimeObjSPtr && object);
 
+    /**
+     * \brief Reserve memory for \a count more objects with the specified name.
+     */
+    void Reserve(const gd::String & name, std::size_t count);
+
     /**
      * \brief Get all objects with the specified name
      */
@@ -67,8 +72,9 @@ public:
 
     /**
      * \brief Get a "raw pointers" list to objects with the specified name
+     * \note The list is updated when objects are added or removed: copy it to keep the current objects.
      */
-    RuntimeObjNonOwningPtrList GetObjectsRawPointers(const gd::String & name);
+    const RuntimeObjNonOwningPtrList & GetObjectsRawPointers(const gd::String & name);
 
     /**
      * \brief Get a list of all objects contained.
@@ -99,6 +105,7 @@ public:
      */
     inline void RemoveObject(RuntimeObject * object)
     {
+        MarkGeometryChanged(object);
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
         if(!debugger.expired())
             debugger.lock()->OnRuntimeObjectAboutToBeRemoved(object);
@@ -140,6 +147,7 @@ public:
 #endif
         objectsInstances[name].clear();
         objectsInstancesRefs[name].clear();
+        ++geometryVersions[name];
     }
 
     /**
@@ -159,8 +167,18 @@ public:
 #endif
         objectsInstances.clear();
         objectsInstancesRefs.clear();
+        for (auto & it : geometryVersions)
+            ++it.second;
     }
 
+    /**
+     * \brief Return a number changed each time an object with the specified name is added, removed,
+     * moved or resized.
+     *
+     * \see RuntimeObject::MarkGeometryChanged
+     */
+    unsigned int GetGeometryVersion(const gd::String & name) { return geometryVersions[name]; }
+
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
     void SetDebugger(std::shared_ptr<BaseDebugger> newDebugger) { debugger = newDebugger; if(newDebugger) newDebugger->OnRuntimeObjectListFullRefresh(); }
 #endif
@@ -168,6 +186,12 @@ public:
 private:
     void Init(const ObjInstancesHolder & other);
 
+    /**
+     * \brief Change the geometry version of the objects having the same name as \a object.
+     */
+    void MarkGeometryChanged(const RuntimeObject * object);
+
+    std::unordered_map<gd::String, unsigned int > geometryVersions; ///< The geometry version of each list (declared first as objects point to them).
     std::unordered_map<gd::String, RuntimeObjList > objectsInstances; ///< The list of all objects, classified by name
     std::unordered_map<gd::String, RuntimeObjNonOwningPtrList > objectsInstancesRefs; ///< Clones of the objectsInstances lists, but with references instead.
 
@@ -0,0 +1,319 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/ObjectsSpatialIndex.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <limits>
+#include <unordered_set>
+
+namespace
+{
+    const std::size_t maxCellsPerEntry = 64; ///< Entries covering more cells are tested for each point query.
+}
+
+ObjectsSpatialIndex::ObjectsSpatialIndex() :
+    cellSize(128),
+    minCellX(0),
+    minCellY(0),
+    maxCellX(-1),
+    maxCellY(-1),
+    minBoundsCellX(0),
+    minBoundsCellY(0),
+    maxBoundsCellX(-1),
+    maxBoundsCellY(-1),
+    version(0),
+    built(false)
+{
+}
+
+int ObjectsSpatialIndex::GetCell(float coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / cellSize));
+}
+
+void ObjectsSpatialIndex::Build(const std::vector<RuntimeObject*> & objects, unsigned int version_)
+{
+    entries.clear();
+    centersCells.clear();
+    boundsCells.clear();
+    largeEntries.clear();
+    version = version_;
+    built = true;
+
+    //Cells are twice as large as the average object, so that most objects cover only a few cells.
+    entries.reserve(objects.size());
+    double totalSize = 0;
+    for (RuntimeObject * object : objects)
+    {
+        Entry entry;
+        entry.object = object;
+        entry.left = object->GetDrawableX();
+        entry.top = object->GetDrawableY();
+        entry.right = entry.left + object->GetWidth();
+        entry.bottom = entry.top + object->GetHeight();
+        entry.centerX = entry.left + object->GetCenterX();
+        entry.centerY = entry.top + object->GetCenterY();
+        entry.radius = std::sqrt(std::max(std::pow(entry.centerX - entry.left, 2), std::pow(entry.right - entry.centerX, 2))
+                                 + std::max(std::pow(entry.centerY - entry.top, 2), std::pow(entry.bottom - entry.centerY, 2)));
+        entries.push_back(entry);
+
+        totalSize += std::max(entry.right - entry.left, entry.bottom - entry.top);
+    }
+    cellSize = entries.empty() ? 128 : std::max(32.0, 2 * totalSize / entries.size());
+
+    minCellX = minCellY = minBoundsCellX = minBoundsCellY = 0;
+    maxCellX = maxCellY = maxBoundsCellX = maxBoundsCellY = -1;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        const Entry & entry = entries[i];
+
+        int cellX = GetCell(entry.centerX);
+        int cellY = GetCell(entry.centerY);
+        centersCells[GetCellKey(cellX, cellY)].push_back(i);
+        if ( i == 0 || cellX < minCellX ) minCellX = cellX;
+        if ( i == 0 || cellY < minCellY ) minCellY = cellY;
+        if ( i == 0 || cellX > maxCellX ) maxCellX = cellX;
+        if ( i == 0 || cellY > maxCellY ) maxCellY = cellY;
+
+        //The cells covered by the object, whatever its angle.
+        int firstCellX = GetCell(entry.centerX - entry.radius), lastCellX = GetCell(entry.centerX + entry.radius);
+        int firstCellY = GetCell(entry.centerY - entry.radius), lastCellY = GetCell(entry.centerY + entry.radius);
+        if ( static_cast<std::size_t>(lastCellX - firstCellX + 1) * (lastCellY - firstCellY + 1) > maxCellsPerEntry )
+        {
+            largeEntries.push_back(i);
+            continue;
+        }
+
+        bool firstBounds = boundsCells.empty();
+        if ( firstBounds || firstCellX < minBoundsCellX ) minBoundsCellX = firstCellX;
+        if ( firstBounds || firstCellY < minBoundsCellY ) minBoundsCellY = firstCellY;
+        if ( firstBounds || lastCellX > maxBoundsCellX ) maxBoundsCellX = lastCellX;
+        if ( firstBounds || lastCellY > maxBoundsCellY ) maxBoundsCellY = lastCellY;
+
+        for (int x = firstCellX; x <= lastCellX; ++x)
+            for (int y = firstCellY; y <= lastCellY; ++y)
+                boundsCells[GetCellKey(x, y)].push_back(i);
+    }
+}
+
+void ObjectsSpatialIndex::GetNearest(float x, float y, std::size_t count, std::vector<RuntimeObject*> & result) const
+{
+    result.clear();
+    if ( entries.empty() || count == 0 ) return;
+
+    //Keep the best entries in a max-heap, ordered by their distance to the position.
+    typedef std::pair<double, std::size_t> Candidate;
+    std::priority_queue<Candidate> best;
+    auto consider = [this, x, y, count, &best](std::size_t index) {
+        double dx = entries[index].centerX - x;
+        double dy = entries[index].centerY - y;
+        double sqDistance = dx*dx + dy*dy;
+        if ( best.size() < count )
+            best.push(Candidate(sqDistance, index));
+        else if ( sqDistance < best.top().first )
+        {
+            best.pop();
+            best.push(Candidate(sqDistance, index));
+        }
+    };
+
+    int cellX = GetCell(x);
+    int cellY = GetCell(y);
+    int maxRing = std::max(std::max(std::abs(cellX - minCellX), std::abs(cellX - maxCellX)),
+                           std::max(std::abs(cellY - minCellY), std::abs(cellY - maxCellY)));
+    std::size_t visitedCells = 0;
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        //When the position is far from the objects, testing all of them is faster than visiting the empty cells.
+        visitedCells += ring == 0 ? 1 : 8*ring;
+        if ( visitedCells > entries.size() + maxCellsPerEntry )
+        {
+            best = std::priority_queue<Candidate>();
+            for (std::size_t index = 0; index < entries.size(); ++index)
+                consider(index);
+            break;
+        }
+
+        //Visit the cells at the border of the square of cells around the position.
+        for (int i = -ring; i <= ring; ++i)
+        {
+            for (int j = -ring; j <= ring; ++j)
+            {
+                if ( std::abs(i) != ring && std::abs(j) != ring ) continue;
+
+                auto cell = centersCells.find(GetCellKey(cellX + i, cellY + j));
+                if ( cell == centersCells.end() ) continue;
+
+                for (std::size_t index : cell->second)
+                    consider(index);
+            }
+        }
+
+        //Cells not visited yet are at least at ring*cellSize from the position.
+        double minDistance = ring * cellSize;
+        if ( best.size() == count && best.top().first <= minDistance*minDistance ) break;
+    }
+
+    std::vector<std::size_t> indices;
+    while ( !best.empty() )
+    {
+        indices.push_back(best.top().second);
+        best.pop();
+    }
+    SortResult(indices, result);
+}
+
+void ObjectsSpatialIndex::GetWithinRadius(float x, float y, float radius, std::vector<RuntimeObject*> & result) const
+{
+    result.clear();
+    if ( entries.empty() || radius < 0 ) return;
+
+    std::vector<std::size_t> indices;
+    double sqRadius = static_cast<double>(radius)*radius;
+    int firstCellX = std::max(GetCell(x - radius), minCellX), lastCellX = std::min(GetCell(x + radius), maxCellX);
+    int firstCellY = std::max(GetCell(y - radius), minCellY), lastCellY = std::min(GetCell(y + radius), maxCellY);
+    if ( firstCellX > lastCellX || firstCellY > lastCellY ) return;
+
+    //For large radiuses, testing all the objects is faster than visiting the cells.
+    if ( static_cast<double>(lastCellX - firstCellX + 1) * (lastCellY - firstCellY + 1) > entries.size() )
+    {
+        for (std::size_t index = 0; index < entries.size(); ++index)
+        {
+            double dx = entries[index].centerX - x;
+            double dy = entries[index].centerY - y;
+            if ( dx*dx + dy*dy <= sqRadius ) indices.push_back(index);
+        }
+
+        SortResult(indices, result);
+        return;
+    }
+
+    for (int cellX = firstCellX; cellX <= lastCellX; ++cellX)
+    {
+        for (int cellY = firstCellY; cellY <= lastCellY; ++cellY)
+        {
+            auto cell = centersCells.find(GetCellKey(cellX, cellY));
+            if ( cell == centersCells.end() ) continue;
+
+            for (std::size_t index : cell->second)
+            {
+                double dx = entries[index].centerX - x;
+                double dy = entries[index].centerY - y;
+                if ( dx*dx + dy*dy <= sqRadius ) indices.push_back(index);
+            }
+        }
+    }
+
+    SortResult(indices, result);
+}
+
+void ObjectsSpatialIndex::GetAtPoint(float x, float y, std::vector<RuntimeObject*> & result) const
+{
+    result.clear();
+
+    std::vector<std::size_t> indices;
+    auto isInside = [this, x, y](std::size_t index) {
+        const Entry & entry = entries[index];
+        return entry.left <= x && x <= entry.right && entry.top <= y && y <= entry.bottom;
+    };
+
+    auto cell = boundsCells.find(GetCellKey(GetCell(x), GetCell(y)));
+    if ( cell != boundsCells.end() )
+    {
+        for (std::size_t index : cell->second)
+            if ( isInside(index) ) indices.push_back(index);
+    }
+    for (std::size_t index : largeEntries)
+        if ( isInside(index) ) indices.push_back(index);
+
+    SortResult(indices, result);
+}
+
+void ObjectsSpatialIndex::GetAlongSegment(float x1, float y1, float x2, float y2, std::vector< std::pair<float, RuntimeObject*> > & result) const
+{
+    result.clear();
+    for (std::size_t index : largeEntries)
+        result.push_back(std::make_pair(0.0f, entries[index].object));
+
+    if ( boundsCells.empty() ) return;
+
+    //Clip the segment to the cells containing objects.
+    double dx = x2 - x1, dy = y2 - y1;
+    double length = std::sqrt(dx*dx + dy*dy);
+    double tMin = 0, tMax = 1;
+    auto clip = [&tMin, &tMax](double start, double delta, double min, double max) {
+        if ( delta == 0 ) return start >= min && start <= max;
+
+        double t1 = (min - start) / delta, t2 = (max - start) / delta;
+        if ( t1 > t2 ) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        return tMin <= tMax;
+    };
+    if ( !clip(x1, dx, minBoundsCellX*cellSize, (maxBoundsCellX + 1)*cellSize) ||
+         !clip(y1, dy, minBoundsCellY*cellSize, (maxBoundsCellY + 1)*cellSize) )
+        return;
+
+    int cellX = std::max(minBoundsCellX, std::min(maxBoundsCellX, GetCell(x1 + tMin*dx)));
+    int cellY = std::max(minBoundsCellY, std::min(maxBoundsCellY, GetCell(y1 + tMin*dy)));
+    int lastCellX = std::max(minBoundsCellX, std::min(maxBoundsCellX, GetCell(x1 + tMax*dx)));
+    int lastCellY = std::max(minBoundsCellY, std::min(maxBoundsCellY, GetCell(y1 + tMax*dy)));
+    std::size_t cellsCount = std::abs(lastCellX - cellX) + std::abs(lastCellY - cellY) + 1;
+
+    //For long segments, testing all the objects is faster than visiting the cells.
+    if ( cellsCount > entries.size() + maxCellsPerEntry )
+    {
+        result.clear();
+        for (const Entry & entry : entries)
+            result.push_back(std::make_pair(0.0f, entry.object));
+
+        return;
+    }
+
+    //Walk the cells crossed by the segment, in order (DDA).
+    const double infinity = std::numeric_limits<double>::infinity();
+    int stepX = dx > 0 ? 1 : -1, stepY = dy > 0 ? 1 : -1;
+    double tDeltaX = dx != 0 ? cellSize / std::abs(dx) : infinity;
+    double tDeltaY = dy != 0 ? cellSize / std::abs(dy) : infinity;
+    double tNextX = dx != 0 ? ((cellX + (dx > 0 ? 1 : 0))*cellSize - x1) / dx : infinity;
+    double tNextY = dy != 0 ? ((cellY + (dy > 0 ? 1 : 0))*cellSize - y1) / dy : infinity;
+    double t = tMin;
+
+    std::unordered_set<std::size_t> added;
+    for (std::size_t step = 0; step < cellsCount; ++step)
+    {
+        auto cell = boundsCells.find(GetCellKey(cellX, cellY));
+        if ( cell != boundsCells.end() )
+        {
+            for (std::size_t index : cell->second)
+                if ( added.insert(index).second ) result.push_back(std::make_pair(static_cast<float>(t*length), entries[index].object));
+        }
+
+        if ( cellX == lastCellX && cellY == lastCellY ) break;
+        if ( tNextX < tNextY )
+        {
+            t = tNextX;
+            tNextX += tDeltaX;
+            cellX += stepX;
+        }
+        else
+        {
+            t = tNextY;
+            tNextY += tDeltaY;
+            cellY += stepY;
+        }
+    }
+}
+
+void ObjectsSpatialIndex::SortResult(std::vector<std::size_t> & indices, std::vector<RuntimeObject*> & result) const
+{
+    std::sort(indices.begin(), indices.end());
+    result.reserve(indices.size());
+    for (std::size_t index : indices)
+        result.push_back(entries[index].object);
+}
@@ -0,0 +1,105 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef OBJECTSSPATIALINDEX_H
+#define OBJECTSSPATIALINDEX_H
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+class RuntimeObject;
+
+/**
+ * \brief A grid storing the position of a list of objects, used to find the objects
+ * near a position or containing a point without testing all of them.
+ *
+ * The index is built from the centers and the bounding boxes (not rotated) of the objects.
+ * Hitboxes are assumed to stay inside the bounding box rotated around the center of the object.
+ * Results are returned in the order of the objects in the list used to build the index,
+ * except for GetAlongSegment.
+ *
+ * \see RuntimeScene::GetSpatialIndex
+ * \ingroup GameEngine
+ */
+class GD_API ObjectsSpatialIndex
+{
+public:
+    ObjectsSpatialIndex();
+    virtual ~ObjectsSpatialIndex() {};
+
+    /**
+     * \brief Build the index from the specified objects.
+     * \param objects The objects to be indexed.
+     * \param version The version of the objects geometry, returned by GetVersion.
+     */
+    void Build(const std::vector<RuntimeObject*> & objects, unsigned int version);
+
+    /**
+     * \brief Return true if the index was built at least once.
+     */
+    bool IsBuilt() const { return built; }
+
+    /**
+     * \brief Return the version passed to Build.
+     */
+    unsigned int GetVersion() const { return version; }
+
+    /**
+     * \brief Return the number of objects in the index.
+     */
+    std::size_t GetObjectsCount() const { return entries.size(); }
+
+    /**
+     * \brief Get the \a count objects having their center nearest to the specified position.
+     */
+    void GetNearest(float x, float y, std::size_t count, std::vector<RuntimeObject*> & result) const;
+
+    /**
+     * \brief Get the objects having their center at a distance less than or equal to \a radius.
+     */
+    void GetWithinRadius(float x, float y, float radius, std::vector<RuntimeObject*> & result) const;
+
+    /**
+     * \brief Get the objects having their bounding box containing the point.
+     */
+    void GetAtPoint(float x, float y, std::vector<RuntimeObject*> & result) const;
+
+    /**
+     * \brief Get the objects that may be crossed by the segment going from (x1;y1) to (x2;y2).
+     *
+     * Each object is returned with the distance, from (x1;y1), before which the segment
+     * can't cross the object. Objects are sorted by this distance, so that a raycast can
+     * stop as soon as an intersection nearer than the next object is found.
+     */
+    void GetAlongSegment(float x1, float y1, float x2, float y2, std::vector< std::pair<float, RuntimeObject*> > & result) const;
+
+private:
+    struct Entry
+    {
+        RuntimeObject * object;
+        float centerX;
+        float centerY;
+        float left;
+        float top;
+        float right;
+        float bottom;
+        float radius; ///< The distance from the center to the farthest corner of the bounding box.
+    };
+
+    int GetCell(float coordinate) const;
+    static std::int64_t GetCellKey(int cellX, int cellY) { return (static_cast<std::int64_t>(cellX) << 32) ^ static_cast<std::uint32_t>(cellY); }
+    void SortResult(std::vector<std::size_t> & indices, std::vector<RuntimeObject*> & result) const;
+
+    std::vector<Entry> entries; ///< The objects, in the order of the list used to build the index.
+    float cellSize;
+    std::unordered_map<std::int64_t, std::vector<std::size_t>> centersCells; ///< Entries classified by the cell of their center.
+    std::unordered_map<std::int64_t, std::vector<std::size_t>> boundsCells; ///< Entries classified by the cells covered by their bounding box.
+    std::vector<std::size_t> largeEntries; ///< Entries with a bounding box covering too many cells to be put in boundsCells.
+    int minCellX, minCellY, maxCellX, maxCellY; ///< The cells containing the centers of the objects.
+    int minBoundsCellX, minBoundsCellY, maxBoundsCellX, maxBoundsCellY; ///< The cells of boundsCells.
+    unsigned int version;
+    bool built;
+};
+
+#endif // OBJECTSSPATIALINDEX_H
@@ -128,3 +128,43 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d & p1, Polygon2d & p2)
 
     return result;
 }
+
+RaycastResult GD_API PolygonRaycastTest(const Polygon2d & p, float startX, float startY, float endX, float endY)
+{
+    RaycastResult result;
+    if(p.vertices.size() < 2) return result;
+
+    sf::Vector2f start(startX, startY);
+    sf::Vector2f ray(endX - startX, endY - startY);
+    float rayLength = sqrt(ray.x*ray.x + ray.y*ray.y);
+
+    //Intersect the ray with each edge: start + t*ray = vertex + u*edge, with t and u in [0;1]
+    float min_t = FLT_MAX;
+    for (std::size_t i = 0; i < p.vertices.size(); i++)
+    {
+        const sf::Vector2f & vertex = p.vertices[i];
+        sf::Vector2f edge = p.vertices[i + 1 < p.vertices.size() ? i + 1 : 0] - vertex;
+
+        float denominator = ray.x*edge.y - ray.y*edge.x;
+        if (denominator == 0.0f) continue; //Parallel lines
+
+        sf::Vector2f toVertex = vertex - start;
+        float t = (toVertex.x*edge.y - toVertex.y*edge.x) / denominator;
+        float u = (toVertex.x*ray.y - toVertex.y*ray.x) / denominator;
+        if (t < 0.0f || t > 1.0f || u < 0.0f || u > 1.0f || t >= min_t) continue;
+
+        min_t = t;
+        result.normal = sf::Vector2f(-edge.y, edge.x);
+    }
+
+    if (min_t == FLT_MAX) return result;
+
+    normalise(result.normal);
+    if (dotProduct(result.normal, ray) > 0.0f) result.normal = -result.normal;
+
+    result.collision = true;
+    result.distance = min_t * rayLength;
+    result.point = start + ray * min_t;
+
+    return result;
+}
@@ -33,5 +33,32 @@ struct CollisionResult
  */
 CollisionResult GD_API PolygonCollisionTest(Polygon2d & p1, Polygon2d & p2);
 
+/**
+ * \brief Contains the result of PolygonRaycastTest.
+ * \see PolygonRaycastTest
+ * \ingroup GameEngine
+ */
+struct RaycastResult
+{
+    RaycastResult() : collision(false), distance(0) {};
+
+    bool collision;
+    float distance; ///< The distance between the start of the ray and the intersection.
+    sf::Vector2f point; ///< The intersection point.
+    sf::Vector2f normal; ///< The normal of the edge hit by the ray, facing the start of the ray.
+};
+
+/**
+ * Do an intersection test between a polygon and a ray going from (startX;startY) to (endX;endY).
+ *
+ * Only the edges of the polygon are tested: a ray starting inside the polygon hits it
+ * where it leaves it.
+ *
+ * \return The nearest intersection of the ray with the edges of the polygon
+ *
+ * \ingroup GameEngine
+ */
+RaycastResult GD_API PolygonRaycastTest(const Polygon2d & p, float startX, float startY, float endX, float endY);
+
 #endif // POLYGONCOLLISION_H
 
@@ -38,13 +38,12 @@ bool ResourcesLoader::SetResourceFile(const gd::String & filename)
 
 void ResourcesLoader::LoadSFMLImage( const gd::String & filename, sf::Image & image )
 {
-    if (resFile.ContainsFile(filename))
+    //Images can be decoded from background threads (see gd::ImageManager::PreloadImages),
+    //so the file is read in a local buffer rather than using DatFile::GetFile.
+    std::vector<char> buffer;
+    if (resFile.ReadFile(filename, buffer))
     {
-        char* buffer = resFile.GetFile(filename);
-        if (buffer==NULL)
-            cout << "Failed to get the file of a SFML image from resource file: " << filename << endl;
-
-        if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+        if (buffer.empty() || !image.loadFromMemory(buffer.data(), buffer.size()))
             cout << "Failed to load a SFML image from resource file: " << filename << endl;
     }
     else
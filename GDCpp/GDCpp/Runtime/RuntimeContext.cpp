@@ -1,25 +1,21 @@
 #include "RuntimeContext.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
 #include "GDCpp/Runtime/profile.h"
 #include <vector>
 
-bool RuntimeContext::TriggerOnce(std::size_t conditionId)
+bool RuntimeContext::TriggerOnceForEachObject(std::map <gd::String, std::vector<RuntimeObject*> *> objectsLists, std::size_t conditionIndex)
 {
-	onceConditionsTriggered[conditionId] = true; //Remember that we triggered this condition.
-
-	//Return true only if the condition was not triggered the last frame.
-	std::map <std::size_t, bool>::iterator lastFrame = onceConditionsTriggeredLastFrame.find(conditionId);
-	return lastFrame == onceConditionsTriggeredLastFrame.end() || lastFrame->second == false;
-}
-
-void RuntimeContext::StartNewFrame()
-{
-	onceConditionsTriggeredLastFrame = onceConditionsTriggered;
-	onceConditionsTriggered.clear();
+	std::size_t frame = onceConditions.GetFrame();
+	return PickObjectsIf(objectsLists, false, [frame, conditionIndex](RuntimeObject * object) {
+		TriggerOnceConditions & objectConditions = object->GetTriggerOnceConditions();
+		objectConditions.StartNewFrame(frame);
+		return objectConditions.TriggerOnce(conditionIndex);
+	});
 }
 
-std::vector<RuntimeObject*> RuntimeContext::GetObjectsRawPointers(const gd::String & name)
+const std::vector<RuntimeObject*> & RuntimeContext::GetObjectsRawPointers(const gd::String & name)
 {
     return scene->objectsInstances.GetObjectsRawPointers(name);
 }
@@ -5,6 +5,7 @@
 #include <string>
 #include <map>
 #include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/TriggerOnceConditions.h"
 class RuntimeObject;
 class RuntimeScene;
 class RuntimeVariablesContainer;
@@ -30,7 +31,7 @@ public:
      * scene->objectsInstances.GetObjectsRawPointers(name)
      * \endcode
      */
-    std::vector<RuntimeObject*> GetObjectsRawPointers(const gd::String & name);
+    const std::vector<RuntimeObject*> & GetObjectsRawPointers(const gd::String & name);
 
     /**
      * \brief Shortcut for scene->GetVariables();
@@ -44,15 +45,23 @@ public:
 
     /**
      * \brief Used by "Trigger once" conditions: Return true only if
-     * this method was not called with the same identifier during the last frame.
+     * this method was not called with the same index during the last frame.
+     * \param conditionIndex The index of the condition (see TriggerOnceConditions).
      */
-    bool TriggerOnce(std::size_t conditionId);
+    bool TriggerOnce(std::size_t conditionIndex) { return onceConditions.TriggerOnce(conditionIndex); }
+
+    /**
+     * \brief Used by "Trigger once for each object" conditions: Pick only the objects
+     * for which this method was not called with the same index during the last frame.
+     * \return true if at least one object is picked.
+     */
+    bool TriggerOnceForEachObject(std::map <gd::String, std::vector<RuntimeObject*> *> objectsLists, std::size_t conditionIndex);
 
     /**
      * \brief To be called when events begin so that "Trigger once" conditions
      * are properly handled.
      */
-    void StartNewFrame();
+    void StartNewFrame() { onceConditions.StartNewFrame(onceConditions.GetFrame()+1); }
 
     RuntimeContext & ClearObjectListsMap();
     RuntimeContext & AddObjectListToMap(const gd::String & objectName, std::vector<RuntimeObject*> & list);
@@ -62,8 +71,7 @@ public:
 
 private:
     std::map <gd::String, std::vector<RuntimeObject*> *> temporaryMap;
-    std::map <std::size_t, bool> onceConditionsTriggered;
-    std::map <std::size_t, bool> onceConditionsTriggeredLastFrame;
+    TriggerOnceConditions onceConditions; ///< The state of the "Trigger once" conditions of the scene.
 };
 
 #endif // RUNTIMECONTEXT_H
@@ -26,7 +26,8 @@ RuntimeObject::RuntimeObject(RuntimeScene & scene, const gd::Object & object) :
     Y(0),
     zOrder(0),
     hidden(false),
-    objectVariables(object.GetVariables())
+    objectVariables(object.GetVariables()),
+    geometryVersion(NULL)
 {
     ClearForce();
 
@@ -57,6 +58,7 @@ void RuntimeObject::Init(const RuntimeObject & object)
     layer = object.layer;
     force5 = object.force5;
     forces = object.forces;
+    snapshot.reset();
 
     behaviors.clear();
     for (auto it = object.behaviors.cbegin() ; it != object.behaviors.cend(); ++it )
@@ -107,7 +109,7 @@ bool RuntimeObject::ChangeProperty(std::size_t propertyNb, gd::String newValue)
         else
             SetHidden(false);
     }
-    else if ( propertyNb == 4 ) { layer = newValue; }
+    else if ( propertyNb == 4 ) { SetLayer(newValue); }
     else if ( propertyNb == 5 ) {SetZOrder(newValue.To<int>());}
     else if ( propertyNb == 6 ) {return false;}
     else if ( propertyNb == 7 ) {return false;}
@@ -130,8 +132,29 @@ signed long long RuntimeObject::GetElapsedTime(const RuntimeScene & scene) const
     return theLayer.GetElapsedTime(scene);
 }
 
+std::shared_ptr<const RuntimeObject> RuntimeObject::GetSnapshot() const
+{
+    if ( snapshot ) return snapshot;
+
+    std::shared_ptr<const RuntimeObject> newSnapshot = CloneForSnapshot();
+    if ( SupportsChangeTracking() && behaviors.empty() )
+        snapshot = newSnapshot;
+
+    return newSnapshot;
+}
+
+std::unique_ptr<RuntimeObject> RuntimeObject::RestoreFromSnapshot(const std::shared_ptr<const RuntimeObject> & snapshot)
+{
+    std::unique_ptr<RuntimeObject> object = snapshot->Clone();
+    if ( object->SupportsChangeTracking() && object->behaviors.empty() )
+        object->snapshot = snapshot; //The object is the same as the snapshot until it is changed.
+
+    return object;
+}
+
 void RuntimeObject::DeleteFromScene(RuntimeScene & scene)
 {
+    MarkAsChanged();
     name = "";
 
     //Notify scene that object's name has changed.
@@ -148,12 +171,14 @@ void RuntimeObject::PutAroundAPosition( float positionX, float positionY, float
 
 void RuntimeObject::AddForce( float x, float y, float clearing )
 {
+    MarkAsChanged();
     forces.push_back( Force(x,y, clearing) );
 }
 
 void RuntimeObject::AddForceUsingPolarCoordinates( float angle, float length, float clearing )
 {
     angle *= 3.14159/180.0;
+    MarkAsChanged();
     forces.push_back( Force(cos(angle)*length,sin(angle)*length, clearing) );
 }
 /**
@@ -166,6 +191,7 @@ void RuntimeObject::AddForceTowardPosition( float positionX, float positionY, fl
 	double x = positionX - (GetDrawableX()+GetCenterX());
 	float angle = atan2(y,x);
 
+    MarkAsChanged();
     forces.push_back( Force(cos(angle)*length, sin(angle)*length, clearing) );
 }
 
@@ -188,6 +214,7 @@ void RuntimeObject::AddForceToMoveAround( float positionX, float positionY, floa
     int newX = cos(newangle/180.f*3.14159f) * distance;
     int newY = sin(newangle/180.f*3.14159f) * distance;
 
+    MarkAsChanged();
     forces.push_back( Force(newX-oldX, newY-oldY, clearing) );
 }
 
@@ -379,6 +406,40 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject * obj2)
     return false;
 }
 
+RaycastResult RuntimeObject::RaycastTest(float startX, float startY, float endX, float endY)
+{
+    RaycastResult result;
+
+    //First check if the bounding circle is too far from the ray.
+    float w = GetWidth();
+    float h = GetHeight();
+    float boundingRadius = sqrt(w*w+h*h)/2.0;
+    float centerX = GetDrawableX()+GetCenterX();
+    float centerY = GetDrawableY()+GetCenterY();
+
+    float rayX = endX - startX;
+    float rayY = endY - startY;
+    float sqLength = rayX*rayX + rayY*rayY;
+    float t = sqLength != 0 ? ((centerX - startX)*rayX + (centerY - startY)*rayY) / sqLength : 0;
+    t = std::max(0.0f, std::min(1.0f, t));
+    float x = startX + t*rayX - centerX;
+    float y = startY + t*rayY - centerY;
+    if ( sqrt(x*x+y*y) > boundingRadius )
+        return result;
+
+    //Do a real check with the hitboxes near the ray.
+    sf::FloatRect rayRect(std::min(startX, endX), std::min(startY, endY), std::abs(rayX), std::abs(rayY));
+    vector<Polygon2d> hitboxes = GetHitBoxes(rayRect);
+    for (std::size_t k = 0;k<hitboxes.size();++k)
+    {
+        RaycastResult hitboxResult = PolygonRaycastTest(hitboxes[k], startX, startY, endX, endY);
+        if ( hitboxResult.collision && (!result.collision || hitboxResult.distance < result.distance) )
+            result = hitboxResult;
+    }
+
+    return result;
+}
+
 void RuntimeObject::SeparateObjectsWithoutForces( std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists)
 {
     vector<RuntimeObject*> objects2;
@@ -427,6 +488,7 @@ void RuntimeObject::SeparateObjectsWithoutForces( std::map <gd::String, std::vec
 
 void RuntimeObject::SeparateObjectsWithForces( std::map <gd::String, std::vector<RuntimeObject*> *> pickedObjectLists)
 {
+    MarkAsChanged();
     vector<RuntimeObject*> objects2;
     for (std::map <gd::String, std::vector<RuntimeObject*> *>::const_iterator it = pickedObjectLists.begin();it!=pickedObjectLists.end();++it)
     {
@@ -604,6 +666,8 @@ Behavior* RuntimeObject::GetBehaviorRawPointer(const gd::String & name) const
 
 bool RuntimeObject::ClearForce()
 {
+    if ( !forces.empty() || force5.GetLength() != 0 ) MarkAsChanged();
+
     force5.SetLength(0); //Clear the deprecated force
     force5.SetClearing(0);
 
@@ -614,6 +678,8 @@ bool RuntimeObject::ClearForce()
 
 bool RuntimeObject::UpdateForce( float elapsedTime )
 {
+    if ( !forces.empty() || force5.GetLength() != 0 ) MarkAsChanged();
+
     force5.SetLength( force5.GetLength() - force5.GetLength() * ( 1 - force5.GetClearing() ) * elapsedTime );
     if ( force5.GetClearing() == 0 ) force5.SetLength(0);
 
@@ -695,7 +761,7 @@ void RuntimeObject::VariableRemoveChild(gd::Variable & variable, const gd::Strin
     variable.RemoveChild(childName);
 }
 
-unsigned int RuntimeObject::GetVariableChildCount(gd::Variable & variable)
+unsigned int RuntimeObject::GetVariableChildCount(const gd::Variable & variable)
 {
     if (variable.IsStructure() == false) return 0;
     return variable.GetAllChildren().size();
@@ -15,12 +15,14 @@
 #include "GDCpp/Runtime/Force.h"
 #include "GDCpp/Runtime/String.h"
 #include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/TriggerOnceConditions.h"
 #include <SFML/Graphics/Rect.hpp>
 namespace gd { class InitialInstance; }
 namespace gd { class Object; }
 namespace sf { class RenderTarget; }
 class Polygon2d;
 class RuntimeScene;
+struct RaycastResult;
 
 /**
  * \brief A RuntimeObject is something displayed on the scene.
@@ -66,7 +68,7 @@ public:
     /**
      * \brief Copy constructor. Calls Init().
      */
-    RuntimeObject(const RuntimeObject & object) { Init(object); };
+    RuntimeObject(const RuntimeObject & object) : geometryVersion(NULL) { Init(object); };
 
     /**
      * \brief Assignment operator. Calls Init().
@@ -87,6 +89,61 @@ public:
      */
     virtual std::unique_ptr<RuntimeObject> Clone() const { return gd::make_unique<RuntimeObject>(*this);}
 
+    /** \name Snapshots
+     * Members functions used by SceneSnapshot to copy the state of the object.
+     */
+    ///@{
+
+    /**
+     * \brief Return a read-only copy of the current state of the object.
+     *
+     * If the object supports change tracking (see SupportsChangeTracking) and was not
+     * changed since the last call, the same copy is returned without cloning the object again.
+     *
+     * \warning The copy must only be used to restore the object later (see RestoreFromSnapshot):
+     * it may share data with the object.
+     */
+    std::shared_ptr<const RuntimeObject> GetSnapshot() const;
+
+    /**
+     * \brief Create a new object from a copy returned by GetSnapshot.
+     */
+    static std::unique_ptr<RuntimeObject> RestoreFromSnapshot(const std::shared_ptr<const RuntimeObject> & snapshot);
+
+    /**
+     * \brief Notify the object that its state changed, so that the next call to GetSnapshot
+     * creates a new copy.
+     *
+     * \note Called by all the setters of RuntimeObject. Objects supporting change tracking
+     * must call it in their own setters.
+     */
+    void MarkAsChanged() { snapshot.reset(); }
+
+    /**
+     * \brief Return true if the object calls MarkAsChanged each time its state is changed.
+     *
+     * The default implementation returns false, so that the object is cloned for each snapshot.
+     * Redefine it to return true in your object if all of its setters call MarkAsChanged.
+     * \note Objects having behaviors are always cloned, as behaviors can change their own state.
+     */
+    virtual bool SupportsChangeTracking() const { return false; }
+    ///@}
+
+    /**
+     * \brief Notify the scene that the position or the size of the object changed,
+     * so that the spatial index of the objects is updated (see RuntimeScene::GetSpatialIndex).
+     *
+     * \note Called by SetX, SetY and SetLayer. Objects supporting change tracking must also call it
+     * when their size changes: the spatial index is only used for these objects.
+     */
+    void MarkGeometryChanged() { if ( geometryVersion ) ++(*geometryVersion); }
+
+    /**
+     * \brief Get the state of the "Trigger once for each object" conditions for this object.
+     * \see RuntimeContext::TriggerOnceForEachObject
+     */
+    TriggerOnceConditions & GetTriggerOnceConditions() { return triggerOnceConditions; }
+
     /**
      * \brief Called by RuntimeScene when creating the RuntimeObject from an initial instance.
      *
@@ -113,8 +170,15 @@ public:
 
     /**
      * \brief Provide access to variables of the object.
+     * \note The object is marked as changed (see MarkAsChanged): use GetConstVariables
+     * when the variables are only read.
+     */
+    inline RuntimeVariablesContainer & GetVariables() { MarkAsChanged(); return objectVariables; }
+
+    /**
+     * \brief Provide a read-only access to variables of the object, without marking it as changed.
      */
-    inline RuntimeVariablesContainer & GetVariables() { return objectVariables; }
+    inline const RuntimeVariablesContainer & GetConstVariables() const { return objectVariables; }
 
     ///@}
 
@@ -167,7 +231,7 @@ public:
     /**
      * \brief Change the Z order of the object
      */
-    inline void SetZOrder(int zOrder_ ) { zOrder = zOrder_; }
+    inline void SetZOrder(int zOrder_ ) { if ( zOrder != zOrder_ ) MarkAsChanged(); zOrder = zOrder_; }
 
     /**
      * \brief Return if the object is hidden or not
@@ -182,12 +246,12 @@ public:
     /**
      * \brief Hide/Show the object
      */
-    inline void SetHidden(bool hide = true) {hidden = hide;};
+    inline void SetHidden(bool hide = true) { if ( hidden != hide ) MarkAsChanged(); hidden = hide;};
 
     /**
      * \brief Change the layer of the object
      */
-    inline void SetLayer(const gd::String & layer_) { layer = layer_;}
+    inline void SetLayer(const gd::String & layer_) { MarkAsChanged(); MarkGeometryChanged(); layer = layer_;}
 
     /**
      * \brief Get the layer of the object
@@ -223,6 +287,14 @@ public:
      */
     bool IsCollidingWith(RuntimeObject * other);
 
+    /**
+     * \brief Check the intersection between the hitboxes of the object and a ray going from
+     * (startX;startY) to (endX;endY).
+     * \note If the bounding circle of the object is not crossed by the ray, hit boxes are not tested.
+     * \return The nearest intersection of the ray with the hitboxes.
+     */
+    RaycastResult RaycastTest(float startX, float startY, float endX, float endY);
+
     /**
      * \brief Check collision with each object of the list using their hitboxes, and move the object
      * according to the sum of the move vector returned by each collision test.
@@ -305,13 +377,13 @@ public:
      * \brief Change X position of the object.
      * \note This method cannot be redefined: Redefine OnPositionChanged() to do extra work if needed.
      */
-    void SetX(float x_) { X = x_; OnPositionChanged(); }
+    void SetX(float x_) { if ( X != x_ ) { MarkAsChanged(); MarkGeometryChanged(); } X = x_; OnPositionChanged(); }
 
     /**
      * \brief Change Y position of the object.
      * \note This method cannot be redefined: Redefine OnPositionChanged() to do extra work if needed.
      */
-    void SetY(float y_) { Y = y_; OnPositionChanged(); }
+    void SetY(float y_) { if ( Y != y_ ) { MarkAsChanged(); MarkGeometryChanged(); } Y = y_; OnPositionChanged(); }
 
     /**
      * Object can use this function to do special work
@@ -432,12 +504,13 @@ public:
     void Rotate(float speed, RuntimeScene & scene);
 
     static gd::Variable & ReturnVariable(gd::Variable & variable) { return variable; };
+    static const gd::Variable & ReturnVariable(const gd::Variable & variable) { return variable; };
     bool VariableExists(const gd::String & variable);
     static double GetVariableValue(const gd::Variable & variable) { return variable.GetValue(); };
     static const gd::String& GetVariableString(const gd::Variable & variable) { return variable.GetString(); };
     static bool VariableChildExists(const gd::Variable & variable, const gd::String & childName);
     static void VariableRemoveChild(gd::Variable & variable, const gd::String & childName);
-    static unsigned int GetVariableChildCount(gd::Variable & variable);
+    static unsigned int GetVariableChildCount(const gd::Variable & variable);
 
     void SetXY( const char* xOperator, float xValue, const char* yOperator, float yValue );
 
@@ -475,11 +548,25 @@ protected:
     RuntimeVariablesContainer                              objectVariables; ///<List of the variables of the object
     std::vector < Force >                                  forces; ///< Forces applied to the object
 
+    /**
+     * \brief Create the copy returned by GetSnapshot. The default implementation calls Clone.
+     *
+     * Objects can redefine it to share unchanged data (like resources) with the copy.
+     */
+    virtual std::unique_ptr<RuntimeObject> CloneForSnapshot() const { return Clone(); }
+
     /**
      * \brief Initialize object using another object. Used by copy-ctor and assign-op.
      * \warning Don't forget to update me if members were changed!
      */
     void Init(const RuntimeObject & object);
+
+private:
+    friend class ObjInstancesHolder;
+
+    mutable std::shared_ptr<const RuntimeObject> snapshot; ///< The last copy returned by GetSnapshot, reset when the object is changed.
+    unsigned int * geometryVersion; ///< The geometry version of the objects list containing the object, if any (set by ObjInstancesHolder).
+    TriggerOnceConditions triggerOnceConditions; ///< The state of the "Trigger once for each object" conditions, not copied by Init.
 };
 
 #endif // RUNTIMEOBJECT_H
@@ -19,3 +19,9 @@ void GD_API PickOnly(RuntimeObjectsLists & pickedObjectsLists, RuntimeObject * t
 
     if (pickedObjectsLists[thisOne->GetName()] != NULL) pickedObjectsLists[thisOne->GetName()]->push_back(thisOne);
 }
+
+bool GD_API CanUseSpatialIndex(RuntimeScene & scene, const gd::String & name, const std::vector<RuntimeObject*> & list)
+{
+    return !list.empty() && list[0]->SupportsChangeTracking()
+        && list.size() == scene.objectsInstances.GetObjects(name).size();
+}
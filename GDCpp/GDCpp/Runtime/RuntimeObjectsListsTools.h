@@ -22,6 +22,14 @@ typedef std::map <gd::String, std::vector<RuntimeObject*> *> RuntimeObjectsLists
  */
 void GD_API PickOnly(RuntimeObjectsLists & pickedObjectsLists, RuntimeObject * thisOne);
 
+/**
+ * \brief Return true if \a list contains all the objects called \a name living in the scene
+ * and if these objects keep the spatial index of the scene up to date, so that
+ * RuntimeScene::GetSpatialIndex can be queried instead of iterating on the list.
+ * \ingroup GameEngine
+ */
+bool GD_API CanUseSpatialIndex(RuntimeScene & scene, const gd::String & name, const std::vector<RuntimeObject*> & list);
+
 /**
  * \brief Filter objects to keep only the one that fullfil the predicate
  *
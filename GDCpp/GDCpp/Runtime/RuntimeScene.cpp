@@ -9,6 +9,7 @@
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <unordered_map>
 #include <SFML/System.hpp>
 #include <SFML/Graphics.hpp>
 #include "GDCpp/Runtime/RuntimeScene.h"
@@ -29,6 +30,7 @@
 #include "GDCpp/Runtime/RuntimeContext.h"
 #include "GDCpp/Runtime/Project/Project.h"
 #include "GDCpp/Runtime/ManualTimer.h"
+#include "GDCpp/Runtime/SceneSnapshot.h"
 #include "GDCpp/Extensions/CppPlatform.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
@@ -59,7 +61,8 @@ RuntimeScene::RuntimeScene(sf::RenderWindow * renderWindow_, RuntimeGame * game_
     #endif
     isFullScreen(false),
     inputManager(renderWindow_),
-    codeExecutionEngine(new CodeExecutionEngine)
+    codeExecutionEngine(new CodeExecutionEngine),
+    fixedTimeStep(0)
 {
     ChangeRenderWindow(renderWindow);
 }
@@ -124,10 +127,13 @@ void RuntimeScene::RequestChange(SceneChange::Change change, gd::String sceneNam
 bool RuntimeScene::RenderAndStep()
 {
     requestedChange.change = SceneChange::CONTINUE;
+    requestedPreload.clear();
     ManageRenderTargetEvents();
-    timeManager.Update(clock.restart().asMicroseconds(), game->GetMinimumFPS());
+    signed int realElapsedTime = clock.restart().asMicroseconds();
+    timeManager.Update(fixedTimeStep > 0 ? fixedTimeStep : realElapsedTime, game->GetMinimumFPS());
     ManageObjectsBeforeEvents();
     if (game) game->GetSoundManager().ManageGarbage();
+    if (game) game->GetImageManager()->UploadDecodedImages(sf::milliseconds(4)); //Textures of the images preloaded in the background.
 
     #if defined(GD_IDE_ONLY)
     if( GetProfiler() )
@@ -338,6 +344,51 @@ void RuntimeScene::ManageObjectsAfterEvents()
     }
 }
 
+SceneSnapshot RuntimeScene::TakeSnapshot()
+{
+    SceneSnapshot snapshot;
+
+    RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
+    snapshot.objects.reserve(allObjects.size());
+    for (const RuntimeObject * object : allObjects)
+    {
+        if ( !object->GetName().empty() ) //Skip objects deleted during this frame.
+            snapshot.objects.push_back(object->GetSnapshot());
+    }
+
+    snapshot.variables = variables;
+    snapshot.timeManager = timeManager;
+
+    return snapshot;
+}
+
+void RuntimeScene::RestoreSnapshot(const SceneSnapshot & snapshot)
+{
+    RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
+    for (RuntimeObject * object : allObjects)
+    {
+        for (std::size_t i = 0;i<extensionsToBeNotifiedOnObjectDeletion.size();++i)
+            extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(*this, object);
+    }
+    objectsInstances.Clear();
+
+    for (const auto & object : snapshot.objects)
+        objectsInstances.AddObject(RuntimeObject::RestoreFromSnapshot(object));
+
+    variables = snapshot.variables;
+    timeManager = snapshot.timeManager;
+}
+
+const ObjectsSpatialIndex & RuntimeScene::GetSpatialIndex(const gd::String & objectName)
+{
+    ObjectsSpatialIndex & index = spatialIndexes[objectName];
+    unsigned int version = objectsInstances.GetGeometryVersion(objectName);
+    if ( !index.IsBuilt() || index.GetVersion() != version )
+        index.Build(objectsInstances.GetObjectsRawPointers(objectName), version);
+
+    return index;
+}
+
 void RuntimeScene::ManageObjectsBeforeEvents()
 {
     RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
@@ -346,33 +397,71 @@ void RuntimeScene::ManageObjectsBeforeEvents()
 }
 
 /**
- * \brief Internal Tool class used by RuntimeScene::CreateObjectsFrom
+ * \brief Internal Tool class used by RuntimeScene::CreateObjectsFrom to group the initial instances by object name.
  */
-class ObjectsFromInitialInstanceCreator : public gd::InitialInstanceFunctor
+class InitialInstancesGrouper : public gd::InitialInstanceFunctor
 {
 public:
-    ObjectsFromInitialInstanceCreator(gd::Project & game_, RuntimeScene & scene_, float xOffset_, float yOffset_) :
-        game(game_),
-        scene(scene_),
-        xOffset(xOffset_),
-        yOffset(yOffset_)
-    {};
-    virtual ~ObjectsFromInitialInstanceCreator() {};
+    InitialInstancesGrouper() {};
+    virtual ~InitialInstancesGrouper() {};
 
     virtual void operator()(gd::InitialInstance & instance)
     {
-        std::vector<ObjSPtr>::const_iterator sceneObject = std::find_if(scene.GetObjects().begin(), scene.GetObjects().end(), std::bind2nd(ObjectHasName(), instance.GetObjectName()));
-        std::vector<ObjSPtr>::const_iterator globalObject = std::find_if(game.GetObjects().begin(), game.GetObjects().end(), std::bind2nd(ObjectHasName(), instance.GetObjectName()));
+        auto it = groupsIndices.find(instance.GetObjectName());
+        if ( it == groupsIndices.end() )
+        {
+            it = groupsIndices.insert(std::make_pair(instance.GetObjectName(), groups.size())).first;
+            groups.push_back(std::make_pair(instance.GetObjectName(), std::vector<const gd::InitialInstance*>()));
+        }
 
-        RuntimeObjSPtr newObject;
+        groups[it->second].second.push_back(&instance);
+    }
+
+    std::vector<std::pair<gd::String, std::vector<const gd::InitialInstance*>>> groups; ///< The instances of each object, in the order of their first instance.
+
+private:
+    std::unordered_map<gd::String, std::size_t> groupsIndices; ///< The index of the group of each object in groups.
+};
 
-        if ( sceneObject != scene.GetObjects().end() ) //We check first scene's objects' list.
-            newObject = CppPlatform::Get().CreateRuntimeObject(scene, **sceneObject);
-        else if ( globalObject != scene.game->GetObjects().end() ) //Then the global object list
-            newObject = CppPlatform::Get().CreateRuntimeObject(scene, **globalObject);
+void RuntimeScene::CreateObjectsFrom(const gd::InitialInstancesContainer & container, float xOffset, float yOffset)
+{
+    InitialInstancesGrouper grouper;
+    const_cast<gd::InitialInstancesContainer&>(container).IterateOverInstances(grouper);
 
-        if ( newObject != std::unique_ptr<RuntimeObject> () )
+    for (auto & group : grouper.groups)
+    {
+        const gd::String & objectName = group.first;
+        const std::vector<const gd::InitialInstance*> & instances = group.second;
+
+        //Create the first object from the scene objects or, if not found, from the global objects.
+        std::vector<ObjSPtr>::const_iterator sceneObject = std::find_if(GetObjects().begin(), GetObjects().end(), std::bind2nd(ObjectHasName(), objectName));
+        std::vector<ObjSPtr>::const_iterator globalObject = std::find_if(game->GetObjects().begin(), game->GetObjects().end(), std::bind2nd(ObjectHasName(), objectName));
+
+        RuntimeObjSPtr prototype;
+        if ( sceneObject != GetObjects().end() )
+            prototype = CppPlatform::Get().CreateRuntimeObject(*this, **sceneObject);
+        else if ( globalObject != game->GetObjects().end() )
+            prototype = CppPlatform::Get().CreateRuntimeObject(*this, **globalObject);
+
+        if ( prototype == std::unique_ptr<RuntimeObject>() )
+        {
+            std::cout << "Could not find and put object " << objectName << " (" << instances.size() << " instances)" << std::endl;
+            continue;
+        }
+
+        //Other objects are copies of the first one, so that resources are not loaded again.
+        //Copies are made on the calling thread: copy constructors of objects are not required to be thread-safe.
+        std::vector<RuntimeObjSPtr> newObjects(instances.size());
+        for (std::size_t i = 1; i < instances.size(); ++i)
+            newObjects[i] = prototype->Clone();
+        newObjects[0] = std::move(prototype);
+
+        objectsInstances.Reserve(objectName, instances.size());
+        for (std::size_t i = 0; i < instances.size(); ++i)
         {
+            const gd::InitialInstance & instance = *instances[i];
+            RuntimeObjSPtr & newObject = newObjects[i];
+
             newObject->SetX( instance.GetX() + xOffset );
             newObject->SetY( instance.GetY() + yOffset );
             newObject->SetZOrder( instance.GetZOrder() );
@@ -387,25 +476,12 @@ public:
             }
 
             //Substitute initial variables specific to that object instance.
-            newObject->GetVariables().Merge(instance.GetVariables());
+            if ( instance.GetVariables().Count() != 0 )
+                newObject->GetVariables().Merge(instance.GetVariables());
 
-            scene.objectsInstances.AddObject(std::move(newObject));
+            objectsInstances.AddObject(std::move(newObject));
         }
-        else
-            std::cout << "Could not find and put object " << instance.GetObjectName() << std::endl;
     }
-
-private:
-    gd::Project & game;
-    RuntimeScene & scene;
-    float xOffset;
-    float yOffset;
-};
-
-void RuntimeScene::CreateObjectsFrom(const gd::InitialInstancesContainer & container, float xOffset, float yOffset)
-{
-    ObjectsFromInitialInstanceCreator func(*game, *this, xOffset, yOffset);
-    const_cast<gd::InitialInstancesContainer&>(container).IterateOverInstances(func);
 }
 
 bool RuntimeScene::LoadFromScene( const gd::Layout & scene )
@@ -414,8 +490,22 @@ bool RuntimeScene::LoadFromScene( const gd::Layout & scene )
 }
 
 bool RuntimeScene::LoadFromSceneAndCustomInstances( const gd::Layout & scene, const gd::InitialInstancesContainer & instances )
+{
+    if (!PrepareFromSceneAndCustomInstances(scene, instances)) return false;
+
+    FinishLoading();
+    return true;
+}
+
+bool RuntimeScene::PreloadFromScene( const gd::Layout & scene )
+{
+    return PrepareFromSceneAndCustomInstances(scene, scene.GetInitialInstances());
+}
+
+bool RuntimeScene::PrepareFromSceneAndCustomInstances( const gd::Layout & scene, const gd::InitialInstancesContainer & instances )
 {
     std::cout << "Loading RuntimeScene from a scene.";
+    sf::Clock loadingClock;
     if (!game)
     {
         std::cout << "..No valid gd::Project associated to the RuntimeScene. Aborting loading." << std::endl;
@@ -452,8 +542,16 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances( const gd::Layout & scene, co
     std::cout << ".";
     behaviorsSharedDatas.LoadFrom(scene.behaviorsInitialSharedDatas);
 
-    std::cout << ".";
+    std::cout << " Done: \"" << scene.GetName() << "\" loaded in " << loadingClock.getElapsedTime().asMilliseconds() << "ms ("
+        << instances.GetInstancesCount() << " instances)." << std::endl;
+
+    return true;
+}
+
+void RuntimeScene::FinishLoading()
+{
     //Extensions specific initialization
+    extensionsToBeNotifiedOnObjectDeletion.clear();
 	for (std::size_t i = 0;i<game->GetUsedExtensions().size();++i)
     {
         std::shared_ptr<gd::PlatformExtension> gdExtension = CppPlatform::Get().GetExtension(game->GetUsedExtensions()[i]);
@@ -465,11 +563,8 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances( const gd::Layout & scene, co
         }
     }
 
-    std::cout << ".";
     if ( StopSoundsOnStartup() ) {game->GetSoundManager().ClearAllSoundsAndMusics(); }
     if ( renderWindow ) renderWindow->setTitle(GetWindowDefaultTitle());
 
-    std::cout << " Done." << std::endl;
-
-    return true;
+    clock.restart(); //The time spent loading the scene is not part of the first frame.
 }
@@ -12,12 +12,16 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <SFML/System.hpp>
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
+#include "GDCpp/Runtime/ObjectsSpatialIndex.h"
+#include "GDCpp/Runtime/PolygonCollision.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/TimeManager.h"
 #include "GDCpp/Runtime/InputManager.h"
 #include "GDCpp/Runtime/BehaviorsRuntimeSharedDataHolder.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
 namespace sf { class RenderWindow; }
 namespace sf { class Event; }
 namespace gd { class Project; }
@@ -28,6 +32,7 @@ class RuntimeGame;
 class BehaviorsRuntimeSharedData;
 class ExtensionBase;
 class CodeExecutionEngine;
+class SceneSnapshot;
 #undef GetObject //Disable an annoying macro
 
 #if defined(GD_IDE_ONLY)
@@ -108,6 +113,21 @@ public:
      */
     const std::shared_ptr<BehaviorsRuntimeSharedData> & GetBehaviorSharedData(const gd::String & behaviorName) const { return behaviorsSharedDatas.GetBehaviorSharedData(behaviorName); }
 
+    /**
+     * \brief Return the data stored by an extension for the scene, creating it if needed.
+     * \param slot The slot of the data, registered by the extension when loaded.
+     * \see SceneExtensionDataSlot
+     */
+    template <class T>
+    T & GetExtensionData(const SceneExtensionDataSlot<T> & slot) { return extensionsData.Get(slot); }
+
+    /**
+     * \brief Destroy the data stored by an extension for the scene.
+     * \see SceneExtensionDataSlot
+     */
+    template <class T>
+    void ResetExtensionData(const SceneExtensionDataSlot<T> & slot) { extensionsData.Reset(slot); }
+
     /**
      * \brief Set up the RuntimeScene using a gd::Layout.
      *
@@ -125,9 +145,29 @@ public:
      */
     bool LoadFromSceneAndCustomInstances( const gd::Layout & scene, const gd::InitialInstancesContainer & instances );
 
+    /**
+     * \brief Set up the RuntimeScene using a gd::Layout, without affecting the rest of the game:
+     * can be called from a background thread, as long as the layout is not modified meanwhile.
+     *
+     * RuntimeScene::FinishLoading must then be called, from the main thread, before playing the scene.
+     * \see SceneStack::Preload
+     */
+    bool PreloadFromScene( const gd::Layout & scene );
+
+    /**
+     * \brief Notify the extensions that the scene is loaded and apply the scene settings
+     * affecting the game (sounds stopped at startup...).
+     *
+     * \note Called by LoadFromScene and LoadFromSceneAndCustomInstances. Only scenes set up with PreloadFromScene
+     * must call it.
+     */
+    void FinishLoading();
+
     /**
      * Create the objects from an gd::InitialInstancesContainer object.
      *
+     * Instances are grouped by object: each object is created once and copied for its other instances.
+     *
      * \param container The object containing the initial instances to be created
      * \param xOffset The offset on x axis to be applied to objects created
      * \param yOffset The offset on y axis to be applied to objects created
@@ -161,6 +201,19 @@ public:
      */
     void RenderWithoutStep();
 
+    /**
+     * \brief Make each frame last the specified time, instead of the real time elapsed
+     * since the last frame. Useful to play a scene in a deterministic way.
+     * \param timeStep The duration of a frame, in microseconds, or 0 to use the real time.
+     * \see SimulationHost
+     */
+    void SetFixedTimeStep(signed int timeStep) { fixedTimeStep = timeStep; }
+
+    /**
+     * \brief Get the duration of a frame, in microseconds, or 0 if the real time is used.
+     */
+    signed int GetFixedTimeStep() const { return fixedTimeStep; }
+
     /** \name Code execution engine
      * Functions members giving access to the code execution engine.
      */
@@ -193,8 +246,80 @@ public:
     SceneChange GetRequestedChange() { return requestedChange; }
     void RequestChange(SceneChange::Change change, gd::String sceneName = "");
 
+    /** \name Scenes preloading
+     * Members functions used to ask the SceneStack playing the scene to preload another scene.
+     */
+    ///@{
+    /**
+     * \brief Ask for the specified scene to be preloaded in the background at the end of the frame.
+     * \see SceneStack::Preload
+     */
+    void RequestPreload(const gd::String & sceneName) { requestedPreload = sceneName; }
+
+    /**
+     * \brief Get the name of the scene to be preloaded, or an empty string.
+     */
+    const gd::String & GetRequestedPreload() const { return requestedPreload; }
+
+    /**
+     * \brief Return true if the specified scene is preloaded and can be started without delay.
+     */
+    bool IsScenePreloaded(const gd::String & sceneName) const { return !sceneName.empty() && preloadedScene == sceneName; }
+
+    /**
+     * \brief Set the name of the scene preloaded, as reported by the SceneStack playing the scene.
+     */
+    void SetPreloadedScene(const gd::String & sceneName) { preloadedScene = sceneName; }
+    ///@}
+
+    /** \name Snapshots
+     * Members functions used to save the state of the scene and restore it later.
+     */
+    ///@{
+    /**
+     * \brief Return a snapshot of the objects, the variables and the timers of the scene.
+     *
+     * Objects not changed since the previous snapshot are shared with it, so that taking
+     * a snapshot at each frame is cheap.
+     */
+    SceneSnapshot TakeSnapshot();
+
+    /**
+     * \brief Replace the objects, the variables and the timers of the scene by the ones stored in \a snapshot.
+     *
+     * \note Extensions are notified that the objects of the scene are deleted.
+     */
+    void RestoreSnapshot(const SceneSnapshot & snapshot);
+    ///@}
+
+    /**
+     * \brief Return the spatial index of the objects with the specified name.
+     *
+     * The index is rebuilt only if one of these objects was added, removed, moved or resized
+     * since the last call.
+     *
+     * \see ObjInstancesHolder::GetGeometryVersion
+     */
+    const ObjectsSpatialIndex & GetSpatialIndex(const gd::String & objectName);
+
+    /**
+     * \brief Return the result of the last raycast done by the events, used by the raycast expressions.
+     */
+    const RaycastResult & GetLastRaycast() const { return lastRaycast; }
+
+    /**
+     * \brief Set the result of the last raycast done by the events.
+     */
+    void SetLastRaycast(const RaycastResult & result) { lastRaycast = result; }
+
 protected:
 
+    /**
+     * \brief Set up the RuntimeScene using the specified \a instances and \a scene, without
+     * calling FinishLoading.
+     */
+    bool PrepareFromSceneAndCustomInstances( const gd::Layout & scene, const gd::InitialInstancesContainer & instances );
+
     /**
      * \brief Handle the events made on the scene's window
      */
@@ -232,10 +357,16 @@ protected:
     RuntimeVariablesContainer               variables; ///<List of the scene variables
     std::vector < ExtensionBase * >         extensionsToBeNotifiedOnObjectDeletion; ///< List, built during LoadFromScene, containing a list of extensions which must be notified when an object is deleted.
     BehaviorsRuntimeSharedDataHolder        behaviorsSharedDatas; ///<Contains all behaviors shared datas.
+    SceneExtensionsData                     extensionsData; ///< The data stored by extensions for the scene (destroyed after the objects).
     std::vector < RuntimeLayer >            layers; ///< The layers used at runtime to display the scene.
+    std::unordered_map<gd::String, ObjectsSpatialIndex> spatialIndexes; ///< The spatial indexes of the objects, built on demand.
+    RaycastResult                           lastRaycast; ///< The result of the last raycast done by the events.
     std::shared_ptr<CodeExecutionEngine>    codeExecutionEngine;
     SceneChange                             requestedChange; ///< What should be done at the end of the frame.
+    gd::String                              requestedPreload; ///< The scene to be preloaded at the end of the frame.
+    gd::String                              preloadedScene; ///< The scene preloaded by the SceneStack, if any.
     sf::Clock                               clock; ///< The clock used to track time.
+    signed int                              fixedTimeStep; ///< The duration of a frame in microseconds, or 0 to use the real time.
 
     static RuntimeLayer badRuntimeLayer; ///< Null object return by GetLayer when no appropriate layer could be found.
 };
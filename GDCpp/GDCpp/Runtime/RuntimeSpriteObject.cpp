@@ -8,6 +8,7 @@
 #include <wx/wx.h> //Must be placed first, otherwise we get nice errors relative to "cannot convert 'const TCHAR*'..." in wx/msw/winundef.h
 #endif
 #include "RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/SpriteFramesTable.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
@@ -35,7 +36,27 @@
 #endif
 
 gd::Animation RuntimeSpriteObject::badAnimation;
-gd::Sprite * RuntimeSpriteObject::badSpriteDatas = NULL;
+
+gd::Sprite * RuntimeSpriteObject::GetBadSpriteDatas()
+{
+    //Created on first use, in a thread-safe way as objects of scenes played on different threads can be created at once.
+    static gd::Sprite * badSpriteDatas = new gd::Sprite();
+    return badSpriteDatas;
+}
+
+namespace
+{
+    /**
+     * \brief Return the frame of the table, or an empty frame if it does not exist.
+     */
+    const SpriteFramesTable::Frame & GetFrame(const SpriteFramesTable & table, std::size_t animation, std::size_t direction, std::size_t sprite)
+    {
+        static const SpriteFramesTable::Frame badFrame = {0, 0, 0, 0, 0, 0, std::vector<Polygon2d>()};
+
+        std::size_t frameIndex = table.GetFrameIndex(animation, direction, sprite);
+        return frameIndex != gd::String::npos ? table.GetFrame(frameIndex) : badFrame;
+    }
+}
 
 RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene & scene, const gd::SpriteObject & spriteObject) :
     RuntimeObject(scene, spriteObject),
@@ -48,6 +69,7 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene & scene, const gd::SpriteO
     animationSpeedScale(1.f),
     ptrToCurrentSprite( NULL ),
     needUpdateCurrentSprite(true),
+    waitingForImages(false),
     opacity( 255 ),
     blendMode(0),
     isFlippedX(false),
@@ -58,8 +80,6 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene & scene, const gd::SpriteO
     colorV( 255 ),
     colorB( 255 )
 {
-    if (!badSpriteDatas) badSpriteDatas = new gd::Sprite();
-
     animations.clear();
     for (std::size_t i = 0; i < spriteObject.GetAllAnimations().size(); ++i)
         animations.push_back(AnimationProxy(spriteObject.GetAllAnimations()[i]));
@@ -75,15 +95,82 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene & scene, const gd::SpriteO
                 gd::Sprite & sprite = anim.GetDirection(k).GetSprite(l);
 
                 sprite.LoadImage(scene.GetImageManager()->GetSFMLTexture(sprite.GetImageName()));
+                if ( sprite.GetSFMLTexture()->IsPlaceholder() ) waitingForImages = true;
             }
         }
     }
+
+    framesTable = std::make_shared<SpriteFramesTable>(animations);
+    UpdateFramesSprites();
 }
 
 RuntimeSpriteObject::~RuntimeSpriteObject()
 {
 };
 
+std::unique_ptr<RuntimeObject> RuntimeSpriteObject::Clone() const
+{
+    std::unique_ptr<RuntimeSpriteObject> clone = gd::make_unique<RuntimeSpriteObject>(*this);
+    for (std::size_t i = 0; i < clone->animations.size(); ++i)
+        clone->animations[i].MakeUnique();
+
+    clone->UpdateFramesSprites();
+    clone->needUpdateCurrentSprite = true;
+    return std::move(clone);
+}
+
+std::unique_ptr<RuntimeObject> RuntimeSpriteObject::CloneForSnapshot() const
+{
+    //The snapshot is never drawn, so animations (and the SFML sprites they contain) can be shared.
+    return gd::make_unique<RuntimeSpriteObject>(*this);
+}
+
+void RuntimeSpriteObject::MakeCurrentAnimationUnique()
+{
+    if ( currentAnimation < animations.size() && animations[currentAnimation].MakeUnique() )
+    {
+        UpdateFramesSprites();
+        UpdateCurrentSprite();
+    }
+}
+
+void RuntimeSpriteObject::UpdateLoadedImages()
+{
+    for (std::size_t i = 0; i < framesSprites.size(); ++i)
+    {
+        if ( framesSprites[i]->GetSFMLTexture() && framesSprites[i]->GetSFMLTexture()->IsPlaceholder() )
+            return;
+    }
+
+    //All the images are loaded: update the sprites and the frames table with their real size.
+    for (std::size_t i = 0; i < framesSprites.size(); ++i)
+    {
+        if ( framesSprites[i]->GetSFMLTexture() )
+            framesSprites[i]->LoadImage(framesSprites[i]->GetSFMLTexture());
+    }
+
+    framesTable = std::make_shared<SpriteFramesTable>(animations);
+    waitingForImages = false;
+    needUpdateCurrentSprite = true;
+}
+
+void RuntimeSpriteObject::UpdateFramesSprites()
+{
+    //Sprites are stored in the same order as the frames of framesTable.
+    framesSprites.clear();
+    framesSprites.reserve(framesTable->GetFramesCount());
+    for (std::size_t i = 0; i < animations.size(); ++i)
+    {
+        gd::Animation & animation = animations[i].GetNonConst();
+        for (std::size_t j = 0; j < animation.GetDirectionsCount(); ++j)
+        {
+            gd::Direction & direction = animation.GetDirection(j);
+            for (std::size_t k = 0; k < direction.GetSpritesCount(); ++k)
+                framesSprites.push_back(&direction.GetSprite(k));
+        }
+    }
+}
+
 bool RuntimeSpriteObject::ExtraInitializationFromInitialInstance(const gd::InitialInstance & position)
 {
     if ( position.floatInfos.find("animation") != position.floatInfos.end() )
@@ -107,31 +194,33 @@ bool RuntimeSpriteObject::Draw( sf::RenderTarget & renderTarget )
 
 float RuntimeSpriteObject::GetDrawableX() const
 {
-    return X - GetCurrentSprite().GetOrigin().GetX()*fabs(scaleX);
+    return X - GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).originX*fabs(scaleX);
 }
 
 float RuntimeSpriteObject::GetDrawableY() const
 {
-    return Y - GetCurrentSprite().GetOrigin().GetY()*fabs(scaleY);
+    return Y - GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).originY*fabs(scaleY);
 }
 
 float RuntimeSpriteObject::GetWidth() const
 {
-    return scaleX > 0 ? GetCurrentSFMLSprite().getLocalBounds().width*scaleX : -GetCurrentSFMLSprite().getLocalBounds().width*scaleX;
+    return GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).width*fabs(scaleX);
 }
 
 float RuntimeSpriteObject::GetHeight() const
 {
-    return scaleY > 0 ? GetCurrentSFMLSprite().getLocalBounds().height*scaleY : -GetCurrentSFMLSprite().getLocalBounds().height*scaleY;
+    return GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).height*fabs(scaleY);
 }
 
 void RuntimeSpriteObject::SetWidth(float newWidth)
 {
     if ( newWidth > 0 )
     {
-        scaleX = newWidth/GetCurrentSFMLSprite().getLocalBounds().width;
+        scaleX = newWidth/GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).width;
         if ( isFlippedX ) scaleX *= -1;
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
     }
 }
 
@@ -139,20 +228,22 @@ void RuntimeSpriteObject::SetHeight(float newHeight)
 {
     if ( newHeight > 0 )
     {
-        scaleY = newHeight/GetCurrentSFMLSprite().getLocalBounds().height;
+        scaleY = newHeight/GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).height;
         if ( isFlippedY ) scaleY *= -1;
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
     }
 }
 
 float RuntimeSpriteObject::GetCenterX() const
 {
-    return GetCurrentSprite().GetCenter().GetX()*fabs(scaleX);
+    return GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).centerX*fabs(scaleX);
 }
 
 float RuntimeSpriteObject::GetCenterY() const
 {
-    return GetCurrentSprite().GetCenter().GetY()*fabs(scaleY);
+    return GetFrame(*framesTable, currentAnimation, currentDirection, currentSprite).centerY*fabs(scaleY);
 }
 
 float RuntimeSpriteObject::GetPointX(const gd::String & name) const
@@ -216,6 +307,8 @@ void RuntimeSpriteObject::SetScaleX(float val)
 
     scaleX = val * (isFlippedX ? -1.0 : 1.0);
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
 }
 
 void RuntimeSpriteObject::SetScaleY(float val)
@@ -225,6 +318,8 @@ void RuntimeSpriteObject::SetScaleY(float val)
 
     scaleY = val * (isFlippedY ? -1.0 : 1.0);
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
 }
 
 float RuntimeSpriteObject::GetScaleX() const
@@ -240,6 +335,8 @@ float RuntimeSpriteObject::GetScaleY() const
 void RuntimeSpriteObject::CopyImageOnImageOfCurrentSprite(RuntimeScene & scene, const gd::String & imageName, float xPosition, float yPosition, bool useTransparency)
 {
     if ( needUpdateCurrentSprite ) UpdateCurrentSprite();
+    MakeCurrentAnimationUnique();
+    MarkAsChanged();
 
     ptrToCurrentSprite->MakeSpriteOwnsItsImage(); //We want to modify only the image of the object, not all objects which have the same image.
     std::shared_ptr<SFMLTextureWrapper> dest = ptrToCurrentSprite->GetSFMLTexture();
@@ -256,6 +353,8 @@ void RuntimeSpriteObject::CopyImageOnImageOfCurrentSprite(RuntimeScene & scene,
 void RuntimeSpriteObject::MakeColorTransparent( const gd::String & colorStr )
 {
     if ( needUpdateCurrentSprite ) UpdateCurrentSprite();
+    MakeCurrentAnimationUnique();
+    MarkAsChanged();
 
     ptrToCurrentSprite->MakeSpriteOwnsItsImage(); //We want to modify only the image of the object, not all objects which have the same image.
     std::shared_ptr<SFMLTextureWrapper> dest = ptrToCurrentSprite->GetSFMLTexture();
@@ -284,26 +383,11 @@ void RuntimeSpriteObject::SetColor(const gd::String & colorStr)
  */
 void RuntimeSpriteObject::UpdateCurrentSprite() const
 {
-    bool multipleDirections = false;
-    if ( currentAnimation >= animations.size() )
-        ptrToCurrentSprite = badSpriteDatas;
-    else
-    {
-        gd::Animation & animation = animations[currentAnimation].GetNonConst();
-        multipleDirections = animation.useMultipleDirections;
+    const SpriteFramesTable::Animation * animation = framesTable->GetAnimation(currentAnimation);
+    bool multipleDirections = animation && animation->useMultipleDirections;
 
-        std::size_t directionIndex = multipleDirections ? currentDirection : 0;
-        if ( directionIndex >= animation.GetDirectionsCount() )
-            ptrToCurrentSprite = badSpriteDatas;
-        else
-        {
-            gd::Direction & direction = animation.GetDirection(directionIndex);
-            if ( currentSprite >= direction.GetSpritesCount())
-                ptrToCurrentSprite = badSpriteDatas;
-            else
-                ptrToCurrentSprite = &direction.GetSprite(currentSprite);
-        }
-    }
+    std::size_t frameIndex = framesTable->GetFrameIndex(currentAnimation, currentDirection, currentSprite);
+    ptrToCurrentSprite = frameIndex < framesSprites.size() ? framesSprites[frameIndex] : GetBadSpriteDatas();
 
     ptrToCurrentSprite->GetSFMLSprite().setOrigin( ptrToCurrentSprite->GetCenter().GetX(), ptrToCurrentSprite->GetCenter().GetY() ); ;
     ptrToCurrentSprite->GetSFMLSprite().setRotation( multipleDirections ? 0 : currentAngle );
@@ -319,15 +403,21 @@ void RuntimeSpriteObject::UpdateCurrentSprite() const
 
 void RuntimeSpriteObject::Update(const RuntimeScene & scene)
 {
-    if ( animationStopped || currentAnimation >= GetAnimationsCount() ) return;
+    if ( waitingForImages ) UpdateLoadedImages();
+    if ( animationStopped ) return;
+
+    const SpriteFramesTable::Direction * direction = framesTable->GetDirection(currentAnimation, currentDirection);
+    if ( !direction || direction->framesCount == 0 ) return;
 
     double elapsedTimeInSeconds = static_cast<double>(GetElapsedTime(scene))/1000000.0;
+    //The object is only marked as changed when the frame changes: a snapshot may not have the
+    //exact time elapsed on the current frame, which is not worth a copy of the object each frame.
     timeElapsedOnCurrentSprite += elapsedTimeInSeconds * animationSpeedScale;
 
-    const gd::Direction & direction = animations[currentAnimation].Get().GetDirection( currentDirection );
-
-    float delay = direction.GetTimeBetweenFrames();
+    float delay = direction->timeBetweenFrames;
+    if ( timeElapsedOnCurrentSprite <= delay && currentSprite < direction->framesCount ) return;
 
+    std::size_t previousSprite = currentSprite;
     if ( timeElapsedOnCurrentSprite > delay )
     {
         if ( delay != 0 )
@@ -339,13 +429,18 @@ void RuntimeSpriteObject::Update(const RuntimeScene & scene)
 
         timeElapsedOnCurrentSprite = 0;
     }
-    if ( currentSprite >= direction.GetSpritesCount() )
+    if ( currentSprite >= direction->framesCount )
     {
-        if ( direction.IsLooping() )  currentSprite = 0;
-        else  currentSprite = direction.GetSpritesCount() - 1;
+        if ( direction->loop )  currentSprite = 0;
+        else  currentSprite = direction->framesCount - 1;
     }
 
-    needUpdateCurrentSprite = true;
+    if ( currentSprite != previousSprite )
+    {
+        needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
+    }
 }
 
 const sf::Sprite & RuntimeSpriteObject::GetCurrentSFMLSprite() const
@@ -364,22 +459,23 @@ const gd::Sprite & RuntimeSpriteObject::GetCurrentSprite() const
 
 std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const
 {
-    if ( currentAnimation >= animations.size() )
+    std::size_t frameIndex = framesTable->GetFrameIndex(currentAnimation, currentDirection, currentSprite);
+    if ( frameIndex == gd::String::npos )
     {
         std::vector<Polygon2d> hitboxes; //Invalid animation, bail out.
         return hitboxes;
     }
-    const sf::Sprite & currentSFMLSprite = GetCurrentSFMLSprite();
+    const SpriteFramesTable::Frame & frame = framesTable->GetFrame(frameIndex);
+    const sf::Transform & transform = GetCurrentSFMLSprite().getTransform();
 
-    std::vector<Polygon2d> polygons = GetCurrentSprite().GetCollisionMask();
+    std::vector<Polygon2d> polygons = frame.hitBoxes;
     for (std::size_t i = 0;i<polygons.size();++i)
     {
         for (std::size_t j = 0;j<polygons[i].vertices.size();++j)
         {
-            sf::Vector2f newVertice = currentSFMLSprite.getTransform().transformPoint(
-                            !isFlippedX ? polygons[i].vertices[j].x : GetCurrentSprite().GetSFMLSprite().getLocalBounds().width-polygons[i].vertices[j].x,
-                            !isFlippedY ? polygons[i].vertices[j].y : GetCurrentSprite().GetSFMLSprite().getLocalBounds().height-polygons[i].vertices[j].y);
-            polygons[i].vertices[j] = newVertice;
+            polygons[i].vertices[j] = transform.transformPoint(
+                            !isFlippedX ? polygons[i].vertices[j].x : frame.width-polygons[i].vertices[j].x,
+                            !isFlippedY ? polygons[i].vertices[j].y : frame.height-polygons[i].vertices[j].y);
         }
     }
 
@@ -388,14 +484,14 @@ std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const
 
 bool RuntimeSpriteObject::SetSprite( std::size_t nb )
 {
-    if ( currentAnimation >= GetAnimationsCount() ||
-        currentDirection >= animations[currentAnimation].Get().GetDirectionsCount() ||
-        nb >= animations[currentAnimation].Get().GetDirection( currentDirection ).GetSpritesCount() ) return false;
+    if ( framesTable->GetFrameIndex(currentAnimation, currentDirection, nb) == gd::String::npos ) return false;
 
     currentSprite = nb;
     timeElapsedOnCurrentSprite = 0;
 
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
     return true;
 }
 
@@ -409,14 +505,16 @@ bool RuntimeSpriteObject::SetCurrentAnimation( std::size_t nb )
     timeElapsedOnCurrentSprite = 0;
 
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
     return true;
 }
 
 bool RuntimeSpriteObject::SetCurrentAnimation(const gd::String & newAnimationName)
 {
-    for(size_t i = 0;i<animations.size();++i)
+    for(size_t i = 0;i<framesTable->GetAnimationsCount();++i)
     {
-        const gd::String & name = animations[i].Get().GetName();
+        const gd::String & name = framesTable->GetAnimation(i)->name;
         if (!name.empty() && name == newAnimationName)
             return SetCurrentAnimation(i);
     }
@@ -427,7 +525,7 @@ bool RuntimeSpriteObject::SetCurrentAnimation(const gd::String & newAnimationNam
 const gd::String & RuntimeSpriteObject::GetCurrentAnimationName() const
 {
     if ( currentAnimation >= GetAnimationsCount() ) return badAnimation.GetName();
-    return animations[currentAnimation].Get().GetName();
+    return framesTable->GetAnimation(currentAnimation)->name;
 }
 
 bool RuntimeSpriteObject::IsCurrentAnimationName(const gd::String & name) const
@@ -439,17 +537,18 @@ bool RuntimeSpriteObject::SetDirection( float nb )
 {
     if ( currentAnimation >= GetAnimationsCount() ) return false;
 
-    if ( !animations[currentAnimation].Get().useMultipleDirections )
+    if ( !framesTable->GetAnimation(currentAnimation)->useMultipleDirections )
     {
         currentAngle = nb;
 
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
         return true;
     }
     else
     {
-        if ( nb >= animations[currentAnimation].Get().GetDirectionsCount() ||
-            animations[currentAnimation].Get().GetDirection( nb ).HasNoSprites() ) return false;
+        if ( framesTable->GetFrameIndex(currentAnimation, static_cast<std::size_t>(nb), 0) == gd::String::npos ) return false;
 
         if ( nb == currentDirection ) return true;
 
@@ -458,6 +557,8 @@ bool RuntimeSpriteObject::SetDirection( float nb )
         timeElapsedOnCurrentSprite = 0;
 
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
         return true;
     }
 }
@@ -466,11 +567,13 @@ bool RuntimeSpriteObject::SetAngle(float newAngle)
 {
     if ( currentAnimation >= GetAnimationsCount() ) return false;
 
-    if ( !animations[currentAnimation].Get().useMultipleDirections )
+    if ( !framesTable->GetAnimation(currentAnimation)->useMultipleDirections )
     {
         currentAngle = newAngle;
 
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
     }
     else
     {
@@ -487,7 +590,7 @@ float RuntimeSpriteObject::GetAngle() const
 {
     if ( currentAnimation >= GetAnimationsCount() ) return 0;
 
-    if ( !animations[currentAnimation].Get().useMultipleDirections )
+    if ( !framesTable->GetAnimation(currentAnimation)->useMultipleDirections )
         return currentAngle;
     else
         return currentDirection*45;
@@ -497,7 +600,7 @@ float RuntimeSpriteObject::GetCurrentDirectionOrAngle() const
 {
     if ( currentAnimation >= GetAnimationsCount() ) return 0;
 
-    if ( animations[currentAnimation].Get().useMultipleDirections )
+    if ( framesTable->GetAnimation(currentAnimation)->useMultipleDirections )
         return GetCurrentDirection();
     else
         return GetAngle();
@@ -507,8 +610,8 @@ bool RuntimeSpriteObject::AnimationEnded() const
 {
     if (currentAnimation >= GetAnimationsCount()) return true;
 
-    const gd::Direction & direction = animations[currentAnimation].Get().GetDirection( currentDirection );
-    return ( !direction.IsLooping() && currentSprite == direction.GetSpritesCount()-1 );
+    const SpriteFramesTable::Direction * direction = framesTable->GetDirection(currentAnimation, currentDirection);
+    return direction && !direction->loop && currentSprite == direction->framesCount-1;
 }
 
 void RuntimeSpriteObject::SetOpacity( float val )
@@ -520,6 +623,8 @@ void RuntimeSpriteObject::SetOpacity( float val )
 
     opacity = val;
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
 }
 
 void RuntimeSpriteObject::SetColor( unsigned int r, unsigned int v, unsigned int b )
@@ -528,6 +633,8 @@ void RuntimeSpriteObject::SetColor( unsigned int r, unsigned int v, unsigned int
     colorV = v;
     colorB = b;
     needUpdateCurrentSprite = true;
+    MarkAsChanged();
+    MarkGeometryChanged();
 }
 
 void RuntimeSpriteObject::FlipX(bool flip)
@@ -536,6 +643,8 @@ void RuntimeSpriteObject::FlipX(bool flip)
     {
         scaleX *= -1.0;
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
     }
     isFlippedX = flip;
 }
@@ -546,6 +655,8 @@ void RuntimeSpriteObject::FlipY(bool flip)
     {
         scaleY *= -1.0;
         needUpdateCurrentSprite = true;
+        MarkAsChanged();
+        MarkGeometryChanged();
     }
     isFlippedY = flip;
 }
@@ -622,7 +733,7 @@ bool RuntimeSpriteObject::ChangeProperty(std::size_t propertyNb, gd::String newV
     {
         if ( currentAnimation >= GetAnimationsCount() ) return false;
 
-        return animations[currentAnimation].Get().useMultipleDirections ? SetDirection(newValue.To<std::size_t>()) : SetAngle(newValue.To<float>());
+        return framesTable->GetAnimation(currentAnimation)->useMultipleDirections ? SetDirection(newValue.To<std::size_t>()) : SetAngle(newValue.To<float>());
     }
     else if ( propertyNb == 2 ) { return SetSprite(newValue.To<int>()); }
     else if ( propertyNb == 3 ) { SetOpacity(newValue.To<float>()); }
@@ -640,26 +751,22 @@ std::size_t RuntimeSpriteObject::GetNumberOfProperties() const
 #endif
 
 AnimationProxy::AnimationProxy() :
-    animation(new gd::Animation)
+    animation(std::make_shared<gd::Animation>())
 {
 }
 AnimationProxy::~AnimationProxy()
 {
-    delete animation;
 }
 
 AnimationProxy::AnimationProxy(const gd::Animation & animation_) :
-    animation(new gd::Animation(animation_))
+    animation(std::make_shared<gd::Animation>(animation_))
 {
 }
 
-AnimationProxy::AnimationProxy(const AnimationProxy & proxy) :
-    animation(new gd::Animation(proxy.Get()))
+bool AnimationProxy::MakeUnique()
 {
-}
-AnimationProxy & AnimationProxy::operator=(const AnimationProxy & rhs)
-{
-    *animation = gd::Animation(rhs.Get());
+    if ( animation.unique() ) return false;
 
-    return *this;
+    animation = std::make_shared<gd::Animation>(*animation);
+    return true;
 }
@@ -17,6 +17,7 @@ namespace gd { class SpriteObject; }
 namespace gd { class Animation; }
 namespace gd { class MainFrameWrapper; }
 namespace gd { class PropertyDescriptor; }
+class SpriteFramesTable;
 #if defined(GD_IDE_ONLY)
 class wxBitmap;
 class wxWindow;
@@ -26,6 +27,8 @@ class wxWindow;
  * \brief Wrapper around a pointer to Animation, used to reduce compile time.
  *
  * This proxy is used to avoid including Animation.h/Direction.h/Sprite.h and SFML headers.
+ * Copies of a proxy share the same animation: call MakeUnique before modifying
+ * the animation if it must not be changed for the copies.
  */
 class GD_API AnimationProxy
 {
@@ -33,15 +36,19 @@ public:
     AnimationProxy();
     AnimationProxy(const gd::Animation & animation);
     virtual ~AnimationProxy();
-    AnimationProxy(const AnimationProxy & proxy);
-    AnimationProxy & operator=(const AnimationProxy & rhs);
 
     gd::Animation & Get() {return *animation; }
     const gd::Animation & Get() const {return *animation; }
     gd::Animation & GetNonConst() const {return *animation; }
 
+    /**
+     * \brief Copy the animation if it is shared with other proxies.
+     * \return true if the animation was copied.
+     */
+    bool MakeUnique();
+
 private:
-    gd::Animation * animation;
+    std::shared_ptr<gd::Animation> animation;
 };
 
 /**
@@ -53,7 +60,8 @@ public:
 
     RuntimeSpriteObject(RuntimeScene & scene, const gd::SpriteObject & spriteObject);
     virtual ~RuntimeSpriteObject();
-    virtual std::unique_ptr<RuntimeObject> Clone() const { return gd::make_unique<RuntimeSpriteObject>(*this);}
+    virtual std::unique_ptr<RuntimeObject> Clone() const;
+    virtual bool SupportsChangeTracking() const { return true; }
 
     virtual bool ExtraInitializationFromInitialInstance(const gd::InitialInstance & position);
 
@@ -119,12 +127,12 @@ public:
     /**
      * \brief Stop the animation being played.
      */
-    void StopAnimation() { animationStopped = true; };
+    void StopAnimation() { MarkAsChanged(); animationStopped = true; };
 
     /**
      * \brief Play the current animation.
      */
-    void PlayAnimation() { animationStopped = false; };
+    void PlayAnimation() { MarkAsChanged(); animationStopped = false; };
 
     /**
      * \brief Check if the current animation is stopped.
@@ -173,7 +181,7 @@ public:
     bool AnimationEnded() const;
 
     float GetAnimationSpeedScale() const { return animationSpeedScale; }
-    void SetAnimationSpeedScale(float ratio) { animationSpeedScale = ratio; }
+    void SetAnimationSpeedScale(float ratio) { MarkAsChanged(); animationSpeedScale = ratio; }
 
     /**
      * \brief Change the frame of the animation being displayed.
@@ -268,7 +276,7 @@ public:
     /**
      * \brief Change the blend mode used to display the sprite.
      */
-    inline void SetBlendMode(unsigned int blendMode_) { blendMode = blendMode_; };
+    inline void SetBlendMode(unsigned int blendMode_) { MarkAsChanged(); blendMode = blendMode_; };
 
     /**
      * \brief Get the identifier of the blend mode used to display the sprite.
@@ -299,8 +307,30 @@ public:
      */
     void ChangeScale(const gd::String & operatorStr, double newValue);
 
+protected:
+    /**
+     * \brief Copy the object for a snapshot, sharing the animations with it.
+     */
+    virtual std::unique_ptr<RuntimeObject> CloneForSnapshot() const;
+
 private:
 
+    /**
+     * \brief Copy the current animation if it is shared with other objects, so that its images can be modified.
+     */
+    void MakeCurrentAnimationUnique();
+
+    /**
+     * \brief Update framesSprites so that it points to the sprites of the animations of the object.
+     */
+    void UpdateFramesSprites();
+
+    /**
+     * \brief Update the sprites and the frames table once the images, loaded in the
+     * background, are not placeholders anymore (see gd::ImageManager::EnableAsynchronousLoading).
+     */
+    void UpdateLoadedImages();
+
     //Animations, direction and current frame:
     std::size_t currentAnimation;
     std::size_t currentDirection;
@@ -313,8 +343,11 @@ private:
 
     mutable gd::Sprite * ptrToCurrentSprite; //Pointer to the current sprite
     mutable bool needUpdateCurrentSprite;
+    bool waitingForImages; ///< True if some images of the animations are still being loaded.
 
     std::vector < AnimationProxy > animations;
+    std::shared_ptr<const SpriteFramesTable> framesTable; ///< The animations, directions and frames, shared by the copies of the object.
+    std::vector < gd::Sprite * > framesSprites; ///< The sprite of each frame of framesTable, in animations.
 
     float opacity;
     unsigned int blendMode;
@@ -330,7 +363,7 @@ private:
     unsigned int colorB;
 
     //Null objects if need to return a bad object.
-    static gd::Sprite     * badSpriteDatas; ///< Used when no valid sprite can be displayed. Created when the first RuntimeSpriteObject is created
+    static gd::Sprite     * GetBadSpriteDatas(); ///< Return the sprite used when no valid sprite can be displayed.
     static gd::Animation    badAnimation;
 };
 
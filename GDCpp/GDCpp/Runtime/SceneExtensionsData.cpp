@@ -0,0 +1,13 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SceneExtensionsData.h"
+
+std::size_t SceneExtensionsData::slotsCount = 0;
+
+std::size_t SceneExtensionsData::RegisterSlot()
+{
+    return slotsCount++;
+}
@@ -0,0 +1,108 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef SCENEEXTENSIONSDATA_H
+#define SCENEEXTENSIONSDATA_H
+#include <memory>
+#include <vector>
+template <class T> class SceneExtensionDataSlot;
+
+/**
+ * \brief Contains the data stored by extensions in a RuntimeScene.
+ *
+ * Each kind of data is stored in a slot, identified by a SceneExtensionDataSlot
+ * registered once when the extension is loaded. Accessing the data of a scene
+ * is then just an access to an array, without any lookup or locking.
+ *
+ * \see SceneExtensionDataSlot
+ * \see RuntimeScene::GetExtensionData
+ */
+class GD_API SceneExtensionsData
+{
+public:
+    SceneExtensionsData() {};
+    virtual ~SceneExtensionsData() {};
+
+    /**
+     * \brief Get the data stored in the slot, creating it (using the default constructor) if needed.
+     */
+    template <class T>
+    T & Get(const SceneExtensionDataSlot<T> & slot)
+    {
+        std::size_t index = slot.GetIndex();
+        if (index >= slots.size()) slots.resize(index+1);
+        if (!slots[index]) slots[index] = std::make_shared<T>();
+
+        return *static_cast<T*>(slots[index].get());
+    }
+
+    /**
+     * \brief Return true if the data of the slot exists.
+     */
+    template <class T>
+    bool Has(const SceneExtensionDataSlot<T> & slot) const
+    {
+        return slot.GetIndex() < slots.size() && slots[slot.GetIndex()];
+    }
+
+    /**
+     * \brief Destroy the data stored in the slot. It will be created again by the next call to Get.
+     */
+    template <class T>
+    void Reset(const SceneExtensionDataSlot<T> & slot)
+    {
+        if (slot.GetIndex() < slots.size()) slots[slot.GetIndex()].reset();
+    }
+
+    /**
+     * \brief Destroy the data stored in all the slots.
+     */
+    void Clear() { slots.clear(); }
+
+    /**
+     * \brief Reserve a new slot, and return its index.
+     * \note Slots are registered when extensions are loaded, before any scene is played.
+     * \see SceneExtensionDataSlot
+     */
+    static std::size_t RegisterSlot();
+
+private:
+    std::vector< std::shared_ptr<void> > slots; ///< The data of each slot, or nullptr if not created.
+
+    static std::size_t slotsCount; ///< The number of registered slots.
+};
+
+/**
+ * \brief Identify the data of type T stored by an extension in each RuntimeScene.
+ *
+ * Declare a slot as a static member (or a global) of the extension, so that it
+ * is registered when the extension is loaded:
+ * \code
+ * //In the header:
+ * static const SceneExtensionDataSlot<MyManager> slot;
+ * //In the source file:
+ * const SceneExtensionDataSlot<MyManager> MyManager::slot;
+ * //To access the manager of a scene:
+ * MyManager & manager = scene.GetExtensionData(MyManager::slot);
+ * \endcode
+ *
+ * \see SceneExtensionsData
+ */
+template <class T>
+class SceneExtensionDataSlot
+{
+public:
+    SceneExtensionDataSlot() : index(SceneExtensionsData::RegisterSlot()) {};
+
+    /**
+     * \brief Get the index of the slot in SceneExtensionsData.
+     */
+    std::size_t GetIndex() const { return index; }
+
+private:
+    std::size_t index;
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+#include <memory>
+#include <vector>
+#include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCpp/Runtime/TimeManager.h"
+class RuntimeObject;
+
+/**
+ * \brief The state of a RuntimeScene at a given time, used to restore the scene later
+ * (save states, rollback, replays...).
+ *
+ * Snapshots contain the objects (with their variables, behaviors and forces), the scene variables and
+ * the time manager (with the scene timers).
+ * Objects are shared between snapshots as long as they are not changed: taking a snapshot only clones the
+ * objects changed since the previous snapshot (see RuntimeObject::GetSnapshot).
+ *
+ * \see RuntimeScene::TakeSnapshot
+ * \see RuntimeScene::RestoreSnapshot
+ * \ingroup GameEngine
+ */
+class GD_API SceneSnapshot
+{
+public:
+    SceneSnapshot() {};
+    virtual ~SceneSnapshot() {};
+
+    /**
+     * \brief Return the (read-only) objects stored in the snapshot.
+     */
+    const std::vector<std::shared_ptr<const RuntimeObject>> & GetObjects() const { return objects; }
+
+    /**
+     * \brief Return the scene variables stored in the snapshot.
+     */
+    const RuntimeVariablesContainer & GetVariables() const { return variables; }
+
+    /**
+     * \brief Return the time manager (and the timers) stored in the snapshot.
+     */
+    const TimeManager & GetTimeManager() const { return timeManager; }
+
+private:
+    friend class RuntimeScene;
+
+    std::vector<std::shared_ptr<const RuntimeObject>> objects; ///< The objects of the scene, possibly shared with other snapshots.
+    RuntimeVariablesContainer variables; ///< The scene variables.
+    TimeManager timeManager; ///< The time manager of the scene, containing the timers.
+};
+
+#endif // SCENESNAPSHOT_H
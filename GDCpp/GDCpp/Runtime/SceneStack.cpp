@@ -8,13 +8,26 @@
 #include "RuntimeGame.h"
 #include "CodeExecutionEngine.h"
 #include "SceneNameMangler.h"
+#include "GDCore/Project/ImageManager.h"
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Sleep.hpp>
+
+SceneStack::~SceneStack()
+{
+	CancelPreload();
+}
 
 bool SceneStack::Step()
 {
 	if (stack.empty()) return false;
 
 	auto & scene = stack.back();
-	if (scene->RenderAndStep())
+	scene->SetPreloadedScene(IsPreloaded(preloadingSceneName) ? preloadingSceneName : "");
+
+	bool changeRequested = scene->RenderAndStep();
+	if (!scene->GetRequestedPreload().empty()) Preload(scene->GetRequestedPreload());
+
+	if (changeRequested)
 	{
 		auto request = scene->GetRequestedChange();
         if (request.change == RuntimeScene::SceneChange::STOP_GAME) {
@@ -42,6 +55,7 @@ std::unique_ptr<RuntimeScene> SceneStack::Pop()
 
 	std::unique_ptr<RuntimeScene> scene = std::move(stack.back());
 	stack.pop_back();
+	UnloadLayoutsIfUnused({scene->GetName()});
 	return scene;
 }
 
@@ -53,33 +67,160 @@ RuntimeScene * SceneStack::Push(gd::String newSceneName)
         return nullptr;
     }
 
-	std::unique_ptr<RuntimeScene> newScene(new RuntimeScene(window, &game));
-    if (!newScene->LoadFromScene(game.GetLayout(newSceneName)))
+    if (!game.LoadLayout(newSceneName))
     {
-        if (errorCallback) errorCallback("Unable to load scene \"" + newSceneName + "\".");
+        if (errorCallback) errorCallback("Unable to load layout of scene \"" + newSceneName + "\".");
         return nullptr;
     }
 
-	if (loadCallback && !loadCallback(*newScene))
-	{
-		if (errorCallback) errorCallback("Unable to setup execution engine for scene \"" + newScene->GetName() + "\".");
-		return nullptr;
-	}
+    std::unique_ptr<RuntimeScene> newScene = TakePreloadedScene(newSceneName);
+    if (newScene)
+        newScene->FinishLoading();
+    else
+    {
+        newScene.reset(new RuntimeScene(window, &game));
+        if (!newScene->LoadFromScene(game.GetLayout(newSceneName)))
+        {
+            if (errorCallback) errorCallback("Unable to load scene \"" + newSceneName + "\".");
+            return nullptr;
+        }
+
+        if (loadCallback && !loadCallback(*newScene))
+        {
+            if (errorCallback) errorCallback("Unable to setup execution engine for scene \"" + newScene->GetName() + "\".");
+            return nullptr;
+        }
+    }
 
     newScene->ChangeRenderWindow(window);
+    newScene->SetFixedTimeStep(fixedTimeStep);
 	stack.push_back(std::move(newScene));
 	return stack.back().get();
 }
 
 RuntimeScene * SceneStack::Replace(gd::String newSceneName, bool clear)
 {
+    std::vector<gd::String> removedScenesNames;
     if (clear)
     {
-        while (!stack.empty()) stack.pop_back();
+        while (!stack.empty())
+        {
+            removedScenesNames.push_back(stack.back()->GetName());
+            stack.pop_back();
+        }
     }
     else
     {
-        if (!stack.empty()) stack.pop_back();
+        if (!stack.empty())
+        {
+            removedScenesNames.push_back(stack.back()->GetName());
+            stack.pop_back();
+        }
     }
-	return Push(newSceneName);
+
+	RuntimeScene * newScene = Push(newSceneName);
+	UnloadLayoutsIfUnused(removedScenesNames); //Done after the push, so that the layout is not reloaded if the same scene is launched again.
+	return newScene;
+}
+
+void SceneStack::UnloadLayoutsIfUnused(const std::vector<gd::String> & layoutsNames)
+{
+	if (!unloadUnusedLayouts) return;
+
+	for (auto & layoutName : layoutsNames)
+	{
+		bool isUsed = layoutName == preloadingSceneName;
+		for (auto & scene : stack)
+		{
+			if (scene->GetName() == layoutName) isUsed = true;
+		}
+
+		if (!isUsed) game.UnloadLayout(layoutName);
+	}
+}
+
+bool SceneStack::Preload(gd::String sceneName)
+{
+	if (!preloadingSceneName.empty() && preloadingSceneName == sceneName) return true;
+
+	if (!game.HasLayoutNamed(sceneName))
+	{
+		if (errorCallback) errorCallback("Scene \"" + sceneName + "\" does not exist.");
+		return false;
+	}
+
+	CancelPreload();
+
+	//Load the layout and start to decode its images: their textures are created by the scenes being played.
+	if (!game.PreloadLayoutImages(sceneName))
+	{
+		if (errorCallback) errorCallback("Unable to load layout of scene \"" + sceneName + "\".");
+		return false;
+	}
+
+	preloadingSceneName = sceneName;
+	preloadingFinished = false;
+	preloadingCancelled = false;
+	preloadingAwaited = false;
+	#if !defined(EMSCRIPTEN)
+	preloadingThread.reset(new sf::Thread(&SceneStack::PreloadScene, this));
+	preloadingThread->launch();
+	#else
+	PreloadScene();
+	#endif
+
+	return true;
+}
+
+bool SceneStack::IsPreloaded(const gd::String & sceneName) const
+{
+	if (preloadingSceneName.empty() || preloadingSceneName != sceneName) return false;
+
+	return preloadingFinished && preloadedScene && game.GetImageManager()->IsPreloadingFinished();
+}
+
+void SceneStack::PreloadScene()
+{
+	//Wait for the textures of the scene to be created on the main thread, so that
+	//they are not created by the objects from this thread.
+	#if !defined(EMSCRIPTEN)
+	auto imageManager = game.GetImageManager();
+	while (!preloadingCancelled && !preloadingAwaited && !imageManager->IsPreloadingFinished())
+		sf::sleep(sf::milliseconds(1));
+	#endif
+
+	if (!preloadingCancelled)
+	{
+		std::unique_ptr<RuntimeScene> newScene(new RuntimeScene(nullptr, &game));
+		if (newScene->PreloadFromScene(game.GetLayout(preloadingSceneName)) &&
+			(!loadCallback || loadCallback(*newScene)))
+			preloadedScene = std::move(newScene);
+	}
+
+	preloadingFinished = true;
+}
+
+std::unique_ptr<RuntimeScene> SceneStack::TakePreloadedScene(const gd::String & sceneName)
+{
+	if (preloadingSceneName.empty() || preloadingSceneName != sceneName) return nullptr;
+
+	//Create all the textures of the scene now, on the main thread, so that the objects
+	//created by the preloading thread only find textures already loaded.
+	game.GetImageManager()->UploadAllPreloadingImages();
+	preloadingAwaited = true;
+
+	if (preloadingThread) preloadingThread->wait();
+	preloadingThread.reset();
+	preloadingSceneName.clear();
+
+	return std::move(preloadedScene);
+}
+
+void SceneStack::CancelPreload()
+{
+	preloadingCancelled = true;
+	if (preloadingThread) preloadingThread->wait();
+	preloadingThread.reset();
+	preloadingSceneName.clear();
+	preloadedScene.reset();
 }
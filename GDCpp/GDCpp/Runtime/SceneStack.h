@@ -6,10 +6,12 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <atomic>
 #include <GDCpp/Runtime/String.h>
 class RuntimeGame;
 class RuntimeScene;
 namespace sf { class RenderWindow; }
+namespace sf { class Thread; }
 
 /**
  * A stack of RuntimeScene.
@@ -25,10 +27,17 @@ public:
 	 */
 	SceneStack(RuntimeGame & game_, sf::RenderWindow * window_) :
 		game(game_),
-		window(window_)
+		window(window_),
+		unloadUnusedLayouts(false),
+		fixedTimeStep(0),
+		preloadingFinished(false),
+		preloadingCancelled(false),
+		preloadingAwaited(false)
 	{
 	};
 
+	~SceneStack();
+
 	/**
 	 * \brief Execute one step of the game.
 	 *
@@ -64,6 +73,25 @@ public:
 	 */
 	RuntimeScene * Replace(gd::String newSceneName, bool clear = false);
 
+	/**
+	 * \brief Start to load a scene in the background, so that it can be pushed (or replace
+	 * the current scene) without freezing the game.
+	 *
+	 * The layout is loaded and its images are decoded immediately. A background thread then creates the
+	 * scene, its objects and its variables and calls the callback set with OnLoadScene (used to load the
+	 * events code). The textures are created, on the main thread, while the current scene is played.
+	 *
+	 * Only one scene is preloaded at a time: preloading another scene releases the previous one.
+	 * \return false if the scene does not exist.
+	 */
+	bool Preload(gd::String sceneName);
+
+	/**
+	 * \brief Return true if the scene was preloaded and can be started without delay.
+	 * \see SceneStack::Preload
+	 */
+	bool IsPreloaded(const gd::String & sceneName) const;
+
 	/**
 	 * \brief Set the callback called when an error occurs (loading failed...)
 	 */
@@ -74,10 +102,56 @@ public:
 	 */
 	void OnLoadScene(std::function<bool(RuntimeScene &)> cb) { loadCallback = cb; }
 
+	/**
+	 * \brief Set if the layouts of the game that were loaded lazily must be unloaded
+	 * when no scene of the stack is using them anymore.
+	 *
+	 * \see gd::Project::SetLazyLayoutsLoading
+	 */
+	void UnloadUnusedLayouts(bool enable = true) { unloadUnusedLayouts = enable; }
+
+	/**
+	 * \brief Set the duration of a frame, in microseconds, of the scenes pushed on the stack.
+	 * 0 (the default) to use the real time elapsed between frames.
+	 *
+	 * \see RuntimeScene::SetFixedTimeStep
+	 */
+	void SetFixedTimeStep(signed int timeStep) { fixedTimeStep = timeStep; }
+
 private:
+	/**
+	 * \brief Unload the layouts of the game that are not used by any scene of the stack,
+	 * if unloadUnusedLayouts is true.
+	 */
+	void UnloadLayoutsIfUnused(const std::vector<gd::String> & layoutsNames);
+
+	/**
+	 * \brief Create the scene being preloaded. Called on the preloading thread.
+	 */
+	void PreloadScene();
+
+	/**
+	 * \brief Return the scene preloaded with the specified name, if any, waiting for its preloading to be finished.
+	 */
+	std::unique_ptr<RuntimeScene> TakePreloadedScene(const gd::String & sceneName);
+
+	/**
+	 * \brief Stop the preloading of a scene and release the scene preloaded, if any.
+	 */
+	void CancelPreload();
+
 	RuntimeGame & game;
 	sf::RenderWindow * window;
+	bool unloadUnusedLayouts; ///< True to unload the layouts not used anymore by the scenes of the stack.
+	signed int fixedTimeStep; ///< The duration of a frame of the scenes, or 0 to use the real time.
 	std::vector<std::unique_ptr<RuntimeScene>> stack;
 	std::function<void(gd::String)> errorCallback;
 	std::function<bool(RuntimeScene &)> loadCallback;
+
+	gd::String preloadingSceneName; ///< The name of the scene being preloaded (or preloaded), if any.
+	std::unique_ptr<RuntimeScene> preloadedScene; ///< The scene created by the preloading thread.
+	std::atomic<bool> preloadingFinished; ///< True when the preloading thread has finished to create the scene.
+	std::atomic<bool> preloadingCancelled; ///< True to ask the preloading thread to stop as soon as possible.
+	std::atomic<bool> preloadingAwaited; ///< True when the scene is needed: the preloading thread must not wait for the textures anymore.
+	std::unique_ptr<sf::Thread> preloadingThread; ///< The thread creating the scene being preloaded (declared last to be stopped first).
 };
@@ -0,0 +1,77 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SimulationHost.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SceneStack.h"
+#include "GDCpp/Runtime/ImageManager.h"
+#include "GDCpp/Runtime/FontManager.h"
+#include "GDCpp/Runtime/ResourcesLoader.h"
+#include "GDCpp/Runtime/Project/ResourcesManager.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCore/Tools/ParallelTasks.h"
+
+SimulationHost::SimulationHost(RuntimeGame & game_) :
+    game(game_),
+    timeStep(1000000/60)
+{
+}
+
+SimulationHost::~SimulationHost()
+{
+}
+
+void SimulationHost::PrepareSharedData()
+{
+    //Create the singletons now, so that they are not created by several threads at once.
+    CppPlatform::Get();
+    gd::ResourcesLoader::Get();
+    FontManager::Get();
+
+    //Load all the images, so that the instances only find already loaded textures in the image manager.
+    std::shared_ptr<gd::ImageManager> imageManager = game.GetImageManager();
+
+    sharedTextures.clear();
+    std::vector<gd::String> resources = game.GetResourcesManager().GetAllResourcesList();
+    for (std::size_t i = 0;i < resources.size();++i)
+    {
+        if (game.GetResourcesManager().GetResource(resources[i]).GetKind() == "image")
+            sharedTextures.push_back(imageManager->GetSFMLTexture(resources[i]));
+    }
+}
+
+void SimulationHost::Run(std::size_t instancesCount, const gd::String & firstSceneName, std::size_t maximumFramesCount, std::size_t threadsCount)
+{
+    PrepareSharedData();
+
+    gd::ParallelTasks::Run(instancesCount, [&](std::size_t instance) {
+        RunInstance(instance, firstSceneName, maximumFramesCount);
+    }, threadsCount);
+}
+
+void SimulationHost::RunInstance(std::size_t instance, const gd::String & firstSceneName, std::size_t maximumFramesCount)
+{
+    //Each instance has its own copy of the game, but shares the textures.
+    RuntimeGame instanceGame;
+    instanceGame.LoadFromProject(game);
+    instanceGame.SetImageManager(game.GetImageManager());
+    if (startCallback) startCallback(instance, instanceGame);
+
+    SceneStack sceneStack(instanceGame, NULL);
+    sceneStack.SetFixedTimeStep(timeStep);
+    sceneStack.OnLoadScene(loadCallback);
+    sceneStack.OnError([this, instance](gd::String error) {
+        if (errorCallback) errorCallback(instance, error);
+    });
+
+    if (sceneStack.Push(firstSceneName))
+    {
+        for (std::size_t frame = 0;frame < maximumFramesCount && sceneStack.Step();++frame)
+            ;
+    }
+
+    if (finishCallback) finishCallback(instance, instanceGame, sceneStack);
+}
@@ -0,0 +1,120 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef SIMULATIONHOST_H
+#define SIMULATIONHOST_H
+#include <functional>
+#include <memory>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class RuntimeGame;
+class RuntimeScene;
+class SceneStack;
+class SFMLTextureWrapper;
+
+/**
+ * \brief Play several independent instances of a game at once, without rendering,
+ * each instance being played on a thread of a pool.
+ *
+ * Each instance has its own RuntimeGame (copied from the game given to the host,
+ * so that global variables, sounds and loaded layouts are not shared) and its own
+ * SceneStack. The images of the game and the platform metadata are loaded once and
+ * shared, read-only, by all the instances.
+ *
+ * Scenes are played with a fixed time step, so that an instance always gives the
+ * same result, whatever the number of instances played at once.
+ *
+ * Example:
+ * \code
+ * SimulationHost host(game);
+ * host.OnLoadScene([](RuntimeScene & scene) { return scene.GetCodeExecutionEngine()->LoadFunction(&EventsFunction); });
+ * host.OnInstanceFinished([&](std::size_t instance, RuntimeGame & instanceGame, SceneStack &) {
+ *     scores[instance] = instanceGame.GetVariables().Get("Score").GetValue();
+ * });
+ * host.Run(32, "Level 1", 3600);
+ * \endcode
+ *
+ * \warning Callbacks are called from the threads of the pool, for several instances at once.
+ * Extensions relying on process-wide state (for example, the sockets of the Network extension,
+ * or the random number generator) are not isolated between instances.
+ *
+ * \ingroup GameEngine
+ */
+class GD_API SimulationHost
+{
+public:
+    /**
+     * \brief Construct a host playing instances of the specified game.
+     * \note The game must not be modified while Run is called.
+     */
+    SimulationHost(RuntimeGame & game_);
+    virtual ~SimulationHost();
+
+    /**
+     * \brief Set the duration of a frame, in microseconds (1/60th of a second by default).
+     */
+    void SetFixedTimeStep(signed int timeStep_) { timeStep = timeStep_; }
+
+    /**
+     * \brief Get the duration of a frame, in microseconds.
+     */
+    signed int GetFixedTimeStep() const { return timeStep; }
+
+    /**
+     * \brief Set the function called when a scene of an instance is loaded (typically to
+     * setup its execution engine).
+     * \see SceneStack::OnLoadScene
+     */
+    void OnLoadScene(std::function<bool(RuntimeScene &)> cb) { loadCallback = cb; }
+
+    /**
+     * \brief Set the function called when an instance is created, before its first scene is loaded.
+     * Can be used to give different parameters to each instance.
+     */
+    void OnInstanceStarted(std::function<void(std::size_t, RuntimeGame &)> cb) { startCallback = cb; }
+
+    /**
+     * \brief Set the function called when an instance is finished, to get its results.
+     */
+    void OnInstanceFinished(std::function<void(std::size_t, RuntimeGame &, SceneStack &)> cb) { finishCallback = cb; }
+
+    /**
+     * \brief Set the function called when an error occurs in an instance.
+     */
+    void OnError(std::function<void(std::size_t, gd::String)> cb) { errorCallback = cb; }
+
+    /**
+     * \brief Play the instances, and return when all of them are finished.
+     *
+     * \param instancesCount The number of instances to play.
+     * \param firstSceneName The name of the scene launched by each instance.
+     * \param maximumFramesCount The number of frames after which an instance is stopped, if the game
+     * was not stopped before.
+     * \param threadsCount The number of threads used to play the instances (0 to use all processors).
+     */
+    void Run(std::size_t instancesCount, const gd::String & firstSceneName, std::size_t maximumFramesCount, std::size_t threadsCount = 0);
+
+private:
+    /**
+     * \brief Load the resources and singletons shared by the instances, so that they are only read
+     * by the threads playing the instances.
+     */
+    void PrepareSharedData();
+
+    /**
+     * \brief Play an instance, until its game is stopped or maximumFramesCount frames are played.
+     */
+    void RunInstance(std::size_t instance, const gd::String & firstSceneName, std::size_t maximumFramesCount);
+
+    RuntimeGame & game; ///< The game played by the instances.
+    signed int timeStep; ///< The duration of a frame, in microseconds.
+    std::vector< std::shared_ptr<SFMLTextureWrapper> > sharedTextures; ///< The images of the game, kept loaded while the host exists.
+    std::function<bool(RuntimeScene &)> loadCallback;
+    std::function<void(std::size_t, RuntimeGame &)> startCallback;
+    std::function<void(std::size_t, RuntimeGame &, SceneStack &)> finishCallback;
+    std::function<void(std::size_t, gd::String)> errorCallback;
+};
+
+#endif // SIMULATIONHOST_H
@@ -14,24 +14,46 @@
 using namespace std;
 
 Sound::Sound(gd::String pFile) :
+buffer(std::make_shared<sf::SoundBuffer>(gd::ResourcesLoader::Get()->LoadSoundBuffer(pFile))),
 file(pFile),
-volume(100)
+volume(100),
+priority(0)
 {
-    buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-    sound.setBuffer(buffer);
+    sound.setBuffer(*buffer);
+}
+
+Sound::Sound(gd::String pFile, std::shared_ptr<sf::SoundBuffer> pBuffer) :
+buffer(pBuffer),
+file(pFile),
+volume(100),
+priority(0)
+{
+    sound.setBuffer(*buffer);
 }
 
 Sound::Sound() :
-volume(100)
+buffer(std::make_shared<sf::SoundBuffer>()),
+volume(100),
+priority(0)
 {
-    sound.setBuffer(buffer);
+    sound.setBuffer(*buffer);
 }
 
 Sound::Sound(const Sound & copy) :
-    file(copy.file)
+    buffer(copy.buffer), //The buffer is shared rather than loaded again.
+    file(copy.file),
+    volume(copy.volume),
+    priority(copy.priority)
+{
+    sound.setBuffer(*buffer);
+}
+
+void Sound::SetBuffer(const gd::String & file_, std::shared_ptr<sf::SoundBuffer> buffer_)
 {
-    buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-    sound.setBuffer(buffer);
+    sound.stop();
+    sound.setBuffer(*buffer_); //Change the buffer of the sound before releasing the old one.
+    buffer = buffer_;
+    file = file_;
 }
 
 void Sound::SetVolume(float volume_, float globalVolume)
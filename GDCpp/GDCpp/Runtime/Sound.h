@@ -6,6 +6,7 @@
 #ifndef SOUND_H
 #define SOUND_H
 #include <SFML/Audio.hpp>
+#include <memory>
 #include "GDCpp/Runtime/String.h"
 
 /**
@@ -19,9 +20,20 @@ class GD_API Sound : sf::NonCopyable
 public:
     Sound();
     Sound(gd::String file);
+
+    /**
+     * \brief Create a sound playing an already loaded buffer, shared with other sounds.
+     * \see SoundManager::GetSoundBuffer
+     */
+    Sound(gd::String file, std::shared_ptr<sf::SoundBuffer> buffer);
     Sound(const Sound & copy);
     virtual ~Sound() {};
 
+    /**
+     * \brief Stop the sound and change the buffer played. Used to reuse a sound to play another file.
+     */
+    void SetBuffer(const gd::String & file, std::shared_ptr<sf::SoundBuffer> buffer);
+
     /**
      * \brief Get the sound status
      * \return sf::Music::Paused, sf::Music::Playing or sf::Music::Stopped.
@@ -60,8 +72,18 @@ public:
      */
     double GetPlayingOffset() const { return sound.getPlayingOffset().asSeconds(); };
 
+    /**
+     * Change the priority of the sound: when all voices are used, SoundManager stops the sound with the lowest priority.
+     */
+    void SetPriority(int priority_) { priority = priority_; };
+
+    /**
+     * Get the priority of the sound.
+     */
+    int GetPriority() const { return priority; };
+
     //Order is important :
-    sf::SoundBuffer buffer;
+    std::shared_ptr<sf::SoundBuffer> buffer; ///< The buffer played, which can be shared with other sounds.
     sf::Sound       sound;
 
     gd::String file;
@@ -75,6 +97,7 @@ public:
 
 private:
     float volume; ///< Volume is not directly stored in the sf::Sound as GD allows to change global volume.
+    int priority; ///< The priority of the sound, see SoundManager::PlaySound.
 };
 
 #endif // SOUND_H
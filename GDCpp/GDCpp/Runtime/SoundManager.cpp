@@ -14,6 +14,7 @@
 #include <vector>
 
 SoundManager::SoundManager() :
+    maxVoices(64),
     globalVolume(100),
     resourcesManager(nullptr)
 {
@@ -27,9 +28,62 @@ const gd::String & SoundManager::GetFileFromSoundName(const gd::String & name) c
     return resourcesManager->GetResource(name).GetFile();
 }
 
+std::shared_ptr<sf::SoundBuffer> SoundManager::GetSoundBuffer(const gd::String & name)
+{
+    auto it = soundBuffers.find(name);
+    if (it != soundBuffers.end())
+    {
+        std::shared_ptr<sf::SoundBuffer> buffer = it->second.lock();
+        if (buffer) return buffer;
+    }
+
+    std::shared_ptr<sf::SoundBuffer> buffer = std::make_shared<sf::SoundBuffer>(
+        gd::ResourcesLoader::Get()->LoadSoundBuffer(GetFileFromSoundName(name)));
+    soundBuffers[name] = buffer;
+    return buffer;
+}
+
+std::shared_ptr<Sound> SoundManager::GetVoice(int priority)
+{
+    //Reuse the voice of a sound that was stopped.
+    if (!freeVoices.empty())
+    {
+        std::shared_ptr<Sound> voice = freeVoices.back();
+        freeVoices.pop_back();
+        sounds.push_back(voice);
+        return voice;
+    }
+    for (std::size_t i = 0;i < sounds.size();++i)
+    {
+        if (sounds[i]->GetStatus() == sf::Sound::Stopped)
+            return sounds[i];
+    }
+
+    if (sounds.size() < maxVoices)
+    {
+        sounds.push_back(std::make_shared<Sound>());
+        return sounds.back();
+    }
+
+    //All voices are used: steal the voice with the lowest priority.
+    std::shared_ptr<Sound> stolenVoice;
+    for (std::size_t i = 0;i < sounds.size();++i)
+    {
+        if (sounds[i]->GetPriority() > priority) continue;
+
+        if (!stolenVoice || sounds[i]->GetPriority() < stolenVoice->GetPriority() ||
+            (sounds[i]->GetPriority() == stolenVoice->GetPriority() &&
+             sounds[i]->GetPlayingOffset() > stolenVoice->GetPlayingOffset()))
+            stolenVoice = sounds[i];
+    }
+
+    if (stolenVoice) stolenVoice->sound.stop();
+    return stolenVoice;
+}
+
 void SoundManager::PlaySoundOnChannel(const gd::String & name, unsigned int channel, bool repeat, float volume, float pitch)
 {
-    std::shared_ptr<Sound> sound = std::make_shared<Sound>(GetFileFromSoundName(name));
+    std::shared_ptr<Sound> sound = std::make_shared<Sound>(GetFileFromSoundName(name), GetSoundBuffer(name));
     sound->sound.play();
     sound->sound.setRelativeToListener(true);
 
@@ -39,15 +93,19 @@ void SoundManager::PlaySoundOnChannel(const gd::String & name, unsigned int chan
     GetSoundOnChannel(channel)->SetPitch(pitch);
 }
 
-void SoundManager::PlaySound(const gd::String & name, bool repeat, float volume, float pitch)
+void SoundManager::PlaySound(const gd::String & name, bool repeat, float volume, float pitch, int priority)
 {
-    sounds.push_back(std::shared_ptr<Sound>(new Sound(GetFileFromSoundName(name))));
-    sounds.back()->sound.play();
-    sounds.back()->sound.setRelativeToListener(true);
+    std::shared_ptr<Sound> voice = GetVoice(priority);
+    if (!voice) return; //All voices are playing sounds with a higher priority.
+
+    voice->SetBuffer(GetFileFromSoundName(name), GetSoundBuffer(name));
+    voice->SetPriority(priority);
+    voice->sound.play();
+    voice->sound.setRelativeToListener(true);
 
-    sounds.back()->sound.setLoop(repeat);
-    sounds.back()->SetVolume(volume, globalVolume);
-    sounds.back()->SetPitch(pitch);
+    voice->sound.setLoop(repeat);
+    voice->SetVolume(volume, globalVolume);
+    voice->SetPitch(pitch);
 }
 
 void SoundManager::PlayMusic(const gd::String & name, bool repeat, float volume, float pitch)
@@ -106,10 +164,17 @@ void SoundManager::PlayMusicOnChannel(const gd::String & name, unsigned int chan
 
 void SoundManager::ManageGarbage()
 {
-    for ( std::size_t i = 0;i < sounds.size();i++ )
+    //Only the voices being used are checked: stopped ones are moved to the free voices.
+    for ( std::size_t i = 0;i < sounds.size(); )
     {
         if ( sounds[i]->sound.getStatus() == sf::Sound::Stopped )
-            sounds.erase( sounds.begin() + i );
+        {
+            freeVoices.push_back(sounds[i]);
+            sounds[i] = sounds.back();
+            sounds.pop_back();
+        }
+        else
+            ++i;
     }
 
     for ( std::size_t i = 0;i < musics.size();i++ )
@@ -38,16 +38,23 @@ public:
     void SetResourcesManager(gd::ResourcesManager * resourcesManager_) { resourcesManager = resourcesManager_; }
 
     vector < std::shared_ptr<Music> >  musics;
-    vector < std::shared_ptr<Sound> >  sounds;
+    vector < std::shared_ptr<Sound> >  sounds; ///< The voices used by sounds played without channels, and not yet collected by ManageGarbage.
 
     /**
      * \brief Play a sound (wav files).
+     *
+     * The sound is played using one of the voices of the manager. If all the voices
+     * are used, the sound with the lowest priority (and, between sounds with the same
+     * priority, the one that played the longest) is stopped to play the new one.
+     * If all the sounds being played have a higher priority, the sound is not played.
+     *
      * \param file The resource name, or filename to load.
      * \param repeat true to loop the sound
      * \param volume The volume, between 0 and 100.
      * \param pitch The pithc, 1 by default
+     * \param priority The priority of the sound, 0 by default.
      */
-    void PlaySound(const gd::String & name, bool repeat, float volume, float pitch);
+    void PlaySound(const gd::String & name, bool repeat, float volume, float pitch, int priority = 0);
 
     /**
      * \brief Play a music (ogg files).
@@ -112,6 +119,27 @@ public:
      */
     void SetGlobalVolume(float volume);
 
+    /**
+     * \brief Change the maximum number of sounds played at the same time without channels.
+     * \note Sounds already played are not stopped if there are more sounds than the new maximum.
+     */
+    void SetMaxVoices(std::size_t maxVoices_) { maxVoices = maxVoices_; }
+
+    /**
+     * \brief Get the maximum number of sounds played at the same time without channels.
+     */
+    std::size_t GetMaxVoices() const { return maxVoices; }
+
+    /**
+     * \brief Get the buffer of a sound, loading it if it is not used by any other sound.
+     *
+     * Buffers are shared between all the sounds playing the same file, and are destroyed
+     * when no sound (or voice kept for reuse) uses them anymore.
+     *
+     * \param name The resource name, or filename to load.
+     */
+    std::shared_ptr<sf::SoundBuffer> GetSoundBuffer(const gd::String & name);
+
     /**
      * Destroy all sounds and musics
      */
@@ -120,17 +148,30 @@ public:
         musicsChannel.clear();
         soundsChannel.clear();
         sounds.clear();
+        freeVoices.clear();
         musics.clear();
     }
 
     /**
-     * Ensure sounds and musics without channels and stopped are destroyed.
+     * Ensure musics without channels and stopped are destroyed, and
+     * release the voices of stopped sounds so that they can be reused.
      */
     void ManageGarbage();
 
 private:
     const gd::String &  GetFileFromSoundName(const gd::String & name) const;
 
+    /**
+     * \brief Get a voice to play a sound of the specified priority.
+     * The voice is stopped and added to sounds. Returns nullptr if all voices are playing
+     * sounds with a higher priority.
+     */
+    std::shared_ptr<Sound> GetVoice(int priority);
+
+    std::vector< std::shared_ptr<Sound> > freeVoices; ///< Voices of stopped sounds, kept to be reused.
+    std::size_t maxVoices; ///< The maximum number of voices (playing or free) for sounds without channels.
+    std::map<gd::String, std::weak_ptr<sf::SoundBuffer> > soundBuffers; ///< The buffers used by sounds, by sound name.
+
     std::map<std::size_t, std::shared_ptr<Sound> >  soundsChannel;
     std::map<std::size_t, std::shared_ptr<Music> >  musicsChannel;
 
@@ -0,0 +1,53 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SpriteFramesTable.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+
+SpriteFramesTable::SpriteFramesTable(const std::vector<AnimationProxy> & animationsProxies)
+{
+    animations.reserve(animationsProxies.size());
+    for (std::size_t i = 0; i < animationsProxies.size(); ++i)
+    {
+        const gd::Animation & animation = animationsProxies[i].Get();
+
+        Animation anim;
+        anim.name = animation.GetName();
+        anim.firstDirection = directions.size();
+        anim.directionsCount = animation.GetDirectionsCount();
+        anim.useMultipleDirections = animation.useMultipleDirections;
+        animations.push_back(anim);
+
+        for (std::size_t j = 0; j < animation.GetDirectionsCount(); ++j)
+        {
+            const gd::Direction & direction = animation.GetDirection(j);
+
+            Direction dir;
+            dir.firstFrame = frames.size();
+            dir.framesCount = direction.GetSpritesCount();
+            dir.timeBetweenFrames = direction.GetTimeBetweenFrames();
+            dir.loop = direction.IsLooping();
+            directions.push_back(dir);
+
+            for (std::size_t k = 0; k < direction.GetSpritesCount(); ++k)
+            {
+                const gd::Sprite & sprite = direction.GetSprite(k);
+
+                Frame frame;
+                frame.originX = sprite.GetOrigin().GetX();
+                frame.originY = sprite.GetOrigin().GetY();
+                frame.centerX = sprite.GetCenter().GetX();
+                frame.centerY = sprite.GetCenter().GetY();
+                frame.width = sprite.GetSFMLSprite().getLocalBounds().width;
+                frame.height = sprite.GetSFMLSprite().getLocalBounds().height;
+                frame.hitBoxes = sprite.GetCollisionMask();
+                frames.push_back(frame);
+            }
+        }
+    }
+}
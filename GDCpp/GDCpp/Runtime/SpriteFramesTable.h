@@ -0,0 +1,104 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef SPRITEFRAMESTABLE_H
+#define SPRITEFRAMESTABLE_H
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/Polygon2d.h"
+class AnimationProxy;
+
+/**
+ * \brief Flat tables describing the animations, directions and frames of a sprite object.
+ *
+ * Built once from the animations of a RuntimeSpriteObject and shared by all its copies,
+ * so that animating the object does not go through gd::Animation, gd::Direction and gd::Sprite.
+ *
+ * Frames of all the directions are stored contiguously: a frame is identified by its
+ * index in the table (see GetFrameIndex).
+ *
+ * \see RuntimeSpriteObject
+ * \ingroup GameEngine
+ */
+class GD_API SpriteFramesTable
+{
+public:
+    struct Frame
+    {
+        float originX;
+        float originY;
+        float centerX;
+        float centerY;
+        float width; ///< The width of the image of the frame.
+        float height; ///< The height of the image of the frame.
+        std::vector<Polygon2d> hitBoxes; ///< The collision mask of the frame, not transformed.
+    };
+
+    struct Direction
+    {
+        std::size_t firstFrame; ///< The index of the first frame of the direction.
+        std::size_t framesCount;
+        float timeBetweenFrames;
+        bool loop;
+    };
+
+    struct Animation
+    {
+        gd::String name;
+        std::size_t firstDirection; ///< The index of the first direction of the animation.
+        std::size_t directionsCount;
+        bool useMultipleDirections;
+    };
+
+    /**
+     * \brief Build the tables from the animations of a sprite object.
+     * \note Images must be loaded in the sprites, as they are used to compute the automatic collision masks.
+     */
+    SpriteFramesTable(const std::vector<AnimationProxy> & animations);
+    virtual ~SpriteFramesTable() {};
+
+    std::size_t GetAnimationsCount() const { return animations.size(); }
+
+    /**
+     * \brief Return the animation, or NULL if it does not exist.
+     */
+    const Animation * GetAnimation(std::size_t animation) const
+    {
+        return animation < animations.size() ? &animations[animation] : NULL;
+    }
+
+    /**
+     * \brief Return the direction of the animation, or NULL if it does not exist.
+     * \note Like gd::Animation::GetDirection, the first direction is returned for animations
+     * not using multiple directions.
+     */
+    const Direction * GetDirection(std::size_t animation, std::size_t direction) const
+    {
+        if ( animation >= animations.size() ) return NULL;
+
+        const Animation & anim = animations[animation];
+        if ( !anim.useMultipleDirections ) direction = 0;
+        return direction < anim.directionsCount ? &directions[anim.firstDirection + direction] : NULL;
+    }
+
+    /**
+     * \brief Return the index of the frame, or gd::String::npos if it does not exist.
+     */
+    std::size_t GetFrameIndex(std::size_t animation, std::size_t direction, std::size_t frame) const
+    {
+        const Direction * dir = GetDirection(animation, direction);
+        return (dir && frame < dir->framesCount) ? dir->firstFrame + frame : gd::String::npos;
+    }
+
+    std::size_t GetFramesCount() const { return frames.size(); }
+    const Frame & GetFrame(std::size_t index) const { return frames[index]; }
+
+private:
+    std::vector<Animation> animations;
+    std::vector<Direction> directions;
+    std::vector<Frame> frames;
+};
+
+#endif // SPRITEFRAMESTABLE_H
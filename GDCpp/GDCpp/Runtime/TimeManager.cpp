@@ -14,7 +14,7 @@ void TimeManager::Reset()
     timeFromStart = 0;
     pauseTime = 0;
 
-    timers.clear();
+    timers.Clear();
 }
 
 bool TimeManager::Update(signed int realElapsedTime, double minimumFPS)
@@ -37,33 +37,7 @@ bool TimeManager::Update(signed int realElapsedTime, double minimumFPS)
     timeFromStart += elapsedTime;
     pauseTime = 0;
 
-    for (auto it = timers.begin();it != timers.end();++it)
-        it->second.UpdateTime(elapsedTime);
+    timers.UpdateTimers(elapsedTime);
 
     return true;
 }
-
-void TimeManager::AddTimer(gd::String name)
-{
-    ManualTimer newTimer;
-    timers[name] = newTimer;
-}
-
-bool TimeManager::HasTimer(gd::String name) const
-{
-    return timers.find(name) != timers.end();
-}
-
-ManualTimer & TimeManager::GetTimer(gd::String name)
-{
-    if (!HasTimer(name)) return nullTimer;
-
-    return timers[name];
-}
-
-void TimeManager::RemoveTimer(gd::String name)
-{
-    if (!HasTimer(name)) return;
-
-    timers.erase(name);
-}
@@ -5,9 +5,9 @@
  */
 #ifndef TIMEMANAGER_H
 #define TIMEMANAGER_H
-#include <map>
 #include "GDCpp/Runtime/String.h"
 #include "GDCpp/Runtime/ManualTimer.h"
+#include "GDCpp/Runtime/TimersContainer.h"
 
 /**
  * \brief Manage the timers and times elapsed during last
@@ -71,20 +71,26 @@ public:
     void NotifyPauseWasMade(signed long long pauseTime_) { pauseTime += pauseTime_; }
 
     /** \name Timers
-     * Functions to manipulate timers
+     * Functions to manipulate timers. Timers can be accessed using their name or, faster,
+     * using the index returned by TimersContainer::GetTimerIndex.
      */
     ///@{
-    void AddTimer(gd::String name);
-    bool HasTimer(gd::String name) const;
-    ManualTimer & GetTimer(gd::String name);
-    void RemoveTimer(gd::String name);
+    void AddTimer(const gd::String & name) { AddTimer(timers.GetIndexOf(name)); }
+    bool HasTimer(const gd::String & name) const { return HasTimer(timers.GetIndexOf(name)); }
+    ManualTimer & GetTimer(const gd::String & name) { return GetTimer(timers.GetIndexOf(name)); }
+    void RemoveTimer(const gd::String & name) { RemoveTimer(timers.GetIndexOf(name)); }
+
+    void AddTimer(std::size_t index) { timers.AddTimer(index); }
+    bool HasTimer(std::size_t index) const { return timers.HasTimer(index); }
+    ManualTimer & GetTimer(std::size_t index) { return timers.HasTimer(index) ? timers.GetTimer(index) : nullTimer; }
+    void RemoveTimer(std::size_t index) { timers.RemoveTimer(index); }
 
     /**
      * \brief Provide a direct access to all the timers.
      *
      * Useful to build a custom interface (i.e: debugger) displaying the timers.
      */
-    std::map<gd::String, ManualTimer> & GetTimers() { return timers; }
+    TimersContainer & GetTimers() { return timers; }
     ///@}
 
 private:
@@ -95,7 +101,7 @@ private:
     signed long long timeFromStart; ///< Time, in microseconds, elapsed since the beginning.
     signed long long pauseTime; ///< Time to be subtracted to realElapsedTime for the current frame.
 
-    std::map<gd::String, ManualTimer> timers; ///<Timers of the scene.
+    TimersContainer timers; ///<Timers of the scene.
     ManualTimer nullTimer; ///<Timer with a time which is always 0.
 };
 
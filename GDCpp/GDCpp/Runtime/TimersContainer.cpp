@@ -0,0 +1,101 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/TimersContainer.h"
+#include <algorithm>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+
+namespace
+{
+
+/**
+ * \brief The names of the timers registered by TimersContainer::GetTimerIndex.
+ * Function-local statics are used as generated code can register names during its own static initialization.
+ */
+struct TimersRegistry
+{
+    std::unordered_map<gd::String, std::size_t> indices;
+    std::vector<gd::String> names;
+    sf::Mutex mutex;
+
+    static TimersRegistry & Get()
+    {
+        static TimersRegistry registry;
+        return registry;
+    }
+};
+
+}
+
+std::size_t TimersContainer::GetTimerIndex(const gd::String & name)
+{
+    TimersRegistry & registry = TimersRegistry::Get();
+    sf::Lock lock(registry.mutex);
+
+    auto it = registry.indices.find(name);
+    if (it != registry.indices.end()) return it->second;
+
+    std::size_t index = registry.names.size();
+    registry.names.push_back(name);
+    registry.indices[name] = index;
+    return index;
+}
+
+gd::String TimersContainer::GetTimerName(std::size_t index)
+{
+    TimersRegistry & registry = TimersRegistry::Get();
+    sf::Lock lock(registry.mutex);
+
+    return index < registry.names.size() ? registry.names[index] : "";
+}
+
+std::size_t TimersContainer::GetIndexOf(const gd::String & name) const
+{
+    auto it = indicesCache.find(name);
+    if (it != indicesCache.end()) return it->second;
+
+    std::size_t index = GetTimerIndex(name);
+    indicesCache[name] = index;
+    return index;
+}
+
+void TimersContainer::AddTimer(std::size_t index)
+{
+    if (index >= timers.size())
+    {
+        timers.resize(index+1);
+        timersExist.resize(index+1, false);
+    }
+
+    if (!timersExist[index]) existingTimers.push_back(index);
+    timersExist[index] = true;
+    timers[index] = ManualTimer();
+}
+
+void TimersContainer::RemoveTimer(std::size_t index)
+{
+    if (!HasTimer(index)) return;
+
+    timersExist[index] = false;
+    auto it = std::find(existingTimers.begin(), existingTimers.end(), index);
+    *it = existingTimers.back();
+    existingTimers.pop_back();
+}
+
+void TimersContainer::Clear()
+{
+    timers.clear();
+    timersExist.clear();
+    existingTimers.clear();
+}
+
+std::vector<std::size_t> TimersContainer::GetTimersIndices() const
+{
+    std::vector<std::size_t> indices = existingTimers;
+    std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
@@ -0,0 +1,105 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef TIMERSCONTAINER_H
+#define TIMERSCONTAINER_H
+#include <vector>
+#include <unordered_map>
+#include "GDCpp/Runtime/String.h"
+#include "GDCpp/Runtime/ManualTimer.h"
+
+/**
+ * \brief Store timers in a contiguous array, each timer being identified by an index.
+ *
+ * Indices are given by TimersContainer::GetTimerIndex and are shared by all the containers
+ * of the game: the code generated from events resolves the index of timers having a literal
+ * name only once, when the code is loaded. Other names are resolved using a hash map.
+ *
+ * \see TimeManager
+ * \ingroup GameEngine
+ */
+class GD_API TimersContainer
+{
+public:
+    TimersContainer() {};
+    virtual ~TimersContainer() {};
+
+    /**
+     * \brief Get the index associated to a timer name, registering the name if necessary.
+     * \note Thread-safe.
+     */
+    static std::size_t GetTimerIndex(const gd::String & name);
+
+    /**
+     * \brief Get the name associated to a timer index.
+     * \note Thread-safe.
+     */
+    static gd::String GetTimerName(std::size_t index);
+
+    /**
+     * \brief Get the index of a timer from its name.
+     *
+     * Same as TimersContainer::GetTimerIndex but the result is cached in the container.
+     */
+    std::size_t GetIndexOf(const gd::String & name) const;
+
+    /**
+     * \brief Return true if the timer with the specified index exists.
+     */
+    bool HasTimer(std::size_t index) const { return index < timersExist.size() && timersExist[index]; }
+
+    /**
+     * \brief Create the timer with the specified index, or reset it if it already exists.
+     */
+    void AddTimer(std::size_t index);
+
+    /**
+     * \brief Get the timer with the specified index, creating it if it does not exist.
+     */
+    ManualTimer & GetTimer(std::size_t index)
+    {
+        if (!HasTimer(index)) AddTimer(index);
+        return timers[index];
+    }
+
+    /**
+     * \brief Remove the timer with the specified index.
+     */
+    void RemoveTimer(std::size_t index);
+
+    /**
+     * \brief Update all the existing timers with the time elapsed, in microseconds.
+     */
+    void UpdateTimers(signed long long elapsedTime)
+    {
+        for (std::size_t i = 0;i<existingTimers.size();++i)
+            timers[existingTimers[i]].UpdateTime(elapsedTime);
+    }
+
+    /**
+     * \brief Remove all the timers.
+     */
+    void Clear();
+
+    /**
+     * \brief Return the number of existing timers.
+     */
+    std::size_t GetTimersCount() const { return existingTimers.size(); }
+
+    /**
+     * \brief Return the indices of the existing timers.
+     *
+     * Useful to build a custom interface (i.e: debugger) displaying the timers.
+     */
+    std::vector<std::size_t> GetTimersIndices() const;
+
+private:
+    std::vector<ManualTimer> timers; ///< The timers, stored by index.
+    std::vector<bool> timersExist; ///< For each index, true if the timer exists.
+    std::vector<std::size_t> existingTimers; ///< The indices of the existing timers, in no particular order.
+    mutable std::unordered_map<gd::String, std::size_t> indicesCache; ///< The indices of the names already resolved by the container.
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#include <unordered_map>
+#include <vector>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include "GDCpp/Runtime/TriggerOnceConditions.h"
+
+namespace
+{
+
+/**
+ * \brief The ranges of indices reserved by TriggerOnceConditions::ReserveIndices.
+ * Function-local statics are used as generated code reserves indices during its own static initialization.
+ */
+struct TriggerOnceRegistry
+{
+    std::unordered_map<gd::String, std::pair<std::size_t, std::size_t>> ranges; ///< First index and count, for each code name.
+    std::vector<std::pair<std::size_t, std::size_t>> freeRanges; ///< First index and count of the ranges not used anymore.
+    std::size_t indicesCount;
+    sf::Mutex mutex;
+
+    TriggerOnceRegistry() : indicesCount(0) {};
+
+    static TriggerOnceRegistry & Get()
+    {
+        static TriggerOnceRegistry registry;
+        return registry;
+    }
+};
+
+}
+
+std::size_t TriggerOnceConditions::ReserveIndices(const gd::String & codeName, std::size_t count)
+{
+    TriggerOnceRegistry & registry = TriggerOnceRegistry::Get();
+    sf::Lock lock(registry.mutex);
+
+    auto it = registry.ranges.find(codeName);
+    if (it != registry.ranges.end())
+    {
+        std::pair<std::size_t, std::size_t> & range = it->second;
+        if (count <= range.second) return range.first;
+
+        //The last range reserved can be extended.
+        if (range.first + range.second == registry.indicesCount)
+        {
+            registry.indicesCount += count - range.second;
+            range.second = count;
+            return range.first;
+        }
+
+        //Otherwise, the range is given back to be used by other code.
+        registry.freeRanges.push_back(range);
+        registry.ranges.erase(it);
+    }
+
+    //Use a range given back if one is large enough, the remaining indices being kept for later.
+    for (std::size_t i = 0; i < registry.freeRanges.size(); ++i)
+    {
+        std::pair<std::size_t, std::size_t> & freeRange = registry.freeRanges[i];
+        if (freeRange.second < count) continue;
+
+        std::size_t firstIndex = freeRange.first;
+        freeRange.first += count;
+        freeRange.second -= count;
+        if (freeRange.second == 0) registry.freeRanges.erase(registry.freeRanges.begin() + i);
+
+        registry.ranges[codeName] = std::make_pair(firstIndex, count);
+        return firstIndex;
+    }
+
+    std::size_t firstIndex = registry.indicesCount;
+    registry.indicesCount += count;
+    registry.ranges[codeName] = std::make_pair(firstIndex, count);
+    return firstIndex;
+}
+
+void TriggerOnceConditions::StartNewFrame(std::size_t newFrame)
+{
+    if (newFrame == frame) return;
+
+    if (newFrame == frame+1)
+        triggeredLastFrame.swap(triggered);
+    else
+        triggeredLastFrame.assign(triggeredLastFrame.size(), false);
+
+    triggered.assign(triggered.size(), false);
+    frame = newFrame;
+}
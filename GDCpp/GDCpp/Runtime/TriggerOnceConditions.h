@@ -0,0 +1,72 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+#ifndef TRIGGERONCECONDITIONS_H
+#define TRIGGERONCECONDITIONS_H
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+
+/**
+ * \brief Store the state of "Trigger once" conditions in two bitsets: the conditions
+ * triggered during the current frame and the ones triggered during the last frame.
+ *
+ * Each condition is identified by a dense index. The code generated from events numbers its
+ * conditions from 0 and adds the first index of a range reserved when the code is loaded
+ * (see TriggerOnceConditions::ReserveIndices), so that scene events and external events
+ * sharing the same RuntimeContext never use the same indices.
+ *
+ * \see RuntimeContext
+ * \ingroup GameEngine
+ */
+class GD_API TriggerOnceConditions
+{
+public:
+    TriggerOnceConditions() : frame(0) {};
+    virtual ~TriggerOnceConditions() {};
+
+    /**
+     * \brief Reserve \a count indices for the conditions of the code called \a codeName,
+     * and return the first one.
+     *
+     * The same range is returned when the code is loaded again. If it has more conditions
+     * than the indices previously reserved, the range is extended when possible, otherwise
+     * it is replaced by a new one and its indices can be reserved again by other code.
+     * \note Thread-safe.
+     */
+    static std::size_t ReserveIndices(const gd::String & codeName, std::size_t count);
+
+    /**
+     * \brief Return true only if the condition with the specified index was not triggered
+     * during the last frame, and remember that it was triggered during this frame.
+     */
+    bool TriggerOnce(std::size_t index)
+    {
+        if (index >= triggered.size()) triggered.resize(index+1, false);
+        triggered[index] = true;
+
+        return index >= triggeredLastFrame.size() || !triggeredLastFrame[index];
+    }
+
+    /**
+     * \brief Start the frame with the specified number: the conditions triggered during
+     * the current frame become the ones triggered during the last frame.
+     *
+     * If frames were skipped (i.e: the conditions of an object were not tested during
+     * the last frame), no condition is considered as triggered during the last frame.
+     */
+    void StartNewFrame(std::size_t newFrame);
+
+    /**
+     * \brief Return the number of the current frame.
+     */
+    std::size_t GetFrame() const { return frame; }
+
+private:
+    std::vector<bool> triggered; ///< For each index, true if the condition was triggered during the current frame.
+    std::vector<bool> triggeredLastFrame; ///< For each index, true if the condition was triggered during the last frame.
+    std::size_t frame; ///< The number of the current frame.
+};
+
+#endif
@@ -90,6 +90,7 @@ int main(int argc, char *argv[])
     gd::String json = gd::ResourcesLoader::Get()->LoadPlainText("gd-project.json");
 
     SerializerElement rootElement = Serializer::FromJSON(json);
+    game.SetLazyLayoutsLoading(); //Scenes are only loaded when launched by the SceneStack.
     game.UnserializeFrom(rootElement);
 
     RuntimeGame runtimeGame;
@@ -134,6 +134,8 @@ int main( int argc, char *p_argv[] )
         TiXmlHandle hdl(&doc);
         gd::SerializerElement rootElement;
         gd::Serializer::FromXML(rootElement, hdl.FirstChildElement().Element());
+        game.SetLoadingThreadsCount(0); //Load the scenes using all the processors.
+        game.SetLazyLayoutsLoading(); //Scenes are only loaded when launched by the SceneStack.
         game.UnserializeFrom(rootElement);
 	}
 
@@ -170,6 +172,7 @@ int main( int argc, char *p_argv[] )
 
     //Initialize image manager and load always loaded images
     game.GetImageManager()->LoadPermanentImages();
+    game.GetImageManager()->EnableAsynchronousLoading(); //Images not preloaded are displayed as invalid until they are loaded in the background.
 
     //Create main window
     sf::RenderWindow window;
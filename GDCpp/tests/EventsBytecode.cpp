@@ -0,0 +1,110 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the interpreter of events lowered to bytecode.
+ */
+#include "catch.hpp"
+#include <memory>
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/EventsBytecode.h"
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
+
+namespace
+{
+	double storedValue = 0;
+
+	EventsBytecode::FunctionCall MakeCall(const gd::String & function, std::vector<unsigned int> arguments,
+		EventsBytecode::FunctionCall::ResultType resultType = EventsBytecode::FunctionCall::NoResult,
+		unsigned int result = EventsBytecode::NoRegister)
+	{
+		EventsBytecode::FunctionCall call;
+		call.function = function;
+		call.arguments = arguments;
+		call.resultType = resultType;
+		call.result = result;
+		return call;
+	}
+
+	/**
+	 * \brief Lowered events storing the sum of Double(i) for i from 0 to 2, if IsPositive(3) is true.
+	 */
+	std::shared_ptr<EventsBytecode> MakeLoopBytecode()
+	{
+		std::shared_ptr<EventsBytecode> bytecode = std::make_shared<EventsBytecode>();
+		bytecode->name = "Scene EventsBytecode";
+		bytecode->numbersCount = 7;
+		bytecode->numberConstants.push_back(std::make_pair(0, 3.0));
+		bytecode->numberConstants.push_back(std::make_pair(1, 0.0));
+
+		bytecode->calls.push_back(MakeCall("Test::IsPositive", {0}, EventsBytecode::FunctionCall::ConditionResult, 6));
+		bytecode->calls.push_back(MakeCall("Test::Double", {2}, EventsBytecode::FunctionCall::NumberResult, 4));
+		bytecode->calls.push_back(MakeCall("Test::Store", {5}));
+
+		typedef EventsBytecode::Instruction Instruction;
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Call, 0));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::JumpIfFalse, 6, 11));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Move, 2, 1));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Move, 5, 1));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Less, 3, 2, 0));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::JumpIfFalse, 3, 10));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Call, 1));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Add, 5, 5, 4));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Increment, 2));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Jump, 4));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Call, 2));
+		bytecode->instructions.push_back(Instruction(EventsBytecode::Return));
+
+		return bytecode;
+	}
+}
+
+TEST_CASE( "EventsBytecodeInterpreter", "[game-engine]" ) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	RuntimeContext context(&scene);
+
+	EventsFunctionsTable table;
+	table.Add("Test::IsPositive", [](EventsFunctionCall & call) { call.SetConditionResult(call.GetNumber(0) > 0); });
+	table.Add("Test::Double", [](EventsFunctionCall & call) { call.SetNumberResult(call.GetNumber(0)*2); });
+	table.Add("Test::Store", [](EventsFunctionCall & call) { storedValue = call.GetNumber(0); });
+
+	SECTION("Loops and calls") {
+		storedValue = 0;
+		EventsBytecodeInterpreter interpreter(MakeLoopBytecode(), table);
+		REQUIRE(interpreter.IsValid() == true);
+
+		interpreter.Execute(context);
+		REQUIRE(storedValue == 6);
+
+		//Registers are kept between frames, but the events give the same result.
+		storedValue = 0;
+		interpreter.Execute(context);
+		REQUIRE(storedValue == 6);
+	}
+	SECTION("Inverted conditions") {
+		storedValue = 0;
+		std::shared_ptr<EventsBytecode> bytecode = MakeLoopBytecode();
+		bytecode->calls[0].inverted = true;
+
+		EventsBytecodeInterpreter interpreter(bytecode, table);
+		interpreter.Execute(context);
+		REQUIRE(storedValue == 0);
+	}
+	SECTION("Missing functions") {
+		std::shared_ptr<EventsBytecode> bytecode = MakeLoopBytecode();
+		bytecode->calls[1].function = "Test::Missing";
+
+		REQUIRE(EventsBytecodeInterpreter::CanRun(*MakeLoopBytecode(), table) == true);
+		REQUIRE(EventsBytecodeInterpreter::CanRun(*bytecode, table) == false);
+
+		EventsBytecodeInterpreter interpreter(bytecode, table);
+		REQUIRE(interpreter.IsValid() == false);
+		REQUIRE(interpreter.GetMissingFunction() == "Test::Missing");
+	}
+}
@@ -0,0 +1,232 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lowering of events to bytecode, run by EventsBytecodeInterpreter.
+ */
+#include "../catch.hpp"
+#include <memory>
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCpp/Events/CodeGeneration/EventsBytecodeGenerator.h"
+#include "GDCpp/Events/CodeGeneration/EventsFunctionsTableCodeGenerator.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/EventsBytecodeInterpreter.h"
+#include "GDCpp/Runtime/EventsFunctionsTable.h"
+
+namespace
+{
+	/**
+	 * \brief Fill \a table with the functions used by the tests, doing what the functions
+	 * generated by EventsFunctionsTableCodeGenerator do.
+	 */
+	void FillFunctionsTable(EventsFunctionsTable & table)
+	{
+		const gd::Platform & platform = CppPlatform::Get();
+		EventsFunctionsTableCodeGenerator functionsTable(platform, {"BuiltinObject", "BuiltinVariables"});
+		auto conditionKey = [&](const gd::String & type, const gd::String & operatorString) {
+			return functionsTable.GetInstructionFunctionKey(gd::MetadataProvider::GetConditionMetadata(platform, type), operatorString);
+		};
+		auto actionKey = [&](const gd::String & type, const gd::String & operatorString) {
+			return functionsTable.GetInstructionFunctionKey(gd::MetadataProvider::GetActionMetadata(platform, type), operatorString);
+		};
+
+		table.Add(conditionKey("PosX", "<"), [](EventsFunctionCall & call) { call.SetConditionResult(call.object->GetX() < call.GetNumber(2)); });
+		table.Add(conditionKey("PosX", ">"), [](EventsFunctionCall & call) { call.SetConditionResult(call.object->GetX() > call.GetNumber(2)); });
+		table.Add(actionKey("MettreX", "="), [](EventsFunctionCall & call) { call.object->SetX(call.GetNumber(2)); });
+		table.Add(actionKey("Cache", ""), [](EventsFunctionCall & call) { call.object->SetHidden(true); });
+		table.Add(conditionKey("VarScene", "<"), [](EventsFunctionCall & call) { call.SetConditionResult(call.GetVariable(0).GetValue() < call.GetNumber(2)); });
+		table.Add(actionKey("ModVarScene", "+"), [](EventsFunctionCall & call) { call.GetVariable(0).SetValue(call.GetVariable(0).GetValue() + call.GetNumber(2)); });
+		table.Add(functionsTable.GetExpressionFunctionKey(gd::MetadataProvider::GetObjectExpressionMetadata(platform, "", "X")),
+			[](EventsFunctionCall & call) { call.SetNumberResult(call.object->GetX()); });
+	}
+
+	gd::Instruction MakeInstruction(const gd::String & type, std::vector<gd::Expression> parameters, bool inverted = false)
+	{
+		return gd::Instruction(type, parameters, inverted);
+	}
+}
+
+TEST_CASE( "EventsBytecodeGenerator", "[game-engine][events]" ) {
+	gd::Project project;
+	project.AddPlatform(CppPlatform::Get());
+	gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+	layout.InsertNewObject(project, "", "Enemy", 0);
+	layout.InsertNewObject(project, "", "Player", 1);
+	gd::EventsList & events = layout.GetEvents();
+
+	EventsFunctionsTable table;
+	FillFunctionsTable(table);
+
+	//Three enemies, at X = 0, 10 and 20, and the player at X = 5.
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	gd::Object enemyObject("Enemy");
+	gd::Object playerObject("Player");
+	std::vector<RuntimeObject*> enemies;
+	for (std::size_t i = 0;i<3;++i)
+	{
+		enemies.push_back(scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, enemyObject))));
+		enemies.back()->SetX(i*10);
+	}
+	scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, playerObject)))->SetX(5);
+	gd::Variable & counter = scene.GetVariables().Get("Counter");
+
+	//Lower the events, check that the bytecode can be run and run it for one frame.
+	std::shared_ptr<EventsBytecode> bytecode;
+	std::unique_ptr<EventsBytecodeInterpreter> interpreter;
+	RuntimeContext context(&scene);
+	auto lowerAndRun = [&]() {
+		bytecode = EventsBytecodeGenerator::GenerateLayoutBytecode(project, layout);
+		REQUIRE(bytecode != nullptr);
+		REQUIRE(EventsBytecodeInterpreter::CanRun(*bytecode, table) == true);
+
+		interpreter.reset(new EventsBytecodeInterpreter(bytecode, table));
+		interpreter->Execute(context);
+	};
+	auto generateCode = [&]() {
+		return EventsCodeGenerator::GenerateSceneEventsCompleteCode(project, layout, layout.GetEvents(), true);
+	};
+
+	SECTION("Standard event") {
+		//Move the enemies on the right of the player.
+		gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+		event.GetConditions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("Player.X()")}));
+		event.GetActions().Insert(MakeInstruction("MettreX", {gd::Expression("Enemy"), gd::Expression("="), gd::Expression("100")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("->GetX() > ") != gd::String::npos);
+		REQUIRE(code.find("->SetX(100)") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(enemies[0]->GetX() == 0);
+		REQUIRE(enemies[1]->GetX() == 100);
+		REQUIRE(enemies[2]->GetX() == 100);
+	}
+	SECTION("Inverted conditions") {
+		gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+		event.GetConditions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression("<"), gd::Expression("5")}, true));
+		event.GetActions().Insert(MakeInstruction("Cache", {gd::Expression("Enemy")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("!(") != gd::String::npos);
+		REQUIRE(code.find("->SetHidden(") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(enemies[0]->IsHidden() == false);
+		REQUIRE(enemies[1]->IsHidden() == true);
+		REQUIRE(enemies[2]->IsHidden() == true);
+	}
+	SECTION("Not") {
+		gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+		gd::Instruction notCondition("BuiltinCommonInstructions::Not");
+		notCondition.GetSubInstructions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("50")}));
+		event.GetConditions().Insert(notCondition);
+		event.GetActions().Insert(MakeInstruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+		event.GetActions().Insert(MakeInstruction("Cache", {gd::Expression("Enemy")}));
+
+		//Like the generated code, the actions are run but no enemy is picked by the sub condition.
+		gd::String code = generateCode();
+		REQUIRE(code.find("conditionTrue = (true && !condition0IsTrue);") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(counter.GetValue() == 1);
+		REQUIRE(enemies[0]->IsHidden() == false);
+		REQUIRE(enemies[1]->IsHidden() == false);
+		REQUIRE(enemies[2]->IsHidden() == false);
+	}
+	SECTION("Or") {
+		gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+		gd::Instruction orCondition("BuiltinCommonInstructions::Or");
+		orCondition.GetSubInstructions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression("<"), gd::Expression("5")}));
+		orCondition.GetSubInstructions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("15")}));
+		event.GetConditions().Insert(orCondition);
+		event.GetActions().Insert(MakeInstruction("Cache", {gd::Expression("Enemy")}));
+
+		//Like the generated code, the objects picked by any of the sub conditions are kept.
+		gd::String code = generateCode();
+		REQUIRE(code.find("->GetX() < ") != gd::String::npos);
+		REQUIRE(code.find("->GetX() > ") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(enemies[0]->IsHidden() == true);
+		REQUIRE(enemies[1]->IsHidden() == false);
+		REQUIRE(enemies[2]->IsHidden() == true);
+	}
+	SECTION("While event") {
+		gd::WhileEvent & event = dynamic_cast<gd::WhileEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::While"));
+		event.GetWhileConditions().Insert(MakeInstruction("VarScene", {gd::Expression("Counter"), gd::Expression("<"), gd::Expression("3")}));
+		event.GetActions().Insert(MakeInstruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("while (") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(counter.GetValue() == 3);
+	}
+	SECTION("Repeat event") {
+		gd::RepeatEvent & event = dynamic_cast<gd::RepeatEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Repeat"));
+		event.SetRepeatExpression("2+2");
+		event.GetConditions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("5")}));
+		event.GetActions().Insert(MakeInstruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+		event.GetActions().Insert(MakeInstruction("Cache", {gd::Expression("Enemy")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("for(std::size_t repeatIndex") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(counter.GetValue() == 4);
+		REQUIRE(enemies[0]->IsHidden() == false);
+		REQUIRE(enemies[1]->IsHidden() == true);
+		REQUIRE(enemies[2]->IsHidden() == true);
+	}
+	SECTION("ForEach event") {
+		//For each enemy on the right of the player, increment the counter.
+		gd::ForEachEvent & event = dynamic_cast<gd::ForEachEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::ForEach"));
+		event.SetObjectToPick("Enemy");
+		event.GetConditions().Insert(MakeInstruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("Player.X()")}));
+		event.GetActions().Insert(MakeInstruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+		event.GetActions().Insert(MakeInstruction("MettreX", {gd::Expression("Enemy"), gd::Expression("="), gd::Expression("Enemy.X()+1")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("for(std::size_t forEachIndex = 0;forEachIndex < forEachObjects.size();++forEachIndex)") != gd::String::npos);
+
+		lowerAndRun();
+		REQUIRE(counter.GetValue() == 2);
+		REQUIRE(enemies[0]->GetX() == 0);
+		REQUIRE(enemies[1]->GetX() == 11);
+		REQUIRE(enemies[2]->GetX() == 21);
+	}
+	SECTION("Trigger once") {
+		gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+		event.GetConditions().Insert(MakeInstruction("VarScene", {gd::Expression("Counter"), gd::Expression("<"), gd::Expression("10")}));
+		event.GetConditions().Insert(MakeInstruction("BuiltinCommonInstructions::Once", {}));
+		event.GetActions().Insert(MakeInstruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+
+		gd::String code = generateCode();
+		REQUIRE(code.find("runtimeContext->TriggerOnce(") != gd::String::npos);
+
+		//Like the generated code, the actions are run only once while the conditions are true.
+		lowerAndRun();
+		REQUIRE(counter.GetValue() == 1);
+		REQUIRE(bytecode->triggerOnceCount == 1);
+		interpreter->Execute(context);
+		interpreter->Execute(context);
+		REQUIRE(counter.GetValue() == 1);
+	}
+}
@@ -0,0 +1,40 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the code generated for external events.
+ */
+#include "../catch.hpp"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
+
+TEST_CASE( "External events code generation", "[game-engine][events]" ) {
+	gd::Project project;
+	project.AddPlatform(CppPlatform::Get());
+	gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+	gd::ExternalEvents & externalEvents = project.InsertNewExternalEvents("MyEvents", 0);
+
+	gd::LinkEvent & link = dynamic_cast<gd::LinkEvent&>(
+		layout.GetEvents().InsertNewEvent(project, "BuiltinCommonInstructions::Link"));
+	link.SetTarget("MyEvents");
+
+	gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(
+		externalEvents.GetEvents().InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+	event.GetConditions().Insert(gd::Instruction("VarScene", {gd::Expression("Counter"), gd::Expression("<"), gd::Expression("3")}));
+	event.GetActions().Insert(gd::Instruction("ModVarScene", {gd::Expression("Counter"), gd::Expression("+"), gd::Expression("1")}));
+
+	gd::String code = EventsCodeGenerator::GenerateExternalEventsCompleteCode(project, externalEvents, true);
+	REQUIRE(code.find("void GDExternalEvents") != gd::String::npos);
+	REQUIRE(code.find("< 3") != gd::String::npos);
+
+	//The generation works on a copy of the events: hoisting the conditions must not modify them.
+	REQUIRE(event.GetConditions().size() == 1);
+	REQUIRE(event.GetActions().size() == 1);
+}
@@ -0,0 +1,55 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the code generated for "For each object" events.
+ */
+#include "../catch.hpp"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
+
+TEST_CASE( "ForEach event code generation", "[game-engine][events]" ) {
+	gd::Project project;
+	project.AddPlatform(CppPlatform::Get());
+	gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+	layout.InsertNewObject(project, "", "Enemy", 0);
+	layout.InsertNewObject(project, "", "Player", 1);
+
+	//For each Enemy on the right of the Player, hide the Enemy.
+	gd::ForEachEvent & event = dynamic_cast<gd::ForEachEvent&>(
+		layout.GetEvents().InsertNewEvent(project, "BuiltinCommonInstructions::ForEach"));
+	event.SetObjectToPick("Enemy");
+	event.GetConditions().Insert(gd::Instruction("PosX", {gd::Expression("Enemy"), gd::Expression(">"), gd::Expression("Player.X()")}));
+	event.GetActions().Insert(gd::Instruction("Cache", {gd::Expression("Enemy")}));
+
+	gd::String code = EventsCodeGenerator::GenerateSceneEventsCompleteCode(project, layout, layout.GetEvents(), true);
+
+	std::size_t loop = code.find("for(std::size_t forEachIndex = 0;forEachIndex < forEachObjects.size();++forEachIndex)");
+	REQUIRE(loop != gd::String::npos);
+	REQUIRE(code.find("std::vector<RuntimeObject*> & forEachObjects = ") < loop);
+
+	SECTION("Lists are declared once, before the loop") {
+		std::size_t declarations = 0;
+		for (std::size_t pos = code.find("std::vector<RuntimeObject*> ", code.find("forEachObjects = "));
+			pos < loop; pos = code.find("std::vector<RuntimeObject*> ", pos+1))
+			declarations++;
+
+		REQUIRE(declarations == 2); //The list of the iterated Enemy and the list of Player.
+		REQUIRE(code.find("std::vector<RuntimeObject*> ", loop) == gd::String::npos);
+	}
+	SECTION("Lists are refilled at each iteration") {
+		std::size_t pushBack = code.find(".push_back(forEachObjects[forEachIndex]);", loop);
+		std::size_t playerReset = code.find(" = runtimeContext->GetObjectsRawPointers(\"Player\");", loop);
+		std::size_t conditions = code.find("->GetX()", loop);
+		REQUIRE(pushBack != gd::String::npos);
+		REQUIRE(playerReset != gd::String::npos);
+		REQUIRE(conditions != gd::String::npos);
+		REQUIRE(pushBack < conditions);
+		REQUIRE(playerReset < conditions);
+	}
+}
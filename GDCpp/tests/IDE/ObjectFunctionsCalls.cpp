@@ -0,0 +1,44 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the code generated for the functions of objects.
+ */
+#include "../catch.hpp"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
+
+TEST_CASE( "Object functions code generation", "[game-engine][events]" ) {
+	gd::Project project;
+	project.AddPlatform(CppPlatform::Get());
+	gd::Layout & layout = project.InsertNewLayout("Scene", 0);
+	layout.InsertNewObject(project, "Sprite", "Player", 0);
+
+	gd::StandardEvent & event = dynamic_cast<gd::StandardEvent&>(
+		layout.GetEvents().InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+
+	SECTION("Functions of the object type are called with its runtime class") {
+		event.GetConditions().Insert(gd::Instruction("Opacity", {gd::Expression("Player"), gd::Expression(">"), gd::Expression("50")}));
+		event.GetActions().Insert(gd::Instruction("Opacity", {gd::Expression("Player"), gd::Expression("="), gd::Expression("Player.Direc()")}));
+
+		gd::String code = EventsCodeGenerator::GenerateSceneEventsCompleteCode(project, layout, layout.GetEvents(), true);
+		REQUIRE(code.find("->RuntimeSpriteObject::GetOpacity()") != gd::String::npos);
+		REQUIRE(code.find("->RuntimeSpriteObject::SetOpacity(") != gd::String::npos);
+		REQUIRE(code.find("->RuntimeSpriteObject::GetCurrentDirectionOrAngle()") != gd::String::npos);
+	}
+	SECTION("Functions of all objects are not qualified") {
+		event.GetConditions().Insert(gd::Instruction("Arret", {gd::Expression("Player")}));
+		event.GetActions().Insert(gd::Instruction("MettreX", {gd::Expression("Player"), gd::Expression("="), gd::Expression("Player.ZOrder()")}));
+
+		gd::String code = EventsCodeGenerator::GenerateSceneEventsCompleteCode(project, layout, layout.GetEvents(), true);
+		REQUIRE(code.find("->IsStopped()") != gd::String::npos);
+		REQUIRE(code.find("->SetX(") != gd::String::npos);
+		REQUIRE(code.find("->GetZOrder()") != gd::String::npos);
+		REQUIRE(code.find("RuntimeSpriteObject::") == gd::String::npos);
+	}
+}
@@ -0,0 +1,12 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Main file for GDevelop C++ Platform tests of the IDE features (like events code generation)
+ *
+ * Please write any new test in a separate file.
+ */
+#define CATCH_CONFIG_MAIN
+#include "../catch.hpp"
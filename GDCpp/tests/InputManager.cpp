@@ -23,6 +23,21 @@ TEST_CASE( "InputManager", "[game-engine]" ) {
 		REQUIRE(InputManager::GetSfButtonToButtonNameMap().find(static_cast<int>(sf::Mouse::Left))->second == "Left");
 		REQUIRE(InputManager::GetButtonNameToSfButtonMap().find("Left")->second == sf::Mouse::Left);
 	}
+	SECTION("Key and button codes") {
+		REQUIRE(InputManager::GetKeyCode("Left") == sf::Keyboard::Left);
+		REQUIRE(InputManager::GetKeyCode("a") == sf::Keyboard::A);
+		REQUIRE(InputManager::GetKeyCode("Not a key") == -1);
+		REQUIRE(InputManager::GetButtonCode("Right") == sf::Mouse::Right);
+		REQUIRE(InputManager::GetButtonCode("Not a button") == -1);
+
+		InputManager m;
+		REQUIRE(m.IsKeyPressed("Not a key") == false);
+		REQUIRE(m.IsKeyPressed(-1) == false);
+		REQUIRE(m.IsKeyPressed(static_cast<int>(sf::Keyboard::KeyCount)) == false);
+		REQUIRE(m.WasKeyReleased(sf::Keyboard::Left) == false);
+		REQUIRE(m.IsMouseButtonPressed(-1) == false);
+		REQUIRE(m.IsMouseButtonReleased(sf::Mouse::Left) == false);
+	}
 	SECTION("Key event management") {
 		InputManager m;
 
@@ -0,0 +1,145 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the spatial index of the objects and the conditions using it.
+ */
+#include "catch.hpp"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/ObjectsSpatialIndex.h"
+#include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
+
+TEST_CASE( "ObjectsSpatialIndex", "[game-engine]" ) {
+	gd::Object object("Object");
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+
+	//A line of objects, 10 pixels apart.
+	std::vector<std::unique_ptr<RuntimeObject>> objects;
+	std::vector<RuntimeObject*> objectsPointers;
+	for (std::size_t i = 0;i<100;++i)
+	{
+		objects.push_back(gd::make_unique<RuntimeObject>(scene, object));
+		objects.back()->SetX(i*10);
+		objects.back()->SetY(0);
+		objectsPointers.push_back(objects.back().get());
+	}
+
+	ObjectsSpatialIndex index;
+	REQUIRE(index.IsBuilt() == false);
+	index.Build(objectsPointers, 1);
+	REQUIRE(index.IsBuilt() == true);
+	REQUIRE(index.GetVersion() == 1);
+	REQUIRE(index.GetObjectsCount() == 100);
+
+	std::vector<RuntimeObject*> result;
+	SECTION("GetNearest") {
+		index.GetNearest(502, 3, 1, result);
+		REQUIRE(result.size() == 1);
+		REQUIRE(result[0] == objectsPointers[50]);
+
+		index.GetNearest(-1000, 0, 3, result);
+		REQUIRE(result.size() == 3);
+		REQUIRE(result[0] == objectsPointers[0]);
+		REQUIRE(result[1] == objectsPointers[1]);
+		REQUIRE(result[2] == objectsPointers[2]);
+
+		index.GetNearest(0, 0, 1000, result);
+		REQUIRE(result.size() == 100);
+	}
+	SECTION("GetWithinRadius") {
+		index.GetWithinRadius(500, 0, 25, result);
+		REQUIRE(result.size() == 5);
+		REQUIRE(result[0] == objectsPointers[48]);
+		REQUIRE(result[4] == objectsPointers[52]);
+
+		index.GetWithinRadius(500, 500, 25, result);
+		REQUIRE(result.empty());
+	}
+	SECTION("GetAtPoint") {
+		index.GetAtPoint(300, 0, result);
+		REQUIRE(result.size() == 1);
+		REQUIRE(result[0] == objectsPointers[30]);
+
+		index.GetAtPoint(305, 0, result);
+		REQUIRE(result.empty());
+	}
+}
+
+TEST_CASE( "ObjectsSpatialIndex conditions", "[game-engine]" ) {
+	gd::SpriteObject spriteObject("Sprite");
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+
+	std::vector<RuntimeObject*> sprites;
+	for (std::size_t i = 0;i<10;++i)
+	{
+		sprites.push_back(scene.objectsInstances.AddObject(gd::make_unique<RuntimeSpriteObject>(scene, spriteObject)));
+		sprites.back()->SetX(i*10);
+	}
+
+	std::vector<RuntimeObject*> list = sprites;
+	std::map <gd::String, std::vector<RuntimeObject*> *> lists;
+	lists["Sprite"] = &list;
+
+	SECTION("The index is rebuilt when objects are moved") {
+		unsigned int version = scene.GetSpatialIndex("Sprite").GetVersion();
+		REQUIRE(scene.GetSpatialIndex("Sprite").GetVersion() == version);
+
+		sprites[9]->SetX(-100);
+		REQUIRE(scene.GetSpatialIndex("Sprite").GetVersion() != version);
+		REQUIRE(PickNearestObject(lists, -90, 0, false, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == sprites[9]);
+	}
+	SECTION("PickNearestObject") {
+		REQUIRE(PickNearestObject(lists, 41, 0, false, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == sprites[4]);
+
+		list = sprites;
+		REQUIRE(PickNearestObject(lists, 41, 0, true, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == sprites[9]);
+	}
+	SECTION("PickObjectsWithinRadius") {
+		REQUIRE(PickObjectsWithinRadius(lists, 0, 0, 25, false, scene) == true);
+		REQUIRE(list.size() == 3);
+		REQUIRE(list[2] == sprites[2]);
+
+		//Partially picked lists are filtered without the index.
+		REQUIRE(PickObjectsWithinRadius(lists, 0, 0, 15, false, scene) == true);
+		REQUIRE(list.size() == 2);
+
+		REQUIRE(PickObjectsWithinRadius(lists, 0, 0, 5, true, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == sprites[1]);
+
+		REQUIRE(PickObjectsWithinRadius(lists, 1000, 0, 5, false, scene) == false);
+		REQUIRE(list.empty());
+	}
+	SECTION("PickNearestObjects") {
+		REQUIRE(PickNearestObjects(lists, 52, 0, 3, false, scene) == true);
+		REQUIRE(list.size() == 3);
+		REQUIRE(list[0] == sprites[4]);
+		REQUIRE(list[1] == sprites[5]);
+		REQUIRE(list[2] == sprites[6]);
+
+		list = sprites;
+		REQUIRE(PickNearestObjects(lists, 0, 0, 2, true, scene) == true);
+		REQUIRE(list.size() == 2);
+		REQUIRE(list[0] == sprites[8]);
+		REQUIRE(list[1] == sprites[9]);
+
+		REQUIRE(PickNearestObjects(lists, 0, 0, 0, false, scene) == false);
+		REQUIRE(list.empty());
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering raycasts against the hitboxes of objects.
+ */
+#include "catch.hpp"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "GDCpp/Runtime/PolygonCollision.h"
+#include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
+
+namespace
+{
+	/**
+	 * \brief A 20x20 object, optionally supporting change tracking so that the spatial index is used.
+	 */
+	class SquareObject : public RuntimeObject
+	{
+	public:
+		SquareObject(RuntimeScene & scene, const gd::Object & object, bool tracked_) :
+			RuntimeObject(scene, object), tracked(tracked_) {};
+		virtual std::unique_ptr<RuntimeObject> Clone() const { return gd::make_unique<SquareObject>(*this); }
+
+		virtual float GetWidth() const { return 20; }
+		virtual float GetHeight() const { return 20; }
+		virtual bool SupportsChangeTracking() const { return tracked; }
+
+	private:
+		bool tracked;
+	};
+}
+
+TEST_CASE( "PolygonRaycastTest", "[game-engine]" ) {
+	Polygon2d square = Polygon2d::CreateRectangle(20, 20);
+	square.Move(100, 0);
+
+	RaycastResult result = PolygonRaycastTest(square, 0, 0, 200, 0);
+	REQUIRE(result.collision == true);
+	REQUIRE(result.distance == Approx(90));
+	REQUIRE(result.point.x == Approx(90));
+	REQUIRE(result.point.y == Approx(0));
+	REQUIRE(result.normal.x == Approx(-1));
+	REQUIRE(result.normal.y == Approx(0));
+
+	result = PolygonRaycastTest(square, 200, 5, 0, 5);
+	REQUIRE(result.collision == true);
+	REQUIRE(result.distance == Approx(90));
+	REQUIRE(result.normal.x == Approx(1));
+
+	REQUIRE(PolygonRaycastTest(square, 0, 0, 80, 0).collision == false);
+	REQUIRE(PolygonRaycastTest(square, 0, 20, 200, 20).collision == false);
+}
+
+TEST_CASE( "Raycast", "[game-engine]" ) {
+	gd::Object wall("Wall");
+
+	for (bool tracked : {false, true})
+	{
+		INFO("Spatial index used: " << tracked);
+		RuntimeGame game;
+		RuntimeScene scene(NULL, &game);
+
+		std::vector<RuntimeObject*> walls;
+		for (std::size_t i = 1;i<=3;++i)
+		{
+			walls.push_back(scene.objectsInstances.AddObject(gd::make_unique<SquareObject>(scene, wall, tracked)));
+			walls.back()->SetX(i*100);
+			walls.back()->SetY(-10);
+		}
+
+		std::vector<RuntimeObject*> list = walls;
+		std::map <gd::String, std::vector<RuntimeObject*> *> lists;
+		lists["Wall"] = &list;
+
+		REQUIRE(RaycastObjects(lists, 0, 0, 0, 1000, false, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == walls[0]);
+		REQUIRE(GetRaycastDistance(scene) == Approx(100));
+		REQUIRE(GetRaycastX(scene) == Approx(100));
+		REQUIRE(GetRaycastNormalX(scene) == Approx(-1));
+
+		list = walls;
+		REQUIRE(RaycastObjects(lists, 0, 0, 0, 1000, true, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == walls[2]);
+		REQUIRE(GetRaycastDistance(scene) == Approx(300));
+
+		list = walls;
+		REQUIRE(RaycastAllObjects(lists, 0, 0, 0, 250, false, scene) == true);
+		REQUIRE(list.size() == 2);
+		REQUIRE(GetRaycastDistance(scene) == Approx(100));
+
+		list = walls;
+		REQUIRE(RaycastAllObjects(lists, 0, 0, 0, 250, true, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == walls[2]);
+
+		list = walls;
+		REQUIRE(RaycastObjects(lists, 0, 0, 90, 500, false, scene) == false);
+		REQUIRE(GetRaycastDistance(scene) == Approx(500));
+		REQUIRE(GetRaycastY(scene) == Approx(500));
+
+		//Moving an object updates the spatial index.
+		walls[1]->SetY(100);
+		REQUIRE(RaycastObjects(lists, 210, 300, -90, 500, false, scene) == true);
+		REQUIRE(list.size() == 1);
+		REQUIRE(list[0] == walls[1]);
+		REQUIRE(GetRaycastDistance(scene) == Approx(180));
+		REQUIRE(GetRaycastNormalY(scene) == Approx(1));
+	}
+}
@@ -7,6 +7,7 @@
  * @file Tests covering common features of GDevelop C++ Platform.
  */
 #include "catch.hpp"
+#include <chrono>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ClassWithObjects.h"
 #include "GDCore/Project/Layout.h"
@@ -86,4 +87,59 @@ TEST_CASE( "RuntimeSpriteObject", "[game-engine]" ) {
 			REQUIRE(object.GetCurrentAnimationName() == "First animation");
 		}
 	}
+	SECTION("Frames") {
+		REQUIRE(object.SetSprite(0) == true);
+		REQUIRE(object.SetSprite(1) == false);
+		REQUIRE(object.GetSpriteNb() == 0);
+		REQUIRE(object.GetHitBoxes().size() == 1);
+
+		object.SetCurrentAnimation(1);
+		REQUIRE(object.SetSprite(0) == false);
+		REQUIRE(object.AnimationEnded() == false);
+
+		std::unique_ptr<RuntimeObject> clone = object.Clone();
+		REQUIRE(static_cast<RuntimeSpriteObject*>(clone.get())->GetCurrentAnimationName() == "Second animation");
+	}
+}
+
+TEST_CASE( "RuntimeSpriteObject qualified calls micro-benchmark", "[benchmark][.]" ) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	gd::SpriteObject spriteObject("Sprite");
+
+	const std::size_t spritesCount = 10000;
+	for (std::size_t i = 0; i < spritesCount; ++i)
+		scene.objectsInstances.AddObject(gd::make_unique<RuntimeSpriteObject>(scene, spriteObject));
+
+	std::vector<RuntimeObject*> Sprite = scene.objectsInstances.GetObjectsRawPointers("Sprite");
+
+	//Hand-written loops shaped like the code of a "Rotate the sprites" action followed by an
+	//"Angle of the sprites" condition, with virtual calls and with qualified calls to the functions
+	//of the runtime class. This is not the code produced by the events code generator.
+	std::size_t virtualCount = 0, directCount = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (std::size_t frame = 0; frame < 60; ++frame)
+	{
+		for(std::size_t i = 0;i < Sprite.size();++i)
+			Sprite[i]->SetAngle(Sprite[i]->GetAngle() + 1);
+		for(std::size_t i = 0;i < Sprite.size();++i)
+			if ( Sprite[i]->GetAngle() > 30 ) ++virtualCount;
+	}
+	auto virtualDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	start = std::chrono::steady_clock::now();
+	for (std::size_t frame = 0; frame < 60; ++frame)
+	{
+		for(std::size_t i = 0;i < Sprite.size();++i)
+			static_cast<RuntimeSpriteObject*>(Sprite[i])->RuntimeSpriteObject::SetAngle(
+				static_cast<RuntimeSpriteObject*>(Sprite[i])->RuntimeSpriteObject::GetAngle() - 1);
+		for(std::size_t i = 0;i < Sprite.size();++i)
+			if ( static_cast<RuntimeSpriteObject*>(Sprite[i])->RuntimeSpriteObject::GetAngle() < 30 ) ++directCount;
+	}
+	auto directDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	REQUIRE(virtualCount == directCount);
+	WARN("60 frames of hand-written loops on " << spritesCount << " sprites: "
+		<< virtualDuration.count() << " microseconds with virtual calls, "
+		<< directDuration.count() << " microseconds with direct calls");
 }
@@ -0,0 +1,66 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the data stored by extensions in scenes.
+ */
+#include "catch.hpp"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/SceneExtensionsData.h"
+
+namespace
+{
+struct Counter
+{
+	Counter() : value(0) {};
+	int value;
+};
+
+const SceneExtensionDataSlot<Counter> counterSlot;
+const SceneExtensionDataSlot<Counter> otherCounterSlot;
+}
+
+TEST_CASE( "SceneExtensionsData", "[game-engine]" ) {
+	SECTION("Slots have different indices") {
+		REQUIRE(counterSlot.GetIndex() != otherCounterSlot.GetIndex());
+	}
+
+	SECTION("Data is created on first access") {
+		SceneExtensionsData data;
+		REQUIRE(data.Has(counterSlot) == false);
+		REQUIRE(data.Get(counterSlot).value == 0);
+		REQUIRE(data.Has(counterSlot) == true);
+		REQUIRE(data.Has(otherCounterSlot) == false);
+	}
+
+	SECTION("Data of each slot is independent") {
+		SceneExtensionsData data;
+		data.Get(counterSlot).value = 3;
+		data.Get(otherCounterSlot).value = 5;
+		REQUIRE(data.Get(counterSlot).value == 3);
+		REQUIRE(data.Get(otherCounterSlot).value == 5);
+
+		data.Reset(counterSlot);
+		REQUIRE(data.Has(counterSlot) == false);
+		REQUIRE(data.Get(counterSlot).value == 0);
+		REQUIRE(data.Get(otherCounterSlot).value == 5);
+	}
+
+	SECTION("Data of each scene is independent") {
+		RuntimeGame game;
+		RuntimeScene scene1(NULL, &game);
+		RuntimeScene scene2(NULL, &game);
+
+		scene1.GetExtensionData(counterSlot).value = 1;
+		scene2.GetExtensionData(counterSlot).value = 2;
+		REQUIRE(scene1.GetExtensionData(counterSlot).value == 1);
+		REQUIRE(scene2.GetExtensionData(counterSlot).value == 2);
+
+		scene1.ResetExtensionData(counterSlot);
+		REQUIRE(scene1.GetExtensionData(counterSlot).value == 0);
+		REQUIRE(scene2.GetExtensionData(counterSlot).value == 2);
+	}
+}
@@ -0,0 +1,152 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering snapshots of RuntimeScene.
+ */
+#include "catch.hpp"
+#include <chrono>
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/SceneSnapshot.h"
+
+namespace
+{
+	gd::SpriteObject MakeSpriteObject()
+	{
+		gd::SpriteObject obj("SpriteObject");
+		gd::Animation anim;
+		anim.SetName("First animation");
+		gd::Sprite sprite;
+		sprite.SetImageName("Image.png");
+		anim.SetDirectionsCount(1);
+		anim.GetDirection(0).AddSprite(sprite);
+		obj.AddAnimation(anim);
+
+		return obj;
+	}
+
+	std::vector<std::shared_ptr<const RuntimeObject>> GetObjects(const SceneSnapshot & snapshot, const gd::String & name)
+	{
+		std::vector<std::shared_ptr<const RuntimeObject>> objects;
+		for (const auto & object : snapshot.GetObjects())
+		{
+			if (object->GetName() == name) objects.push_back(object);
+		}
+
+		return objects;
+	}
+}
+
+TEST_CASE( "SceneSnapshot", "[game-engine]" ) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	gd::SpriteObject spriteObject = MakeSpriteObject();
+	gd::Object object("Object");
+
+	RuntimeObject * sprite1 = scene.objectsInstances.AddObject(gd::make_unique<RuntimeSpriteObject>(scene, spriteObject));
+	RuntimeObject * sprite2 = scene.objectsInstances.AddObject(gd::make_unique<RuntimeSpriteObject>(scene, spriteObject));
+	scene.objectsInstances.AddObject(gd::make_unique<RuntimeObject>(scene, object));
+	sprite1->SetX(10);
+	sprite2->SetX(20);
+	scene.GetVariables().Get("Score").SetValue(5);
+	scene.GetTimeManager().AddTimer("Timer");
+
+	SECTION("Restore") {
+		SceneSnapshot snapshot = scene.TakeSnapshot();
+		REQUIRE(snapshot.GetObjects().size() == 3);
+
+		sprite1->SetX(100);
+		sprite1->AddForce(1, 2, 0);
+		scene.GetVariables().Get("Score").SetValue(6);
+		scene.GetTimeManager().RemoveTimer("Timer");
+		scene.objectsInstances.AddObject(gd::make_unique<RuntimeObject>(scene, object));
+		REQUIRE(scene.objectsInstances.GetAllObjects().size() == 4);
+
+		scene.RestoreSnapshot(snapshot);
+		REQUIRE(scene.objectsInstances.GetAllObjects().size() == 3);
+		REQUIRE(scene.objectsInstances.GetObjects("SpriteObject").size() == 2);
+		REQUIRE(scene.objectsInstances.GetObjects("SpriteObject")[0]->GetX() == 10);
+		REQUIRE(scene.objectsInstances.GetObjects("SpriteObject")[0]->TotalForceLength() == 0);
+		REQUIRE(scene.objectsInstances.GetObjects("SpriteObject")[1]->GetX() == 20);
+		REQUIRE(scene.GetVariables().Get("Score").GetValue() == 5);
+		REQUIRE(scene.GetTimeManager().HasTimer("Timer") == true);
+	}
+	SECTION("Unchanged objects are shared between snapshots") {
+		SceneSnapshot snapshot1 = scene.TakeSnapshot();
+		sprite2->SetX(30);
+		SceneSnapshot snapshot2 = scene.TakeSnapshot();
+
+		auto sprites1 = GetObjects(snapshot1, "SpriteObject");
+		auto sprites2 = GetObjects(snapshot2, "SpriteObject");
+		REQUIRE(sprites1[0] == sprites2[0]);
+		REQUIRE(sprites1[1] != sprites2[1]);
+		REQUIRE(sprites2[1]->GetX() == 30);
+		REQUIRE(sprites1[1]->GetX() == 20);
+
+		//Objects not supporting change tracking are always copied.
+		REQUIRE(GetObjects(snapshot1, "Object")[0] != GetObjects(snapshot2, "Object")[0]);
+	}
+	SECTION("Restored objects are shared with the snapshot until changed") {
+		SceneSnapshot snapshot1 = scene.TakeSnapshot();
+		scene.RestoreSnapshot(snapshot1);
+
+		SceneSnapshot snapshot2 = scene.TakeSnapshot();
+		REQUIRE(GetObjects(snapshot1, "SpriteObject")[0] == GetObjects(snapshot2, "SpriteObject")[0]);
+
+		static_cast<RuntimeSpriteObject*>(scene.objectsInstances.GetObjects("SpriteObject")[0].get())->SetOpacity(100);
+		SceneSnapshot snapshot3 = scene.TakeSnapshot();
+		REQUIRE(GetObjects(snapshot1, "SpriteObject")[0] != GetObjects(snapshot3, "SpriteObject")[0]);
+		REQUIRE(GetObjects(snapshot1, "SpriteObject")[1] == GetObjects(snapshot3, "SpriteObject")[1]);
+	}
+	SECTION("Reading variables does not mark objects as changed") {
+		SceneSnapshot snapshot1 = scene.TakeSnapshot();
+		REQUIRE(sprite1->GetConstVariables().Has("Life") == false);
+		SceneSnapshot snapshot2 = scene.TakeSnapshot();
+		REQUIRE(GetObjects(snapshot1, "SpriteObject")[0] == GetObjects(snapshot2, "SpriteObject")[0]);
+
+		sprite1->GetVariables().Get("Life").SetValue(10);
+		SceneSnapshot snapshot3 = scene.TakeSnapshot();
+		REQUIRE(GetObjects(snapshot1, "SpriteObject")[0] != GetObjects(snapshot3, "SpriteObject")[0]);
+	}
+}
+
+TEST_CASE( "SceneSnapshot benchmark", "[benchmark][.]" ) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	gd::SpriteObject spriteObject = MakeSpriteObject();
+
+	const std::size_t objectsCount = 5000;
+	const std::size_t movingObjectsCount = 100;
+	std::vector<RuntimeObject*> objects;
+	for (std::size_t i = 0; i < objectsCount; ++i)
+	{
+		objects.push_back(scene.objectsInstances.AddObject(gd::make_unique<RuntimeSpriteObject>(scene, spriteObject)));
+		objects.back()->SetX(i);
+	}
+
+	//Take 60 snapshots, as done during one second of a game with rollback.
+	auto start = std::chrono::steady_clock::now();
+	std::vector<SceneSnapshot> snapshots;
+	for (std::size_t frame = 0; frame < 60; ++frame)
+	{
+		for (std::size_t i = 0; i < movingObjectsCount; ++i)
+			objects[(frame * movingObjectsCount + i) % objectsCount]->SetY(frame);
+
+		snapshots.push_back(scene.TakeSnapshot());
+	}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	REQUIRE(snapshots.size() == 60);
+	REQUIRE(snapshots.back().GetObjects().size() == objectsCount);
+	WARN("60 snapshots of " << objectsCount << " objects (" << movingObjectsCount << " changed per frame): "
+		<< duration.count() << " microseconds");
+}
@@ -15,6 +15,7 @@
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/SceneStack.h"
+#include "GDCpp/Runtime/Serialization/SerializerElement.h"
 
 TEST_CASE( "SceneStack", "[game-engine]" ) {
 	RuntimeGame game;
@@ -61,4 +62,62 @@ TEST_CASE( "SceneStack", "[game-engine]" ) {
 		});
 		stack.Replace("Scene 1", true);
 	}
+
+	SECTION("Preload") {
+		stack.Push("Scene 1");
+		REQUIRE(stack.Preload("test") == false);
+		REQUIRE(stack.Preload("Scene 2") == true);
+		REQUIRE(stack.IsPreloaded("Scene 1") == false);
+
+		for (std::size_t i = 0;i < 1000 && !stack.IsPreloaded("Scene 2");++i)
+			stack.Step();
+		REQUIRE(stack.IsPreloaded("Scene 2") == true);
+
+		auto scene = stack.Push("Scene 2");
+		REQUIRE(scene != nullptr);
+		REQUIRE(scene->GetName() == "Scene 2");
+		REQUIRE(stack.IsPreloaded("Scene 2") == false);
+	}
+
+	SECTION("Preload then push without waiting") {
+		std::size_t loadedScenesCount = 0;
+		stack.OnLoadScene([&loadedScenesCount](RuntimeScene & scene) {
+			loadedScenesCount++;
+			return true;
+		});
+
+		stack.Push("Scene 1");
+		stack.Preload("Scene 2");
+		auto scene = stack.Push("Scene 2");
+		REQUIRE(scene != nullptr);
+		REQUIRE(scene->GetName() == "Scene 2");
+		REQUIRE(loadedScenesCount == 2);
+	}
+
+	SECTION("Lazy loading of layouts") {
+		gd::SerializerElement projectElement;
+		gd::SerializerElement & layoutsElement = projectElement.AddChild("layouts");
+		layoutsElement.ConsiderAsArrayOf("layout");
+		layoutsElement.AddChild("layout").SetAttribute("name", "Lazy scene 1").SetAttribute("title", "Title 1");
+		layoutsElement.AddChild("layout").SetAttribute("name", "Lazy scene 2").SetAttribute("title", "Title 2");
+
+		RuntimeGame lazyGame;
+		lazyGame.SetLazyLayoutsLoading();
+		lazyGame.UnserializeFrom(projectElement);
+		REQUIRE(lazyGame.GetLayoutsCount() == 2);
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 1") == false);
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 2") == false);
+
+		SceneStack lazyStack(lazyGame, NULL);
+		lazyStack.UnloadUnusedLayouts();
+		auto scene = lazyStack.Push("Lazy scene 1");
+		REQUIRE(scene->GetWindowDefaultTitle() == "Title 1");
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 1") == true);
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 2") == false);
+
+		scene = lazyStack.Replace("Lazy scene 2");
+		REQUIRE(scene->GetWindowDefaultTitle() == "Title 2");
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 1") == false);
+		REQUIRE(lazyGame.IsLayoutLoaded("Lazy scene 2") == true);
+	}
 }
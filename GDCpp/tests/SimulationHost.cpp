@@ -0,0 +1,100 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the simulation of several instances of a game at once.
+ */
+#include "catch.hpp"
+#include "GDCore/CommonTools.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/SceneStack.h"
+#include "GDCpp/Runtime/SimulationHost.h"
+#include "GDCpp/Runtime/CodeExecutionEngine.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/Project/Variable.h"
+
+namespace
+{
+
+/**
+ * Events of the scenes: accumulate the time elapsed in a global variable,
+ * and go to the second scene after a few frames.
+ */
+int SimulatedEvents(RuntimeContext * context)
+{
+	RuntimeScene & scene = *context->scene;
+	gd::Variable & total = scene.game->GetVariables().Get("Total");
+	gd::Variable & frames = scene.GetVariables().Get("Frames");
+
+	frames.SetValue(frames.GetValue()+1);
+	total.SetValue(total.GetValue()+scene.GetTimeManager().GetElapsedTime()/1000.0*frames.GetValue());
+	if (scene.GetName() == "Scene 1" && frames.GetValue() == 50)
+		scene.RequestChange(RuntimeScene::SceneChange::REPLACE_SCENE, "Scene 2");
+
+	return 0;
+}
+
+}
+
+TEST_CASE( "SimulationHost", "[game-engine]" ) {
+	RuntimeGame game;
+	game.InsertNewLayout("Scene 1", 0);
+	game.InsertNewLayout("Scene 2", 1);
+
+	SimulationHost host(game);
+	host.OnLoadScene([](RuntimeScene & scene) {
+		return scene.GetCodeExecutionEngine()->LoadFunction(&SimulatedEvents);
+	});
+
+	SECTION("Instances give the same result as a single-threaded run") {
+		double expectedTotal = 0;
+		host.OnInstanceFinished([&expectedTotal](std::size_t, RuntimeGame & instanceGame, SceneStack &) {
+			expectedTotal = instanceGame.GetVariables().Get("Total").GetValue();
+		});
+		host.Run(1, "Scene 1", 120, 1);
+		REQUIRE(expectedTotal != 0);
+
+		std::vector<double> totals(32, 0);
+		host.OnInstanceFinished([&totals](std::size_t instance, RuntimeGame & instanceGame, SceneStack &) {
+			totals[instance] = instanceGame.GetVariables().Get("Total").GetValue();
+		});
+		host.Run(32, "Scene 1", 120);
+
+		for (std::size_t i = 0;i < totals.size();++i)
+			REQUIRE(totals[i] == expectedTotal);
+
+		//The game given to the host is not modified.
+		REQUIRE(game.GetVariables().Has("Total") == false);
+	}
+
+	SECTION("Instances can be given different parameters") {
+		std::vector<double> totals(8, 0);
+		host.OnInstanceStarted([](std::size_t instance, RuntimeGame & instanceGame) {
+			instanceGame.GetVariables().Get("Total").SetValue(instance*1000);
+		});
+		host.OnInstanceFinished([&totals](std::size_t instance, RuntimeGame & instanceGame, SceneStack &) {
+			totals[instance] = instanceGame.GetVariables().Get("Total").GetValue();
+		});
+		host.Run(8, "Scene 1", 120);
+
+		for (std::size_t i = 1;i < totals.size();++i)
+		{
+			double difference = totals[i]-totals[i-1];
+			REQUIRE(difference == Approx(1000));
+		}
+	}
+
+	SECTION("Errors are reported for each instance") {
+		std::vector<bool> errors(4, false);
+		host.OnError([&errors](std::size_t instance, gd::String) {
+			errors[instance] = true;
+		});
+		host.Run(4, "Not existing scene", 10);
+
+		for (std::size_t i = 0;i < errors.size();++i)
+			REQUIRE(errors[i] == true);
+	}
+}
@@ -0,0 +1,57 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the timers of the game engine.
+ */
+
+#include "catch.hpp"
+#include "GDCpp/Runtime/TimeManager.h"
+#include "GDCpp/Runtime/TimersContainer.h"
+
+TEST_CASE("TimeManager", "[game-engine]") {
+	SECTION("Timers indices") {
+		std::size_t index = TimersContainer::GetTimerIndex("MyTimer");
+		REQUIRE(TimersContainer::GetTimerIndex("MyTimer") == index);
+		REQUIRE(TimersContainer::GetTimerIndex("MyOtherTimer") != index);
+		REQUIRE(TimersContainer::GetTimerName(index) == "MyTimer");
+	}
+	SECTION("Timers accessed by name or by index") {
+		TimeManager timeManager;
+		std::size_t index = TimersContainer::GetTimerIndex("MyTimer");
+
+		REQUIRE(timeManager.HasTimer("MyTimer") == false);
+		REQUIRE(timeManager.HasTimer(index) == false);
+		timeManager.AddTimer("MyTimer");
+		REQUIRE(timeManager.HasTimer("MyTimer") == true);
+		REQUIRE(timeManager.HasTimer(index) == true);
+		REQUIRE(&timeManager.GetTimer("MyTimer") == &timeManager.GetTimer(index));
+
+		timeManager.RemoveTimer(index);
+		REQUIRE(timeManager.HasTimer("MyTimer") == false);
+		REQUIRE(timeManager.GetTimers().GetTimersCount() == 0);
+	}
+	SECTION("Timers update") {
+		TimeManager timeManager;
+		timeManager.AddTimer("MyTimer");
+		timeManager.AddTimer("MyPausedTimer");
+		timeManager.GetTimer("MyPausedTimer").SetPaused(true);
+		timeManager.Update(1000, 0);
+		timeManager.Update(2000, 0);
+
+		REQUIRE(timeManager.GetTimer("MyTimer").GetTime() == 3000);
+		REQUIRE(timeManager.GetTimer("MyPausedTimer").GetTime() == 0);
+		REQUIRE(timeManager.GetTimers().GetTimersCount() == 2);
+
+		//A removed timer is restarted from zero when added again.
+		timeManager.RemoveTimer("MyTimer");
+		REQUIRE(timeManager.GetTimer("MyTimer").GetTime() == 0);
+		timeManager.AddTimer("MyTimer");
+		REQUIRE(timeManager.GetTimer("MyTimer").GetTime() == 0);
+
+		timeManager.Reset();
+		REQUIRE(timeManager.HasTimer("MyPausedTimer") == false);
+	}
+}
@@ -0,0 +1,108 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the state of "Trigger once" conditions.
+ */
+#include "catch.hpp"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/TriggerOnceConditions.h"
+
+TEST_CASE( "TriggerOnceConditions", "[game-engine]" ) {
+	SECTION("Reserved indices") {
+		std::size_t first = TriggerOnceConditions::ReserveIndices("Scene MyScene", 3);
+		REQUIRE(TriggerOnceConditions::ReserveIndices("Scene MyScene", 3) == first);
+		REQUIRE(TriggerOnceConditions::ReserveIndices("Scene MyScene", 2) == first);
+
+		std::size_t other = TriggerOnceConditions::ReserveIndices("External events MyEvents", 2);
+		REQUIRE((other >= first+3 || other+2 <= first));
+
+		//More conditions than the indices reserved: the last range is extended...
+		REQUIRE(TriggerOnceConditions::ReserveIndices("External events MyEvents", 4) == other);
+
+		//...and other ranges are replaced, their indices being reused.
+		std::size_t grown = TriggerOnceConditions::ReserveIndices("Scene MyScene", 5);
+		REQUIRE(grown == other+4);
+		REQUIRE(TriggerOnceConditions::ReserveIndices("Scene MyOtherScene", 2) == first);
+		REQUIRE(TriggerOnceConditions::ReserveIndices("Scene MyLastScene", 1) == first+2);
+	}
+	SECTION("Frames") {
+		TriggerOnceConditions conditions;
+		conditions.StartNewFrame(1);
+		REQUIRE(conditions.TriggerOnce(0) == true);
+		REQUIRE(conditions.TriggerOnce(5) == true);
+
+		conditions.StartNewFrame(2);
+		REQUIRE(conditions.TriggerOnce(0) == false);
+		REQUIRE(conditions.TriggerOnce(1) == true);
+
+		//Condition 5 was not triggered during frame 2.
+		conditions.StartNewFrame(3);
+		REQUIRE(conditions.TriggerOnce(5) == true);
+		REQUIRE(conditions.TriggerOnce(1) == false);
+
+		//Frames were skipped.
+		conditions.StartNewFrame(5);
+		REQUIRE(conditions.TriggerOnce(5) == true);
+		conditions.StartNewFrame(5);
+		REQUIRE(conditions.TriggerOnce(5) == true);
+	}
+}
+
+TEST_CASE( "RuntimeContext TriggerOnce", "[game-engine]" ) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	RuntimeContext context(&scene);
+
+	SECTION("TriggerOnce") {
+		context.StartNewFrame();
+		REQUIRE(context.TriggerOnce(2) == true);
+		REQUIRE(context.TriggerOnce(2) == true);
+		context.StartNewFrame();
+		REQUIRE(context.TriggerOnce(2) == false);
+		context.StartNewFrame();
+		context.StartNewFrame();
+		REQUIRE(context.TriggerOnce(2) == true);
+	}
+	SECTION("TriggerOnceForEachObject") {
+		gd::Object object("Object");
+		std::vector<RuntimeObject*> objects;
+		for (std::size_t i = 0;i<3;++i)
+			objects.push_back(scene.objectsInstances.AddObject(gd::make_unique<RuntimeObject>(scene, object)));
+
+		std::vector<RuntimeObject*> list = objects;
+		std::map <gd::String, std::vector<RuntimeObject*> *> lists;
+		lists["Object"] = &list;
+
+		//All the objects meet the conditions during the first frame.
+		context.StartNewFrame();
+		REQUIRE(context.TriggerOnceForEachObject(lists, 0) == true);
+		REQUIRE(list.size() == 3);
+
+		//Only the first object meets them again: it is not picked.
+		context.StartNewFrame();
+		list.assign(1, objects[0]);
+		REQUIRE(context.TriggerOnceForEachObject(lists, 0) == false);
+		REQUIRE(list.empty());
+
+		//The other objects did not meet the conditions during the last frame.
+		context.StartNewFrame();
+		list = objects;
+		REQUIRE(context.TriggerOnceForEachObject(lists, 0) == true);
+		REQUIRE(list.size() == 2);
+		REQUIRE(list[0] == objects[1]);
+		REQUIRE(list[1] == objects[2]);
+
+		//Conditions with another index are independent.
+		list = objects;
+		REQUIRE(context.TriggerOnceForEachObject(lists, 1) == true);
+		REQUIRE(list.size() == 3);
+	}
+}
@@ -461,11 +461,20 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(gd::InstructionsList
     return outputCode;
 }
 
-gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+gd::String EventsCodeGenerator::GenerateConditionsListPredicat(const gd::InstructionsList & conditions, const gd::EventsCodeGenerationContext & context)
+{
+    if ( conditions.empty() ) return "";
+
+    return GenerateBooleanFullName("condition"+gd::String::From(conditions.size()-1)+"IsTrue", context)+".val";
+}
+
+gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                         gd::EventsCodeGenerationContext & context,
                                                         const gd::String & previousParameter,
                                                         std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes)
 {
+    const gd::String & parameter = expression.GetPlainString();
+
     //*Optimization:* when a function need objects, it receive a map of (references to) objects lists.
     //We statically declare and construct them to avoid re-creating them at runtime.
     //Arrays are passed as reference in JS and we always use the same static arrays, making this possible.
@@ -571,7 +580,7 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(const gd::String & parame
         }
     }
     else
-        return gd::EventsCodeGenerator::GenerateParameterCodes(parameter, metadata, context, previousParameter, supplementaryParametersTypes);
+        return gd::EventsCodeGenerator::GenerateParameterCodes(expression, metadata, context, previousParameter, supplementaryParametersTypes);
 
     return argOutput;
 }
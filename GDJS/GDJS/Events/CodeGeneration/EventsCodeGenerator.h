@@ -66,6 +66,14 @@ public:
      */
     virtual gd::String GenerateConditionsListCode(gd::InstructionsList & conditions, gd::EventsCodeGenerationContext & context);
 
+    /**
+     * \brief Generate the predicate which is true if all the conditions generated by
+     * GenerateConditionsListCode are true.
+     *
+     * As the conditions are nested, this is the boolean of the last condition.
+     */
+    virtual gd::String GenerateConditionsListPredicat(const gd::InstructionsList & conditions, const gd::EventsCodeGenerationContext & context);
+
     /**
      * \brief Generate the full name for accessing to a boolean variable used for conditions.
      */
@@ -85,7 +93,7 @@ public:
 
 protected:
 
-    virtual gd::String GenerateParameterCodes(const gd::String & parameter, const gd::ParameterMetadata & metadata,
+    virtual gd::String GenerateParameterCodes(const gd::Expression & expression, const gd::ParameterMetadata & metadata,
                                                gd::EventsCodeGenerationContext & context,
                                                const gd::String & previousParameter,
                                                std::vector < std::pair<gd::String, gd::String> > * supplementaryParametersTypes);
@@ -29,7 +29,10 @@ BEGIN_EVENT_TABLE(BuildProgressPnl,wxPanel)
 END_EVENT_TABLE()
 
 BuildProgressPnl::BuildProgressPnl(wxWindow* parent,wxWindowID id,const wxPoint& pos,const wxSize& size) :
-clearOnNextTextAdding(true)
+clearOnNextTextAdding(true),
+nextReportNumber(0),
+cacheHitsCount(0),
+cacheMissesCount(0)
 {
 	//(*Initialize(BuildProgressPnl)
 	wxFlexGridSizer* FlexGridSizer1;
@@ -63,6 +66,7 @@ BuildProgressPnl::~BuildProgressPnl()
 void BuildProgressPnl::OnMustRefresh(wxCommandEvent&)
 {
     std::vector < CodeCompilerTask > currentTasks = CodeCompiler::Get()->GetCurrentTasks();
+    AppendTasksReports();
 
     if (CodeCompiler::Get()->CompilationInProcess())
     {
@@ -101,6 +105,9 @@ void BuildProgressPnl::OnMustRefresh(wxCommandEvent&)
                 statusTxt->SetLabel(_("Compilation finished."));
                 AppendText(_("All tasks have been completed.")+" "+timeStr+"\n");
             }
+            if (cacheHitsCount != 0 || cacheMissesCount != 0)
+                AppendText(wxString::Format(_("Compilation cache: %lu hit(s), %lu miss(es)."),
+                    static_cast<unsigned long>(cacheHitsCount), static_cast<unsigned long>(cacheMissesCount))+"\n");
         }
         clearOnNextTextAdding = true;
     }
@@ -109,6 +116,30 @@ void BuildProgressPnl::OnMustRefresh(wxCommandEvent&)
         progressGauge->SetValue(100.f/static_cast<float>(currentTasks.size()));
 }
 
+void BuildProgressPnl::AppendTasksReports()
+{
+    std::vector < CodeCompilerTaskReport > reports = CodeCompiler::Get()->GetTasksReports();
+    for (std::size_t i = 0;i<reports.size();++i)
+    {
+        const CodeCompilerTaskReport & report = reports[i];
+        if (report.number < nextReportNumber) continue;
+        nextReportNumber = report.number+1;
+
+        if (!report.succeeded) continue; //Failures are already reported.
+
+        if (report.cacheHit)
+            AppendText(wxString::Format(_("%s: reused from the compilation cache."), report.userFriendlyName.ToWxString())+"\n");
+        else
+        {
+            AppendText(wxString::Format(_("%s: done in %.2f seconds."),
+                report.userFriendlyName.ToWxString(), static_cast<double>(report.duration)/1000.0)+"\n");
+        }
+
+        if (report.cacheUsed && report.cacheHit) cacheHitsCount++;
+        else if (report.cacheUsed) cacheMissesCount++;
+    }
+}
+
 void BuildProgressPnl::AppendText(wxString text)
 {
     if (text != lastTextAdded)
@@ -118,6 +149,8 @@ void BuildProgressPnl::AppendText(wxString text)
             tasksLogEdit->Clear();
             compilationTimer.Start();
             clearOnNextTextAdding = false;
+            cacheHitsCount = 0;
+            cacheMissesCount = 0;
         }
 
         tasksLogEdit->AppendText(text);
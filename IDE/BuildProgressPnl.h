@@ -55,9 +55,17 @@ class BuildProgressPnl: public wxPanel
 		 */
 		void OnMustRefresh(wxCommandEvent&);
 
+		/**
+		 * Add the reports of the tasks ended since the last call to the log.
+		 */
+		void AppendTasksReports();
+
 		wxString lastTextAdded; ///< Used to prevent duplicates
 		wxStopWatch compilationTimer;
 		bool clearOnNextTextAdding;
+		std::size_t nextReportNumber; ///< The number of the next task report to be added to the log.
+		std::size_t cacheHitsCount; ///< The number of tasks reused from the compilation cache since the log was cleared.
+		std::size_t cacheMissesCount; ///< The number of tasks not found in the compilation cache since the log was cleared.
 
 		DECLARE_EVENT_TABLE()
 };
@@ -24,6 +24,7 @@
 #include <wx/stdpaths.h>
 #include <wx/filename.h>
 #include <wx/cmdline.h>
+#include <wx/stopwatch.h>
 #include <string>
 #include <unistd.h>
 #include <stdexcept>
@@ -46,6 +47,8 @@
 #include "GDCore/IDE/wxTools/GUIContentScaleFactor.h"
 #include "GDCore/IDE/Clipboard.h"
 #include "GDCore/CommonTools.h"
+#include "GDCpp/IDE/CodeCompiler.h"
+#include "GDCpp/IDE/FullProjectCompiler.h"
 #include "MainFrame.h"
 #include "GDevelopIDEApp.h"
 #include "UpdateChecker.h"
@@ -63,6 +66,29 @@ using namespace gd;
 
 IMPLEMENT_APP(GDevelopIDEApp)
 
+namespace
+{
+
+/**
+ * \brief Display the messages of a compilation launched from the command line in the console,
+ * and remember if it succeeded.
+ */
+class CommandLineDiagnosticManager : public GDpriv::FullProjectCompilerConsoleDiagnosticManager
+{
+public:
+    CommandLineDiagnosticManager() : succeeded(false) {};
+
+    virtual void OnCompilationSucceeded()
+    {
+        GDpriv::FullProjectCompilerConsoleDiagnosticManager::OnCompilationSucceeded();
+        succeeded = true;
+    }
+
+    bool succeeded;
+};
+
+}
+
 /**
  * Program entry point
  */
@@ -70,6 +96,8 @@ bool GDevelopIDEApp::OnInit()
 {
     //Disable assertions
     wxDisableAsserts();
+    commandLineExitCode = -1;
+    wxString launchDirectory = wxGetCwd(); //Paths given in the command line are relative to it.
 
     //Setting up working directory:
 #ifdef LINUX
@@ -103,6 +131,10 @@ bool GDevelopIDEApp::OnInit()
         {wxCMD_LINE_OPTION, NULL, ("lang"), ("Force loading a specific language ( Example : /lang=en_GB )"), wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
         {wxCMD_LINE_SWITCH, NULL, ("allowMultipleInstances"), ("Allow to launch GDevelop even if it is already opened") },
         {wxCMD_LINE_SWITCH, NULL, ("noCrashCheck"), ("Don't check if GDevelop crashed during last use.") },
+        {wxCMD_LINE_OPTION, NULL, ("compile"), ("Compile the project with the C++ platform into the directory specified with --output, then quit, without launching the editor"), wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
+        {wxCMD_LINE_OPTION, NULL, ("output"), ("Directory where the project specified with --compile is compiled"), wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL },
+        {wxCMD_LINE_OPTION, NULL, ("jobs"), ("Number of compiler processes launched at the same time by --compile ( Default: one per processor )"), wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL },
+        {wxCMD_LINE_SWITCH, NULL, ("unity"), ("With --compile, compile all the events in a single file, with more optimizations ( Slower to compile, faster to run )") },
         {wxCMD_LINE_NONE}
     };
 
@@ -192,6 +224,33 @@ bool GDevelopIDEApp::OnInit()
     }
     cout << "* Language loaded" << endl;
 
+    //Compile a project without launching the editor ( for example, on a continuous integration server ).
+    wxString projectToCompile;
+    if ( parser.Found( wxT("compile"), &projectToCompile ) )
+    {
+        wxString outputDirectory;
+        if ( !parser.Found( wxT("output"), &outputDirectory ) )
+        {
+            cout << "The output directory must be specified with --output." << endl;
+            return false;
+        }
+
+        wxFileName projectFile(projectToCompile), outputDir = wxFileName::DirName(outputDirectory);
+        projectFile.MakeAbsolute(launchDirectory);
+        outputDir.MakeAbsolute(launchDirectory);
+
+        singleInstanceChecker = NULL;
+        wxInitAllImageHandlers();
+        gd::PlatformLoader::LoadAllPlatformsInManager(".");
+
+        long jobs = 0;
+        if ( parser.Found( wxT("jobs"), &jobs ) && jobs >= 0 )
+            CodeCompiler::Get()->AllowMultithread(jobs != 1, jobs);
+
+        commandLineExitCode = CompileFromCommandLine(projectFile.GetFullPath(), outputDir.GetPath(), parser.Found( wxT("unity") ));
+        return true;
+    }
+
     #if defined(RELEASE)
     {
         wxLogNull noLogPlease;
@@ -424,6 +483,44 @@ bool GDevelopIDEApp::OnInit()
 
 }
 
+int GDevelopIDEApp::CompileFromCommandLine(const gd::String & projectFile, const gd::String & outputDirectory, bool unityBuild)
+{
+    cout << "* Compiling " << projectFile << " into " << outputDirectory << endl;
+
+    gd::Project project;
+    bool isJSON = wxString(projectFile).EndsWith(".json");
+    if ((isJSON && !gd::ProjectFileWriter::LoadFromJSONFile(project, projectFile)) ||
+        (!isJSON && !gd::ProjectFileWriter::LoadFromFile(project, projectFile)))
+    {
+        cout << "Unable to open the project." << endl;
+        return 1;
+    }
+
+    if ( !wxDirExists(outputDirectory) && !wxMkdir(outputDirectory) )
+    {
+        cout << "Unable to create the output directory." << endl;
+        return 1;
+    }
+
+    wxStopWatch compilationClock;
+    CommandLineDiagnosticManager diagnosticManager;
+    GDpriv::FullProjectCompiler compiler(project, diagnosticManager, outputDirectory);
+    compiler.SetUnityBuild(unityBuild);
+    compiler.LaunchProjectCompilation();
+
+    cout << "* Compilation done in " << compilationClock.Time()/1000.0 << " seconds, with "
+         << CodeCompiler::Get()->GetMaxWorkersCount() << " compiler process(es) at the same time." << endl;
+    return diagnosticManager.succeeded ? 0 : 1;
+}
+
+int GDevelopIDEApp::OnRun()
+{
+    //A compilation was launched from the command line: quit without launching the editor.
+    if ( commandLineExitCode != -1 ) return commandLineExitCode;
+
+    return wxApp::OnRun();
+}
+
 int GDevelopIDEApp::OnExit()
 {
     cout << "\nGDevelop shutdown started:" << endl;
@@ -25,6 +25,7 @@ class GDevelopIDEApp : public wxApp
 {
 public:
     virtual bool    OnInit();
+    virtual int     OnRun();
     virtual int     OnExit();
     #ifndef DEBUG
     virtual void    OnUnhandledException();
@@ -36,6 +37,16 @@ public:
     wxSingleInstanceChecker * singleInstanceChecker;
     STServer * server;
     Rebrander rebrander;
+
+private:
+    /**
+     * \brief Compile a project with the C++ platform, without launching the editor.
+     * \param unityBuild True to compile all the events in a single file ( see GDpriv::FullProjectCompiler::SetUnityBuild ).
+     * \return The exit code of the application: 0 if the compilation succeeded.
+     */
+    int CompileFromCommandLine(const gd::String & projectFile, const gd::String & outputDirectory, bool unityBuild);
+
+    int commandLineExitCode; ///< The exit code of a compilation launched from the command line, or -1 if the editor is launched.
 };
 
 /** \brief Tool class used when dealing with interprocess communications.
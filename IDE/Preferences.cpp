@@ -546,10 +546,10 @@ changesNeedRestart(false)
     FlexGridSizer23->Add(StaticBoxSizer13, 1, wxALL|wxEXPAND, 5);
     StaticBoxSizer18 = new wxStaticBoxSizer(wxHORIZONTAL, Panel7, _("Internal code compiler"));
     FlexGridSizer33 = new wxFlexGridSizer(0, 3, 0, 0);
-    StaticText23 = new wxStaticText(Panel7, ID_STATICTEXT23, _("Maximum thread number for code compiler :"), wxDefaultPosition, wxDefaultSize, 0, _T("ID_STATICTEXT23"));
+    StaticText23 = new wxStaticText(Panel7, ID_STATICTEXT23, _("Maximum thread number for code compiler (0 for one per processor) :"), wxDefaultPosition, wxDefaultSize, 0, _T("ID_STATICTEXT23"));
     FlexGridSizer33->Add(StaticText23, 1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 5);
-    codeCompilerThreadEdit = new wxSpinCtrl(Panel7, ID_SPINCTRL1, _T("1"), wxDefaultPosition, wxDefaultSize, 0, 1, 100, 1, _T("ID_SPINCTRL1"));
-    codeCompilerThreadEdit->SetValue(_T("1"));
+    codeCompilerThreadEdit = new wxSpinCtrl(Panel7, ID_SPINCTRL1, _T("0"), wxDefaultPosition, wxDefaultSize, 0, 0, 100, 0, _T("ID_SPINCTRL1"));
+    codeCompilerThreadEdit->SetValue(_T("0"));
     FlexGridSizer33->Add(codeCompilerThreadEdit, 1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 5);
     StaticBoxSizer18->Add(FlexGridSizer33, 1, wxALL|wxALIGN_CENTER_HORIZONTAL|wxALIGN_CENTER_VERTICAL, 0);
     FlexGridSizer23->Add(StaticBoxSizer18, 1, wxALL|wxEXPAND, 5);
@@ -907,7 +907,7 @@ changesNeedRestart(false)
     }
 
     int eventsCompilerMaxThread = 0;
-    if ( pConfig->Read("/CodeCompiler/MaxThread", &eventsCompilerMaxThread, 1) )
+    if ( pConfig->Read("/CodeCompiler/MaxThread", &eventsCompilerMaxThread, 0) )
     {
         codeCompilerThreadEdit->SetValue(eventsCompilerMaxThread);
     }
@@ -1081,7 +1081,7 @@ void Preferences::OnOkBtClick( wxCommandEvent& event )
 	pConfig->Write("EventsEditor/Font", eventsEditorFontDialog->GetFontData().GetChosenFont());
 
     pConfig->Write("/CodeCompiler/MaxThread", codeCompilerThreadEdit->GetValue() );
-    CodeCompiler::Get()->AllowMultithread(codeCompilerThreadEdit->GetValue() > 1, codeCompilerThreadEdit->GetValue());
+    CodeCompiler::Get()->AllowMultithread(codeCompilerThreadEdit->GetValue() != 1, codeCompilerThreadEdit->GetValue());
 
     pConfig->Write("/Paths/Java", javaDirEdit->GetValue() );
 